@@ -44,6 +44,7 @@ endfunction()
 
 macro(get_list_of_supported_optimizations optimizations_list)
     list(APPEND optimizations_list "px_")
+    list(APPEND optimizations_list "avx2_")
     list(APPEND optimizations_list "avx512_")
 endmacro(get_list_of_supported_optimizations)
 
@@ -106,6 +107,7 @@ function(generate_unpack_kernel_arrays current_directory)
 
     list(APPEND PLATFORM_PREFIX_LIST "")
     list(APPEND PLATFORM_PREFIX_LIST "avx512_")
+    list(APPEND PLATFORM_PREFIX_LIST "avx2_")
     list(APPEND PLATFORM_PREFIX_LIST "px_")
 
 
@@ -309,6 +311,32 @@ function(generate_unpack_kernel_arrays current_directory)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}scan_i.cpp "}\n")
 
+        #
+        # Write scan_packed table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}scan_packed.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_packed.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_packed.cpp "namespace qpl::ml::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_packed.cpp "scan_packed_table_t ${PLATFORM_PREFIX}scan_packed_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_packed.cpp "\t${PLATFORM_PREFIX}qplc_scan_range_nu1u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_packed.cpp "\t${PLATFORM_PREFIX}qplc_scan_not_range_nu1u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}scan_packed.cpp "}\n")
+
+        #
+        # Write set_membership_hash table
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}set_membership_hash.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}set_membership_hash.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}set_membership_hash.cpp "namespace qpl::ml::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}set_membership_hash.cpp "set_membership_hash_table_t ${PLATFORM_PREFIX}set_membership_hash_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}set_membership_hash.cpp "\t${PLATFORM_PREFIX}qplc_set_membership_hash_16u8u_i,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}set_membership_hash.cpp "\t${PLATFORM_PREFIX}qplc_set_membership_hash_32u8u_i};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}set_membership_hash.cpp "}\n")
+
         #
         # Write pack_index table
         #
@@ -393,6 +421,31 @@ function(generate_unpack_kernel_arrays current_directory)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}aggregates.cpp "}\n")
 
+        #
+        # Write bitmap functions tables
+        #
+        file(WRITE ${directory}/${PLATFORM_PREFIX}bitmap.cpp "#include \"qplc_api.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "namespace qpl::ml::dispatcher\n{\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "bitmap_logic_table_t ${PLATFORM_PREFIX}bitmap_logic_table = {\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_and_8u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_or_8u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_xor_8u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_and_not_8u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "bitmap_not_table_t ${PLATFORM_PREFIX}bitmap_not_table = {\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_not_8u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "bitmap_popcount_table_t ${PLATFORM_PREFIX}bitmap_popcount_table = {\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_popcount_8u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "bitmap_find_table_t ${PLATFORM_PREFIX}bitmap_find_table = {\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_find_first_8u,\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "\t${PLATFORM_PREFIX}qplc_bitmap_find_last_8u};\n")
+
+        file(APPEND ${directory}/${PLATFORM_PREFIX}bitmap.cpp "}\n")
+
         #
         # Write mem_copy functions table
         #
@@ -470,10 +523,16 @@ function(generate_unpack_kernel_arrays current_directory)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}zero_compress.cpp "}\n")
 
+        # Compression kernels are built for px and avx512 only
+        if (PLATFORM_PREFIX STREQUAL "avx2_")
+            continue()
+        endif ()
+
         #
         # Write deflate functions table
         #
         file(WRITE ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_slow_icf.h\"\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_optimal_icf.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_hash_table.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"deflate_histogram.h\"\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "#include \"dispatcher/dispatcher.hpp\"\n")
@@ -482,7 +541,8 @@ function(generate_unpack_kernel_arrays current_directory)
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}slow_deflate_icf_body),\n")
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_histogram_reset),\n")
-        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_hash_table_reset)};\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}deflate_hash_table_reset),\n")
+        file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "\t reinterpret_cast<void *>(&${PLATFORM_PREFIX}optimal_deflate_icf_body)};\n")
 
         file(APPEND ${directory}/${PLATFORM_PREFIX}deflate.cpp "}\n")
 
@@ -185,6 +185,57 @@ extern "C" {
  * Add description
  */
 #define QPL_FLAG_CANNED_MODE 0x00400000u
+
+/**
+ * Set membership and find unique, software path only: the set is a list of 32-bit little-endian keys.
+ * For set membership src2 holds available_src2 / 4 keys and src2_bit_width must be 32,
+ * find unique writes distinct values to the destination as an ascending list of such keys.
+ * The domain of values may be up to 32 bits wide.
+ */
+#define QPL_FLAG_SET_LIST 0x00800000u
+
+/**
+ * Scan with @ref QPL_FLAG_DECOMPRESS_ENABLE, software path only: the compressed source is fed by a sequence of jobs.
+ * @ref QPL_FLAG_FIRST starts the stream, @ref QPL_FLAG_LAST marks the job with the end of the source.
+ * Each job processes as many elements as its destination can hold, so the destination may be smaller
+ * than the whole output. QPL_STS_MORE_OUTPUT_NEEDED means the destination is full and the job
+ * should be resubmitted with a new destination, the rest of the source is left at next_in_ptr.
+ * Results of every job but the last start at byte boundary, aggregates and indices continue across the jobs.
+ * Parquet RLE source isn't supported.
+ */
+#define QPL_FLAG_STREAMING_SCAN 0x01000000u
+
+/**
+ * Scan with @ref qpl_ow_8, @ref qpl_ow_16 or @ref qpl_ow_32 output, software path only: every run of consecutive
+ * matching elements is written as a pair of its first index and its length in the output bit width.
+ * Runs longer than the maximal value of the output bit width are split into several pairs.
+ * Not compatible with @ref QPL_FLAG_OUT_BE and @ref QPL_FLAG_STREAMING_SCAN.
+ */
+#define QPL_FLAG_OUT_RANGES 0x02000000u
+
+/**
+ * Scan, software path only: evaluates a program of up to 16 predicates in one pass over the source.
+ * The program is an array of @ref qpl_scan_predicate set by @ref qpl_job.next_src2_ptr, its size in bytes is
+ * @ref qpl_job.available_src2. The operation and parameters of the job itself are ignored.
+ * Elements of 33-64 bits and @ref QPL_FLAG_STREAMING_SCAN aren't supported.
+ */
+#define QPL_FLAG_SCAN_PREDICATES 0x04000000u
+
+/**
+ * Compression: verifies one stream of every @ref qpl_job.verify_sample_period streams compressed with the job,
+ * beginning with the first one; the other streams are processed as if @ref QPL_FLAG_OMIT_VERIFY was set.
+ * A stream starts with a @ref QPL_FLAG_FIRST job, and all jobs of the stream follow the decision made for it.
+ * Ignored if @ref QPL_FLAG_OMIT_VERIFY is set.
+ */
+#define QPL_FLAG_VERIFY_SAMPLED 0x08000000u
+
+/**
+ * Compression, software path: verifies each dynamic block right after it is written, while it is still in cache,
+ * instead of decoding the whole output of the job after compression. The decoding tables are kept between blocks
+ * that have the same header. Other blocks are verified after compression as usual.
+ * Ignored if @ref QPL_FLAG_OMIT_VERIFY is set.
+ */
+#define QPL_FLAG_VERIFY_STREAMING 0x10000000u
 /** @} */
 
 /**
@@ -279,9 +330,80 @@ typedef enum {
     /**
      * Compare "not-in-range" filter operation (@ref ANALYTIC_OPERATIONS group)
      */
-    qpl_op_scan_not_range = 0x27u
+    qpl_op_scan_not_range = 0x27u,
+
+    // start bit vector operations
+    /**
+     * Bitwise AND of two bit vectors (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bitmap_and = 0x30u,
+
+    /**
+     * Bitwise OR of two bit vectors (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bitmap_or = 0x31u,
+
+    /**
+     * Bitwise XOR of two bit vectors (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bitmap_xor = 0x32u,
+
+    /**
+     * Bitwise AND NOT of two bit vectors, the first vector and the negation of the second one
+     * (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bitmap_and_not = 0x33u,
+
+    /**
+     * Bitwise NOT of the bit vector (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bitmap_not = 0x34u,
+
+    /**
+     * Counts set bits of the bit vector and finds the first and the last of them, no output is written
+     * (@ref ANALYTIC_OPERATIONS group)
+     */
+    qpl_op_bitmap_count = 0x35u
 } qpl_operation;
 
+/**
+ * @brief Enumerates the ways a predicate of @ref QPL_FLAG_SCAN_PREDICATES program is combined with the result
+ *        of the previous ones
+ */
+typedef enum {
+    qpl_predicate_and     = 0u,    /**< Element matches if it matches the previous predicates and this one */
+    qpl_predicate_or      = 1u,    /**< Element matches if it matches the previous predicates or this one */
+    qpl_predicate_and_not = 2u,    /**< Element matches if it matches the previous predicates and not this one */
+    qpl_predicate_or_not  = 3u     /**< Element matches if it matches the previous predicates or not this one */
+} qpl_predicate_combination;
+
+/**
+ * @brief Predicate of @ref QPL_FLAG_SCAN_PREDICATES program
+ *
+ * @note Predicates are combined from left to right, the combination of the first one is ignored.
+ *       Negation of the first predicate is expressed by the opposite operation, e.g. @ref qpl_op_scan_ne
+ *       for @ref qpl_op_scan_eq.
+ */
+typedef struct {
+    qpl_operation             op;             /**< One of the scan operations, from @ref qpl_op_scan_eq to @ref qpl_op_scan_not_range */
+    uint32_t                  param_low;      /**< Lower parameter of the comparison, the same as @ref qpl_job.param_low */
+    uint32_t                  param_high;     /**< Upper parameter of the comparison, the same as @ref qpl_job.param_high */
+    qpl_predicate_combination combination;    /**< Combination with the result of the previous predicates */
+} qpl_scan_predicate;
+
+/**
+ * @brief Classes of @ref qpl_operation a job can be initialized for.
+ *
+ * @note Values are bit flags and can be combined to reserve internal buffers for several classes in one job.
+ */
+typedef enum {
+    qpl_op_class_analytics  = 0x01u, /**< Analytic operations (@ref ANALYTIC_OPERATIONS group) */
+    qpl_op_class_compress   = 0x02u, /**< @ref qpl_op_compress operation */
+    qpl_op_class_decompress = 0x04u, /**< @ref qpl_op_decompress operation */
+    qpl_op_class_other      = 0x08u, /**< Copy, CRC and Zero-compress operations */
+    qpl_op_class_all        = 0x0Fu  /**< All operations, layout of @ref qpl_init_job */
+} qpl_operation_class;
+
 /**
  * @brief Enumerates mini-blocks sizes for the @ref qpl_op_compress and @ref qpl_op_decompress operations.
  */
@@ -349,17 +471,23 @@ typedef enum {
  * @brief Enumerates different compressions levels
  */
 typedef enum {
+    /**
+     * The fastest software compression, greedy matching with the shortest search.
+     * The numeric value is 10, not 0: the value 0 stays invalid, so a zero-initialized level is rejected.
+     * Levels must not be ordered by their values, qpl_level_0 is faster than @ref qpl_level_1
+     */
+    qpl_level_0 = 10,
     qpl_level_1 = 1,                 /**< The fastest compression with low compression ratio*/
-    qpl_level_2 = 2,                 /**< Not supported */
+    qpl_level_2 = 2,                 /**< Software only, greedy matching with short hash chains */
     qpl_level_3 = 3,                 /**< Medium compression speed, medium compression ratio*/
     qpl_level_4 = 4,                 /**< Not supported */
     qpl_level_5 = 5,                 /**< Not supported */
     qpl_level_6 = 6,                 /**< Not supported */
     qpl_level_7 = 7,                 /**< Not supported */
     qpl_level_8 = 8,                 /**< Not supported */
-    qpl_level_9 = 9,                 /**< Not supported */
+    qpl_level_9 = 9,                 /**< Software only, optimal parsing with the longest hash chains. The highest compression ratio */
     qpl_default_level = qpl_level_1, /**< Default compression level defined by the highest compression level supported by Accelerator */
-    qpl_high_level = qpl_level_3     /**< The level with highest compression level from supported by Intel QPL */
+    qpl_high_level = qpl_level_3     /**< The level with high compression ratio, the highest one is reached with qpl_level_9 */
 } qpl_compression_levels;
 
 #ifdef __cplusplus
@@ -27,6 +27,35 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief The way @ref qpl_wait_job spends time until the hardware completes the job
+ */
+typedef enum {
+    qpl_wait_default = 0u,  /**< Library-wide policy for a job, build default for the library */
+    qpl_wait_spin,          /**< PAUSE between completion checks */
+    qpl_wait_umwait,        /**< PAUSE for spin_count checks, then UMONITOR/UMWAIT on the completion record,
+                                 falls back to yielding if the CPU does not support WAITPKG */
+    qpl_wait_yield          /**< PAUSE for spin_count checks, then yield the CPU between checks */
+} qpl_wait_mode;
+
+/**
+ * @brief Waiting policy of @ref qpl_wait_job
+ */
+typedef struct {
+    qpl_wait_mode mode;       /**< @ref qpl_wait_mode to wait with */
+    uint32_t      spin_count; /**< Number of PAUSE checks before qpl_wait_umwait and qpl_wait_yield wait */
+    uint64_t      timeout_ns; /**< Time after which @ref qpl_wait_job returns QPL_STS_WAIT_TIMEOUT, 0 - no limit */
+} qpl_wait_policy;
+
+/**
+ * @brief Restricts the accelerators used by the library, see @ref qpl_init_library
+ */
+typedef struct {
+    int32_t        numa_id;          /**< NUMA node of the devices to use, -1 - devices of all nodes */
+    const uint32_t *device_ids_ptr;  /**< IDs of the devices to use (1 for iax1), NULL - all devices */
+    uint32_t       device_ids_count; /**< Number of device IDs */
+} qpl_library_options;
+
 /**
  * @brief @ref qpl_job extension that holds internal buffers and context for @ref qpl_operation
  */
@@ -37,6 +66,11 @@ struct qpl_aux_data {
     uint8_t    *middle_layer_buffer_ptr; /**< Internal middle-level layer buffer */
     uint8_t    *hw_state_ptr;            /**< Hardware path execution context */
     qpl_path_t path;                     /**< @ref qpl_path_t marker */
+    uint32_t   op_classes;               /**< @ref qpl_operation_class flags the buffers are reserved for */
+    void       *sw_task_ptr;             /**< Software path submission that is in flight or not checked yet */
+    qpl_wait_policy wait_policy;         /**< Job @ref qpl_wait_policy, qpl_wait_default mode - library-wide one */
+    uint32_t   verify_stream_count;      /**< Number of compression streams started, see @ref QPL_FLAG_VERIFY_SAMPLED */
+    uint32_t   is_stream_verified;       /**< Current compression stream is sampled for verification */
 };
 
 typedef struct qpl_aux_data qpl_data; /**< Hidden internal state structure */
@@ -84,7 +118,8 @@ typedef struct {
     // Filter Function Fields
     uint8_t    *next_src2_ptr;        /**< Pointer to source-2 data. Updated value is returned */
     uint32_t   available_src2;        /**< Number of valid bytes of source-2 data */
-    uint32_t   src1_bit_width;        /**< Source-1 bit width for Analytics. Valid values are 1-32 */
+    uint32_t   src1_bit_width;        /**< Source-1 bit width for Analytics. Valid values are 1-32,
+                                        *  and 33-64 for uncompressed packed arrays on the software path */
     uint32_t   src2_bit_width;        /**< Source-2 bit width for Analytics. Valid values are 1-32 */
     uint32_t   num_input_elements;    /**< Number of input elements for Analytics */
 
@@ -129,6 +164,22 @@ typedef struct {
     // NUMA ID
     int32_t numa_id; /**< ID of the NUMA. Set it to -1 for auto detecting */
 
+    // Filter Function Fields for elements of 33-64 bits
+    uint64_t param_low_64;             /**< Low parameter of scan if @ref src1_bit_width is greater than 32 */
+    uint64_t param_high_64;            /**< High parameter of scan if @ref src1_bit_width is greater than 32 */
+
+    /**
+     * Output aggregate values if @ref src1_bit_width is greater than 32 - min, max and sum of the output values,
+     * their lower 32 bits are written to the 32-bit aggregate fields as well. For scan, these are the index
+     * of the first match, the index of the last match and the number of matches
+     */
+    uint64_t first_index_min_value_64;
+    uint64_t last_index_max_value_64;
+    uint64_t sum_value_64;
+
+    // Verification
+    uint32_t verify_sample_period;    /**< Streams per verified one with @ref QPL_FLAG_VERIFY_SAMPLED, 0 and 1 - each */
+
     // storage for auxiliary data
     qpl_data data_ptr;    /**< Internal memory buffers & structures for all Intel QPL operations */
 } qpl_job;
@@ -185,6 +236,47 @@ QPL_API(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t * job_size_
  */
 QPL_API(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Calculates the amount of memory, in bytes, required for the qpl_job structure
+ *        that is able to perform only the given classes of operations.
+ *
+ * @param[in]   qpl_path      type of implementation path to use - @ref qpl_path_auto,
+ *                            @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]   op_classes    combination of @ref qpl_operation_class flags
+ * @param[out]  job_size_ptr  a pointer to uint32_t, where the qpl_job size (in bytes) is stored
+ *
+ * @note Hardware execution context is not reserved for @ref qpl_path_software unless
+ *       @ref qpl_op_class_compress is requested.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_OPERATION_ERR.
+ */
+QPL_API(qpl_status, qpl_get_job_size_for_class, (qpl_path_t qpl_path, uint32_t op_classes, uint32_t * job_size_ptr))
+
+/**
+ * @brief Initializes the qpl_job structure that is able to perform only the given classes of operations.
+ *        Only internal buffers of these classes are laid out and zeroed.
+ *
+ * @param[in]      qpl_path     type of implementation path to use - @ref qpl_path_auto,
+ *                              @ref qpl_path_hardware or @ref qpl_path_software
+ * @param[in]      op_classes   combination of @ref qpl_operation_class flags
+ * @param[in,out]  qpl_job_ptr  a pointer to the @ref qpl_job structure
+ *
+ * @warning Memory for qpl_job structure must be allocated at the application side. Size (in bytes)
+ * must be obtained with the @ref qpl_get_job_size_for_class function with the same arguments.
+ * Submission of an operation that doesn't belong to op_classes returns @ref QPL_STS_BAD_JOB_STRUCT_ERR.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_PATH_ERR;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_OPERATION_ERR.
+ */
+QPL_API(qpl_status, qpl_init_job_for_class, (qpl_path_t qpl_path, uint32_t op_classes, qpl_job * qpl_job_ptr))
+
 /**
  * @brief Parses the qpl_job structure and forms the corresponding processing functions pipeline.
  *
@@ -196,10 +288,14 @@ QPL_API(qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr))
 
 /**
  * @brief Parses the qpl_job structure and forms the corresponding processing functions pipeline.
- *        In case of software solution, it is an alias for execute_job.
+ *        In case of software solution, the job is enqueued to the internal pool of worker threads
+ *        and processed asynchronously.
  *
  * @param[in,out]  qpl_job_ptr  Pointer to the initialized @ref qpl_job structure
  *
+ * @note The job and its buffers must not be changed until @ref qpl_check_job or @ref qpl_wait_job
+ *       reports that the job is completed. One of them must be called for every submitted job.
+ *
  * @return One of statuses presented in the @ref qpl_status
  *
  */
@@ -210,6 +306,10 @@ QPL_API(qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr))
  *
  * @param[in,out]  qpl_job_ptr  Pointer to the initialized @ref qpl_job structure
  *
+ * @note The wait follows the job @ref qpl_wait_policy, or the library-wide one if the job has none.
+ *       If the timeout is reached, QPL_STS_WAIT_TIMEOUT is returned and the job stays in flight,
+ *       so it must be waited or checked again before reuse.
+ *
  * @return One of statuses presented in the @ref qpl_status
  *
  */
@@ -225,6 +325,120 @@ QPL_API(qpl_status, qpl_wait_job, (qpl_job * qpl_job_ptr))
  */
 QPL_API(qpl_status, qpl_check_job, (qpl_job * qpl_job_ptr))
 
+/**
+ * @brief Submits independent jobs at once: the batch is validated before any job is submitted,
+ *        software path jobs are enqueued to the worker threads as one group of tasks
+ *
+ * @param[in,out]  jobs_ptr    Array of pointers to distinct initialized @ref qpl_job structures
+ * @param[in]      jobs_count  Number of jobs in the batch
+ *
+ * @note Accelerator jobs are enqueued one after another, as the accelerator has no batch descriptor.
+ *       If a job is rejected, the jobs enqueued before it are waited and none of the batch stays in flight.
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_submit_batch, (qpl_job **jobs_ptr, uint32_t jobs_count))
+
+/**
+ * @brief Checks jobs of the batch submitted with @ref qpl_submit_batch
+ *
+ * @param[in,out]  jobs_ptr      Array of pointers to the submitted jobs
+ * @param[in]      jobs_count    Number of jobs in the batch
+ * @param[in,out]  statuses_ptr  Statuses of the jobs, only QPL_STS_BEING_PROCESSED entries are checked and updated,
+ *                               so all of them must be set to QPL_STS_BEING_PROCESSED after submission
+ *
+ * @return QPL_STS_BEING_PROCESSED while any job is processed, the first job error or QPL_STS_OK then
+ */
+QPL_API(qpl_status, qpl_check_batch, (qpl_job **jobs_ptr, uint32_t jobs_count, qpl_status *statuses_ptr))
+
+/**
+ * @brief Waits for jobs of the batch submitted with @ref qpl_submit_batch
+ *
+ * @param[in,out]  jobs_ptr      Array of pointers to the submitted jobs
+ * @param[in]      jobs_count    Number of jobs in the batch
+ * @param[in,out]  statuses_ptr  Statuses of the jobs, only QPL_STS_BEING_PROCESSED entries are waited and updated
+ *
+ * @note The timeout of the batch is taken from the @ref qpl_wait_policy of its first job. If it is reached,
+ *       QPL_STS_WAIT_TIMEOUT is returned and jobs that are not completed keep QPL_STS_BEING_PROCESSED status.
+ *
+ * @return The first job error, QPL_STS_OK if all jobs are completed successfully
+ */
+QPL_API(qpl_status, qpl_wait_batch, (qpl_job **jobs_ptr, uint32_t jobs_count, qpl_status *statuses_ptr))
+
+/**
+ * @brief Configures the pool of worker threads that processes software path jobs submitted
+ *        with @ref qpl_submit_job
+ *
+ * @param[in]  threads_count  Number of worker threads, 0 means the number of hardware threads
+ * @param[in]  cpu_ids_ptr    CPUs that worker threads are pinned to round-robin
+ * @param[in]  cpu_ids_count  Number of CPUs, 0 means that worker threads are not pinned
+ *
+ * @note The pool is started with the first submitted job. Jobs submitted before reconfiguration are
+ *       completed by the previous pool, the call is blocked until then. The pool also runs the tasks
+ *       of the high-level API.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_NO_MEM_ERR;
+ *     - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR if it is called from a worker thread of the pool.
+ */
+QPL_API(qpl_status, qpl_configure_sw_executor, (uint32_t threads_count,
+                                                 const uint32_t *cpu_ids_ptr,
+                                                 uint32_t cpu_ids_count))
+
+/**
+ * @brief Discovers the accelerators at the moment chosen by the user
+ *
+ * @param[in]  options_ptr  Pointer to the @ref qpl_library_options, NULL - all accelerators are used
+ *
+ * @note Otherwise the accelerators are discovered with the first @ref qpl_path_hardware or @ref qpl_path_auto job.
+ *       Accelerators discovered before the call are released, so it must not be called while hardware jobs
+ *       are in flight.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NULL_PTR_ERR;
+ *     - @ref QPL_STS_INVALID_PARAM_ERR;
+ *     - Initialization statuses if no accelerators are available, the software path is still usable.
+ */
+QPL_API(qpl_status, qpl_init_library, (const qpl_library_options *options_ptr))
+
+/**
+ * @brief Releases the accelerators discovered by @ref qpl_init_library or by the first hardware job
+ *        and stops the worker threads of the software path
+ *
+ * @note Must not be called while hardware jobs are in flight. Software path jobs in flight are completed first.
+ *       The next hardware job discovers all accelerators again, the next software path job starts the workers again.
+ *       Workers that are not stopped live until the process exits.
+ *
+ * @return
+ *     - @ref QPL_STS_OK;
+ *     - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR if it is called from a worker thread of the software path.
+ */
+QPL_API(qpl_status, qpl_fini_library, (void))
+
+/**
+ * @brief Sets the library-wide @ref qpl_wait_policy used by jobs that have no own policy
+ *
+ * @param[in]  policy_ptr  Pointer to the policy, qpl_wait_default mode restores the build default
+ *
+ * @note The build default is qpl_wait_umwait if the library is built with EFFICIENT_WAIT, qpl_wait_spin otherwise.
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_set_wait_policy, (const qpl_wait_policy *policy_ptr))
+
+/**
+ * @brief Sets the @ref qpl_wait_policy of the job, qpl_wait_default mode makes the job use the library-wide one
+ *
+ * @param[in,out]  qpl_job_ptr  Pointer to the initialized @ref qpl_job structure
+ * @param[in]      policy_ptr   Pointer to the policy
+ *
+ * @return One of statuses presented in the @ref qpl_status
+ */
+QPL_API(qpl_status, qpl_set_job_wait_policy, (qpl_job *qpl_job_ptr, const qpl_wait_policy *policy_ptr))
+
 /**
  * @brief Completes @ref qpl_job lifecycle: disconnects from the internal library context, frees internal resources.
  *
@@ -47,6 +47,7 @@ typedef enum {
     QPL_STS_MORE_INPUT_NEEDED       = QPL_PROCESSING_ERROR(3u), /**< Compress/Decompress operation need more input @todo deprecate in the future */
     QPL_STS_JOB_NOT_CONTINUABLE_ERR = QPL_PROCESSING_ERROR(4u), /**< A job after a LAST job was not marked as FIRST */
     QPL_STS_QUEUES_ARE_BUSY_ERR     = QPL_PROCESSING_ERROR(5u), /**< Descriptor can't be submitted into filled work queue*/
+    QPL_STS_WAIT_TIMEOUT            = QPL_PROCESSING_ERROR(6u), /**< Wait timeout is reached, job is still being processed */
 
 /* ====== Operations Statuses ====== */
 /* --- Incorrect Parameter Value --- */
@@ -14,6 +14,8 @@
 
 #include <tuple>
 #include <cstring>
+#include <future>
+#include <memory>
 
 #include "qpl/cpp_api/operations/operation.hpp"
 #include "qpl/cpp_api/operations/custom_operation.hpp"
@@ -21,6 +23,7 @@
 #include "qpl/cpp_api/results/stream.hpp"
 #include "qpl/cpp_api/util/qpl_traits.hpp"
 #include "qpl/cpp_api/util/qpl_internal.hpp"
+#include "qpl/cpp_api/util/task_pool.hpp"
 
 namespace qpl {
 
@@ -231,21 +234,28 @@ auto execute(operation_chain<operations_t...> chain,
 }
 
 /**
-* @brief Performs an asyncronous execution of the chain
-*
-* @tparam  path                execution path that should be used
-* @tparam  allocator_t         type of the allocator to be used
-* @tparam  input_container_t   type of input container
-* @tparam  output_container_t  type of output container
-* @tparam  operations_t        list of operations types in the chain
-*
-* @param   chain               instance of the chain for execution
-* @param   source              instance of source container
-* @param   destination         instance of destination container
-* @param   numa_id             Numa node identifier
-*
-* @return @ref execution_result consisting of status code and number of produced elements in output buffer
-*/
+ * @brief Performs an asynchronous execution of the chain
+ *
+ * The chain is executed by the internal pool of worker threads, so the call returns immediately
+ * and any number of chains can be in flight at the same time.
+ *
+ * @tparam  path                execution path that should be used
+ * @tparam  allocator_t         type of the allocator to be used
+ * @tparam  input_container_t   type of input container
+ * @tparam  output_container_t  type of output container
+ * @tparam  operations_t        list of operations types in the chain
+ *
+ * @param   chain               instance of the chain for execution
+ * @param   source              instance of source container
+ * @param   destination         instance of destination container
+ * @param   numa_id             Numa node identifier
+ *
+ * @warning Source and destination containers must stay alive and unchanged until the execution is completed,
+ *          that is until the returned result is handled or reports readiness
+ *
+ * @return @ref execution_result that can be polled for readiness and provides status code
+ *         and number of produced elements in output buffer once the execution is completed
+ */
 template <execution_path path = qpl::software,
         template <class> class allocator_t = std::allocator,
                          class input_container_t,
@@ -254,8 +264,20 @@ template <execution_path path = qpl::software,
 auto submit(operation_chain<operations_t...> chain,
             input_container_t &source,
             output_container_t &destination,
-            int32_t numa_id = numa_auto_detect) -> execution_result<uint32_t, sync> {
-    return qpl::execute<path, allocator_t>(chain, source, destination, numa_id);
+            int32_t numa_id = numa_auto_detect) -> execution_result<uint32_t, async> {
+    using task_t = std::packaged_task<execution_result<uint32_t, sync>()>;
+
+    auto task = std::make_shared<task_t>([chain, &source, &destination, numa_id]() {
+        return qpl::execute<path, allocator_t>(chain, source, destination, numa_id);
+    });
+
+    execution_result<uint32_t, async> result(task->get_future().share());
+
+    util::submit_task([task]() -> void {
+        (*task)();
+    });
+
+    return result;
 }
 
 /**
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "qpl/cpp_api/common/execution_context.hpp"
+#include "qpl/cpp_api/util/qpl_service_functions_wrapper.hpp"
+
+namespace qpl {
+
+template <template <class> class allocator_t>
+execution_context<allocator_t>::execution_context(execution_context &&other) noexcept
+        : allocator_(std::move(other.allocator_)) {
+    // The buffers are released by the allocator that reserved them
+    job_buffers_ = other.job_buffers_;
+    buffers_     = other.buffers_;
+
+    other.job_buffers_.fill(buffer_t{});
+    other.buffers_.fill(buffer_t{});
+}
+
+template <template <class> class allocator_t>
+execution_context<allocator_t>::~execution_context() {
+    for (auto &buffer : job_buffers_) {
+        if (buffer.data) {
+            allocator_.deallocate(buffer.data, buffer.size);
+        }
+    }
+
+    for (auto &buffer : buffers_) {
+        if (buffer.data) {
+            allocator_.deallocate(buffer.data, buffer.size);
+        }
+    }
+}
+
+template <template <class> class allocator_t>
+auto execution_context<allocator_t>::get_job_buffer(execution_path path) -> uint8_t * {
+    return reserve(job_buffers_[static_cast<uint32_t>(path)], qpl::util::get_job_size());
+}
+
+template <template <class> class allocator_t>
+auto execution_context<allocator_t>::get_buffer(context_buffer kind, size_t size) -> uint8_t * {
+    return reserve(buffers_[static_cast<uint32_t>(kind)], size);
+}
+
+template <template <class> class allocator_t>
+auto execution_context<allocator_t>::get_thread_local() -> execution_context & {
+    static thread_local execution_context context;
+
+    return context;
+}
+
+template <template <class> class allocator_t>
+auto execution_context<allocator_t>::reserve(buffer_t &buffer, size_t size) -> uint8_t * {
+    if (buffer.size < size) {
+        if (buffer.data) {
+            allocator_.deallocate(buffer.data, buffer.size);
+        }
+
+        buffer.data = nullptr;
+        buffer.size = 0;
+
+        buffer.data = allocator_.allocate(size);
+        buffer.size = size;
+    }
+
+    return buffer.data;
+}
+
+} // namespace qpl
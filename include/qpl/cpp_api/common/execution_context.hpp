@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  High Level API (public C++ API)
+ */
+
+#ifndef QPL_EXECUTION_CONTEXT_HPP
+#define QPL_EXECUTION_CONTEXT_HPP
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "qpl/cpp_api/common/definitions.hpp"
+
+namespace qpl {
+
+/**
+ * @addtogroup HL_PUBLIC
+ * @{
+ */
+
+/**
+ * @brief Kinds of internal buffers cached by @link execution_context @endlink
+ */
+enum class context_buffer : uint32_t {
+    analytics,    /**< Unpack, mask and output buffers of analytic operations */
+    inflate,      /**< Software state of inflate operation */
+    deflate,      /**< Software state of deflate operation */
+    rle_burst,    /**< Source, unpack, mask and output buffers of rle_burst operation */
+    count         /**< Number of buffer kinds */
+};
+
+/**
+ * @brief Owns job and scratch buffers reused by consecutive operation executions
+ *
+ * Buffers are allocated with the first execution that needs them and kept until the context is destroyed,
+ * so passing the context to @link execute @endlink removes per-call allocation and zeroing of internal buffers.
+ *
+ * @tparam  allocator_t  type of the allocator to be used for buffers
+ *
+ * @note The context isn't thread-safe: one instance should be used by one thread at a time.
+ *       @link get_thread_local @endlink returns an instance owned by the calling thread.
+ */
+template <template <class> class allocator_t = std::allocator>
+class execution_context final {
+public:
+    /**
+     * @brief Default constructor, no memory is allocated
+     */
+    execution_context() = default;
+
+    /**
+     * @brief Deleted copy constructor
+     */
+    execution_context(const execution_context &other) = delete;
+
+    /**
+     * @brief Simple move constructor
+     */
+    execution_context(execution_context &&other) noexcept;
+
+    /**
+     * @brief Deleted assignment operator
+     */
+    auto operator=(const execution_context &other) -> execution_context & = delete;
+
+    /**
+     * @brief Frees all cached buffers
+     */
+    ~execution_context();
+
+    /**
+     * @brief Returns buffer for Intel QPL job of the given path
+     *
+     * @param  path  execution path the job is initialized for
+     *
+     * @return pointer to memory of @ref qpl_get_job_size bytes
+     */
+    [[nodiscard]] auto get_job_buffer(execution_path path) -> uint8_t *;
+
+    /**
+     * @brief Returns scratch buffer of the given kind, buffer is reallocated if it is smaller than requested
+     *
+     * @param  kind  kind of the buffer
+     * @param  size  required size in bytes
+     *
+     * @note Buffer content is kept between calls and isn't zeroed
+     *
+     * @return pointer to memory of at least size bytes
+     */
+    [[nodiscard]] auto get_buffer(context_buffer kind, size_t size) -> uint8_t *;
+
+    /**
+     * @brief Returns the context owned by the calling thread
+     */
+    static auto get_thread_local() -> execution_context &;
+
+private:
+    /**
+     * @brief Cached buffer
+     */
+    struct buffer_t {
+        uint8_t *data = nullptr;    /**< Pointer to the buffer */
+        size_t  size  = 0;          /**< Size of the buffer */
+    };
+
+    static constexpr uint32_t paths_count = 3;    /**< Number of execution paths */
+
+    std::array<buffer_t, paths_count>                                      job_buffers_{};    /**< Jobs per path */
+    std::array<buffer_t, static_cast<uint32_t>(context_buffer::count)> buffers_{};        /**< Scratch buffers */
+    allocator_t<uint8_t>                                                   allocator_{};      /**< Allocator */
+
+    /**
+     * @brief Reallocates the buffer if it's smaller than requested
+     */
+    auto reserve(buffer_t &buffer, size_t size) -> uint8_t *;
+};
+
+/** @} */
+
+} // namespace qpl
+
+#include "execution_context.cxx"
+
+#endif // QPL_EXECUTION_CONTEXT_HPP
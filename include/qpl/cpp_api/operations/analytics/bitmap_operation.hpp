@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_BITMAP_OPERATION_HPP
+#define QPL_BITMAP_OPERATION_HPP
+
+#include "qpl/cpp_api/operations/analytic_operation.hpp"
+
+#if defined(__linux__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
+#endif
+
+namespace qpl {
+
+/**
+ * @addtogroup HL_ANALYTICS
+ * @{
+ */
+
+namespace internal {
+template <execution_path path>
+auto validate_operation(bitmap_operation &operation) -> uint32_t;
+}
+
+/**
+ * @brief operation_t that performs logic operations over bit vectors, or counts and finds set bits
+ *
+ * @details The source is a bit vector, e.g. the output of @ref scan_operation, so the operation can follow
+ *          analytic operations with 1-bit output in @ref operation_chain. Binary operations take the second
+ *          vector from the constructor. Logic operations return the number of bits written to the destination,
+ *          @ref bitmap_popcount returns the number of set bits, @ref bitmap_first_set and @ref bitmap_last_set
+ *          return the index of the bit (or the number of input elements if there are no set bits) and
+ *          don't write the destination.
+ *
+ * @note The operation is performed on the software path only.
+ */
+class bitmap_operation final : public analytics_operation {
+    class bitmap_operation_builder;
+
+    friend class internal::analytic_operation_builder<bitmap_operation, bitmap_operation_builder>;
+
+    template <execution_path path>
+    friend auto internal::execute(bitmap_operation &operation,
+                                  int32_t numa_id,
+                                  uint8_t *buffer_ptr,
+                                  size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+    template <execution_path path>
+    friend auto internal::validate_operation(bitmap_operation &operation) -> uint32_t;
+
+public:
+    /**
+     * Builder type for operation detailed configuring
+     */
+    using builder = bitmap_operation_builder;
+
+    /**
+     * @brief Simple default constructor (required for using of @ref operation_chain)
+     */
+    constexpr bitmap_operation()
+            : analytics_operation(false) {
+        input_vector_bit_width_ = 1u;
+    }
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param  other  object that should be copied
+     */
+    constexpr bitmap_operation(const bitmap_operation &other) = default;
+
+    /**
+     * @brief Move constructor
+     *
+     * @param  other  object that should be moved
+     */
+    constexpr bitmap_operation(bitmap_operation &&other) = default;
+
+    /**
+     * @brief Main constructor
+     *
+     * @param  operation           operation that should be performed
+     * @param  bitmap              pointer to the second bit vector of binary operations
+     * @param  bitmap_byte_length  length of the second bit vector in bytes
+     */
+    constexpr explicit bitmap_operation(bitmap_operations operation,
+                                        const uint8_t *bitmap = nullptr,
+                                        size_t bitmap_byte_length = 0)
+            : analytics_operation(false),
+              operation_(operation),
+              bitmap_(bitmap),
+              bitmap_byte_length_(bitmap_byte_length) {
+        input_vector_bit_width_ = 1u;
+    }
+
+    /**
+     * @brief Default assignment operator
+     */
+    constexpr auto operator=(const bitmap_operation &other) -> bitmap_operation & = default;
+
+    [[nodiscard]] auto get_output_vector_width() const noexcept -> uint32_t override;
+
+protected:
+    void set_job_buffer(uint8_t *buffer) noexcept override;
+
+private:
+    bitmap_operations operation_          = bitmap_and;    /**< Operation that should be performed */
+    const uint8_t     *bitmap_            = nullptr;       /**< Second bit vector of binary operations */
+    size_t            bitmap_byte_length_ = 0;             /**< Length of the second bit vector in bytes */
+};
+
+/**
+ * @brief Builder for @ref bitmap_operation (performs detailed configuration
+ * or re-configuration of the operation)
+ */
+class bitmap_operation::bitmap_operation_builder
+        : public internal::analytic_operation_builder<bitmap_operation, bitmap_operation_builder> {
+    using parent_builder = analytic_operation_builder<bitmap_operation, bitmap_operation_builder>;
+
+public:
+    /**
+     * @brief Duplicates @ref bitmap_operation main constructor
+     */
+    constexpr explicit bitmap_operation_builder(bitmap_operations operation,
+                                                const uint8_t *bitmap = nullptr,
+                                                size_t bitmap_byte_length = 0)
+            : parent_builder(bitmap_operation(operation, bitmap, bitmap_byte_length)) {
+        // Empty constructor
+    }
+
+    /**
+     * @brief Reconstructs already existing operation
+     *
+     * @param  operation  instance of operation that should be re-constructed
+     */
+    constexpr explicit bitmap_operation_builder(bitmap_operation operation)
+            : parent_builder(std::move(operation)) {
+        // Empty constructor
+    }
+
+    /**
+     * @brief Sets the second bit vector of binary operations
+     */
+    [[nodiscard]] auto bitmap(const uint8_t *bitmap, size_t bitmap_byte_length) -> bitmap_operation_builder &;
+};
+
+/** @} */
+
+} // namespace qpl
+
+#if defined(__linux__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // QPL_BITMAP_OPERATION_HPP
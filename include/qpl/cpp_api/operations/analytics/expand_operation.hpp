@@ -40,7 +40,10 @@ class expand_operation final : public operation_with_mask {
     friend class internal::operation_with_mask_builder<expand_operation>;
 
     template <execution_path path>
-    friend auto internal::execute(expand_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
+    friend auto internal::execute(expand_operation &operation,
+                                  int32_t numa_id,
+                                  uint8_t *buffer_ptr,
+                                  size_t buffer_size) -> execution_result<uint32_t, sync>;
 
     template <execution_path path>
     friend auto internal::validate_operation(expand_operation &operation) -> uint32_t;
@@ -42,7 +42,10 @@ class extract_operation final : public analytics_operation {
     friend auto internal::validate_operation(extract_operation &operation) -> uint32_t;
 
     template <execution_path path>
-    friend auto internal::execute(extract_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
+    friend auto internal::execute(extract_operation &operation,
+                                  int32_t numa_id,
+                                  uint8_t *buffer_ptr,
+                                  size_t buffer_size) -> execution_result<uint32_t, sync>;
 
 public:
     /**
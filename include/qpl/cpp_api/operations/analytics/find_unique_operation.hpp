@@ -37,7 +37,9 @@ class find_unique_operation final : public analytics_operation {
 
     template <execution_path path>
     friend auto internal::execute(find_unique_operation &operation,
-                                  int32_t numa_id) -> execution_result<uint32_t, sync>;
+                                  int32_t numa_id,
+                                  uint8_t *buffer_ptr,
+                                  size_t buffer_size) -> execution_result<uint32_t, sync>;
 
     template <execution_path path>
     friend auto internal::validate_operation(find_unique_operation &operation) -> uint32_t;
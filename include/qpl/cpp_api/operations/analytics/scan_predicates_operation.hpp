@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SCAN_PREDICATES_OPERATION_HPP
+#define QPL_SCAN_PREDICATES_OPERATION_HPP
+
+#include <array>
+
+#include "qpl/cpp_api/operations/analytic_operation.hpp"
+#include "qpl/cpp_api/util/constants.hpp"
+
+#if defined(__linux__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
+#endif
+
+namespace qpl {
+
+/**
+ * @addtogroup HL_ANALYTICS
+ * @{
+ */
+
+namespace internal {
+template <execution_path path>
+auto validate_operation(scan_predicates_operation &operation) -> uint32_t;
+}
+
+/**
+ * @brief Predicate of @ref scan_predicates_operation, the same comparison as @ref scan_operation performs
+ */
+struct scan_predicate {
+    comparators            comparator   = equals;           /**< Type of comparison (>, <, ==, !=) */
+    uint32_t               boundary     = 0;                /**< Value that is compared with elements */
+    bool                   is_inclusive = false;            /**< Makes comparison >= or <= */
+    predicate_combinations combination  = predicate_and;    /**< Combination with the previous predicates */
+};
+
+/**
+ * @brief operation_t that evaluates several scan predicates in one pass over the source
+ *
+ * @note Predicates are combined from left to right, the combination of the first one is ignored.
+ *       The operation is performed on the software path only.
+ */
+class scan_predicates_operation final : public analytics_operation {
+    class scan_predicates_operation_builder;
+
+    friend class internal::analytic_operation_builder<scan_predicates_operation, scan_predicates_operation_builder>;
+
+    template <execution_path path>
+    friend auto internal::execute(scan_predicates_operation &operation,
+                                  int32_t numa_id,
+                                  uint8_t *buffer_ptr,
+                                  size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+    template <execution_path path>
+    friend auto internal::validate_operation(scan_predicates_operation &operation) -> uint32_t;
+
+public:
+    /**
+     * Builder type for operation detailed configuring
+     */
+    using builder = scan_predicates_operation_builder;
+
+    /**
+     * Maximal number of predicates of the operation
+     */
+    static constexpr uint32_t max_predicates = 16u;
+
+    /**
+     * @brief Simple default constructor (required for using of @ref operation_chain)
+     */
+    constexpr scan_predicates_operation()
+            : analytics_operation(false) {
+        // Empty constructor
+    }
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param  other  object that should be copied
+     */
+    constexpr scan_predicates_operation(const scan_predicates_operation &other) = default;
+
+    /**
+     * @brief Move constructor
+     *
+     * @param  other  object that should be moved
+     */
+    constexpr scan_predicates_operation(scan_predicates_operation &&other) = default;
+
+    /**
+     * @brief Main constructor that sets the first predicate
+     *
+     * @param  comparator  specifies type of the first scan (>, <, ==, !=)
+     * @param  boundary    value that should be used for comparing
+     */
+    constexpr scan_predicates_operation(comparators comparator, uint32_t boundary)
+            : analytics_operation(false),
+              predicates_{scan_predicate{comparator, boundary, false, predicate_and}},
+              predicates_count_(1u) {
+        // Empty constructor
+    }
+
+    /**
+     * @brief Default assignment operator
+     */
+    constexpr auto operator=(const scan_predicates_operation &other) -> scan_predicates_operation & = default;
+
+    [[nodiscard]] auto get_output_vector_width() const noexcept -> uint32_t override;
+
+protected:
+    void set_job_buffer(uint8_t *buffer) noexcept override;
+
+private:
+    std::array<scan_predicate, max_predicates> predicates_{};
+    uint32_t                                   predicates_count_ = 0u; /**< May exceed max_predicates */
+};
+
+/**
+ * @brief Builder for @ref scan_predicates_operation (performs detailed configuration
+ * or re-configuration of the operation)
+ */
+class scan_predicates_operation::scan_predicates_operation_builder
+        : public internal::analytic_operation_builder<scan_predicates_operation, scan_predicates_operation_builder> {
+    using parent_builder = analytic_operation_builder<scan_predicates_operation, scan_predicates_operation_builder>;
+
+public:
+    /**
+     * @brief Duplicates @ref scan_predicates_operation main constructor
+     */
+    constexpr explicit scan_predicates_operation_builder(comparators comparator, uint32_t boundary)
+            : parent_builder(scan_predicates_operation(comparator, boundary)) {
+        // Empty constructor
+    }
+
+    /**
+     * @brief Reconstructs already existing operation
+     *
+     * @param  operation  instance of operation that should be re-constructed
+     */
+    constexpr explicit scan_predicates_operation_builder(scan_predicates_operation operation)
+            : parent_builder(std::move(operation)) {
+        // Empty constructor
+    }
+
+    /**
+     * @brief Appends the predicate, the operation fails with more than @ref max_predicates ones
+     */
+    [[nodiscard]] auto predicate(predicate_combinations combination,
+                                 comparators comparator,
+                                 uint32_t boundary,
+                                 bool is_inclusive = false) -> scan_predicates_operation_builder &;
+
+    /**
+     * @brief Sets inclusivity of the last predicate (to make it >=, <=)
+     */
+    [[nodiscard]] auto is_inclusive(bool value) -> scan_predicates_operation_builder &;
+};
+
+/** @} */
+
+} // namespace qpl
+
+#if defined(__linux__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // QPL_SCAN_PREDICATES_OPERATION_HPP
@@ -39,7 +39,10 @@ class scan_range_operation final : public analytics_operation {
     friend class internal::analytic_operation_builder<scan_range_operation, scan_range_operation_builder>;
 
     template <execution_path path>
-    friend auto internal::execute(scan_range_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
+    friend auto internal::execute(scan_range_operation &operation,
+                                  int32_t numa_id,
+                                  uint8_t *buffer_ptr,
+                                  size_t buffer_size) -> execution_result<uint32_t, sync>;
 
     template <execution_path path>
     friend auto internal::validate_operation(scan_range_operation &operation) -> uint32_t;
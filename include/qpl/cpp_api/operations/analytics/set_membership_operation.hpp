@@ -48,7 +48,9 @@ class set_membership_operation final : public operation_with_mask {
 
     template <execution_path path>
     friend auto internal::execute(set_membership_operation &operation,
-                                  int32_t numa_id) -> execution_result<uint32_t, sync>;
+                                  int32_t numa_id,
+                                  uint8_t *buffer_ptr,
+                                  size_t buffer_size) -> execution_result<uint32_t, sync>;
 
     template <execution_path path>
     friend auto internal::validate_operation(set_membership_operation &operation) -> uint32_t;
@@ -44,6 +44,11 @@ auto call_deflate(deflate_operation &operation,
 
 }
 
+/**
+ * @brief Default size of the source segment for the parallel compression
+ */
+constexpr uint32_t parallel_segment_size = 256u * 1024u;
+
 /**
  * @brief operation_t that performs compression function
  *
@@ -169,6 +174,20 @@ public:
      */
     [[nodiscard]] auto compression_level(compression_levels value) -> deflate_operation_builder &;
 
+    /**
+     * @brief Enables parallel compression on the software path: the source is split into segments,
+     *        segments are compressed by several threads and joined into one deflate (or GZIP) stream
+     *
+     * @note Every segment uses the tail of the previous one as a dictionary, so the result is
+     *       a regular stream that can be decompressed by any inflate implementation.
+     *       The option is ignored by the hardware path, mini-blocks and canned mode compression.
+     *
+     * @param  thread_count  number of threads that compress segments (0 - number of hardware threads)
+     * @param  segment_size  number of source bytes in one segment
+     */
+    [[nodiscard]] auto parallel(uint32_t thread_count,
+                                uint32_t segment_size = parallel_segment_size) -> deflate_operation_builder &;
+
     /**
      * @brief Sets compression mode (fixed_mode or dynamic)
      *
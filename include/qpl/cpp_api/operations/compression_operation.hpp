@@ -48,6 +48,7 @@ enum compression_levels {
     /**
     * Comression levels for compression method
     */
+    level_0 = 10, /**< The same value as qpl_level_0, 0 is not a valid level */
     level_1 = 1,
     level_2 = 2,
     level_3 = 3,
@@ -64,7 +65,7 @@ enum compression_levels {
     default_level = level_1,
 
     /**
-     * Max compression ratio
+     * High compression ratio, the maximal one is reached with level_9 on the software path
      */
     high_level = level_3
 };
@@ -176,6 +177,9 @@ struct deflate_properties : public compression_properties {
 
     internal::index *index_array_     = nullptr;    /**< Pointer to indices array */
     uint32_t        index_array_size_ = 0;          /**< Size of indices array */
+
+    uint32_t parallel_threads_      = 1u;    /**< Number of threads for the software compression */
+    uint32_t parallel_segment_size_ = 0u;    /**< Size of one independently compressed source segment */
 };
 
 /**
@@ -16,6 +16,7 @@
 #include <future>
 
 #include "qpl/cpp_api/common/definitions.hpp"
+#include "qpl/cpp_api/common/execution_context.hpp"
 #include "qpl/cpp_api/operations/operation_builder.hpp"
 #include "qpl/cpp_api/results/execution_result.hpp"
 #include "qpl/cpp_api/results/stream.hpp"
@@ -63,6 +64,30 @@ enum comparators {
     not_equals    /**< Represents != */
 };
 
+/**
+ * @brief Contains ways a predicate of @ref scan_predicates_operation is combined with the previous ones
+ */
+enum predicate_combinations {
+    predicate_and,        /**< Represents && */
+    predicate_or,         /**< Represents || */
+    predicate_and_not,    /**< Represents && ! */
+    predicate_or_not      /**< Represents || ! */
+};
+
+/**
+ * @brief Contains operations of @ref bitmap_operation
+ */
+enum bitmap_operations {
+    bitmap_and,          /**< Represents a & b */
+    bitmap_or,           /**< Represents a | b */
+    bitmap_xor,          /**< Represents a ^ b */
+    bitmap_and_not,      /**< Represents a & ~b */
+    bitmap_not,          /**< Represents ~a */
+    bitmap_popcount,     /**< Number of set bits */
+    bitmap_first_set,    /**< Index of the first set bit */
+    bitmap_last_set      /**< Index of the last set bit */
+};
+
 constexpr const int32_t numa_auto_detect = -1; /**< Numa ID defined by default */
 
 class extract_operation;
@@ -71,6 +96,10 @@ class scan_operation;
 
 class scan_range_operation;
 
+class scan_predicates_operation;
+
+class bitmap_operation;
+
 class find_unique_operation;
 
 class set_membership_operation;
@@ -103,24 +132,84 @@ void connect_two(const operation1_t &a, operation2_t &b);
 template <execution_path path>
 auto execute(extract_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template <execution_path path>
+auto execute(extract_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template <execution_path path>
 auto execute(scan_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template <execution_path path>
+auto execute(scan_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template <execution_path path>
 auto execute(scan_range_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template <execution_path path>
+auto execute(scan_range_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+template <execution_path path>
+auto execute(scan_predicates_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template <execution_path path>
+auto execute(scan_predicates_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+template <execution_path path>
+auto execute(bitmap_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template <execution_path path>
+auto execute(bitmap_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template <execution_path path>
 auto execute(find_unique_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template <execution_path path>
+auto execute(find_unique_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template <execution_path path>
 auto execute(set_membership_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template <execution_path path>
+auto execute(set_membership_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template <execution_path path>
 auto execute(expand_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template <execution_path path>
+auto execute(expand_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template <execution_path path>
 auto execute(select_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template <execution_path path>
+auto execute(select_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template <execution_path path>
 auto execute(rle_burst_operation &operation,
              uint8_t *source_buffer_ptr,
@@ -364,6 +453,8 @@ auto execute(operation_t &op,
                                  extract_operation,
                                  scan_operation,
                                  scan_range_operation,
+                                 scan_predicates_operation,
+                                 bitmap_operation,
                                  find_unique_operation,
                                  set_membership_operation,
                                  expand_operation,
@@ -375,7 +466,7 @@ auto execute(operation_t &op,
                                  zero_decompress_operation,
                                  inflate_operation,
                                  deflate_operation>) {
-        auto operation_helper = dynamic_cast<operation *>(&op);
+        auto operation_helper = static_cast<operation *>(&op);
         operation_helper->set_buffers(source_begin, source_end, destination_begin, destination_end);
 
         if constexpr (traits::is_any<operation_t,
@@ -419,7 +510,7 @@ auto execute(operation_t &op,
             }
         }
     } else if constexpr (std::is_base_of<custom_operation, operation_t>::value) {
-        auto operation_helper = dynamic_cast<custom_operation *>(&op);
+        auto operation_helper = static_cast<custom_operation *>(&op);
 
         operation_helper->set_buffers(source_begin, source_end, destination_begin, destination_end);
 
@@ -430,7 +521,7 @@ auto execute(operation_t &op,
                                           operation_helper->destination_,
                                           static_cast<uint32_t>(operation_helper->destination_size_)));
     } else if constexpr (std::is_base_of<compression_stateful_operation, operation_t>::value) {
-        auto operation_helper = dynamic_cast<operation *>(&op);
+        auto operation_helper = static_cast<operation *>(&op);
         operation_helper->set_buffers(source_begin, source_end, destination_begin, destination_end);
 
         op.set_buffers();
@@ -438,7 +529,7 @@ auto execute(operation_t &op,
 
         return execution_result<uint32_t, sync>(result.first, result.second);
     } else {
-        auto operation_helper = dynamic_cast<operation *>(&op);
+        auto operation_helper = static_cast<operation *>(&op);
         operation_helper->set_buffers(source_begin, source_end, destination_begin, destination_end);
 
         if (job_buffer) {
@@ -472,6 +563,118 @@ auto execute(operation_t &op,
     }
 }
 
+/**
+ * @brief Implementation of public wrapper that takes internal buffers from @link execution_context @endlink
+ *
+ * @tparam  path               execution path
+ * @tparam  allocator_t        type of the allocator used by the context
+ * @tparam  input_iterator_t   type of input iterator (same requirements as for @link operation @endlink)
+ * @tparam  output_iterator_t  type of output iterator (same requirements as for @link operation @endlink)
+ * @tparam  operation_t        type of operation that should be executed
+ *
+ * @param   op                 instance of operation that should be executed
+ * @param   context            context that owns internal buffers
+ * @param   source_begin       iterator that points to begin of the source
+ * @param   source_end         iterator that points to end of the source
+ * @param   destination_begin  iterator that points to begin of the output
+ * @param   destination_end    iterator that points to end of the output
+ * @param   numa_id            Numa node identifier
+ *
+ * @return @ref execution_result consisting of status code and number of produced elements in output buffer
+ */
+template <execution_path path,
+        template <class> class allocator_t,
+                         class input_iterator_t,
+                         class output_iterator_t,
+                         class operation_t>
+auto execute(operation_t &op,
+             execution_context<allocator_t> &context,
+             const input_iterator_t source_begin,
+             const input_iterator_t source_end,
+             const output_iterator_t destination_begin,
+             const output_iterator_t destination_end,
+             int32_t numa_id) -> execution_result<uint32_t, sync> {
+    if constexpr (traits::is_any<operation_t,
+                                 extract_operation,
+                                 scan_operation,
+                                 scan_range_operation,
+                                 scan_predicates_operation,
+                                 bitmap_operation,
+                                 find_unique_operation,
+                                 set_membership_operation,
+                                 expand_operation,
+                                 select_operation>) {
+        auto operation_helper = static_cast<operation *>(&op);
+        operation_helper->set_buffers(source_begin, source_end, destination_begin, destination_end);
+
+        const auto buffer_size = util::get_buffer_size<operation_t>();
+        auto       *buffer_ptr = context.get_buffer(context_buffer::analytics, buffer_size);
+
+        return internal::execute<path>(op, numa_id, buffer_ptr, buffer_size);
+    } else if constexpr (traits::is_any<operation_t,
+                                        inflate_operation,
+                                        deflate_operation>) {
+        auto operation_helper = static_cast<operation *>(&op);
+        operation_helper->set_buffers(source_begin, source_end, destination_begin, destination_end);
+
+        if constexpr (path == hardware) {
+            return internal::execute<path>(op);
+        }
+
+        constexpr auto kind = std::is_same_v<operation_t, inflate_operation>
+                              ? context_buffer::inflate
+                              : context_buffer::deflate;
+
+        const auto buffer_size = util::get_buffer_size<operation_t>();
+        auto       *buffer_ptr = context.get_buffer(kind, buffer_size);
+
+        return internal::execute<path>(op, buffer_ptr, buffer_size);
+    } else if constexpr (traits::is_any<operation_t, rle_burst_operation>) {
+        auto operation_helper = static_cast<operation *>(&op);
+        operation_helper->set_buffers(source_begin, source_end, destination_begin, destination_end);
+
+        // Maximum number of unpacked elements
+        constexpr auto max_elements = 4096u;
+        // Unpack buffer size, +1u - especially for RLE_Burst
+        constexpr auto buf_size     = (max_elements + 1u) * sizeof(uint32_t);
+
+        auto *unpack_buffer_ptr = context.get_buffer(context_buffer::rle_burst, 3u * buf_size + 100u);
+        auto *mask_buffer_ptr   = unpack_buffer_ptr + buf_size + 100u;
+        auto *output_buffer_ptr = mask_buffer_ptr + buf_size;
+
+        return internal::execute<path>(op,
+                                       unpack_buffer_ptr,
+                                       buf_size,
+                                       output_buffer_ptr,
+                                       buf_size,
+                                       mask_buffer_ptr,
+                                       buf_size,
+                                       numa_id);
+    } else if constexpr (traits::is_any<operation_t,
+                                        copy_operation,
+                                        crc_operation,
+                                        zero_compress_operation,
+                                        zero_decompress_operation>
+                         || std::is_base_of<custom_operation, operation_t>::value
+                         || std::is_base_of<compression_stateful_operation, operation_t>::value) {
+        // These operations don't use internal buffers
+        return internal::execute<path, allocator_t>(op,
+                                                    source_begin,
+                                                    source_end,
+                                                    destination_begin,
+                                                    destination_end,
+                                                    numa_id);
+    } else {
+        return internal::execute<path, allocator_t>(op,
+                                                    source_begin,
+                                                    source_end,
+                                                    destination_begin,
+                                                    destination_end,
+                                                    numa_id,
+                                                    context.get_job_buffer(path));
+    }
+}
+
 /** @} */
 
 } // namespace internal
@@ -539,6 +742,80 @@ auto execute(operation_t &operation,
                                            output.end());
 }
 
+/**
+ * @brief Executes the operation using job and internal buffers cached in the given @link execution_context @endlink
+ *
+ * @tparam  path               execution path
+ * @tparam  allocator_t        type of the allocator used by the context
+ * @tparam  input_iterator_t   type of input iterator (same requirements as for @link operation @endlink)
+ * @tparam  output_iterator_t  type of output iterator (same requirements as for @link operation @endlink)
+ * @tparam  operation_t        type of operation that should be executed
+ *
+ * @param   operation          instance of operation that should be executed
+ * @param   context            context that owns internal buffers, can't be used by other threads during the call
+ * @param   source_begin       iterator that points to begin of the source
+ * @param   source_end         iterator that points to end of the source
+ * @param   destination_begin  iterator that points to begin of the output
+ * @param   destination_end    iterator that points to end of the output
+ * @param   numa_id            Numa node identifier
+ *
+ * Example of main usage:
+ * @code
+ *  auto &context = qpl::execution_context<>::get_thread_local();
+ *  auto result   = qpl::execute<qpl::software>(operation, context, source, destination);
+ * @endcode
+ *
+ * @return @ref execution_result consisting of status code and number of produced elements in output buffer
+ */
+template <execution_path path = execution_path::software,
+        template <class> class allocator_t,
+                         class input_iterator_t,
+                         class output_iterator_t,
+                         class operation_t>
+auto execute(operation_t &operation,
+             execution_context<allocator_t> &context,
+             const input_iterator_t source_begin,
+             const input_iterator_t source_end,
+             const output_iterator_t destination_begin,
+             const output_iterator_t destination_end,
+             int32_t numa_id = numa_auto_detect) -> execution_result<uint32_t, sync> {
+    return internal::execute<path>(operation,
+                                   context,
+                                   source_begin,
+                                   source_end,
+                                   destination_begin,
+                                   destination_end,
+                                   numa_id);
+}
+
+/**
+ * @brief Just a wrapper for the previous function with usage of containers
+ *
+ * @tparam  path                execution path
+ * @tparam  allocator_t         type of the allocator used by the context
+ * @tparam  input_container_t   type of input container
+ * @tparam  output_container_t  type of output container
+ * @tparam  operation_t         type of operation that should be executed
+ *
+ * @return @ref execution_result consisting of status code and number of produced elements in output buffer
+ */
+template <execution_path path = execution_path::software,
+        template <class> class allocator_t,
+                         class input_container_t,
+                         class output_container_t,
+                         class operation_t>
+auto execute(operation_t &operation,
+             execution_context<allocator_t> &context,
+             const input_container_t &input,
+             const output_container_t &output) -> execution_result<uint32_t, sync> {
+    return qpl::execute<path>(operation,
+                              context,
+                              input.begin(),
+                              input.end(),
+                              output.begin(),
+                              output.end());
+}
+
 /**
  * @brief Performs asynchronous execution of simple operation
  *
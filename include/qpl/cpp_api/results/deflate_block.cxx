@@ -10,16 +10,18 @@ template <template <class> class allocator_t>
 deflate_block<allocator_t>::deflate_block(const mini_block_sizes mini_block_size,
                                           const uint32_t index_array_size,
                                           const execution_path path) {
-    buffer_.mini_block_size = mini_block_size;
-    buffer_.size            = util::convert_mini_block_size(buffer_.mini_block_size);
+    mini_block_size_  = mini_block_size;
+    mini_block_bytes_ = util::convert_mini_block_size(mini_block_size_);
     index_array_size_ = index_array_size;
+    path_             = path;
 
     auto job_buffer_size = qpl::util::get_job_size();
 
-    buffer_.buffer = util::allocate_array<allocator_t, uint8_t>(buffer_.size);
     index_array_ = util::allocate_array<allocator_t, internal::index>(index_array_size_);
     job_buffer_  = util::allocate_array<allocator_t, uint8_t>(job_buffer_size);
 
+    set_cache_size(util::default_mini_block_cache_size);
+
     operation_.set_job_buffer(job_buffer_.get());
     operation_.init_job(path);
 }
@@ -36,22 +38,145 @@ auto deflate_block<allocator_t>::size() const noexcept -> size_t {
 
 template <template <class> class allocator_t>
 auto deflate_block<allocator_t>::operator[](const size_t index) -> uint8_t {
-    auto mini_block_index = util::get_mini_block_index(static_cast<uint32_t>(index),
-                                                       buffer_.mini_block_size);
-
-    if (buffer_.is_empty || buffer_.stored_mini_block != mini_block_index) {
-        util::read_mini_block(source_.get(),
-                              buffer_.buffer.get(),
-                              buffer_.size,
-                              mini_block_index,
-                              index_array_.get(),
-                              operation_);
-
-        buffer_.is_empty          = false;
-        buffer_.stored_mini_block = mini_block_index;
+    auto mini_block_index = util::get_mini_block_index(static_cast<uint32_t>(index), mini_block_size_);
+
+    return get_mini_block(mini_block_index)[static_cast<uint32_t>(index) % mini_block_bytes_];
+}
+
+template <template <class> class allocator_t>
+template <class output_iterator_t>
+void deflate_block<allocator_t>::read(const size_t offset,
+                                      const size_t length,
+                                      output_iterator_t destination_begin) {
+    if (offset > uncompressed_size_ || length > uncompressed_size_ - offset) {
+        throw invalid_argument_exception(messages::out_of_range_access);
+    }
+
+    auto current = static_cast<uint32_t>(offset);
+    auto end     = static_cast<uint32_t>(offset + length);
+
+    while (current < end) {
+        const auto mini_block_index = util::get_mini_block_index(current, mini_block_size_);
+        const auto mini_block_end   = std::min(end, (mini_block_index + 1u) * mini_block_bytes_);
+
+        const auto *mini_block = get_mini_block(mini_block_index);
+
+        destination_begin = std::copy(mini_block + current % mini_block_bytes_,
+                                      mini_block + (mini_block_end - mini_block_index * mini_block_bytes_),
+                                      destination_begin);
+
+        current = mini_block_end;
     }
+}
 
-    return buffer_.buffer[static_cast<uint32_t>(index) % buffer_.size];
+template <template <class> class allocator_t>
+template <class index_iterator_t, class output_iterator_t>
+void deflate_block<allocator_t>::gather(index_iterator_t indices_begin,
+                                        index_iterator_t indices_end,
+                                        output_iterator_t destination_begin) {
+    const std::vector<size_t> indices(indices_begin, indices_end);
+
+    for (auto index : indices) {
+        if (index >= uncompressed_size_) {
+            throw invalid_argument_exception(messages::out_of_range_access);
+        }
+    }
+
+    std::vector<size_t> order(indices.size());
+    std::iota(order.begin(), order.end(), 0u);
+
+    // Requests to the same mini-block become neighbours, so each mini-block is decompressed once
+    std::stable_sort(order.begin(), order.end(), [&](size_t left, size_t right) -> bool {
+        return indices[left] / mini_block_bytes_ < indices[right] / mini_block_bytes_;
+    });
+
+    for (auto position : order) {
+        const auto index            = static_cast<uint32_t>(indices[position]);
+        const auto mini_block_index = util::get_mini_block_index(index, mini_block_size_);
+
+        destination_begin[position] = get_mini_block(mini_block_index)[index % mini_block_bytes_];
+    }
+}
+
+template <template <class> class allocator_t>
+void deflate_block<allocator_t>::set_cache_size(const uint32_t count) {
+    if (count == 0u) {
+        throw invalid_argument_exception(messages::zero_cache_size);
+    }
+
+    cache_.clear();
+    cache_.resize(count);
+
+    // The first entry is also used as a scratch buffer for parsing of the block header
+    cache_.front().buffer = util::allocate_array<allocator_t, uint8_t>(mini_block_bytes_);
+}
+
+template <template <class> class allocator_t>
+auto deflate_block<allocator_t>::get_mini_block(const uint32_t mini_block_index) -> const uint8_t * {
+    access_counter_++;
+
+    auto *victim = &cache_.front();
+
+    for (auto &entry : cache_) {
+        if (!entry.is_empty && entry.stored_mini_block == mini_block_index) {
+            entry.last_access = access_counter_;
+
+            return entry.buffer.get();
+        }
+
+        if (victim->is_empty) {
+            continue;
+        }
+
+        if (entry.is_empty || entry.last_access < victim->last_access) {
+            victim = &entry;
+        }
+    }
+
+    if (!victim->buffer) {
+        victim->buffer = util::allocate_array<allocator_t, uint8_t>(mini_block_bytes_);
+    }
+
+    victim->is_empty = true;
+
+    util::read_mini_block(source_.get(),
+                          victim->buffer.get(),
+                          mini_block_bytes_,
+                          mini_block_index,
+                          index_array_.get(),
+                          operation_);
+
+    victim->is_empty          = false;
+    victim->stored_mini_block = mini_block_index;
+    victim->last_access       = access_counter_;
+
+    return victim->buffer.get();
+}
+
+template <template <class> class allocator_t>
+template <class output_iterator_t>
+auto deflate_block<allocator_t>::decompress(output_iterator_t destination_begin,
+                                            output_iterator_t destination_end,
+                                            const uint32_t thread_count) -> size_t {
+    const auto destination_size = static_cast<uint32_t>(std::distance(destination_begin, destination_end));
+    const auto threads_count    = util::get_mini_blocks_threads_count(uncompressed_size_,
+                                                                      mini_block_size_,
+                                                                      thread_count);
+
+    // Every thread decompresses its mini-blocks with a separate job
+    auto job_buffers = util::allocate_array<allocator_t, uint8_t>(threads_count * util::get_job_size());
+
+    util::read_mini_blocks(source_.get(),
+                           &*destination_begin,
+                           destination_size,
+                           uncompressed_size_,
+                           mini_block_size_,
+                           index_array_.get(),
+                           path_,
+                           thread_count,
+                           job_buffers.get());
+
+    return static_cast<size_t>(uncompressed_size_);
 }
 
 template <template <class> class allocator_t>
@@ -63,8 +188,8 @@ void deflate_block<allocator_t>::assign(input_iterator_t begin, input_iterator_t
     std::memcpy(source_.get(), &*begin, source_size_);
 
     util::read_header(source_.get(),
-                      buffer_.buffer.get(),
-                      buffer_.size,
+                      cache_.front().buffer.get(),
+                      mini_block_bytes_,
                       index_array_.get(),
                       operation_);
 }
@@ -7,11 +7,15 @@
 #ifndef QPL_DEFLATE_BLOCK_HPP
 #define QPL_DEFLATE_BLOCK_HPP
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <functional>
+#include <numeric>
+#include <vector>
 
 #include "qpl/cpp_api/util/deflate_block_utils.hpp"
+#include "qpl/cpp_api/util/exceptions.hpp"
 #include "qpl/cpp_api/operations/compression/inflate_stateful_operation.hpp"
 
 namespace qpl {
@@ -65,28 +69,23 @@ class deflate_block final {
     using index_deleter = std::function<void(internal::index *)>;
 
     /**
-     * @brief Representation of one decompressed mini-block
+     * @brief Representation of one decompressed mini-block in the cache
      */
     struct mini_block_buffer final {
         /**
-         * Decompressed content of the mini-block
+         * Decompressed content of the mini-block, allocated with the first use of the entry
          */
         std::unique_ptr<uint8_t[], unsigned_char_deleter> buffer;
 
         /**
-         * Size of the mini-block
-         */
-        mini_block_sizes mini_block_size;
-
-        /**
-         * Size of the mini-block in bytes
+         * Index of stored mini-block
          */
-        uint32_t size = 0;
+        uint32_t stored_mini_block = 0;
 
         /**
-         * Index of stored mini-block
+         * Value of the access counter at the last access to the entry, used for LRU eviction
          */
-        uint32_t stored_mini_block = 0;
+        uint64_t last_access = 0;
 
         /**
          * Does mini-block contain decompressed data or not
@@ -125,6 +124,67 @@ public:
      */
     auto operator[](size_t index) -> uint8_t;
 
+    /**
+     * @brief Copies a contiguous range of decompressed elements into the destination,
+     *        every mini-block touched by the range is decompressed at most once
+     *
+     * @tparam  output_iterator_t  type of output iterator
+     *
+     * @param   offset             position of the first element in decompressed stream
+     * @param   length             number of elements to read
+     * @param   destination_begin  iterator to the beginning of the destination
+     *
+     * @throws invalid_argument_exception if the range exceeds the size of the block
+     */
+    template <class output_iterator_t>
+    void read(size_t offset, size_t length, output_iterator_t destination_begin);
+
+    /**
+     * @brief Gathers elements with the given positions into the destination, requests are
+     *        processed in the order of mini-blocks, so every mini-block is decompressed at most once
+     *
+     * @tparam  index_iterator_t   type of iterator over positions
+     * @tparam  output_iterator_t  type of output iterator (random access is required)
+     *
+     * @param   indices_begin      iterator to the beginning of positions in decompressed stream
+     * @param   indices_end        iterator to the end of positions in decompressed stream
+     * @param   destination_begin  iterator to the beginning of the destination, i-th element gets
+     *                             the value at the i-th position
+     *
+     * @throws invalid_argument_exception if any position exceeds the size of the block
+     */
+    template <class index_iterator_t, class output_iterator_t>
+    void gather(index_iterator_t indices_begin, index_iterator_t indices_end, output_iterator_t destination_begin);
+
+    /**
+     * @brief Sets the number of decompressed mini-blocks that are kept at the same time,
+     *        the least recently used one is evicted when a new mini-block is required
+     *
+     * @param  count  number of cached mini-blocks, must be greater than zero
+     *
+     * @note All previously cached mini-blocks are dropped
+     */
+    void set_cache_size(uint32_t count);
+
+    /**
+     * @brief Decompresses the whole block, disjoint ranges of mini-blocks are decompressed
+     *        by different threads directly into their places in the destination
+     *
+     * @tparam  output_iterator_t  type of output iterator (contiguous memory is expected)
+     *
+     * @param   destination_begin  iterator to the beginning of the destination
+     * @param   destination_end    iterator to the end of the destination
+     * @param   thread_count       number of threads, 0 means the number of hardware threads
+     *
+     * @note CRC of the decompressed data is checked against the one recorded in the index
+     *
+     * @return number of decompressed bytes
+     */
+    template <class output_iterator_t>
+    auto decompress(output_iterator_t destination_begin,
+                    output_iterator_t destination_end,
+                    uint32_t thread_count = 0u) -> size_t;
+
     /**
      * @brief Default assignment operator
      */
@@ -187,9 +247,30 @@ protected:
     internal::inflate_stateful_operation operation_;
 
     /**
-     * Something like cache for mini-blocks functionality
+     * Returns decompressed content of the mini-block, decompresses it into the least recently
+     * used cache entry if the mini-block is not cached
+     */
+    auto get_mini_block(uint32_t mini_block_index) -> const uint8_t *;
+
+    /**
+     * Cache of decompressed mini-blocks
      */
-    mini_block_buffer buffer_;
+    std::vector<mini_block_buffer> cache_;
+
+    /**
+     * Monotonic counter of accesses to the cache
+     */
+    uint64_t access_counter_ = 0;
+
+    /**
+     * Size of the mini-blocks inside the block
+     */
+    mini_block_sizes mini_block_size_;
+
+    /**
+     * Size of the mini-block in bytes
+     */
+    uint32_t mini_block_bytes_ = 0;
 
     /**
      * Size of compressed data
@@ -205,6 +286,11 @@ protected:
      * Size of uncompressed data
      */
     uint32_t uncompressed_size_ = 0;
+
+    /**
+     * Execution path that is used for decompression
+     */
+    execution_path path_;
 };
 
 /** @} */
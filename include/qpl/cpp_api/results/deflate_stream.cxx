@@ -74,6 +74,32 @@ void deflate_stream<path>::flush(const input_iterator_t &source_begin,
     this->state_ = initial;
 }
 
+template <execution_path path>
+template <class input_iterator_t>
+auto deflate_stream<path>::push(const input_iterator_t &source_begin,
+                                const input_iterator_t &source_end,
+                                segment_sink &sink) -> deflate_stream & {
+    const bool is_first = this->state_ == compression_stream_state::initial;
+
+    this->state_ = compression_stream_state::basic;
+
+    submit_operation(&*source_begin, std::distance(source_begin, source_end), sink, is_first, false);
+
+    return *this;
+}
+
+template <execution_path path>
+template <class input_iterator_t>
+void deflate_stream<path>::flush(const input_iterator_t &source_begin,
+                                 const input_iterator_t &source_end,
+                                 segment_sink &sink) {
+    const bool is_first = this->state_ == compression_stream_state::initial;
+
+    submit_operation(&*source_begin, std::distance(source_begin, source_end), sink, is_first, true);
+
+    this->state_ = initial;
+}
+
 template <execution_path path>
 template <class input_iterator_t>
 void deflate_stream<path>::submit_operation(const input_iterator_t &source_begin,
@@ -97,4 +123,94 @@ void deflate_stream<path>::submit_operation(const input_iterator_t &source_begin
     });
 }
 
+template <execution_path path>
+void deflate_stream<path>::submit_operation(const uint8_t *source_ptr,
+                                            size_t source_size,
+                                            segment_sink &sink,
+                                            bool is_first,
+                                            bool is_last) {
+    // Smaller parts are compressed into the next segment, otherwise they spoil the compression ratio
+    constexpr size_t min_part_size = 4096u;
+
+    static_assert(get_safe_destination_size(min_part_size) <= segment_sink::min_segment_size,
+                  "Segments of the minimal size must hold the output of the smallest part");
+
+    do {
+        const auto segment      = sink.acquire(get_safe_destination_size(std::min(source_size, min_part_size)));
+        const auto segment_size = std::min<size_t>(segment.size, std::numeric_limits<uint32_t>::max());
+        const auto part_size    = std::min(source_size, get_max_source_size(segment_size));
+
+        operation_.first_chunk(is_first);
+        operation_.last_chunk(is_last && part_size == source_size);
+        operation_.set_proper_flags();
+
+        // Compression job is never completed partially, so the part that fits the segment is compressed at once,
+        // the first chunk resets the number of produced bytes
+        const auto previous_total_out = is_first ? 0u : operation_.get_processed_bytes();
+
+        auto result = internal::execute<path, std::allocator>(operation_,
+                                                              source_ptr,
+                                                              source_ptr + part_size,
+                                                              segment.data,
+                                                              segment.data + segment_size,
+                                                              numa_auto_detect,
+                                                              this->job_buffer_.get());
+
+        result.if_absent([](uint32_t status) -> void {
+            util::handle_status(status);
+        });
+
+        sink.commit(operation_.get_processed_bytes() - previous_total_out);
+
+        source_ptr += part_size;
+        source_size -= part_size;
+        is_first = false;
+    } while (0u != source_size);
+}
+
+// Hardware writes the output that doesn't fit as stored blocks of at most 65535 bytes with the 5 bytes header,
+// the reserve holds the bits accumulated by the previous chunks, the end of block and the GZIP header and trailer.
+// Software falls back to stored blocks only for the stream compressed at once, so the destination holds
+// the longest code of 15 bits per byte and the reserve holds the dynamic block header as well
+template <execution_path path>
+constexpr auto deflate_stream<path>::get_max_source_size(size_t destination_size) noexcept -> size_t {
+    constexpr size_t stored_block_size   = 65535u;
+    constexpr size_t stored_block_header = 5u;
+    constexpr size_t reserved_size       = (path == execution_path::hardware) ? 128u : 512u;
+    constexpr size_t max_code_length     = 15u;
+    constexpr size_t byte_bits_size      = 8u;
+
+    if (destination_size <= reserved_size) {
+        return 0u;
+    }
+
+    if constexpr (path != execution_path::hardware) {
+        return (destination_size - reserved_size) * byte_bits_size / max_code_length;
+    }
+
+    const size_t blocks_size     = destination_size - reserved_size;
+    const size_t full_blocks     = blocks_size / (stored_block_size + stored_block_header);
+    const size_t last_block_size = blocks_size % (stored_block_size + stored_block_header);
+
+    return full_blocks * stored_block_size
+           + ((last_block_size > stored_block_header) ? last_block_size - stored_block_header : 0u);
+}
+
+template <execution_path path>
+constexpr auto deflate_stream<path>::get_safe_destination_size(size_t source_size) noexcept -> size_t {
+    constexpr size_t stored_block_size   = 65535u;
+    constexpr size_t stored_block_header = 5u;
+    constexpr size_t reserved_size       = (path == execution_path::hardware) ? 128u : 512u;
+    constexpr size_t max_code_length     = 15u;
+    constexpr size_t byte_bits_size      = 8u;
+
+    if constexpr (path != execution_path::hardware) {
+        return reserved_size + (source_size * max_code_length + byte_bits_size - 1u) / byte_bits_size;
+    }
+
+    const size_t blocks_count = (source_size + stored_block_size - 1u) / stored_block_size;
+
+    return reserved_size + source_size + blocks_count * stored_block_header;
+}
+
 } // namespace qpl
@@ -7,7 +7,11 @@
 #ifndef QPL_DEFLATE_STREAM_HPP
 #define QPL_DEFLATE_STREAM_HPP
 
+#include <algorithm>
+#include <limits>
+
 #include "qpl/cpp_api/results/compression_stream.hpp"
+#include "qpl/cpp_api/results/segment_sink.hpp"
 #include "qpl/cpp_api/operations/compression/deflate_operation.hpp"
 #include "qpl/cpp_api/operations/compression/deflate_stateful_operation.hpp"
 
@@ -74,6 +78,38 @@ public:
     template <class input_iterator_t>
     void flush(const input_iterator_t &source_begin, const input_iterator_t &source_end);
 
+    /**
+     * @brief Performs compression of the new chunk with specified boundaries into the segments of the sink
+     *
+     * @details The chunk is split so that the output of each part fits the free space of the current segment,
+     *          the next segment is requested from the sink once the current one is full.
+     *          The internal destination buffer is not used, so the stream may be created with zero destination size.
+     *          The output of the stream must be written either into the destination buffer or into the sink.
+     *
+     * @tparam  input_iterator_t  type of input iterator, the source must be contiguous
+     *
+     * @param   source_begin      pointer to the beginning of the source
+     * @param   source_end        pointer to the end of the source
+     * @param   sink              sink that receives the compressed data
+     */
+    template <class input_iterator_t>
+    auto push(const input_iterator_t &source_begin,
+              const input_iterator_t &source_end,
+              segment_sink &sink) -> deflate_stream &;
+
+    /**
+     * @brief Performs compression of the last chunk into the segments of the sink
+     *        and sets the stream to initial state
+     *
+     * @tparam  input_iterator_t  type of input iterator, the source must be contiguous
+     *
+     * @param   source_begin      pointer to the beginning of the source
+     * @param   source_end        pointer to the end of the source
+     * @param   sink              sink that receives the compressed data
+     */
+    template <class input_iterator_t>
+    void flush(const input_iterator_t &source_begin, const input_iterator_t &source_end, segment_sink &sink);
+
 private:
     /**
      * @brief Internal implementation of operation execution
@@ -86,6 +122,31 @@ private:
     template <class input_iterator_t>
     void submit_operation(const input_iterator_t &source_begin, const input_iterator_t &source_end);
 
+    /**
+     * @brief Internal implementation of operation execution with the output into the sink
+     *
+     * @param  source_ptr   pointer to the beginning of the source
+     * @param  source_size  number of bytes in the source
+     * @param  sink         sink that receives the compressed data
+     * @param  is_first     the source is the first chunk of the stream
+     * @param  is_last      the source is the last chunk of the stream
+     */
+    void submit_operation(const uint8_t *source_ptr,
+                          size_t source_size,
+                          segment_sink &sink,
+                          bool is_first,
+                          bool is_last);
+
+    /**
+     * @brief Returns the maximal number of source bytes that are compressed into the destination in any case
+     */
+    static constexpr auto get_max_source_size(size_t destination_size) noexcept -> size_t;
+
+    /**
+     * @brief Returns the destination size that holds the compressed source in any case
+     */
+    static constexpr auto get_safe_destination_size(size_t source_size) noexcept -> size_t;
+
     /**
      * Instance of operation that should be used for compression
      */
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <chrono>
+
 #include "qpl/cpp_api/results/execution_result.hpp"
 
 namespace qpl {
@@ -80,4 +82,16 @@ void execution_result<result_t, async>::if_present(present_statement_t present_s
     }
 }
 
+template <class result_t>
+auto execution_result<result_t, async>::is_ready() const -> bool {
+    return future_.valid() && future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+template <class result_t>
+void execution_result<result_t, async>::wait() const {
+    if (future_.valid()) {
+        future_.wait();
+    }
+}
+
 } // namespace qpl
@@ -123,20 +123,20 @@ public:
     /**
      * @brief Default copy constructor
      */
-    constexpr execution_result(const execution_result &other) noexcept = default;
+    execution_result(const execution_result &other) noexcept = default;
 
     /**
      * @brief Default move constructor
      */
-    constexpr execution_result(execution_result &&other) noexcept = default;
+    execution_result(execution_result &&other) noexcept = default;
 
     /**
      * @brief Default assignment operator
      */
-    constexpr auto operator=(const execution_result &other) -> execution_result & = default;
+    auto operator=(const execution_result &other) -> execution_result & = default;
 
     /**
-     * @brief Method that performs the given actions depending on status
+     * @brief Method that waits for the execution and performs the given actions depending on status
      *
      * @tparam  present_statement_t  type of the present statement
      * @tparam  absent_statement_t   type of the absent statement
@@ -148,7 +148,7 @@ public:
     void handle(present_statement_t present_statement, absent_statement_t absent_statement) const;
 
     /**
-     * @brief Method that performs the given action if a result was present
+     * @brief Method that waits for the execution and performs the given action if a result was present
      *
      * @tparam  present_statement_t  type of the present statement
      *
@@ -158,7 +158,7 @@ public:
     void if_present(present_statement_t present_statement) const;
 
     /**
-     * @brief Method that performs the given action if a result was absent
+     * @brief Method that waits for the execution and performs the given action if a result was absent
      *
      * @tparam  absent_statement_t  type of the absent statement
      *
@@ -167,10 +167,22 @@ public:
     template <class absent_statement_t>
     void if_absent(absent_statement_t absent_statement) const;
 
+    /**
+     * @brief Checks whether the execution is completed, doesn't block
+     *
+     * @return true if the result can be handled without waiting
+     */
+    [[nodiscard]] auto is_ready() const -> bool;
+
+    /**
+     * @brief Blocks until the execution is completed
+     */
+    void wait() const;
+
     /**
      * @brief Constructor that accepts the @code std::shared_future @endcode with the result
      */
-    constexpr explicit execution_result(const std::shared_future<result_t> &future)
+    explicit execution_result(const std::shared_future<execution_result<result_t, sync>> &future)
             : future_(future) {
         // Empty constructor
     }
@@ -179,7 +191,7 @@ private:
     /**
      * @code std::shared_future @endcode containing execution result
      */
-    std::shared_future<result_t> future_{};
+    std::shared_future<execution_result<result_t, sync>> future_{};
 };
 
 /** @} */
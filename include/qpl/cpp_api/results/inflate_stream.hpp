@@ -8,6 +8,7 @@
 #define QPL_INFLATE_STREAM_HPP
 
 #include "qpl/cpp_api/results/compression_stream.hpp"
+#include "qpl/cpp_api/results/segment_sink.hpp"
 #include "qpl/cpp_api/operations/compression/inflate_operation.hpp"
 
 namespace qpl {
@@ -68,6 +69,16 @@ public:
         return inflate_stream::extract_impl(&*destination_begin, destination_size);
     }
 
+    /**
+     * @brief Decompresses the rest of the source into the segments of the sink
+     *
+     * @details The next segment is requested from the sink once the current one is full,
+     *          so the size of the decompressed data doesn't need to be known in advance.
+     *
+     * @param   sink  sink that receives the decompressed data
+     */
+    auto extract(segment_sink &sink) -> inflate_stream &;
+
 protected:
 
     /**
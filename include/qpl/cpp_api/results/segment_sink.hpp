@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SEGMENT_SINK_HPP
+#define QPL_SEGMENT_SINK_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace qpl {
+
+/**
+ * @addtogroup HL_COMPRESSION
+ * @{
+ */
+
+/**
+ * @brief Contiguous piece of memory, the same as `struct iovec`
+ */
+struct output_segment {
+    uint8_t *data = nullptr;    /**< Pointer to the first byte of the segment */
+    size_t   size = 0u;         /**< Number of bytes in the segment */
+};
+
+/**
+ * @brief Growable output of the compression streams that consists of a chain of segments
+ *
+ * @details The stream writes into the free space of the current segment and asks for the next one
+ *          once the current segment can't hold the output. Segments are either allocated by the sink
+ *          with the fixed size or taken from the buffer provider of the user. Written data is never copied,
+ *          it is available as the list of segments in the order it was written.
+ */
+class segment_sink {
+public:
+    /**
+     * @brief Type of the buffer provider, it accepts the minimal number of bytes the new segment must hold
+     */
+    using provider_t = std::function<output_segment(size_t min_size)>;
+
+    /**
+     * @brief Minimal size of the allocated segments, the compression stream compresses parts of up to 4096 bytes
+     *        and requests the free space for their worst-case output, 8192 bytes on the software path
+     */
+    static constexpr size_t min_segment_size = 8192u;
+
+    /**
+     * @brief Constructor of the sink that allocates segments of the specified size
+     *
+     * @param  segment_size  number of bytes in each segment
+     *
+     * @throws invalid_argument_exception if the size is less than @ref min_segment_size
+     */
+    explicit segment_sink(size_t segment_size);
+
+    /**
+     * @brief Constructor of the sink that writes into the segments given by the user
+     *
+     * @param  provider  function that returns the next segment, the segment must outlive the sink usage
+     *                   and hold at least the requested number of bytes
+     */
+    explicit segment_sink(provider_t provider) noexcept;
+
+    /**
+     * @brief Deleted copy constructor
+     */
+    segment_sink(const segment_sink &other) = delete;
+
+    /**
+     * @brief Deleted assignment operator
+     */
+    auto operator=(const segment_sink &other) -> segment_sink & = delete;
+
+    /**
+     * @brief Default move constructor
+     */
+    segment_sink(segment_sink &&other) noexcept = default;
+
+    /**
+     * @brief Default move assignment operator
+     */
+    auto operator=(segment_sink &&other) noexcept -> segment_sink & = default;
+
+    /**
+     * @brief Returns written parts of the segments in the order they were written
+     */
+    [[nodiscard]] auto segments() const noexcept -> const std::vector<output_segment> &;
+
+    /**
+     * @brief Returns the total number of written bytes
+     */
+    [[nodiscard]] auto size() const noexcept -> size_t;
+
+    /**
+     * @brief Returns free space of the current segment or the next segment if the free space is smaller
+     *
+     * @param  min_size  minimal number of bytes the returned space must hold
+     *
+     * @throws short_destination_exception if the buffer provider returns a smaller segment
+     */
+    auto acquire(size_t min_size) -> output_segment;
+
+    /**
+     * @brief Marks the bytes at the beginning of the space returned by @ref acquire() as written
+     *
+     * @param  size  number of written bytes
+     *
+     * @note The space for the list entry is reserved by @ref acquire(), so committing never allocates
+     */
+    void commit(size_t size) noexcept;
+
+private:
+    provider_t                              provider_;               /**< Source of the next segments */
+    size_t                                  segment_size_ = 0u;      /**< Size of the allocated segments */
+    std::vector<std::unique_ptr<uint8_t[]>> allocated_segments_;     /**< Segments allocated by the sink */
+    std::vector<output_segment>             written_segments_;       /**< Written parts of the segments */
+    output_segment                          current_segment_{};      /**< Segment that is being written */
+    size_t                                  current_size_ = 0u;      /**< Written bytes of the current segment */
+    size_t                                  total_size_   = 0u;      /**< Written bytes of all segments */
+};
+
+/** @} */
+
+} // namespace qpl
+
+#endif // QPL_SEGMENT_SINK_HPP
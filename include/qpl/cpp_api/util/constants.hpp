@@ -32,6 +32,11 @@ namespace util {
  */
 constexpr uint32_t minimal_mini_block_size_power = 8;
 
+/**
+ * Number of decompressed mini-blocks that are kept by the deflate block by default
+ */
+constexpr uint32_t default_mini_block_cache_size = 4;
+
 /**
  * Power of 2 that represents bit-length of one byte
  */
@@ -74,6 +79,8 @@ constexpr const char *invalid_parameter              = "Invalid parameter value
 constexpr const char *buffer_exceeds_max_size        = "Buffer exceeds max size supported by hardware";
 constexpr const char *library_internal_error         = "Unexpected internal error condition";
 constexpr const char *verify_error                   = "CRC of decompressed verify output did not match CRC of input";
+constexpr const char *index_crc_mismatch             = "CRC of decompressed mini-blocks did not match CRC recorded "
+                                                       "in the index";
 constexpr const char *invalid_index_generation       = "Parameters inappropriate for indexing usage";
 constexpr const char *index_table_missed             = "Index table is not set";
 constexpr const char *index_array_too_small          = "Indexing buffer too small";
@@ -94,6 +101,10 @@ constexpr const char *short_mask                     = "Mask buffer has less byt
                                                        "to process input elements";
 constexpr const char *short_destination              = "Destination buffer has less bytes than required "
                                                        "to process input elements";
+constexpr const char *short_segment                  = "Buffer provider returned a segment with less bytes than "
+                                                       "requested";
+constexpr const char *short_segment_size             = "Segment size is less than the minimal size of the "
+                                                       "segment sink";
 constexpr const char *distance_spans_mini_blocks     = "Distance spans mini-block boundary on indexing";
 constexpr const char *length_spans_mini_blocks       = "Length spans mini-block boundary on indexing";
 constexpr const char *verif_invalid_block_size       = "Invalid block size (not multiple of mini-block size)";
@@ -104,6 +115,8 @@ constexpr const char *invalid_rle_counter            = "During RLE-burst, the cu
                                                        "count < prev count), or a count exceeded 2^16";
 constexpr const char *invalid_zero_decompress_header = "Invalid header for ZeroDecompress functionality";
 constexpr const char *no_any_exception_occurred      = "No any exception occurred";
+constexpr const char *out_of_range_access            = "Requested elements are out of the deflate block range";
+constexpr const char *zero_cache_size                = "Mini-block cache must keep at least one mini-block";
 /** @} */
 
 /** @} */
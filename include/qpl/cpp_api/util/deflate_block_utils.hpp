@@ -98,6 +98,45 @@ void read_mini_block(const uint8_t *source,
                      const internal::index *index_array,
                      internal::inflate_stateful_operation &operation);
 
+/**
+ * @brief Returns the number of threads @ref read_mini_blocks uses for the stream,
+ *        it also needs a job buffer for each of them
+ *
+ * @param  uncompressed_size  size of the data before compression
+ * @param  mini_block_size    size of one mini-block
+ * @param  thread_count       number of threads, 0 means the number of hardware threads
+ */
+auto get_mini_blocks_threads_count(uint32_t uncompressed_size,
+                                   mini_block_sizes mini_block_size,
+                                   uint32_t thread_count) noexcept -> uint32_t;
+
+/**
+ * @brief Decompresses all mini-blocks of the stream into destination, disjoint ranges of
+ *        mini-blocks are decompressed by different threads
+ *
+ * @param  source             pointer to the source
+ * @param  destination        pointer to the destination
+ * @param  destination_size   size of the destination
+ * @param  uncompressed_size  size of the data before compression
+ * @param  mini_block_size    size of one mini-block
+ * @param  index_array        pointer to indices array that should be used for decompression
+ * @param  path               execution path that should be used for decompression
+ * @param  thread_count       number of threads, 0 means the number of hardware threads
+ * @param  job_buffers        @ref get_mini_blocks_threads_count buffers of get_job_size() bytes each, one per thread
+ *
+ * @throws short_destination_exception if destination can't hold the decompressed data
+ * @throws invalid_data_exception if CRC of the decompressed data differs from the one recorded in the index
+ */
+void read_mini_blocks(const uint8_t *source,
+                      uint8_t *destination,
+                      uint32_t destination_size,
+                      uint32_t uncompressed_size,
+                      mini_block_sizes mini_block_size,
+                      const internal::index *index_array,
+                      execution_path path,
+                      uint32_t thread_count,
+                      uint8_t *job_buffers);
+
 /** @} */
 
 } // namespace qpl::util
@@ -0,0 +1,37 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_TASK_POOL_HPP
+#define QPL_TASK_POOL_HPP
+
+#include <functional>
+
+namespace qpl::util {
+
+/**
+ * @addtogroup HL_UTIL
+ * @{
+ */
+
+/**
+ * @brief Enqueues the task to the internal pool of worker threads without blocking the caller
+ *
+ * @note The pool is shared with the software path jobs submitted with qpl_submit_job(), so its size and
+ *       the CPUs of the workers are set with qpl_configure_sw_executor(). Workers are started with
+ *       the first submitted task. Idle workers take tasks from the queues of busy ones,
+ *       so tasks are not started in the submission order.
+ *
+ * @param  task  callable that should be executed by one of the workers
+ *
+ * @throws memory_underflow_exception if the workers can't be started
+ */
+void submit_task(std::function<void()> task);
+
+/** @} */
+
+} // namespace qpl::util
+
+#endif // QPL_TASK_POOL_HPP
@@ -24,10 +24,12 @@
 #include "cpp_api/chaining/merge_manipulator.hpp"
 
 // Analytic Operations API
+#include "cpp_api/operations/analytics/bitmap_operation.hpp"
 #include "cpp_api/operations/analytics/expand_operation.hpp"
 #include "cpp_api/operations/analytics/extract_operation.hpp"
 #include "cpp_api/operations/analytics/find_unique_operation.hpp"
 #include "cpp_api/operations/analytics/scan_operation.hpp"
+#include "cpp_api/operations/analytics/scan_predicates_operation.hpp"
 #include "cpp_api/operations/analytics/scan_range_operation.hpp"
 #include "cpp_api/operations/analytics/select_operation.hpp"
 #include "cpp_api/operations/analytics/set_membership_operation.hpp"
@@ -41,6 +43,7 @@
 #include "cpp_api/results/deflate_block.hpp"
 #include "cpp_api/results/deflate_stream.hpp"
 #include "cpp_api/results/inflate_stream.hpp"
+#include "cpp_api/results/segment_sink.hpp"
 
 // Other Operations API
 #include "cpp_api/operations/other/crc_operation.hpp"
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+
+#include "async_sw_job.hpp"
+
+// Middle layer headers
+#include "util/executor.hpp"
+
+namespace qpl::job {
+
+namespace {
+
+struct sw_group_t;
+
+/**
+ * @brief Software path submission of one job of the group
+ */
+struct sw_task_t {
+    ml::util::executor_task_t executor_task;                         /**< Node of the executor queue */
+    qpl_job                   *job_ptr     = nullptr;
+    sw_group_t                *group_ptr   = nullptr;
+    qpl_status                status       = QPL_STS_BEING_PROCESSED;
+    std::atomic<bool>         is_completed = false;
+    bool                      is_awaited   = false;     /**< Waiter sleeps on the group condition, protected by mutex */
+};
+
+/**
+ * @brief Jobs submitted together, lives from the submission till statuses of all of its jobs are taken
+ */
+struct sw_group_t {
+    sw_execute_routine_t    execute          = nullptr;
+    sw_task_t               *tasks_ptr       = nullptr;
+    sw_task_t               single_task;                /**< Storage of the group of one job */
+    uint32_t                not_taken_count  = 0u;      /**< Tasks whose status is not taken, protected by mutex */
+    std::mutex              mutex;
+    std::condition_variable condition;
+
+    ~sw_group_t() {
+        if (tasks_ptr != &single_task) {
+            delete[] tasks_ptr;
+        }
+    }
+};
+
+void process_sw_task(void *context) {
+    auto *task_ptr  = reinterpret_cast<sw_task_t *>(context);
+    auto *group_ptr = task_ptr->group_ptr;
+
+    const auto status = group_ptr->execute(task_ptr->job_ptr);
+
+    // Waiters are notified under the lock, as the group may be deleted as soon as the lock is released
+    std::lock_guard<std::mutex> lock(group_ptr->mutex);
+
+    task_ptr->status = status;
+    task_ptr->is_completed.store(true, std::memory_order_release);
+
+    // Completion of other jobs of the group doesn't wake the waiter up
+    if (task_ptr->is_awaited) {
+        group_ptr->condition.notify_all();
+    }
+}
+
+auto take_status(qpl_job *job_ptr) noexcept -> qpl_status {
+    auto *task_ptr  = reinterpret_cast<sw_task_t *>(job_ptr->data_ptr.sw_task_ptr);
+    auto *group_ptr = task_ptr->group_ptr;
+
+    const auto status = task_ptr->status;
+    bool is_last      = false;
+
+    job_ptr->data_ptr.sw_task_ptr = nullptr;
+
+    {
+        // Worker may still hold the lock while notifying waiters
+        std::lock_guard<std::mutex> lock(group_ptr->mutex);
+
+        is_last = (0u == --group_ptr->not_taken_count);
+    }
+
+    if (is_last) {
+        delete group_ptr;
+    }
+
+    return status;
+}
+
+} // anonymous namespace
+
+auto submit_sw_job(qpl_job *job_ptr, sw_execute_routine_t execute) noexcept -> qpl_status {
+    return submit_sw_jobs(&job_ptr, 1u, execute);
+}
+
+auto submit_sw_jobs(qpl_job *const *jobs_ptr, uint32_t jobs_count, sw_execute_routine_t execute) noexcept -> qpl_status {
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        if (is_sw_job_submitted(jobs_ptr[i])) {
+            if (QPL_STS_BEING_PROCESSED == check_sw_job(jobs_ptr[i])) {
+                return QPL_STS_BEING_PROCESSED;
+            }
+        }
+    }
+
+    auto *group_ptr = new (std::nothrow) sw_group_t();
+
+    if (nullptr == group_ptr) {
+        return QPL_STS_NO_MEM_ERR;
+    }
+
+    ml::util::executor_task_t *single_executor_task = &group_ptr->single_task.executor_task;
+    ml::util::executor_task_t **executor_tasks_ptr  = &single_executor_task;
+
+    if (1u == jobs_count) {
+        group_ptr->tasks_ptr = &group_ptr->single_task;
+    } else {
+        group_ptr->tasks_ptr = new (std::nothrow) sw_task_t[jobs_count];
+        executor_tasks_ptr   = new (std::nothrow) ml::util::executor_task_t *[jobs_count];
+
+        if (nullptr == group_ptr->tasks_ptr || nullptr == executor_tasks_ptr) {
+            delete[] executor_tasks_ptr;
+            delete group_ptr;
+
+            return QPL_STS_NO_MEM_ERR;
+        }
+    }
+
+    group_ptr->execute         = execute;
+    group_ptr->not_taken_count = jobs_count;
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        auto &task = group_ptr->tasks_ptr[i];
+
+        task.executor_task.routine = process_sw_task;
+        task.executor_task.context = &task;
+        task.job_ptr               = jobs_ptr[i];
+        task.group_ptr             = group_ptr;
+        executor_tasks_ptr[i]      = &task.executor_task;
+
+        jobs_ptr[i]->data_ptr.sw_task_ptr = &task;
+    }
+
+    const auto status = ml::util::execute_async(executor_tasks_ptr, jobs_count);
+
+    if (executor_tasks_ptr != &single_executor_task) {
+        delete[] executor_tasks_ptr;
+    }
+
+    // None of the tasks is queued if the workers can't be started
+    if (ml::status_list::ok != status) {
+        for (uint32_t i = 0u; i < jobs_count; i++) {
+            jobs_ptr[i]->data_ptr.sw_task_ptr = nullptr;
+        }
+
+        delete group_ptr;
+
+        return static_cast<qpl_status>(status);
+    }
+
+    return QPL_STS_OK;
+}
+
+auto is_sw_job_submitted(const qpl_job *job_ptr) noexcept -> bool {
+    return nullptr != job_ptr->data_ptr.sw_task_ptr;
+}
+
+auto check_sw_job(qpl_job *job_ptr) noexcept -> qpl_status {
+    auto *task_ptr = reinterpret_cast<sw_task_t *>(job_ptr->data_ptr.sw_task_ptr);
+
+    if (!task_ptr->is_completed.load(std::memory_order_acquire)) {
+        return QPL_STS_BEING_PROCESSED;
+    }
+
+    return take_status(job_ptr);
+}
+
+auto wait_sw_job(qpl_job *job_ptr, ml::wait_deadline_t deadline) noexcept -> qpl_status {
+    auto *task_ptr  = reinterpret_cast<sw_task_t *>(job_ptr->data_ptr.sw_task_ptr);
+    auto *group_ptr = task_ptr->group_ptr;
+
+    {
+        std::unique_lock<std::mutex> lock(group_ptr->mutex);
+        const auto is_completed = [task_ptr]() -> bool {
+            return task_ptr->is_completed.load(std::memory_order_relaxed);
+        };
+
+        task_ptr->is_awaited = true;
+
+        if (ml::wait_deadline_t::max() == deadline) {
+            group_ptr->condition.wait(lock, is_completed);
+        } else if (!group_ptr->condition.wait_until(lock, deadline, is_completed)) {
+            task_ptr->is_awaited = false;
+
+            return QPL_STS_WAIT_TIMEOUT;
+        }
+    }
+
+    return take_status(job_ptr);
+}
+
+} // namespace qpl::job
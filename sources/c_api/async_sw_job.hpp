@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Job API (public C API)
+ */
+
+#ifndef QPL_ASYNC_SW_JOB_HPP_
+#define QPL_ASYNC_SW_JOB_HPP_
+
+#include "qpl/c_api/job.h"
+
+// Middle layer headers
+#include "util/awaiter.hpp"
+
+namespace qpl::job {
+
+/**
+ * @brief Function that processes the job on the software path synchronously
+ */
+using sw_execute_routine_t = qpl_status (*)(qpl_job *job_ptr);
+
+/**
+ * @brief Enqueues the job to the software path executor
+ *
+ * @return QPL_STS_BEING_PROCESSED if the previous submission of the job is not completed yet
+ */
+auto submit_sw_job(qpl_job *job_ptr, sw_execute_routine_t execute) noexcept -> qpl_status;
+
+/**
+ * @brief Enqueues distinct jobs to the software path executor as one group of tasks
+ *
+ * @return QPL_STS_BEING_PROCESSED if the previous submission of one of the jobs is not completed yet,
+ *         none of the jobs is submitted then
+ */
+auto submit_sw_jobs(qpl_job *const *jobs_ptr, uint32_t jobs_count, sw_execute_routine_t execute) noexcept -> qpl_status;
+
+/**
+ * @brief Returns true if the job was submitted to the software path executor and its result is not taken yet
+ */
+auto is_sw_job_submitted(const qpl_job *job_ptr) noexcept -> bool;
+
+/**
+ * @brief Returns QPL_STS_BEING_PROCESSED while the job is processed, and the job status once it is completed
+ */
+auto check_sw_job(qpl_job *job_ptr) noexcept -> qpl_status;
+
+/**
+ * @brief Blocks until the job is completed and returns its status
+ *
+ * @return QPL_STS_WAIT_TIMEOUT if the deadline is reached first, the job stays submitted then
+ */
+auto wait_sw_job(qpl_job *job_ptr, ml::wait_deadline_t deadline = ml::wait_deadline_t::max()) noexcept -> qpl_status;
+
+} // namespace qpl::job
+
+#endif //QPL_ASYNC_SW_JOB_HPP_
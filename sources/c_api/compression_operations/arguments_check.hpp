@@ -65,11 +65,19 @@ auto inline bad_arguments_check(const qpl_job *const job_ptr) -> uint32_t {
 
 template <>
 inline auto validate_mode<qpl_operation::qpl_op_compress>(const qpl_job * const qpl_job_ptr) noexcept {
-    if (qpl_job_ptr->level != qpl_high_level && qpl_job_ptr->level != qpl_default_level) {
-        return ml::status_list::not_supported_level_err;
+    switch (qpl_job_ptr->level) {
+        case qpl_level_0:
+        case qpl_level_1:
+        case qpl_level_2:
+        case qpl_level_3:
+        case qpl_level_9:
+            break;
+        default:
+            return ml::status_list::not_supported_level_err;
     }
 
-    if (qpl_job_ptr->level == qpl_high_level &&
+    // Accelerator supports the default level only, other levels are processed by the own software matcher
+    if (qpl_job_ptr->level != qpl_default_level &&
         (job::get_execution_path(qpl_job_ptr) == ml::execution_path_t::hardware)) {
         return ml::status_list::not_supported_level_err;
     }
@@ -76,7 +76,7 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
                .be_output(job_ptr->flags & QPL_FLAG_HUFFMAN_BE)
                .collect_statistics_step(job_ptr->flags & QPL_FLAG_DYNAMIC_HUFFMAN)
                .crc_seed(job_ptr->crc)
-               .verify(!(job_ptr->flags & QPL_FLAG_OMIT_VERIFY))
+               .verify(job::is_verification_required(job_ptr))
                .total_out(job_ptr->total_out);
 
         if (job_ptr->huffman_table != nullptr) {
@@ -102,7 +102,7 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
                .compression_level(static_cast<compression_level_t>(job_ptr->level))
                .crc_seed({job_ptr->crc, 1})
                .terminate(job_ptr->flags & QPL_FLAG_LAST)
-               .verify(!(job_ptr->flags & QPL_FLAG_OMIT_VERIFY))
+               .verify(job::is_verification_required(job_ptr))
                .load_current_position(job_ptr->total_out); // Shall be deprecated
 
         if (job_ptr->flags & QPL_FLAG_DYNAMIC_HUFFMAN) {
@@ -132,7 +132,11 @@ uint32_t perform_compression(qpl_job *const job_ptr) noexcept {
             }
         }
 
-        auto state = builder.verify(!(job_ptr->flags & QPL_FLAG_OMIT_VERIFY))
+        if constexpr (qpl::ml::execution_path_t::software == path) {
+            builder.verify_in_lockstep(job_ptr->flags & QPL_FLAG_VERIFY_STREAMING);
+        }
+
+        auto state = builder.verify(job::is_verification_required(job_ptr))
                             .build();
 
         if (job_ptr->flags & QPL_FLAG_CANNED_MODE) { // LZ Only
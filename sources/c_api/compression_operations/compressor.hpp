@@ -90,6 +90,9 @@ namespace qpl {
  *
  *    The compressor performs post verification of the compressed stream.
  *    The @ref QPL_FLAG_OMIT_VERIFY flag must be set to disable this step.
+ *    With the @ref QPL_FLAG_VERIFY_SAMPLED flag only one of each @ref qpl_job.verify_sample_period streams
+ *    is verified. With the @ref QPL_FLAG_VERIFY_STREAMING flag the software path verifies each dynamic block
+ *    right after it is written.
  *
  * <b> `Huffman Only Mode:` </b><br>
  *    Compressor supports Huffman only mode that implements encoding of literals using Huffman codes
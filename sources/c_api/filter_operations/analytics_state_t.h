@@ -69,6 +69,17 @@ extern "C" {
  */
 #define OWN_SRC2_BUF_SIZE (OWN_MAX_ELEMENTS * sizeof(uint32_t))
 
+/**
+ * @brief Position of the streaming scan that is kept between the jobs of the stream
+ */
+typedef struct {
+    uint32_t elements_processed;    /**< Number of elements scanned by the previous jobs */
+    uint32_t pending_bytes;         /**< Decompressed bytes kept at the inflate buffer begin */
+    uint32_t first_index;           /**< Index of the first matched element */
+    uint32_t last_index;            /**< Index of the last matched element */
+    uint32_t matches_count;         /**< Number of matched elements */
+} own_scan_stream_t;
+
 /**
  * @brief Interal structure for analytics buffers manipulations
  */
@@ -81,6 +92,7 @@ typedef struct {
     uint8_t  *unpack_buf_ptr;     /**< Pointer to unpack buffer */
     uint8_t  *set_buf_ptr;        /**< Pointer to find unique & set membership buffer */
     uint8_t  *src2_buf_ptr;       /**< Pointer to src2 buffer for expand */
+    own_scan_stream_t scan_stream; /**< Position of the streaming scan */
 } own_analytics_state_t;
 
 #ifdef __cplusplus
@@ -23,7 +23,12 @@ inline auto validate_analytic_buffers(const qpl_job *const job_ptr) noexcept {
         return QPL_STS_NULL_PTR_ERR;
     }
 
-    if (0u == job_ptr->available_in || 0u == job_ptr->available_out || 0u == job_ptr->num_input_elements) {
+    // Next jobs of the streaming scan may only drain the results, the rest of the source is kept in the state
+    const bool is_streaming_scan  = (operation == qpl_op_scan_eq) && (QPL_FLAG_STREAMING_SCAN & job_ptr->flags);
+    const bool is_source_required = !is_streaming_scan || (QPL_FLAG_FIRST & job_ptr->flags);
+
+    if ((0u == job_ptr->available_in && is_source_required) ||
+        0u == job_ptr->available_out || 0u == job_ptr->num_input_elements) {
         return QPL_STS_SIZE_ERR;
     }
 
@@ -81,8 +86,10 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
         source_bit_width = static_cast<uint32_t>(job_ptr->next_in_ptr[0]);
     }
 
+    const uint32_t max_bit_width = (is_wide_analytics(job_ptr)) ? limits::max_wide_bit_width : limits::max_bit_width;
+
     if (false == source_bit_width_is_unknown &&
-        (source_bit_width < 1u || source_bit_width > 32u)) {
+        (source_bit_width < 1u || source_bit_width > max_bit_width)) {
         return QPL_STS_BIT_WIDTH_ERR;
     }
 
@@ -94,6 +101,21 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 }
 }
 
+namespace wide_elements {
+static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
+    if (!is_wide_analytics(job_ptr)) {
+        return QPL_STS_OK;
+    }
+
+    // Elements themselves are written as is, only indices of scan may be extended
+    if (!is_scan(job_ptr) && qpl_ow_nom != job_ptr->out_bit_width) {
+        return QPL_STS_OUT_FORMAT_ERR;
+    }
+
+    return QPL_STS_OK;
+}
+}
+
 namespace select {
 static inline qpl_status check_bad_arguments(const qpl_job *const job_ptr) {
     QPL_BADARG_RET((qpl_op_select != job_ptr->op), QPL_STS_OPERATION_ERR)
@@ -145,7 +167,11 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 namespace set_membership {
 static inline qpl_status check_bad_arguments(const qpl_job *const job_ptr) {
     QPL_BADARG_RET(qpl_op_set_membership != job_ptr->op, QPL_STS_OPERATION_ERR)
-    QPL_BADARG_RET((1u != job_ptr->src2_bit_width), QPL_STS_BIT_WIDTH_ERR);
+
+    const bool is_set_list = (job_ptr->flags & QPL_FLAG_SET_LIST);
+
+    QPL_BADARG_RET(((is_set_list ? 32u : 1u) != job_ptr->src2_bit_width), QPL_STS_BIT_WIDTH_ERR);
+    QPL_BADARG_RET((is_set_list && 0u != job_ptr->available_src2 % sizeof(uint32_t)), QPL_STS_SIZE_ERR);
 
     QPL_BADARG_RET(job_ptr->initial_output_index, QPL_STS_INVALID_PARAM_ERR);
 
@@ -178,14 +204,16 @@ static inline qpl_status check_bad_arguments(const qpl_job *const job_ptr) {
 
     const uint32_t actual_bit_width = source_bit_width - drop_bits_count;
 
-    const uint32_t required_src2_bit_size  = 1u << actual_bit_width;
-    const uint32_t required_src2_byte_size = util::bit_to_byte(required_src2_bit_size);
+    // List of keys is not limited by the internal buffer
+    if (!is_set_list) {
+        const uint64_t required_src2_bit_size  = 1ull << actual_bit_width;
+        const uint64_t required_src2_byte_size = util::bit_to_byte(required_src2_bit_size);
 
-    QPL_BADARG_RET(job_ptr->available_src2 < required_src2_byte_size, QPL_STS_SRC2_IS_SHORT_ERR)
+        QPL_BADARG_RET(job_ptr->available_src2 < required_src2_byte_size, QPL_STS_SRC2_IS_SHORT_ERR)
 
-
-    // Source-2 is unpacked into internal buffer of size 2^N, where N = source-1 bit width
-    QPL_BADARG_RET(required_src2_bit_size > limits::set_buf_bit_size, QPL_STS_SET_TOO_LARGE_ERR)
+        // Source-2 is unpacked into internal buffer of size 2^N, where N = source-1 bit width
+        QPL_BADARG_RET(required_src2_bit_size > limits::set_buf_bit_size, QPL_STS_SET_TOO_LARGE_ERR)
+    }
 
     if (job_ptr->parser != qpl_p_parquet_rle && !(job_ptr->flags & QPL_FLAG_DECOMPRESS_ENABLE)) {
         uint64_t expected_source_byte_length = util::bit_to_byte((uint64_t)job_ptr->num_input_elements *
@@ -300,7 +328,21 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 
 namespace scanning {
 static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
-    if (qpl_ow_nom == job_ptr->out_bit_width) {
+    const bool is_streaming = (QPL_FLAG_STREAMING_SCAN & job_ptr->flags);
+
+    if (is_streaming) {
+        if (!(QPL_FLAG_DECOMPRESS_ENABLE & job_ptr->flags) || qpl_p_parquet_rle == job_ptr->parser) {
+            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+        }
+    }
+
+    if (QPL_FLAG_OUT_RANGES & job_ptr->flags) {
+        if (qpl_ow_nom == job_ptr->out_bit_width || (QPL_FLAG_OUT_BE & job_ptr->flags) || is_streaming) {
+            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+        }
+    }
+
+    if (qpl_ow_nom == job_ptr->out_bit_width && !is_streaming) {
         if (util::bit_to_byte(job_ptr->num_input_elements) > job_ptr->available_out) {
             return QPL_STS_DST_IS_SHORT_ERR;
         }
@@ -331,6 +373,92 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 }
 }
 
+namespace scan_predicates {
+static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
+    if (!is_scan_predicates(job_ptr)) {
+        return QPL_STS_OK;
+    }
+
+    if ((QPL_FLAG_STREAMING_SCAN & job_ptr->flags) || is_wide_analytics(job_ptr)) {
+        return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+    }
+
+    QPL_BAD_PTR_RET(job_ptr->next_src2_ptr)
+
+    const uint32_t predicates_count = job_ptr->available_src2 / sizeof(qpl_scan_predicate);
+
+    if (0u != job_ptr->available_src2 % sizeof(qpl_scan_predicate) ||
+        0u == predicates_count || predicates_count > limits::max_scan_predicates) {
+        return QPL_STS_SIZE_ERR;
+    }
+
+    if (ml::bad_argument::buffers_overlap(job_ptr->next_src2_ptr, job_ptr->available_src2,
+                                          job_ptr->next_out_ptr, job_ptr->available_out)) {
+        return QPL_STS_BUFFER_OVERLAP_ERR;
+    }
+
+    const auto *predicates_ptr = reinterpret_cast<const qpl_scan_predicate *>(job_ptr->next_src2_ptr);
+
+    for (uint32_t i = 0u; i < predicates_count; i++) {
+        if (predicates_ptr[i].op < qpl_op_scan_eq || predicates_ptr[i].op > qpl_op_scan_not_range) {
+            return QPL_STS_OPERATION_ERR;
+        }
+
+        if (predicates_ptr[i].combination > qpl_predicate_or_not) {
+            return QPL_STS_INVALID_PARAM_ERR;
+        }
+    }
+
+    return QPL_STS_OK;
+}
+}
+
+namespace bitmap {
+static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
+    const bool     is_binary  = qpl_op_bitmap_not != job_ptr->op && qpl_op_bitmap_count != job_ptr->op;
+    const bool     has_output = qpl_op_bitmap_count != job_ptr->op;
+    const uint32_t byte_size  = util::bit_to_byte(job_ptr->num_input_elements);
+
+    QPL_BAD_PTR_RET(job_ptr->next_in_ptr)
+
+    if (0u == job_ptr->available_in || 0u == job_ptr->num_input_elements) {
+        return QPL_STS_SIZE_ERR;
+    }
+
+    if (job_ptr->flags & QPL_FLAG_DECOMPRESS_ENABLE) {
+        return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+    }
+
+    if (job_ptr->drop_initial_bytes) {
+        return QPL_STS_DROP_BYTES_ERR;
+    }
+
+    QPL_BADARG_RET((byte_size > job_ptr->available_in), QPL_STS_SRC_IS_SHORT_ERR)
+
+    if (is_binary) {
+        QPL_BAD_PTR_RET(job_ptr->next_src2_ptr)
+        QPL_BADARG_RET((byte_size > job_ptr->available_src2), QPL_STS_SRC_IS_SHORT_ERR)
+    }
+
+    if (has_output) {
+        QPL_BAD_PTR_RET(job_ptr->next_out_ptr)
+        QPL_BADARG_RET((byte_size > job_ptr->available_out), QPL_STS_DST_IS_SHORT_ERR)
+
+        if (ml::bad_argument::buffers_overlap(job_ptr->next_in_ptr, job_ptr->available_in,
+                                              job_ptr->next_out_ptr, job_ptr->available_out)) {
+            return QPL_STS_BUFFER_OVERLAP_ERR;
+        }
+
+        if (is_binary && ml::bad_argument::buffers_overlap(job_ptr->next_src2_ptr, job_ptr->available_src2,
+                                                           job_ptr->next_out_ptr, job_ptr->available_out)) {
+            return QPL_STS_BUFFER_OVERLAP_ERR;
+        }
+    }
+
+    return QPL_STS_OK;
+}
+}
+
 namespace find_unique {
 static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t {
     uint32_t input_bit_width       = job_ptr->src1_bit_width;
@@ -357,8 +485,13 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
             return QPL_STS_DROP_BITS_OVERFLOW_ERR;
         }
 
+        // List of distinct values is not limited by the internal buffer, its size is known after processing only
+        if (job_ptr->flags & QPL_FLAG_SET_LIST) {
+            return (qpl_ow_nom == job_ptr->out_bit_width) ? QPL_STS_OK : QPL_STS_OUT_FORMAT_ERR;
+        }
+
         // Find unique outputs vector of size 2^N, where N = actual source bit width
-        uint32_t required_set_size = 1u << (input_bit_width - lower_bits_to_ignore - higher_bits_to_ignore);
+        uint64_t required_set_size = 1ull << (input_bit_width - lower_bits_to_ignore - higher_bits_to_ignore);
 
         // Check if internal buffer is large enough to perform find unique
         if (required_set_size > limits::set_buf_bit_size) {
@@ -367,7 +500,7 @@ static inline auto check_bad_arguments(const qpl_job *const job_ptr) -> uint32_t
 
         if (qpl_ow_nom == job_ptr->out_bit_width) {
             // Size of output bit vector after packing
-            uint32_t output_vector_size = (required_set_size + max_bit_index) >> bit_len_to_byte_shift_offset;
+            uint64_t output_vector_size = (required_set_size + max_bit_index) >> bit_len_to_byte_shift_offset;
 
             // Check if there are enough output bytes
             if (output_vector_size > job_ptr->available_out) {
@@ -386,7 +519,9 @@ template<>
 inline auto validate_operation<qpl_op_scan_eq>(const qpl_job *const job_ptr) noexcept {
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_scan_eq>(job_ptr));
     OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::wide_elements::check_bad_arguments(job_ptr));
     OWN_QPL_CHECK_STATUS(details::scanning::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::scan_predicates::check_bad_arguments(job_ptr));
 
     return QPL_STS_OK;
 }
@@ -404,6 +539,7 @@ template<>
 inline auto validate_operation<qpl_op_extract>(const qpl_job *const job_ptr) noexcept {
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_extract>(job_ptr));
     OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr))
+    OWN_QPL_CHECK_STATUS(details::wide_elements::check_bad_arguments(job_ptr));
     OWN_QPL_CHECK_STATUS(details::extract::check_bad_arguments(job_ptr));
 
     return QPL_STS_OK;
@@ -422,6 +558,7 @@ template<>
 inline auto validate_operation<qpl_op_select>(const qpl_job *const job_ptr) noexcept {
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_select>(job_ptr));
     OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::wide_elements::check_bad_arguments(job_ptr));
     OWN_QPL_CHECK_STATUS(details::select::check_bad_arguments(job_ptr));
 
     return QPL_STS_OK;
@@ -431,11 +568,22 @@ template<>
 inline auto validate_operation<qpl_op_expand>(const qpl_job *const job_ptr) noexcept {
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_expand>(job_ptr));
     OWN_QPL_CHECK_STATUS(details::common::check_bad_arguments(job_ptr));
+    OWN_QPL_CHECK_STATUS(details::wide_elements::check_bad_arguments(job_ptr));
     OWN_QPL_CHECK_STATUS(details::expand::check_bad_arguments(job_ptr));
 
     return QPL_STS_OK;
 }
 
+/**
+ * @note Is used for all bit vector operations, parser and bit widths of the job are ignored
+ */
+template<>
+inline auto validate_operation<qpl_op_bitmap_and>(const qpl_job *const job_ptr) noexcept {
+    OWN_QPL_CHECK_STATUS(details::bitmap::check_bad_arguments(job_ptr));
+
+    return QPL_STS_OK;
+}
+
 template<>
 inline auto validate_operation<qpl_op_rle_burst>(const qpl_job *const job_ptr) noexcept {
     OWN_QPL_CHECK_STATUS(details::validate_analytic_buffers<qpl_op_rle_burst>(job_ptr));
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "filter_operations.hpp"
+#include "arguments_check.hpp"
+#include "analytics/bitmap.hpp"
+
+static inline auto get_bitmap_operation(const qpl_operation operation) noexcept -> qpl::ml::analytics::bitmap_operation_t {
+    using namespace qpl::ml::analytics;
+
+    switch (operation) {
+        case qpl_op_bitmap_and:
+            return bitmap_operation_t::and_op;
+        case qpl_op_bitmap_or:
+            return bitmap_operation_t::or_op;
+        case qpl_op_bitmap_xor:
+            return bitmap_operation_t::xor_op;
+        case qpl_op_bitmap_and_not:
+            return bitmap_operation_t::and_not_op;
+        case qpl_op_bitmap_not:
+            return bitmap_operation_t::not_op;
+        default:
+            return bitmap_operation_t::count;
+    }
+}
+
+uint32_t perform_bitmap(qpl_job *job_ptr) {
+    using namespace qpl::ml;
+
+    OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_bitmap_and>(job_ptr))
+
+    const auto result = analytics::call_bitmap(get_bitmap_operation(job_ptr->op),
+                                               job_ptr->next_in_ptr,
+                                               job_ptr->next_src2_ptr,
+                                               job_ptr->next_out_ptr,
+                                               job_ptr->num_input_elements,
+                                               job_ptr->flags & QPL_FLAG_OMIT_AGGREGATES);
+
+    job_ptr->total_out = result.output_bytes_;
+
+    if (QPL_STS_OK == result.status_code_) {
+        analytics::update_job(job_ptr, result);
+    }
+
+    return result.status_code_;
+}
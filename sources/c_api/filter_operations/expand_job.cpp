@@ -21,6 +21,10 @@ uint32_t perform_expand(qpl_job *job_ptr,
 
     OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_expand>(job_ptr))
 
+    if (qpl::job::is_wide_analytics(job_ptr)) {
+        return perform_wide_elements(job_ptr, unpack_buffer_ptr, unpack_buffer_size);
+    }
+
     const auto input_stream_format  = get_stream_format(job_ptr->parser);
     const auto out_bit_width_format = static_cast<analytics::output_bit_width_format_t>(job_ptr->out_bit_width);
     const auto mask_stream_format   = job_ptr->flags & QPL_FLAG_SRC2_BE ? stream_format_t::be_format
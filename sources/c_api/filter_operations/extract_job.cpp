@@ -20,6 +20,10 @@ uint32_t perform_extract(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_
         return status_list::ok;
     }
 
+    if (qpl::job::is_wide_analytics(job_ptr)) {
+        return perform_wide_elements(job_ptr, buffer_ptr, buffer_size);
+    }
+
     const auto input_stream_format  = analytics::get_stream_format(job_ptr->parser);
     const auto out_bit_width_format = static_cast<analytics::output_bit_width_format_t>(job_ptr->out_bit_width);
     const auto output_stream_format = (job_ptr->flags & QPL_FLAG_OUT_BE) ? analytics::stream_format_t::be_format
@@ -92,6 +92,10 @@
  *      - If output format is @ref qpl_ow_8, @ref qpl_ow_16 or @ref qpl_ow_32, output will be indexes vector.
  *        Indexes vector contains indexes of all elements that satisfy condition in the table above.
  *
+ * @note 3: With @ref QPL_FLAG_SCAN_PREDICATES the condition is the program of @ref qpl_scan_predicate
+ *      at @ref qpl_job.next_src2_ptr, the predicates of the table above are combined from left to right.
+ *      The source is unpacked once, the results of every predicate are combined into the single output.
+ *
  * @warning
  *      If index is great than output extension, it will be error.
  *          - @ref qpl_ow_8  - max index is 255;
@@ -592,6 +596,54 @@ uint32_t perform_rle_burst(qpl_job *job_ptr,
                            uint32_t output_buffer_size,
                            uint8_t *mask_buffer_ptr,
                            uint32_t mask_buffer_size);
+
+/**
+ * @brief Performs scan, extract, select or expand over elements of 33-64 bits, called by the operations
+ *        after the job is validated
+ *
+ * @param [in,out] job_ptr pointer onto user specified @ref qpl_job
+ * @param [in] buffer_ptr  unpack buffer, keeps the results of scan before they are packed
+ * @param [in] buffer_size unpack buffer size
+ *
+ * @details Source-1 is an uncompressed little- or big-endian packed array. Scan compares elements with
+ *          @ref qpl_job.param_low_64 and @ref qpl_job.param_high_64, and writes any output format of scan.
+ *          Other operations write elements as is, so @ref qpl_job.out_bit_width must be @ref qpl_ow_nom.
+ *          Aggregates are also written to @ref qpl_job.first_index_min_value_64,
+ *          @ref qpl_job.last_index_max_value_64 and @ref qpl_job.sum_value_64.
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_SRC_IS_SHORT_ERR
+ *    - @ref QPL_STS_DST_IS_SHORT_ERR
+ *    - @ref QPL_STS_OUTPUT_OVERFLOW_ERR
+ *    - @ref QPL_STS_OPERATION_ERR
+ */
+uint32_t perform_wide_elements(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_size);
+
+/**
+ * @brief Performs AND, OR, XOR, AND NOT and NOT of bit vectors, or counts set bits of the bit vector
+ *
+ * @param [in,out] job_ptr pointer onto user specified @ref qpl_job
+ *
+ * @details @ref qpl_job.num_input_elements is the number of bits in the vectors, `source-1` is set by
+ *          @ref qpl_job.next_in_ptr, `source-2` of binary operations is set by @ref qpl_job.next_src2_ptr.
+ *          The result of logic operations takes util::bit_to_byte(num_input_elements) bytes, unused bits
+ *          of the last byte are zeroed. @ref qpl_op_bitmap_count writes no output.
+ *          Number of set bits of the result (of `source-1` for count) is written to @ref qpl_job.sum_value,
+ *          indices of the first and the last set bits to @ref qpl_job.first_index_min_value and
+ *          @ref qpl_job.last_index_max_value.
+ *
+ * @return
+ *    - @ref QPL_STS_OK
+ *    - @ref QPL_STS_NULL_PTR_ERR
+ *    - @ref QPL_STS_SIZE_ERR
+ *    - @ref QPL_STS_SRC_IS_SHORT_ERR
+ *    - @ref QPL_STS_DST_IS_SHORT_ERR
+ *    - @ref QPL_STS_BUFFER_OVERLAP_ERR
+ *    - @ref QPL_STS_DROP_BYTES_ERR
+ *    - @ref QPL_STS_NOT_SUPPORTED_MODE_ERR
+ */
+uint32_t perform_bitmap(qpl_job *job_ptr);
 /** @} */
 
 #endif // JOB_PARSER_H
@@ -75,33 +75,47 @@ uint32_t perform_find_unique(qpl_job *job_ptr,
 
     analytic_operation_result_t find_unique_result{};
 
-    switch (job_ptr->data_ptr.path) {
-        case qpl_path_hardware:
-            find_unique_result = call_find_unique<execution_path_t::hardware>(input_stream,
-                                                                              output_stream,
-                                                                              job_ptr->param_low,
-                                                                              job_ptr->param_high,
-                                                                              unpack_buffer,
-                                                                              set_buffer,
-                                                                              job_ptr->numa_id);
-            break;
-        case qpl_path_auto:
-            find_unique_result = call_find_unique<execution_path_t::auto_detect>(input_stream,
-                                                                                 output_stream,
-                                                                                 job_ptr->param_low,
-                                                                                 job_ptr->param_high,
-                                                                                 unpack_buffer,
-                                                                                 set_buffer,
-                                                                                 job_ptr->numa_id);
-            break;
-        case qpl_path_software:
-            find_unique_result = call_find_unique<execution_path_t::software>(input_stream,
-                                                                              output_stream,
-                                                                              job_ptr->param_low,
-                                                                              job_ptr->param_high,
-                                                                              unpack_buffer,
-                                                                              set_buffer);
-            break;
+    if (job_ptr->flags & QPL_FLAG_SET_LIST) {
+        if (qpl_path_hardware == job_ptr->data_ptr.path) {
+            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+        }
+
+        find_unique_result = call_find_unique_list(input_stream,
+                                                   dst_begin,
+                                                   dst_end,
+                                                   job_ptr->param_low,
+                                                   job_ptr->param_high,
+                                                   unpack_buffer,
+                                                   set_buffer);
+    } else {
+        switch (job_ptr->data_ptr.path) {
+            case qpl_path_hardware:
+                find_unique_result = call_find_unique<execution_path_t::hardware>(input_stream,
+                                                                                  output_stream,
+                                                                                  job_ptr->param_low,
+                                                                                  job_ptr->param_high,
+                                                                                  unpack_buffer,
+                                                                                  set_buffer,
+                                                                                  job_ptr->numa_id);
+                break;
+            case qpl_path_auto:
+                find_unique_result = call_find_unique<execution_path_t::auto_detect>(input_stream,
+                                                                                     output_stream,
+                                                                                     job_ptr->param_low,
+                                                                                     job_ptr->param_high,
+                                                                                     unpack_buffer,
+                                                                                     set_buffer,
+                                                                                     job_ptr->numa_id);
+                break;
+            case qpl_path_software:
+                find_unique_result = call_find_unique<execution_path_t::software>(input_stream,
+                                                                                  output_stream,
+                                                                                  job_ptr->param_low,
+                                                                                  job_ptr->param_high,
+                                                                                  unpack_buffer,
+                                                                                  set_buffer);
+                break;
+        }
     }
 
     job_ptr->total_out = find_unique_result.output_bytes_;
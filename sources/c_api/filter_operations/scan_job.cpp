@@ -4,21 +4,79 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <array>
+
 #include "analytics_state_t.h"
 #include "filter_operations.hpp"
 #include "arguments_check.hpp"
 #include "analytics/scan.hpp"
+#include "analytics/scan_predicates.hpp"
 
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstack-usage=4096"
 #endif
 
+/**
+ * @brief Moves the job of the streaming scan forward and keeps the reached position for the next job
+ */
+static inline void update_streaming_job(qpl_job *job_ptr,
+                                        own_scan_stream_t &scan_stream,
+                                        const qpl::ml::analytics::input_stream_t &input_stream,
+                                        const qpl::ml::analytics::analytic_operation_result_t &scan_result,
+                                        uint32_t elements_processed) {
+    const uint32_t bytes_consumed = input_stream.compressed_bytes_consumed();
+    const uint32_t bytes_written  = scan_result.output_bytes_;
+
+    scan_stream.elements_processed += elements_processed;
+    scan_stream.pending_bytes = input_stream.position().pending_bytes;
+    scan_stream.first_index   = scan_result.aggregates_.min_value_;
+    scan_stream.last_index    = scan_result.aggregates_.max_value_;
+    scan_stream.matches_count = scan_result.aggregates_.sum_;
+
+    job_ptr->next_in_ptr   += bytes_consumed;
+    job_ptr->available_in  -= bytes_consumed;
+    job_ptr->total_in      += bytes_consumed;
+    job_ptr->next_out_ptr  += bytes_written;
+    job_ptr->available_out -= bytes_written;
+    job_ptr->total_out     += bytes_written;
+
+    job_ptr->first_index_min_value = scan_stream.first_index;
+    job_ptr->last_index_max_value  = scan_stream.last_index;
+    job_ptr->sum_value             = scan_stream.matches_count;
+    job_ptr->last_bit_offset       = scan_result.last_bit_offset_;
+    job_ptr->crc                   = scan_result.checksums_.crc32_;
+}
+
+/**
+ * @brief Converts the program of QPL_FLAG_SCAN_PREDICATES, the job is validated, so every predicate is a scan
+ */
+static inline auto get_scan_predicates(const qpl_job *job_ptr,
+                                       qpl::ml::analytics::scan_predicate_t *predicates_ptr) -> uint32_t {
+    using namespace qpl::ml::analytics;
+
+    const auto     *program_ptr     = reinterpret_cast<const qpl_scan_predicate *>(job_ptr->next_src2_ptr);
+    const uint32_t predicates_count = job_ptr->available_src2 / sizeof(qpl_scan_predicate);
+
+    for (uint32_t i = 0u; i < predicates_count; i++) {
+        predicates_ptr[i].comparator  = static_cast<comparator_t>(program_ptr[i].op - qpl_op_scan_eq);
+        predicates_ptr[i].param_low   = program_ptr[i].param_low;
+        predicates_ptr[i].param_high  = program_ptr[i].param_high;
+        predicates_ptr[i].combination = static_cast<predicate_combination_t>(program_ptr[i].combination);
+    }
+
+    return predicates_count;
+}
+
 uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_size) {
     using namespace qpl::ml;
 
     OWN_QPL_CHECK_STATUS(qpl::job::validate_operation<qpl_op_scan_eq>(job_ptr))
 
+    if (qpl::job::is_wide_analytics(job_ptr)) {
+        return perform_wide_elements(job_ptr, buffer_ptr, buffer_size);
+    }
+
     const auto input_stream_format  = analytics::get_stream_format(job_ptr->parser);
     const auto out_bit_width_format = static_cast<analytics::output_bit_width_format_t>(job_ptr->out_bit_width);
     const auto output_stream_format = (job_ptr->flags & QPL_FLAG_OUT_BE) ? analytics::stream_format_t::be_format
@@ -37,8 +95,28 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
 
     allocation_buffer_t state_buffer(job_ptr->data_ptr.middle_layer_buffer_ptr, job_ptr->data_ptr.hw_state_ptr);
 
+    // Streaming scan continues from the position reached by the previous jobs of the stream
+    auto       &scan_stream  = analytics_state_ptr->scan_stream;
+    const bool is_streaming  = job_ptr->flags & QPL_FLAG_STREAMING_SCAN;
+    const bool is_first_part = job_ptr->flags & QPL_FLAG_FIRST;
+
+    if (is_streaming && is_first_part) {
+        scan_stream        = own_scan_stream_t{0u, 0u, UINT32_MAX, 0u, 0u};
+        job_ptr->total_in  = 0u;
+        job_ptr->total_out = 0u;
+    }
+
+    const uint32_t elements_processed = (is_streaming) ? scan_stream.elements_processed : 0u;
+
+    analytics::input_stream_t::stream_position_t stream_position{};
+    stream_position.pending_bytes         = scan_stream.pending_bytes;
+    stream_position.aggregates.min_value_ = scan_stream.first_index;
+    stream_position.aggregates.max_value_ = scan_stream.last_index;
+    stream_position.aggregates.sum_       = scan_stream.matches_count;
+    stream_position.aggregates.index_     = scan_stream.elements_processed;
+
     auto input_stream = analytics::input_stream_t::builder(src_begin, src_end)
-            .element_count(job_ptr->num_input_elements)
+            .element_count(job_ptr->num_input_elements - elements_processed)
             .omit_checksums(job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS)
             .omit_aggregates(job_ptr->flags & QPL_FLAG_OMIT_AGGREGATES)
             .ignore_bytes(job_ptr->drop_initial_bytes)
@@ -48,13 +126,15 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
                         job_ptr->ignore_end_bits)
             .decompress_buffer<execution_path_t::auto_detect>(decompress_buffer_begin, decompress_buffer_end)
             .stream_format(input_stream_format, job_ptr->src1_bit_width)
+            .resumable(is_streaming, is_first_part, job_ptr->flags & QPL_FLAG_LAST, stream_position)
             .build<execution_path_t::auto_detect>(state_buffer);
 
     auto output_stream = analytics::output_stream_t<analytics::bit_stream>::builder(dst_begin, dst_end)
             .stream_format(output_stream_format)
             .bit_format(out_bit_width_format, bit_bits_size)
             .nominal(true)
-            .initial_output_index(job_ptr->initial_output_index)
+            .ranges(job_ptr->flags & QPL_FLAG_OUT_RANGES)
+            .initial_output_index(job_ptr->initial_output_index + elements_processed)
             .build<execution_path_t::auto_detect>();
 
     auto bad_arg_status = validate_input_stream(input_stream);
@@ -66,6 +146,37 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
     limited_buffer_t temporary_buffer(buffer_ptr, buffer_ptr + buffer_size, input_stream.bit_width());
 
     analytics::analytic_operation_result_t scan_result{};
+
+    // Results of the whole program and of the current predicate are kept in the buffers of set and src2
+    if (qpl::job::is_scan_predicates(job_ptr)) {
+        std::array<analytics::scan_predicate_t, limits::max_scan_predicates> predicates{};
+
+        const uint32_t predicates_count = get_scan_predicates(job_ptr, predicates.data());
+
+        limited_buffer_t results_buffer(analytics_state_ptr->set_buf_ptr,
+                                        analytics_state_ptr->set_buf_ptr + analytics_state_ptr->set_buf_size,
+                                        byte_bits_size);
+        limited_buffer_t predicate_buffer(analytics_state_ptr->src2_buf_ptr,
+                                          analytics_state_ptr->src2_buf_ptr + analytics_state_ptr->src2_buf_size,
+                                          byte_bits_size);
+
+        scan_result = analytics::call_scan_predicates(input_stream,
+                                                      output_stream,
+                                                      predicates.data(),
+                                                      predicates_count,
+                                                      temporary_buffer,
+                                                      results_buffer,
+                                                      predicate_buffer);
+
+        job_ptr->total_out = scan_result.output_bytes_;
+
+        if (QPL_STS_OK == scan_result.status_code_) {
+            update_job(job_ptr, scan_result);
+        }
+
+        return scan_result.status_code_;
+    }
+
     switch (job_ptr->data_ptr.path) {
         case qpl_path_hardware:
             switch (job_ptr->op) {
@@ -241,6 +352,18 @@ uint32_t perform_scan(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_siz
             }
     }
 
+    if (is_streaming) {
+        if (QPL_STS_OK == scan_result.status_code_ || QPL_STS_MORE_OUTPUT_NEEDED == scan_result.status_code_) {
+            update_streaming_job(job_ptr,
+                                 scan_stream,
+                                 input_stream,
+                                 scan_result,
+                                 job_ptr->num_input_elements - elements_processed - input_stream.elements_left());
+        }
+
+        return scan_result.status_code_;
+    }
+
     job_ptr->total_out = scan_result.output_bytes_;
 
     if (QPL_STS_OK == scan_result.status_code_) {
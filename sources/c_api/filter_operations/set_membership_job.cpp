@@ -54,13 +54,6 @@ uint32_t perform_set_membership(qpl_job *job_ptr,
             .stream_format(input_stream_format, job_ptr->src1_bit_width)
             .build<execution_path_t::auto_detect>(state_buffer);
 
-    const uint32_t set_size = 1u << (input_stream.bit_width() - job_ptr->param_low - job_ptr->param_high);
-
-    auto set_stream = analytics::input_stream_t::builder(set_begin, set_end)
-            .element_count(set_size)
-            .stream_format(set_stream_format, job_ptr->src2_bit_width)
-            .build<execution_path_t::auto_detect>();
-
     auto output_stream = analytics::output_stream_t<analytics::bit_stream>::builder(dst_begin, dst_end)
             .stream_format(output_stream_format)
             .bit_format(out_bit_width_format, bit_bits_size)
@@ -80,35 +73,57 @@ uint32_t perform_set_membership(qpl_job *job_ptr,
 
     analytic_operation_result_t result{};
 
-    switch (job_ptr->data_ptr.path) {
-        case qpl_path_hardware:
-            result = call_set_membership<execution_path_t::hardware>(input_stream,
-                                                                     set_stream,
-                                                                     output_stream,
-                                                                     job_ptr->param_low,
-                                                                     job_ptr->param_high,
-                                                                     unpack_buffer,
-                                                                     set_buffer,
-                                                                     job_ptr->numa_id);
-            break;
-        case qpl_path_auto:
-            result = call_set_membership<execution_path_t::auto_detect>(input_stream,
-                                                                        set_stream,
-                                                                        output_stream,
-                                                                        job_ptr->param_low,
-                                                                        job_ptr->param_high,
-                                                                        unpack_buffer,
-                                                                        set_buffer,
-                                                                        job_ptr->numa_id);
-            break;
-        case qpl_path_software:
-            result = call_set_membership<execution_path_t::software>(input_stream,
-                                                                     set_stream,
-                                                                     output_stream,
-                                                                     job_ptr->param_low,
-                                                                     job_ptr->param_high,
-                                                                     unpack_buffer,
-                                                                     set_buffer);
+    if (job_ptr->flags & QPL_FLAG_SET_LIST) {
+        if (qpl_path_hardware == job_ptr->data_ptr.path) {
+            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+        }
+
+        result = call_set_membership_list(input_stream,
+                                          reinterpret_cast<const uint32_t *>(set_begin),
+                                          job_ptr->available_src2 / sizeof(uint32_t),
+                                          output_stream,
+                                          job_ptr->param_low,
+                                          job_ptr->param_high,
+                                          unpack_buffer,
+                                          set_buffer);
+    } else {
+        const uint32_t set_size = 1u << (input_stream.bit_width() - job_ptr->param_low - job_ptr->param_high);
+
+        auto set_stream = analytics::input_stream_t::builder(set_begin, set_end)
+                .element_count(set_size)
+                .stream_format(set_stream_format, job_ptr->src2_bit_width)
+                .build<execution_path_t::auto_detect>();
+
+        switch (job_ptr->data_ptr.path) {
+            case qpl_path_hardware:
+                result = call_set_membership<execution_path_t::hardware>(input_stream,
+                                                                         set_stream,
+                                                                         output_stream,
+                                                                         job_ptr->param_low,
+                                                                         job_ptr->param_high,
+                                                                         unpack_buffer,
+                                                                         set_buffer,
+                                                                         job_ptr->numa_id);
+                break;
+            case qpl_path_auto:
+                result = call_set_membership<execution_path_t::auto_detect>(input_stream,
+                                                                            set_stream,
+                                                                            output_stream,
+                                                                            job_ptr->param_low,
+                                                                            job_ptr->param_high,
+                                                                            unpack_buffer,
+                                                                            set_buffer,
+                                                                            job_ptr->numa_id);
+                break;
+            case qpl_path_software:
+                result = call_set_membership<execution_path_t::software>(input_stream,
+                                                                         set_stream,
+                                                                         output_stream,
+                                                                         job_ptr->param_low,
+                                                                         job_ptr->param_high,
+                                                                         unpack_buffer,
+                                                                         set_buffer);
+        }
     }
 
     job_ptr->total_out = result.output_bytes_;
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "filter_operations.hpp"
+#include "arguments_check.hpp"
+#include "analytics/wide_elements.hpp"
+
+static inline auto get_comparator(const qpl_operation operation) noexcept -> qpl::ml::analytics::comparator_t {
+    using namespace qpl::ml::analytics;
+
+    switch (operation) {
+        case qpl_op_scan_eq:
+            return comparator_t::equals;
+        case qpl_op_scan_ne:
+            return comparator_t::not_equals;
+        case qpl_op_scan_lt:
+            return comparator_t::less_than;
+        case qpl_op_scan_le:
+            return comparator_t::less_equals;
+        case qpl_op_scan_gt:
+            return comparator_t::greater_than;
+        case qpl_op_scan_ge:
+            return comparator_t::greater_equals;
+        case qpl_op_scan_range:
+            return comparator_t::in_range;
+        default:
+            return comparator_t::out_of_range;
+    }
+}
+
+uint32_t perform_wide_elements(qpl_job *job_ptr, uint8_t *buffer_ptr, uint32_t buffer_size) {
+    using namespace qpl::ml;
+    using namespace qpl::ml::analytics;
+
+    const auto input_stream_format  = get_stream_format(job_ptr->parser);
+    const auto mask_stream_format   = (job_ptr->flags & QPL_FLAG_SRC2_BE) ? stream_format_t::be_format
+                                                                          : stream_format_t::le_format;
+    const auto output_stream_format = (job_ptr->flags & QPL_FLAG_OUT_BE) ? stream_format_t::be_format
+                                                                         : stream_format_t::le_format;
+    const bool omit_aggregates      = job_ptr->flags & QPL_FLAG_OMIT_AGGREGATES;
+
+    auto *src_begin = const_cast<uint8_t *>(job_ptr->next_in_ptr);
+    auto *src_end   = const_cast<uint8_t *>(job_ptr->next_in_ptr + job_ptr->available_in);
+    auto *dst_begin = const_cast<uint8_t *>(job_ptr->next_out_ptr);
+    auto *dst_end   = const_cast<uint8_t *>(job_ptr->next_out_ptr + job_ptr->available_out);
+
+    wide_stream_t input_stream(src_begin,
+                               src_end,
+                               job_ptr->src1_bit_width,
+                               input_stream_format,
+                               job_ptr->drop_initial_bytes);
+
+    wide_operation_result_t result{};
+
+    if (qpl::job::is_scan(job_ptr)) {
+        const auto out_bit_width_format = static_cast<output_bit_width_format_t>(job_ptr->out_bit_width);
+
+        auto output_stream = output_stream_t<bit_stream>::builder(dst_begin, dst_end)
+                .stream_format(output_stream_format)
+                .bit_format(out_bit_width_format, bit_bits_size)
+                .nominal(true)
+                .ranges(job_ptr->flags & QPL_FLAG_OUT_RANGES)
+                .initial_output_index(job_ptr->initial_output_index)
+                .build<execution_path_t::software>();
+
+        limited_buffer_t temporary_buffer(buffer_ptr, buffer_ptr + buffer_size, byte_bits_size);
+
+        result = call_wide_scan(get_comparator(job_ptr->op),
+                                input_stream,
+                                job_ptr->num_input_elements,
+                                output_stream,
+                                job_ptr->param_low_64,
+                                job_ptr->param_high_64,
+                                temporary_buffer,
+                                omit_aggregates);
+    } else {
+        wide_output_stream_t output_stream(dst_begin, dst_end, job_ptr->src1_bit_width, output_stream_format);
+
+        switch (job_ptr->op) {
+            case qpl_op_extract: {
+                result = call_wide_extract(input_stream,
+                                           job_ptr->num_input_elements,
+                                           output_stream,
+                                           job_ptr->param_low,
+                                           job_ptr->param_high,
+                                           omit_aggregates);
+                break;
+            }
+            case qpl_op_select: {
+                result = call_wide_select(input_stream,
+                                          job_ptr->next_src2_ptr,
+                                          mask_stream_format,
+                                          job_ptr->num_input_elements,
+                                          output_stream,
+                                          omit_aggregates);
+                break;
+            }
+            case qpl_op_expand: {
+                result = call_wide_expand(input_stream,
+                                          job_ptr->next_src2_ptr,
+                                          mask_stream_format,
+                                          job_ptr->num_input_elements,
+                                          output_stream,
+                                          omit_aggregates);
+                break;
+            }
+            default: {
+                result.status_code_ = QPL_STS_OPERATION_ERR;
+                break;
+            }
+        }
+    }
+
+    job_ptr->total_out = result.output_bytes_;
+
+    if (QPL_STS_OK == result.status_code_) {
+        if (!(job_ptr->flags & QPL_FLAG_OMIT_CHECKSUMS)) {
+            result.checksums_ = calculate_wide_checksums(input_stream, job_ptr->flags & QPL_FLAG_CRC32C);
+        }
+
+        update_job(job_ptr, result);
+
+        job_ptr->first_index_min_value_64 = result.wide_aggregates_.min_value_;
+        job_ptr->last_index_max_value_64  = result.wide_aggregates_.max_value_;
+        job_ptr->sum_value_64             = result.wide_aggregates_.sum_;
+    }
+
+    return result.status_code_;
+}
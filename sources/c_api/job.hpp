@@ -48,6 +48,32 @@ static inline auto get_state(const qpl_job *const job_ptr) noexcept {
     return job_ptr->data_ptr.hw_state_ptr;
 }
 
+static inline auto get_operation_class(const qpl_job *const job_ptr) noexcept -> qpl_operation_class {
+    switch (job_ptr->op) {
+        case qpl_op_compress: {
+            return qpl_op_class_compress;
+        }
+        case qpl_op_decompress: {
+            return qpl_op_class_decompress;
+        }
+        case qpl_op_memcpy:
+        case qpl_op_crc64:
+        case qpl_op_z_decompress32:
+        case qpl_op_z_decompress16:
+        case qpl_op_z_compress32:
+        case qpl_op_z_compress16: {
+            return qpl_op_class_other;
+        }
+        default: {
+            return qpl_op_class_analytics;
+        }
+    }
+}
+
+static inline bool is_operation_class_reserved(const qpl_job *const job_ptr) noexcept {
+    return job_ptr->data_ptr.op_classes & get_operation_class(job_ptr);
+}
+
 static inline bool is_indexing_enabled(const qpl_job *const job_ptr) noexcept {
     return job_ptr->mini_block_size;
 }
@@ -57,7 +83,7 @@ static inline bool is_dictionary(const qpl_job *const job_ptr) noexcept {
 }
 
 static inline bool is_high_level_compression(const qpl_job *const job_ptr) noexcept{
-    return (qpl_op_compress == job_ptr->op) && (qpl_high_level == job_ptr->level);
+    return (qpl_op_compress == job_ptr->op) && (qpl_default_level != job_ptr->level);
 }
 
 static inline bool is_canned_mode_compression(const qpl_job *const job_ptr) noexcept {
@@ -103,12 +129,58 @@ static inline bool is_extract(const qpl_job *const job_ptr) noexcept {
     return qpl_op_extract == job_ptr->op;
 }
 
+static inline bool is_set_membership(const qpl_job *const job_ptr) noexcept {
+    return qpl_op_set_membership == job_ptr->op;
+}
+
 static inline bool is_find_unique(const qpl_job *const job_ptr) noexcept {
     return qpl_op_find_unique == job_ptr->op;
 }
 
 static inline bool is_scan(const qpl_job *const job_ptr) noexcept {
-    return qpl_op_scan_eq <= job_ptr->op;
+    return qpl_op_scan_eq <= job_ptr->op && job_ptr->op <= qpl_op_scan_not_range;
+}
+
+static inline bool is_bitmap(const qpl_job *const job_ptr) noexcept {
+    return qpl_op_bitmap_and <= job_ptr->op && job_ptr->op <= qpl_op_bitmap_count;
+}
+
+static inline bool is_streaming_scan(const qpl_job *const job_ptr) noexcept {
+    return is_scan(job_ptr) && (QPL_FLAG_STREAMING_SCAN & job_ptr->flags);
+}
+
+static inline bool is_range_encoded_scan(const qpl_job *const job_ptr) noexcept {
+    return is_scan(job_ptr) && (QPL_FLAG_OUT_RANGES & job_ptr->flags);
+}
+
+static inline bool is_scan_predicates(const qpl_job *const job_ptr) noexcept {
+    return is_scan(job_ptr) && (QPL_FLAG_SCAN_PREDICATES & job_ptr->flags);
+}
+
+static inline bool is_set_list(const qpl_job *const job_ptr) noexcept {
+    return (is_set_membership(job_ptr) || is_find_unique(job_ptr)) && (QPL_FLAG_SET_LIST & job_ptr->flags);
+}
+
+/**
+ * @brief Returns true for analytics operations over uncompressed packed arrays of elements of 33-64 bits
+ */
+static inline bool is_wide_analytics(const qpl_job *const job_ptr) noexcept {
+    const bool is_wide_operation = is_scan(job_ptr) || is_extract(job_ptr)
+                                   || qpl_op_select == job_ptr->op || qpl_op_expand == job_ptr->op;
+
+    const bool is_wide_bit_width = job_ptr->src1_bit_width > ml::limits::max_bit_width
+                                   && job_ptr->src1_bit_width <= ml::limits::max_wide_bit_width;
+
+    return is_wide_operation && is_wide_bit_width
+           && qpl_p_parquet_rle != job_ptr->parser && !(QPL_FLAG_DECOMPRESS_ENABLE & job_ptr->flags);
+}
+
+/**
+ * @brief Returns true for the modes of operations that are implemented on the software path only
+ */
+static inline bool is_software_only(const qpl_job *const job_ptr) noexcept {
+    return is_streaming_scan(job_ptr) || is_range_encoded_scan(job_ptr) || is_scan_predicates(job_ptr)
+           || is_wide_analytics(job_ptr) || is_bitmap(job_ptr) || is_set_list(job_ptr);
 }
 
 static inline bool is_rle_burst(const qpl_job *const job_ptr) noexcept {
@@ -123,10 +195,6 @@ static inline bool is_expand(const qpl_job *const job_ptr) noexcept {
     return qpl_op_expand == job_ptr->op;
 }
 
-static inline bool is_set_membership(const qpl_job *const job_ptr) noexcept {
-    return qpl_op_set_membership == job_ptr->op;
-}
-
 static inline bool is_copy(const qpl_job *const job_ptr) noexcept {
     return qpl_op_memcpy == job_ptr->op;
 }
@@ -154,10 +222,50 @@ static inline bool is_verification_supported(const qpl_job *const qpl_job_ptr) n
     return stream_should_be_verified;
 }
 
+static inline bool is_stream_start(const qpl_job *const qpl_job_ptr) noexcept {
+    return qpl_op_compress == qpl_job_ptr->op && (qpl_job_ptr->flags & QPL_FLAG_FIRST);
+}
+
+/**
+ * @brief Decides whether the compression stream started by the job is verified, is called before each submission
+ *
+ * The decision depends on the number of accepted streams only, so a rejected submission that is retried
+ * gets the same decision.
+ */
+static inline void sample_stream_verification(qpl_job *const qpl_job_ptr) noexcept {
+    if (!is_stream_start(qpl_job_ptr)) {
+        return;
+    }
+
+    auto &data = qpl_job_ptr->data_ptr;
+
+    const uint32_t period = qpl_job_ptr->verify_sample_period;
+
+    data.is_stream_verified = (period <= 1u || 0u == data.verify_stream_count % period) ? 1u : 0u;
+}
+
+/**
+ * @brief Counts the compression stream started by the job, is called once its submission is accepted
+ */
+static inline void count_sampled_stream(qpl_job *const qpl_job_ptr) noexcept {
+    if (is_stream_start(qpl_job_ptr)) {
+        qpl_job_ptr->data_ptr.verify_stream_count++;
+    }
+}
+
+static inline bool is_verification_required(const qpl_job *const qpl_job_ptr) noexcept {
+    if (qpl_job_ptr->flags & QPL_FLAG_OMIT_VERIFY) {
+        return false;
+    }
+
+    return !(qpl_job_ptr->flags & QPL_FLAG_VERIFY_SAMPLED) || qpl_job_ptr->data_ptr.is_stream_verified;
+}
+
 static inline bool hardware_supported(const qpl_job *const qpl_ptr) {
     return ((qpl_path_hardware == qpl_ptr->data_ptr.path || qpl_path_auto == qpl_ptr->data_ptr.path)
             && !is_high_level_compression(qpl_ptr)
-            && !is_zlib_flag_set(qpl_ptr));
+            && !is_zlib_flag_set(qpl_ptr)
+            && !is_software_only(qpl_ptr));
 }
 
 // ------ JOB SETTERS ------ //
@@ -9,9 +9,13 @@
  *  Job API (public C API)
  */
 
+#include <memory>
+#include <new>
+
 // C_API headers
 #include "qpl/qpl.h"
 #include "job.hpp"
+#include "async_sw_job.hpp"
 #include "compression_operations/compressor.hpp"
 #include "filter_operations/filter_operations.hpp"
 #include "filter_operations/analytics_state_t.h"
@@ -20,7 +24,10 @@
 #include "other_operations/copy.hpp"
 
 // Middle layer headers
+#include "util/awaiter.hpp"
+#include "util/checkers.hpp"
 #include "util/checksum.hpp"
+#include "util/executor.hpp"
 
 // Legacy
 #include "own_defs.h"
@@ -29,60 +36,19 @@
 
 //#define KEEP_DESCRIPTOR_ENABLED
 
-QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
-    using namespace qpl;
+namespace {
 
-    QPL_BAD_PTR_RET(qpl_job_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->next_in_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.compress_state_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.decompress_state_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.analytics_state_ptr);
-    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.hw_state_ptr);
-    QPL_BAD_OP_RET(qpl_job_ptr->op);
+/**
+ * @brief Processes the job on the software path, is called inline or by the software path executor
+ */
+auto execute_sw_job(qpl_job *qpl_job_ptr) noexcept -> qpl_status {
+    using namespace qpl;
 
     uint32_t status = QPL_STS_OK;
 
-    qpl_path_t path = qpl_job_ptr->data_ptr.path;
-
-    if (qpl_path_hardware == path) {
-        if ((qpl_op_compress == qpl_job_ptr->op) && (qpl_high_level == qpl_job_ptr->level)) {
-            return QPL_STD_UNSUPPORTED_COMPRESSION_LEVEL;
-        }
-        if (QPL_FLAG_ZLIB_MODE & qpl_job_ptr->flags) {
-            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
-        }
-    }
-
-    if (qpl_path_hardware == qpl_job_ptr->data_ptr.path || qpl_path_auto == qpl_job_ptr->data_ptr.path) {
-#if defined(KEEP_DESCRIPTOR_ENABLED)
-        auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
-
-        if (state_ptr->descriptor_not_submitted) {
-            status = hw_enqueue_descriptor(&state_ptr->desc_ptr, qpl_job_ptr->numa_id);
-
-            if (status == QPL_STS_OK) {
-                state_ptr->descriptor_not_submitted = false;
-            }
-
-            return static_cast<qpl_status>(status);
-        }
-#endif
-
-        status = hw_submit_job(qpl_job_ptr);
-
-#if defined(KEEP_DESCRIPTOR_ENABLED)
-        if (status == QPL_STS_QUEUES_ARE_BUSY_ERR && qpl_path_hardware == qpl_job_ptr->data_ptr.path) {
-            state_ptr->descriptor_not_submitted = true;
-        }
-#endif
-
-        // Call SW-path fallback in case if HW limits are exceeded
-        if (status != QPL_STS_OK && qpl_job_ptr->data_ptr.path == qpl_path_auto) {
-            qpl_job_ptr->data_ptr.path = qpl_path_software;
-        } else {
-            return static_cast<qpl_status>(status);
-        }
-    }
+    // Auto path job that is rejected by the accelerator is processed as a software one
+    const qpl_path_t path = qpl_job_ptr->data_ptr.path;
+    qpl_job_ptr->data_ptr.path = qpl_path_software;
 
     qpl_job_ptr->first_index_min_value = UINT32_MAX;
 
@@ -136,8 +102,7 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
         case qpl_op_extract: {
             if (qpl_job_ptr->param_low > qpl_job_ptr->param_high) {
                 qpl_job_ptr->first_index_min_value = 0u;
-
-                return QPL_STS_OK;
+                break;
             }
 
             status = perform_extract(qpl_job_ptr,
@@ -191,6 +156,15 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
                                        analytics_state_ptr->src2_buf_ptr,
                                        analytics_state_ptr->src2_buf_size);
             break;
+        }
+        case qpl_op_bitmap_and:
+        case qpl_op_bitmap_or:
+        case qpl_op_bitmap_xor:
+        case qpl_op_bitmap_and_not:
+        case qpl_op_bitmap_not:
+        case qpl_op_bitmap_count: {
+            status = perform_bitmap(qpl_job_ptr);
+            break;
         } //filter operations
         default: {
             status = QPL_STS_OPERATION_ERR;
@@ -202,24 +176,129 @@ QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
     return static_cast<qpl_status>(status);
 }
 
-QPL_FUN("C" qpl_status, qpl_check_job, (qpl_job *qpl_job_ptr)) {
+/**
+ * @brief Checks the job before submission, the same for single jobs and batches
+ */
+auto validate_submission(const qpl_job *qpl_job_ptr) noexcept -> qpl_status {
+    using namespace qpl;
+
     QPL_BAD_PTR_RET(qpl_job_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->next_in_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.compress_state_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.decompress_state_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.analytics_state_ptr);
+    QPL_BAD_PTR_RET(qpl_job_ptr->data_ptr.hw_state_ptr);
+    QPL_BAD_OP_RET(qpl_job_ptr->op);
+    QPL_BADARG_RET(!job::is_operation_class_reserved(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
+
+    if (qpl_path_hardware == qpl_job_ptr->data_ptr.path) {
+        if ((qpl_op_compress == qpl_job_ptr->op) && (qpl_default_level != qpl_job_ptr->level)) {
+            return QPL_STD_UNSUPPORTED_COMPRESSION_LEVEL;
+        }
+        if ((QPL_FLAG_ZLIB_MODE & qpl_job_ptr->flags) || job::is_software_only(qpl_job_ptr)) {
+            return QPL_STS_NOT_SUPPORTED_MODE_ERR;
+        }
+    }
+
+    return QPL_STS_OK;
+}
+
+/**
+ * @brief Submits the job to the accelerator or to the software path executor
+ *
+ * @param  is_blocking  if true, software path job is processed inline
+ */
+auto submit_job(qpl_job *qpl_job_ptr, bool is_blocking) noexcept -> qpl_status {
+    using namespace qpl;
+
+    OWN_QPL_CHECK_STATUS(validate_submission(qpl_job_ptr))
+
     uint32_t status = QPL_STS_OK;
 
-    if (qpl::job::hardware_supported(qpl_job_ptr)) {
-        status = hw_check_job(qpl_job_ptr);
+    const bool is_hw_capable = !job::is_software_only(qpl_job_ptr);
+
+    if (is_hw_capable &&
+        (qpl_path_hardware == qpl_job_ptr->data_ptr.path || qpl_path_auto == qpl_job_ptr->data_ptr.path)) {
+#if defined(KEEP_DESCRIPTOR_ENABLED)
+        auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
+
+        if (state_ptr->descriptor_not_submitted) {
+            status = hw_enqueue_descriptor(&state_ptr->desc_ptr, qpl_job_ptr->numa_id, &state_ptr->queue_tag);
+
+            if (status == QPL_STS_OK) {
+                state_ptr->descriptor_not_submitted = false;
+            }
+
+            return static_cast<qpl_status>(status);
+        }
+#endif
+
+        status = hw_submit_job(qpl_job_ptr);
+
+#if defined(KEEP_DESCRIPTOR_ENABLED)
+        if (status == QPL_STS_QUEUES_ARE_BUSY_ERR && qpl_path_hardware == qpl_job_ptr->data_ptr.path) {
+            state_ptr->descriptor_not_submitted = true;
+        }
+#endif
+
+        // Call SW-path fallback in case if HW limits are exceeded
+        if (status == QPL_STS_OK || qpl_job_ptr->data_ptr.path != qpl_path_auto) {
+            return static_cast<qpl_status>(status);
+        }
     }
 
-    return static_cast<qpl_status>(status);
+    if (is_blocking) {
+        return execute_sw_job(qpl_job_ptr);
+    }
+
+    return job::submit_sw_job(qpl_job_ptr, execute_sw_job);
 }
 
-QPL_FUN("C" qpl_status, qpl_wait_job, (qpl_job *qpl_job_ptr)) {
-    QPL_BAD_PTR_RET(qpl_job_ptr);
+/**
+ * @brief Converts the public wait policy, its mode must not be qpl_wait_default
+ */
+auto to_ml_wait_policy(const qpl_wait_policy &policy) noexcept -> qpl::ml::wait_policy_t {
+    qpl::ml::wait_policy_t result;
+
+    result.mode       = static_cast<qpl::ml::wait_mode_t>(policy.mode - qpl_wait_spin);
+    result.spin_count = policy.spin_count;
+    result.timeout_ns = policy.timeout_ns;
+
+    return result;
+}
+
+/**
+ * @brief Returns the job wait policy, or the library-wide one if the job has none
+ */
+auto get_wait_policy(const qpl_job *qpl_job_ptr) noexcept -> qpl::ml::wait_policy_t {
+    const auto &job_policy = qpl_job_ptr->data_ptr.wait_policy;
+
+    return (qpl_wait_default == job_policy.mode) ? qpl::ml::get_wait_policy() : to_ml_wait_policy(job_policy);
+}
+
+/**
+ * @brief Waits for the job with its wait policy till the deadline, the timeout of the policy is not used
+ */
+auto wait_job(qpl_job *qpl_job_ptr, qpl::ml::wait_deadline_t deadline) noexcept -> qpl_status {
+    using namespace qpl;
+
+    const auto policy = get_wait_policy(qpl_job_ptr);
+
+    if (job::is_sw_job_submitted(qpl_job_ptr)) {
+        return job::wait_sw_job(qpl_job_ptr, deadline);
+    }
 
     uint32_t status = QPL_STS_OK;
-    // HW path doesn't support qpl_high_level compression ratio and ZLIB headers/trailers
-    if (qpl::job::hardware_supported(qpl_job_ptr)) {
+    // HW path supports qpl_default_level compression only and doesn't support ZLIB headers/trailers
+    if (job::hardware_supported(qpl_job_ptr)) {
+        auto *state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
+
+        // Check may resubmit the job (verification, large buffers), so the record is awaited again
         do {
+            if (!ml::awaiter::wait_for(&state_ptr->comp_ptr.status, 0u, policy, deadline)) {
+                return QPL_STS_WAIT_TIMEOUT;
+            }
+
             status = hw_check_job(qpl_job_ptr);
         } while (QPL_STS_BEING_PROCESSED == status);
     }
@@ -227,10 +306,30 @@ QPL_FUN("C" qpl_status, qpl_wait_job, (qpl_job *qpl_job_ptr)) {
     return static_cast<qpl_status>(status);
 }
 
-QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
-    using namespace qpl;
+/**
+ * @brief Folds statuses of the batch: QPL_STS_BEING_PROCESSED while any job is, the first error after that
+ */
+auto get_batch_status(const qpl_status *statuses_ptr, uint32_t jobs_count) noexcept -> qpl_status {
+    qpl_status result = QPL_STS_OK;
 
-    QPL_BAD_PTR_RET(qpl_job_ptr);
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        if (QPL_STS_BEING_PROCESSED == statuses_ptr[i]) {
+            return QPL_STS_BEING_PROCESSED;
+        }
+
+        if (QPL_STS_OK == result) {
+            result = statuses_ptr[i];
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Processes the job synchronously on the path it was initialized for
+ */
+auto execute_job(qpl_job *qpl_job_ptr) noexcept -> qpl_status {
+    using namespace qpl;
 
     if (job::hardware_supported(qpl_job_ptr)) {
         auto *const analytics_state_ptr = reinterpret_cast<own_analytics_state_t *>(qpl_job_ptr->data_ptr.analytics_state_ptr);
@@ -312,8 +411,218 @@ QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
 
         qpl_status status = hw_submit_job(qpl_job_ptr);
 
-        return (QPL_STS_OK == status) ? qpl_wait_job(qpl_job_ptr) : status;
+        return (QPL_STS_OK == status) ? wait_job(qpl_job_ptr, qpl::ml::wait_deadline_t::max()) : status;
+    }
+
+    return submit_job(qpl_job_ptr, true);
+}
+
+} // anonymous namespace
+
+QPL_FUN("C" qpl_status, qpl_submit_job, (qpl_job * qpl_job_ptr)) {
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+
+    qpl::job::sample_stream_verification(qpl_job_ptr);
+
+    const auto status = submit_job(qpl_job_ptr, false);
+
+    if (QPL_STS_OK == status) {
+        qpl::job::count_sampled_stream(qpl_job_ptr);
+    }
+
+    return status;
+}
+
+QPL_FUN("C" qpl_status, qpl_check_job, (qpl_job *qpl_job_ptr)) {
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+    uint32_t status = QPL_STS_OK;
+
+    if (qpl::job::is_sw_job_submitted(qpl_job_ptr)) {
+        return qpl::job::check_sw_job(qpl_job_ptr);
+    }
+
+    if (qpl::job::hardware_supported(qpl_job_ptr)) {
+        status = hw_check_job(qpl_job_ptr);
     }
 
-    return qpl_submit_job(qpl_job_ptr);
+    return static_cast<qpl_status>(status);
+}
+
+QPL_FUN("C" qpl_status, qpl_wait_job, (qpl_job *qpl_job_ptr)) {
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+
+    return wait_job(qpl_job_ptr, qpl::ml::make_wait_deadline(get_wait_policy(qpl_job_ptr)));
+}
+
+QPL_FUN("C" qpl_status, qpl_submit_batch, (qpl_job **jobs_ptr, uint32_t jobs_count)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(jobs_ptr);
+    QPL_BADARG_RET(0u == jobs_count, QPL_STS_SIZE_ERR);
+
+    // Software jobs are gathered at the beginning, accelerator ones at the end
+    std::unique_ptr<qpl_job *[]> submitted_jobs(new (std::nothrow) qpl_job *[jobs_count]);
+    std::unique_ptr<bool[]>      is_hw_job(new (std::nothrow) bool[jobs_count]);
+    QPL_BADARG_RET(nullptr == submitted_jobs || nullptr == is_hw_job, QPL_STS_NO_MEM_ERR);
+
+    // The whole batch is validated before any of its jobs is submitted, the accelerator limits are checked here
+    // as well, so a hardware path job can't reject the batch after others are enqueued
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        auto *job_ptr = jobs_ptr[i];
+
+        OWN_QPL_CHECK_STATUS(validate_submission(job_ptr))
+
+        is_hw_job[i] = !job::is_software_only(job_ptr) &&
+                       (qpl_path_hardware == job_ptr->data_ptr.path || qpl_path_auto == job_ptr->data_ptr.path);
+
+        if (is_hw_job[i]) {
+            const auto hw_status = hw_validate_job(job_ptr);
+
+            // Auto path jobs the accelerator can't process go to the software group
+            if (QPL_STS_OK != hw_status && qpl_path_auto != job_ptr->data_ptr.path) {
+                return hw_status;
+            }
+
+            is_hw_job[i] = (QPL_STS_OK == hw_status);
+        }
+    }
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        job::sample_stream_verification(jobs_ptr[i]);
+    }
+
+    uint32_t   sw_jobs_count = 0u;
+    uint32_t   hw_jobs_count = 0u;
+    qpl_status status        = QPL_STS_OK;
+
+    // Accelerator jobs are enqueued one after another, rejected auto path jobs are moved to the software group
+    for (uint32_t i = 0u; i < jobs_count && QPL_STS_OK == status; i++) {
+        auto *job_ptr = jobs_ptr[i];
+
+        if (is_hw_job[i]) {
+            status = hw_submit_validated_job(job_ptr);
+
+            if (QPL_STS_OK == status) {
+                submitted_jobs[jobs_count - ++hw_jobs_count] = job_ptr;
+                continue;
+            }
+
+            if (qpl_path_auto != job_ptr->data_ptr.path) {
+                break;
+            }
+
+            status = QPL_STS_OK;
+        }
+
+        submitted_jobs[sw_jobs_count++] = job_ptr;
+    }
+
+    if (QPL_STS_OK == status && 0u != sw_jobs_count) {
+        status = job::submit_sw_jobs(submitted_jobs.get(), sw_jobs_count, execute_sw_job);
+    }
+
+    if (QPL_STS_OK != status) {
+        // Nothing stays in flight if the batch is rejected
+        for (uint32_t i = jobs_count - hw_jobs_count; i < jobs_count; i++) {
+            wait_job(submitted_jobs[i], ml::wait_deadline_t::max());
+        }
+
+        return status;
+    }
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        job::count_sampled_stream(jobs_ptr[i]);
+    }
+
+    return status;
+}
+
+QPL_FUN("C" qpl_status, qpl_check_batch, (qpl_job **jobs_ptr, uint32_t jobs_count, qpl_status *statuses_ptr)) {
+    QPL_BAD_PTR2_RET(jobs_ptr, statuses_ptr);
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        if (QPL_STS_BEING_PROCESSED == statuses_ptr[i]) {
+            statuses_ptr[i] = qpl_check_job(jobs_ptr[i]);
+        }
+    }
+
+    return get_batch_status(statuses_ptr, jobs_count);
+}
+
+QPL_FUN("C" qpl_status, qpl_wait_batch, (qpl_job **jobs_ptr, uint32_t jobs_count, qpl_status *statuses_ptr)) {
+    QPL_BAD_PTR2_RET(jobs_ptr, statuses_ptr);
+
+    if (0u == jobs_count) {
+        return QPL_STS_OK;
+    }
+
+    // Jobs that are completed after the deadline are still taken, the rest stay in flight
+    const auto deadline = qpl::ml::make_wait_deadline(get_wait_policy(jobs_ptr[0]));
+    bool is_timed_out   = false;
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        if (QPL_STS_BEING_PROCESSED != statuses_ptr[i]) {
+            continue;
+        }
+
+        const auto status = wait_job(jobs_ptr[i], deadline);
+
+        if (QPL_STS_WAIT_TIMEOUT == status) {
+            is_timed_out = true;
+        } else {
+            statuses_ptr[i] = status;
+        }
+    }
+
+    return is_timed_out ? QPL_STS_WAIT_TIMEOUT : get_batch_status(statuses_ptr, jobs_count);
+}
+
+QPL_FUN("C" qpl_status, qpl_execute_job, (qpl_job * qpl_job_ptr)) {
+    using namespace qpl;
+
+    QPL_BAD_PTR_RET(qpl_job_ptr);
+    QPL_BADARG_RET(!job::is_operation_class_reserved(qpl_job_ptr), QPL_STS_BAD_JOB_STRUCT_ERR);
+
+    job::sample_stream_verification(qpl_job_ptr);
+
+    const auto status = execute_job(qpl_job_ptr);
+
+    if (QPL_STS_OK == status) {
+        job::count_sampled_stream(qpl_job_ptr);
+    }
+
+    return status;
+}
+
+QPL_FUN("C" qpl_status, qpl_configure_sw_executor, (uint32_t threads_count,
+                                                     const uint32_t *cpu_ids_ptr,
+                                                     uint32_t cpu_ids_count)) {
+    QPL_BADARG_RET(0u != cpu_ids_count && nullptr == cpu_ids_ptr, QPL_STS_NULL_PTR_ERR);
+
+    return static_cast<qpl_status>(qpl::ml::util::configure_executor(threads_count, cpu_ids_ptr, cpu_ids_count));
+}
+
+QPL_FUN("C" qpl_status, qpl_set_wait_policy, (const qpl_wait_policy *policy_ptr)) {
+    QPL_BAD_PTR_RET(policy_ptr);
+
+    if (qpl_wait_default == policy_ptr->mode) {
+        qpl::ml::set_wait_policy(qpl::ml::get_default_wait_policy());
+
+        return QPL_STS_OK;
+    }
+
+    QPL_BADARG_RET(qpl_wait_yield < policy_ptr->mode, QPL_STS_INVALID_PARAM_ERR);
+
+    qpl::ml::set_wait_policy(to_ml_wait_policy(*policy_ptr));
+
+    return QPL_STS_OK;
+}
+
+QPL_FUN("C" qpl_status, qpl_set_job_wait_policy, (qpl_job *qpl_job_ptr, const qpl_wait_policy *policy_ptr)) {
+    QPL_BAD_PTR2_RET(qpl_job_ptr, policy_ptr);
+    QPL_BADARG_RET(qpl_wait_yield < policy_ptr->mode, QPL_STS_INVALID_PARAM_ERR);
+
+    qpl_job_ptr->data_ptr.wait_policy = *policy_ptr;
+
+    return QPL_STS_OK;
 }
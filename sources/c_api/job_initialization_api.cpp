@@ -9,9 +9,16 @@
  *  Job API (public C API)
  */
 
+#include <algorithm>
+
 #include "qpl/qpl.h"
+#include "async_sw_job.hpp"
 #include "util/memory.hpp"
+#include "util/descriptor_processing.hpp"
+#include "util/executor.hpp"
 #include "compression/verification/verification_state.hpp"
+#include "compression/inflate/inflate_state.hpp"
+#include "compression/huffman_only/huffman_only_decompression_state.hpp"
 
 // Legacy
 #include "own_defs.h"
@@ -32,35 +39,87 @@ QPL_INLINE uint32_t own_get_job_size_decompress();
 QPL_INLINE uint32_t own_get_job_size_compress();
 QPL_INLINE uint32_t own_get_job_size_analytics();
 uint32_t own_get_job_size_middle_layer_buffer();
+QPL_INLINE uint32_t own_get_job_size_inflate_buffer();
+
+/**
+ * @brief Sizes of the job regions reserved for the given operation classes
+ */
+typedef struct {
+    uint32_t comp_size;
+    uint32_t decomp_size;
+    uint32_t analytics_size;
+    uint32_t middle_layer_buffer_size;
+    uint32_t hw_size;
+} own_job_layout_t;
+
+QPL_INLINE own_job_layout_t own_get_job_layout(qpl_path_t qpl_path, uint32_t op_classes) {
+    own_job_layout_t layout = {0u, 0u, 0u, 0u, 0u};
+
+    if (op_classes & qpl_op_class_compress) {
+        // Compression allocates its state across all regions, so full layout is kept
+        layout.comp_size                = QPL_ALIGNED_SIZE(own_get_job_size_compress(), QPL_DEFAULT_ALIGNMENT);
+        layout.decomp_size              = QPL_ALIGNED_SIZE(own_get_job_size_decompress(), QPL_DEFAULT_ALIGNMENT);
+        layout.analytics_size           = QPL_ALIGNED_SIZE(own_get_job_size_analytics(), QPL_DEFAULT_ALIGNMENT);
+        layout.middle_layer_buffer_size = QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(),
+                                                           QPL_DEFAULT_ALIGNMENT);
+        layout.hw_size                  = QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
+
+        return layout;
+    }
+
+    if (op_classes & qpl_op_class_analytics) {
+        layout.analytics_size = QPL_ALIGNED_SIZE(own_get_job_size_analytics(), QPL_DEFAULT_ALIGNMENT);
+    }
+
+    // Decompression and analytics on compressed input need an inflate state only
+    if (op_classes & (qpl_op_class_analytics | qpl_op_class_decompress)) {
+        layout.middle_layer_buffer_size = QPL_ALIGNED_SIZE(own_get_job_size_inflate_buffer(), QPL_DEFAULT_ALIGNMENT);
+    }
+
+    if (qpl_path_software != qpl_path) {
+        layout.hw_size = QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
+    }
+
+    return layout;
+}
 
 QPL_FUN(qpl_status, qpl_get_job_size, (qpl_path_t qpl_path, uint32_t *job_size_ptr)) {
+    return qpl_get_job_size_for_class(qpl_path, qpl_op_class_all, job_size_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_get_job_size_for_class, (qpl_path_t qpl_path, uint32_t op_classes, uint32_t *job_size_ptr)) {
     QPL_BAD_PTR_RET(job_size_ptr);
     QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BADARG_RET (0u == op_classes || (op_classes & ~qpl_op_class_all), QPL_STS_OPERATION_ERR);
+
+    const own_job_layout_t layout = own_get_job_layout(qpl_path, op_classes);
 
     // qpl_job_ptr can have any alignment - therefore need additional bytes to align ptr
     *job_size_ptr = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT) + QPL_DEFAULT_ALIGNMENT;
 
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_compress(), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_decompress(), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_analytics(), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(), QPL_DEFAULT_ALIGNMENT);
-    *job_size_ptr += QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
+    *job_size_ptr += layout.comp_size;
+    *job_size_ptr += layout.decomp_size;
+    *job_size_ptr += layout.analytics_size;
+    *job_size_ptr += layout.middle_layer_buffer_size;
+    *job_size_ptr += layout.hw_size;
 
     return QPL_STS_OK;
 }
 
 QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
+    return qpl_init_job_for_class(qpl_path, qpl_op_class_all, qpl_job_ptr);
+}
+
+QPL_FUN(qpl_status, qpl_init_job_for_class, (qpl_path_t qpl_path, uint32_t op_classes, qpl_job *qpl_job_ptr)) {
     using namespace qpl::ml;
 
     QPL_BADARG_RET (qpl_path_auto > qpl_path || qpl_path_software < qpl_path, QPL_STS_PATH_ERR);
+    QPL_BADARG_RET (0u == op_classes || (op_classes & ~qpl_op_class_all), QPL_STS_OPERATION_ERR);
     QPL_BAD_PTR_RET(qpl_job_ptr);
 
-    uint32_t       status                   = QPL_STS_OK;
-    const uint32_t decomp_size              = QPL_ALIGNED_SIZE(own_get_job_size_decompress(), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t comp_size                = QPL_ALIGNED_SIZE(own_get_job_size_compress(), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t analytics_size           = QPL_ALIGNED_SIZE(own_get_job_size_analytics(), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t middle_layer_buffer_size = QPL_ALIGNED_SIZE(own_get_job_size_middle_layer_buffer(), QPL_DEFAULT_ALIGNMENT);
-    const uint32_t job_size                 = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT);
+    uint32_t               status   = QPL_STS_OK;
+    const own_job_layout_t layout   = own_get_job_layout(qpl_path, op_classes);
+    const uint32_t         job_size = QPL_ALIGNED_SIZE(sizeof(qpl_job), QPL_DEFAULT_ALIGNMENT);
 
     util::set_zeros((uint8_t *) qpl_job_ptr, job_size);
 
@@ -68,20 +127,21 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
     // qpl_job_ptr can have any alignment - therefore need to align ptr
     qpl_job_ptr->data_ptr.compress_state_ptr =
             (uint8_t *) QPL_ALIGNED_PTR(((uint8_t *) qpl_job_ptr), QPL_DEFAULT_ALIGNMENT) + job_size;
-    qpl_job_ptr->data_ptr.decompress_state_ptr    = qpl_job_ptr->data_ptr.compress_state_ptr + comp_size;
-    qpl_job_ptr->data_ptr.analytics_state_ptr     = qpl_job_ptr->data_ptr.decompress_state_ptr + decomp_size;
-    qpl_job_ptr->data_ptr.middle_layer_buffer_ptr = qpl_job_ptr->data_ptr.analytics_state_ptr + analytics_size;
-    qpl_job_ptr->data_ptr.hw_state_ptr            = qpl_job_ptr->data_ptr.middle_layer_buffer_ptr + middle_layer_buffer_size;
+    qpl_job_ptr->data_ptr.decompress_state_ptr    = qpl_job_ptr->data_ptr.compress_state_ptr + layout.comp_size;
+    qpl_job_ptr->data_ptr.analytics_state_ptr     = qpl_job_ptr->data_ptr.decompress_state_ptr + layout.decomp_size;
+    qpl_job_ptr->data_ptr.middle_layer_buffer_ptr = qpl_job_ptr->data_ptr.analytics_state_ptr + layout.analytics_size;
+    qpl_job_ptr->data_ptr.hw_state_ptr            = qpl_job_ptr->data_ptr.middle_layer_buffer_ptr
+                                                    + layout.middle_layer_buffer_size;
     qpl_job_ptr->data_ptr.path                    = qpl_path;
+    qpl_job_ptr->data_ptr.op_classes              = op_classes;
 
 #ifdef linux
     if (qpl_path_hardware == qpl_path || qpl_path_auto == qpl_path) {
         qpl_job_ptr->numa_id = -1;
 
         auto *const hw_state_ptr = (qpl_hw_state *) (qpl_job_ptr->data_ptr.hw_state_ptr);
-        uint32_t hw_size = QPL_ALIGNED_SIZE(hw_get_job_size(), QPL_DEFAULT_ALIGNMENT);
 
-        util::set_zeros((uint8_t *) hw_state_ptr, hw_size);
+        util::set_zeros((uint8_t *) hw_state_ptr, layout.hw_size);
 
         if (qpl_path_hardware == qpl_job_ptr->data_ptr.path) {
             status = hw_accelerator_get_context(&hw_state_ptr->accel_context);
@@ -99,15 +159,23 @@ QPL_FUN(qpl_status, qpl_init_job, (qpl_path_t qpl_path, qpl_job *qpl_job_ptr)) {
 #endif
 
     // Zero descriptors
-    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.compress_state_ptr, comp_size);
-    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.decompress_state_ptr, decomp_size);
-    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.analytics_state_ptr, analytics_size);
-    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.middle_layer_buffer_ptr, middle_layer_buffer_size);
+    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.compress_state_ptr, layout.comp_size);
+    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.decompress_state_ptr, layout.decomp_size);
+    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.analytics_state_ptr, layout.analytics_size);
+    util::set_zeros((uint8_t *) qpl_job_ptr->data_ptr.middle_layer_buffer_ptr, layout.middle_layer_buffer_size);
 
     // Initialize states
-    own_init_compress(qpl_job_ptr);
-    own_init_decompress(qpl_job_ptr);
-    own_init_analytics(qpl_job_ptr);
+    if (0u != layout.comp_size) {
+        own_init_compress(qpl_job_ptr);
+    }
+
+    if (0u != layout.decomp_size) {
+        own_init_decompress(qpl_job_ptr);
+    }
+
+    if (0u != layout.analytics_size) {
+        own_init_analytics(qpl_job_ptr);
+    }
 
     return static_cast<qpl_status>(status);
 }
@@ -116,6 +184,11 @@ QPL_FUN(qpl_status, qpl_fini_job, (qpl_job *qpl_job_ptr)) {
     QPL_BAD_PTR_RET(qpl_job_ptr);
     uint32_t status = QPL_STS_OK;
 
+    // Software path submission that is not checked by the user is completed before the job is released
+    if (qpl::job::is_sw_job_submitted(qpl_job_ptr)) {
+        qpl::job::wait_sw_job(qpl_job_ptr);
+    }
+
     if (qpl_path_software != qpl_job_ptr->data_ptr.path) {
         status = hw_accelerator_finalize(&((qpl_hw_state *) qpl_job_ptr->data_ptr.hw_state_ptr)->accel_context);
     }
@@ -123,6 +196,38 @@ QPL_FUN(qpl_status, qpl_fini_job, (qpl_job *qpl_job_ptr)) {
     return static_cast<qpl_status>(status);
 }
 
+QPL_FUN(qpl_status, qpl_init_library, (const qpl_library_options *options_ptr)) {
+    int32_t        numa_id          = -1;
+    const uint32_t *device_ids_ptr  = nullptr;
+    uint32_t       device_ids_count = 0u;
+
+    if (nullptr != options_ptr) {
+        QPL_BADARG_RET(-1 > options_ptr->numa_id, QPL_STS_INVALID_PARAM_ERR);
+        QPL_BADARG_RET(0u != options_ptr->device_ids_count && nullptr == options_ptr->device_ids_ptr,
+                       QPL_STS_NULL_PTR_ERR);
+
+        numa_id          = options_ptr->numa_id;
+        device_ids_ptr   = options_ptr->device_ids_ptr;
+        device_ids_count = options_ptr->device_ids_count;
+    }
+
+    const auto status = hw_accelerator_initialize(numa_id, device_ids_ptr, device_ids_count);
+
+    return qpl::ml::util::accelerator_status_to_qpl(status);
+}
+
+QPL_FUN(qpl_status, qpl_fini_library, ()) {
+    const auto status = qpl::ml::util::shutdown_executor();
+
+    if (qpl::ml::status_list::ok != status) {
+        return static_cast<qpl_status>(status);
+    }
+
+    hw_accelerator_release();
+
+    return QPL_STS_OK;
+}
+
 QPL_INLINE uint32_t own_get_job_size_decompress() {
     uint32_t size = sizeof(own_decompression_state_t) + HUFF_LOOK_UP_TABLE_SIZE;
 
@@ -174,6 +279,20 @@ uint32_t own_get_job_size_middle_layer_buffer() {
     return size;
 }
 
+QPL_INLINE uint32_t own_get_job_size_inflate_buffer() {
+    using namespace qpl::ml;
+    using namespace qpl::ml::compression;
+
+    // The buffer holds one of the decompression states at a time
+    const uint32_t size = std::max({inflate_state<execution_path_t::software>::get_buffer_size(),
+                                    inflate_state<execution_path_t::hardware>::get_buffer_size(),
+                                    huffman_only_decompression_state<execution_path_t::software>::get_buffer_size(),
+                                    huffman_only_decompression_state<execution_path_t::hardware>::get_buffer_size()});
+
+    // Alignment of the buffer start
+    return size + QPL_DEFAULT_ALIGNMENT;
+}
+
 QPL_INLINE void own_init_decompress(qpl_job *qpl_job_ptr) {
     auto *data = (own_decompression_state_t *) qpl_job_ptr->data_ptr.decompress_state_ptr;
     data->inflate_state.block_state = ISAL_BLOCK_NEW_HDR;
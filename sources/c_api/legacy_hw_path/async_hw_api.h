@@ -15,6 +15,16 @@ extern "C" {
 
 QPL_API (qpl_status, hw_submit_job, (qpl_job * qpl_job_ptr));
 
+/**
+ * @brief Checks the job against the accelerator limits, the same checks @ref hw_submit_job starts with
+ */
+QPL_API (qpl_status, hw_validate_job, (qpl_job * qpl_job_ptr));
+
+/**
+ * @brief Submits the job that has passed @ref hw_validate_job
+ */
+QPL_API (qpl_status, hw_submit_validated_job, (qpl_job * qpl_job_ptr));
+
 QPL_API (qpl_status, hw_check_job, (qpl_job * qpl_job_ptr));
 
 QPL_API (uint32_t,   hw_get_job_size, ());
@@ -144,7 +144,7 @@ qpl_status hw_check_compress_job(qpl_job *qpl_job_ptr) {
             state_ptr->execution_history.execution_step = qpl_task_execution_step_header_inserting;
         }
 
-        if (!(QPL_FLAG_OMIT_VERIFY & qpl_job_ptr->flags)) {
+        if (qpl::job::is_verification_required(qpl_job_ptr)) {
             return hw_submit_verify_job(qpl_job_ptr);
         }
 
@@ -180,7 +180,8 @@ qpl_status hw_check_compress_job(qpl_job *qpl_job_ptr) {
         auto status = process_descriptor<qpl_status,
                                          execution_mode_t::async>((hw_descriptor *) desc_ptr,
                                                                   (hw_completion_record *) &state_ptr->comp_ptr,
-                                                                  qpl_job_ptr->numa_id);
+                                                                  qpl_job_ptr->numa_id,
+                                                                  &state_ptr->queue_tag);
 
         HW_IMMEDIATELY_RET(0u != status, QPL_STS_QUEUES_ARE_BUSY_ERR);
 
@@ -201,7 +202,7 @@ qpl_status hw_check_compress_job(qpl_job *qpl_job_ptr) {
         state_ptr->execution_history.execution_step = qpl_task_execution_step_data_processing;
     }
 
-    if (!(QPL_FLAG_OMIT_VERIFY & qpl_job_ptr->flags)) {
+    if (qpl::job::is_verification_required(qpl_job_ptr)) {
         return hw_submit_verify_job(qpl_job_ptr);
     }
 
@@ -225,6 +226,8 @@ extern "C" qpl_status hw_check_job (qpl_job * qpl_job_ptr) {
         return QPL_STS_BEING_PROCESSED;
     }
 
+    hw_retire_descriptor(&state_ptr->queue_tag);
+
     if (TRIVIAL_COMPLETE == comp_ptr->status) {
         job::update_input_stream (qpl_job_ptr, comp_ptr->bytes_completed);
 
@@ -164,7 +164,8 @@ extern "C" qpl_status hw_submit_decompress_job(qpl_job *qpl_job_ptr,
     return process_descriptor<qpl_status,
                               execution_mode_t::async>((hw_descriptor *) desc_ptr,
                                                        (hw_completion_record *) &state_ptr->comp_ptr,
-                                                       qpl_job_ptr->numa_id);
+                                                       qpl_job_ptr->numa_id,
+                                                       &state_ptr->queue_tag);
 }
 
 #if 0
@@ -192,7 +193,8 @@ extern "C" qpl_status hw_submit_simple_inflate(qpl_job *qpl_job_ptr) {
     return process_descriptor<qpl_status,
                               execution_mode_t::async>(desc_ptr,
                                                        (hw_completion_record *) &state_ptr->comp_ptr,
-                                                       qpl_job_ptr->numa_id);
+                                                       qpl_job_ptr->numa_id,
+                                                       &state_ptr->queue_tag);
 }
 #endif
 
@@ -320,7 +322,8 @@ extern "C" qpl_status hw_submit_verify_job(qpl_job *qpl_job_ptr) {
     auto status = process_descriptor<qpl_status,
                                      execution_mode_t::async>((hw_descriptor *) desc_ptr,
                                                               (hw_completion_record *) &state_ptr->comp_ptr,
-                                                              qpl_job_ptr->numa_id);
+                                                              qpl_job_ptr->numa_id,
+                                                              &state_ptr->queue_tag);
 
     HW_IMMEDIATELY_RET(status, QPL_STS_QUEUES_ARE_BUSY_ERR)
 
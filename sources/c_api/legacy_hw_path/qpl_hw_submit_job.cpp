@@ -260,7 +260,8 @@ static inline qpl_status hw_submit_analytic_task(qpl_job *const job_ptr) {
     return process_descriptor<qpl_status,
                               execution_mode_t::async>(descriptor_ptr,
                                                        (hw_completion_record *) &state_ptr->comp_ptr,
-                                                       job_ptr->numa_id);
+                                                       job_ptr->numa_id,
+                                                       &state_ptr->queue_tag);
 }
 
 static inline qpl_status own_bad_argument_validation(qpl_job *const job_ptr) {
@@ -431,7 +432,8 @@ static inline qpl_status hw_submit_task (qpl_job *const job_ptr) {
     return process_descriptor<qpl_status,
                               execution_mode_t::async>(descriptor_ptr,
                                                        (hw_completion_record *) &state_ptr->comp_ptr,
-                                                       job_ptr->numa_id);
+                                                       job_ptr->numa_id,
+                                                       &state_ptr->queue_tag);
 }
 
 static inline void own_hw_state_reset(qpl_hw_state *const state_ptr) {
@@ -443,24 +445,30 @@ static inline void own_hw_state_reset(qpl_hw_state *const state_ptr) {
 
 #define STOP_CHECK_RULE_COUNT 7u
 
-extern "C" qpl_status hw_submit_job (qpl_job * qpl_job_ptr) {
-    QPL_BAD_OP_RET(qpl_job_ptr->op);
+/**
+ * @brief Checks whether the decompression job is processed by the legacy code, not as a single task
+ */
+static inline bool own_is_legacy_decompression(const qpl_job *const job_ptr) {
+    const uint32_t flags = job_ptr->flags;
 
-    // Variables
-    using namespace qpl;
-    auto *const state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
+    if (!(flags & QPL_FLAG_RND_ACCESS && !(flags & QPL_FLAG_NO_HDRS))
+          && !(flags & QPL_FLAG_CANNED_MODE)) {
+        return true; // Run legacy code
+    }
 
-    uint32_t flags = qpl_job_ptr->flags;
+    // Workaround for header reading
+    return (flags & QPL_FLAG_FIRST) && !(flags & QPL_FLAG_CANNED_MODE);
+}
+
+extern "C" qpl_status hw_validate_job (qpl_job * qpl_job_ptr) {
+    QPL_BAD_OP_RET(qpl_job_ptr->op);
 
     OWN_QPL_CHECK_STATUS(own_bad_argument_validation(qpl_job_ptr))
-    own_job_fix_task_properties(qpl_job_ptr);
 
     switch (qpl_job_ptr->op) {
         case qpl_op_extract:
             if (qpl_job_ptr->param_low > qpl_job_ptr->param_high) {
-                hw_iaa_completion_record_init_trivial_completion(&state_ptr->comp_ptr, 0u);
-
-                return QPL_STS_OK;
+                return QPL_STS_OK; // Completed without the accelerator
             }
             [[fallthrough]];
         case qpl_op_find_unique:
@@ -480,7 +488,7 @@ extern "C" qpl_status hw_submit_job (qpl_job * qpl_job_ptr) {
                                QPL_STS_BUFFER_TOO_LARGE_ERR);
             HW_IMMEDIATELY_RET((qpl_job_ptr->flags & QPL_FLAG_NO_HDRS) || (qpl_job_ptr->flags & QPL_FLAG_RND_ACCESS),
                                QPL_STS_OPERATION_ERR)
-            return hw_submit_analytic_task(qpl_job_ptr);
+            return QPL_STS_OK;
 
         case qpl_op_decompress:
             if (qpl_job_ptr->dictionary != NULL && qpl_job_ptr->flags & QPL_FLAG_CANNED_MODE) {
@@ -489,13 +497,66 @@ extern "C" qpl_status hw_submit_job (qpl_job * qpl_job_ptr) {
                 return QPL_STS_NOT_SUPPORTED_MODE_ERR;
             }
 
-            if (!(flags & QPL_FLAG_RND_ACCESS && !(flags & QPL_FLAG_NO_HDRS))
-                  && !(flags & QPL_FLAG_CANNED_MODE)) {
-                break; // Run legacy code
+            if (!own_is_legacy_decompression(qpl_job_ptr)) {
+                return QPL_STS_OK;
+            }
+            break;
+
+        case qpl_op_compress:
+        case qpl_op_memcpy:
+        case qpl_op_crc64:
+        case qpl_op_z_compress16:
+        case qpl_op_z_compress32:
+        case qpl_op_z_decompress16:
+        case qpl_op_z_decompress32:
+            return QPL_STS_OK;
+
+        default: {
+            break;
+        }
+    }
+
+    // Below is a bug: qpl_check_on_nonlast_block in decomp_end_processing field can't be processed as expected.
+    HW_IMMEDIATELY_RET((STOP_CHECK_RULE_COUNT <= qpl_job_ptr->decomp_end_processing), QPL_STS_INVALID_PARAM_ERR);
+
+    return QPL_STS_OK;
+}
+
+extern "C" qpl_status hw_submit_validated_job (qpl_job * qpl_job_ptr) {
+    // Variables
+    using namespace qpl;
+    auto *const state_ptr = reinterpret_cast<qpl_hw_state *>(job::get_state(qpl_job_ptr));
+
+    uint32_t flags = qpl_job_ptr->flags;
+
+    own_job_fix_task_properties(qpl_job_ptr);
+
+    switch (qpl_job_ptr->op) {
+        case qpl_op_extract:
+            if (qpl_job_ptr->param_low > qpl_job_ptr->param_high) {
+                hw_iaa_completion_record_init_trivial_completion(&state_ptr->comp_ptr, 0u);
+
+                return QPL_STS_OK;
             }
+            [[fallthrough]];
+        case qpl_op_find_unique:
+        case qpl_op_select:
+        case qpl_op_expand:
+        case qpl_op_set_membership:
+        case qpl_op_rle_burst:
+        case qpl_op_scan_ne:
+        case qpl_op_scan_eq:
+        case qpl_op_scan_le:
+        case qpl_op_scan_lt:
+        case qpl_op_scan_gt:
+        case qpl_op_scan_ge:
+        case qpl_op_scan_range:
+        case qpl_op_scan_not_range:
+            return hw_submit_analytic_task(qpl_job_ptr);
 
-            if ((flags & QPL_FLAG_FIRST) && !(flags & QPL_FLAG_CANNED_MODE)) {
-                break; // Workaround for header reading
+        case qpl_op_decompress:
+            if (own_is_legacy_decompression(qpl_job_ptr)) {
+                break;
             }
 
             job::reset<qpl_op_decompress>(qpl_job_ptr);
@@ -515,9 +576,6 @@ extern "C" qpl_status hw_submit_job (qpl_job * qpl_job_ptr) {
         }
     }
 
-    // Below is a bug: qpl_check_on_nonlast_block in decomp_end_processing field can't be processed as expected.
-    HW_IMMEDIATELY_RET((STOP_CHECK_RULE_COUNT <= qpl_job_ptr->decomp_end_processing), QPL_STS_INVALID_PARAM_ERR);
-
     // This is the first job
     if (flags & QPL_FLAG_FIRST) {
         hw_iaa_analytics_descriptor *desc_ptr = &state_ptr->desc_ptr;
@@ -579,4 +637,10 @@ extern "C" qpl_status hw_submit_job (qpl_job * qpl_job_ptr) {
     return hw_submit_decompress_job(qpl_job_ptr, is_last_job, source_ptr, source_size);
 }
 
+extern "C" qpl_status hw_submit_job (qpl_job * qpl_job_ptr) {
+    OWN_QPL_CHECK_STATUS(hw_validate_job(qpl_job_ptr))
+
+    return hw_submit_validated_job(qpl_job_ptr);
+}
+
 /** @} */
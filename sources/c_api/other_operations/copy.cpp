@@ -44,6 +44,11 @@ uint32_t perform_copy(qpl_job *const job_ptr) noexcept {
             break;
     }
 
+    // The job stays unchanged if the copy is rejected, e.g. by a busy work queue, so it can be executed again
+    if (status_list::ok != result.status_code_) {
+        return result.status_code_;
+    }
+
     qpl::job::update_input_stream(job_ptr, result.copied_bytes_);
     qpl::job::update_output_stream(job_ptr, result.copied_bytes_, 0);
 
@@ -62,7 +62,13 @@ if(NULL == (expression)) { \
     (1ULL << qpl_op_scan_gt       ) |\
     (1ULL << qpl_op_scan_ge       ) |\
     (1ULL << qpl_op_scan_range    ) |\
-    (1ULL << qpl_op_scan_not_range))
+    (1ULL << qpl_op_scan_not_range) |\
+    (1ULL << qpl_op_bitmap_and    ) |\
+    (1ULL << qpl_op_bitmap_or     ) |\
+    (1ULL << qpl_op_bitmap_xor    ) |\
+    (1ULL << qpl_op_bitmap_and_not) |\
+    (1ULL << qpl_op_bitmap_not    ) |\
+    (1ULL << qpl_op_bitmap_count  ))
 
 #define QPL_BAD_OP_RET(op)\
    { QPL_BADARG_RET((0 == (((uint64_t)QPL_VALID_OP >> op) & 1)), QPL_STS_OPERATION_ERR)};
@@ -47,6 +47,24 @@ HW_PATH_GENERAL_API(hw_accelerator_status, accelerator_get_context, (hw_accelera
  */
 HW_PATH_GENERAL_API(hw_accelerator_status, accelerator_finalize, (hw_accelerator_context *const accel_context_ptr));
 
+/**
+ * @brief Discovers accelerators restricted to the given devices, the previously discovered ones are released
+ *
+ * @param[in] numa_id           NUMA node of the devices, -1 for devices of all nodes
+ * @param[in] device_ids_ptr    IDs of the devices to use, NULL for all devices
+ * @param[in] device_ids_count  number of the device IDs
+ *
+ * @return @ref hw_accelerator_status
+ */
+HW_PATH_GENERAL_API(hw_accelerator_status, accelerator_initialize, (int32_t numa_id,
+                                                                   const uint32_t *device_ids_ptr,
+                                                                   uint32_t device_ids_count));
+
+/**
+ * @brief Releases discovered accelerators, they are discovered again on the next use
+ */
+HW_PATH_GENERAL_API(void, accelerator_release, (void));
+
 
 /**
  * @todo API will be described after refactoring completed
@@ -60,11 +78,24 @@ HW_PATH_GENERAL_API(hw_accelerator_status, accelerator_submit_descriptor, (hw_ac
  *
  * @param[in]   desc_ptr        - pointer to descriptor
  * @param[in]   device_numa_id  - preferred NUMA node ID (-1 for automatic choice)
+ * @param[out]  queue_tag_ptr   - receives the work queue tag of the descriptor, 0 if it was not enqueued
+ *
+ * @note The descriptor is not modified, the tag must be kept by the caller until @ref hw_retire_descriptor
  *
  * @return 0 in case of success execution, or non-zero value, otherwise
  *
  */
-hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t device_numa_id);
+hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t device_numa_id, uint32_t *queue_tag_ptr);
+
+/**
+ * @brief hw_retire_descriptor - notifies the work queue selection that the enqueued descriptor is completed
+ *
+ * @param[in,out] queue_tag_ptr  - work queue tag returned by @ref hw_enqueue_descriptor, reset to 0
+ *
+ * @note Must be called once the completion record is written, repeated calls have no effect
+ *
+ */
+void hw_retire_descriptor(uint32_t *queue_tag_ptr);
 
 #ifdef __cplusplus
 }
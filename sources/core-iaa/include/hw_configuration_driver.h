@@ -87,6 +87,40 @@ HW_PATH_GENERAL_API (unsigned int,  device_get_version, (accfg_dev *device));
 
 HW_PATH_GENERAL_API (int,  work_queue_get_block_on_fault, (accfg_wq *wq));
 
+HW_PATH_GENERAL_API (uint64_t, work_queue_get_size, (accfg_wq *wq));
+
+HW_PATH_GENERAL_API (uint64_t, work_queue_get_max_transfer_size, (accfg_wq *wq));
+
+HW_PATH_GENERAL_API (int32_t, device_get_id, (accfg_dev *device));
+
+#if defined( QPL_HW_EMULATOR )
+
+/**
+ * @brief Properties of a work queue of the emulated accelerator
+ */
+typedef struct {
+    uint32_t size;           /**< Number of descriptors the queue holds, the next enqueue is rejected */
+    uint32_t busy_period;    /**< Every busy_period-th enqueue is rejected as if the queue was full, 0 - none */
+    uint64_t latency_ns;     /**< Time between the enqueue of a descriptor and the start of its execution */
+} hw_emulated_work_queue_properties;
+
+/**
+ * @brief Checks whether the emulated accelerator is requested with QPL_HW_EMULATOR environment variable
+ */
+HW_PATH_GENERAL_API(bool, emulator_is_requested, (void));
+
+/**
+ * @brief Fills the table of @ref qpl_desc_t with the functions of the emulated configuration driver
+ */
+HW_PATH_GENERAL_API(hw_accelerator_status, emulator_load_functions, (qpl_desc_t *functions_table));
+
+/**
+ * @brief Returns properties of the emulated work queue, NULL if the configuration library isn't emulated
+ */
+HW_PATH_GENERAL_API(const hw_emulated_work_queue_properties *, work_queue_get_emulated_properties, (accfg_wq *wq));
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
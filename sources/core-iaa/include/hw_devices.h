@@ -118,6 +118,7 @@ typedef struct {
 typedef struct {
     uint64_t submit_flags;  /**< @todo */
     int32_t numa_id;        /**< ID of the NUMA. Set it to -1 for auto detecting */
+    uint32_t queue_tag;     /**< Receives the tag to retire the descriptor with @ref hw_retire_descriptor */
 } hw_accelerator_submit_options;
 
 #ifdef __cplusplus
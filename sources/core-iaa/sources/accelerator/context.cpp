@@ -6,7 +6,8 @@
 
 /**
  * @date 3/23/2020
- * @brief Internal HW API functions for @ref hw_accelerator_get_context and @ref hw_accelerator_finalize API implementation
+ * @brief Internal HW API functions for @ref hw_accelerator_get_context, @ref hw_accelerator_finalize,
+ *        @ref hw_accelerator_initialize and @ref hw_accelerator_release API implementation
  *
  * @defgroup HW_ACCELERATOR_INIT_API Initialization API
  * @ingroup HW_PRIVATE_API
@@ -39,3 +40,19 @@ extern "C" hw_accelerator_status hw_accelerator_get_context(hw_accelerator_conte
 extern "C" hw_accelerator_status hw_accelerator_finalize(hw_accelerator_context *const UNREFERENCED_PARAMETER(accel_context_ptr)) {
     return HW_ACCELERATOR_STATUS_OK;
 }
+
+extern "C" hw_accelerator_status hw_accelerator_initialize(int32_t numa_id,
+                                                           const uint32_t *device_ids_ptr,
+                                                           uint32_t device_ids_count) {
+    qpl::ml::dispatcher::hw_dispatcher_options_t options{};
+
+    options.numa_id          = numa_id;
+    options.device_ids_ptr   = device_ids_ptr;
+    options.device_ids_count = device_ids_count;
+
+    return qpl::ml::dispatcher::hw_dispatcher::initialize(options);
+}
+
+extern "C" void hw_accelerator_release() {
+    qpl::ml::dispatcher::hw_dispatcher::finalize();
+}
@@ -10,58 +10,28 @@
  */
 
 #include "hw_definitions.h"
-#include "hw_descriptors_api.h"
 #include "dispatcher/hw_dispatcher.hpp"
-#include "dispatcher/numa.hpp"
-
-
-extern "C" hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t device_numa_id) {
-    auto result = HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
-    auto enqueue_failed = false;
 
 
+extern "C" hw_accelerator_status hw_enqueue_descriptor(void *desc_ptr, int32_t device_numa_id, uint32_t *queue_tag_ptr) {
 #if defined( linux )
-    auto                               &dispatcher   = qpl::ml::dispatcher::hw_dispatcher::get_instance();
-    const auto                          device_count = dispatcher.device_count();
-    static thread_local std::uint32_t   device_idx   = 0;
-
-    if (device_count == 0) {
-        return HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
-    }
-
-    int32_t numa_id = (device_numa_id == -1) ? qpl::ml::util::get_numa_id()
-                                             : device_numa_id;
-
-    for (uint64_t try_count = 0u; try_count < device_count; ++try_count) {
-        const auto &device = dispatcher.device(device_idx);
-        device_idx = (device_idx+1) % device_count;
-
-        if (device.numa_id() != (uint64_t)numa_id) {
-            continue;
-        }
-
-        hw_iaa_descriptor_hint_cpu_cache_as_destination((hw_descriptor *) desc_ptr, device.get_cache_write_available());
-
-        enqueue_failed = device.enqueue_descriptor(desc_ptr);
-        if (enqueue_failed) {
-            result = HW_ACCELERATOR_WQ_IS_BUSY;
-        } else {
-            result = HW_ACCELERATOR_STATUS_OK;
-            break;
-        }
-
-
-    }
+    return qpl::ml::dispatcher::hw_dispatcher::get_instance().enqueue_descriptor(desc_ptr,
+                                                                                 device_numa_id,
+                                                                                 queue_tag_ptr);
 #else
     // Not supported on Windows yet
     return HW_ACCELERATOR_SUPPORT_ERR;
 #endif
+}
 
-    return result;
+extern "C" void hw_retire_descriptor(uint32_t *queue_tag_ptr) {
+#if defined( linux )
+    qpl::ml::dispatcher::hw_dispatcher::get_instance().retire_descriptor(queue_tag_ptr);
+#endif
 }
 
 extern "C" hw_accelerator_status hw_accelerator_submit_descriptor(hw_accelerator_context *const UNREFERENCED_PARAMETER(accel_context_ptr),
                                                                   const hw_descriptor *const descriptor_ptr,
                                                                   hw_accelerator_submit_options *const submit_options) {
-    return hw_enqueue_descriptor((void *) descriptor_ptr, submit_options->numa_id);
+    return hw_enqueue_descriptor((void *) descriptor_ptr, submit_options->numa_id, &submit_options->queue_tag);
 }
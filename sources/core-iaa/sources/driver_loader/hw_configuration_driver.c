@@ -51,6 +51,12 @@ typedef unsigned int            (*accfg_device_get_version_ptr)(accfg_dev *devic
 
 typedef int                     (*accfg_wq_get_block_on_fault_ptr)(accfg_wq *wq);
 
+typedef uint64_t                (*accfg_wq_get_size_ptr)(accfg_wq *wq);
+
+typedef uint64_t                (*accfg_wq_get_max_transfer_size_ptr)(accfg_wq *wq);
+
+typedef int                     (*accfg_device_get_id_ptr)(accfg_dev *device);
+
 /**
  * @brief Table with functions required from accelerator configuration library
  */
@@ -73,6 +79,9 @@ static qpl_desc_t functions_table[] = {
         {NULL, "accfg_wq_get_devname"},
         {NULL, "accfg_device_get_version"},
         {NULL, "accfg_wq_get_block_on_fault"},
+        {NULL, "accfg_wq_get_size"},
+        {NULL, "accfg_wq_get_max_transfer_size"},
+        {NULL, "accfg_device_get_id"},
         // Terminate list/init
         {NULL, NULL}
 };
@@ -86,6 +95,13 @@ hw_accelerator_status hw_initialize_accelerator_driver(hw_driver_t *driver_ptr)
     // Variables
     driver_ptr->driver_instance_ptr = NULL;
 
+#if defined( QPL_HW_EMULATOR )
+    // The emulated accelerator replaces the configuration library if it is requested
+    if (hw_emulator_is_requested()) {
+        return hw_emulator_load_functions(functions_table);
+    }
+#endif
+
     // Load DLL
     hw_accelerator_status status = own_load_accelerator_configuration_driver(&driver_ptr->driver_instance_ptr);
 
@@ -185,6 +201,18 @@ int hw_work_queue_get_block_on_fault(accfg_wq *wq) {
     return ((accfg_wq_get_block_on_fault_ptr) functions_table[17].function)(wq);
 }
 
+uint64_t hw_work_queue_get_size(accfg_wq *wq) {
+    return ((accfg_wq_get_size_ptr) functions_table[18].function)(wq);
+}
+
+uint64_t hw_work_queue_get_max_transfer_size(accfg_wq *wq) {
+    return ((accfg_wq_get_max_transfer_size_ptr) functions_table[19].function)(wq);
+}
+
+int32_t hw_device_get_id(accfg_dev *device) {
+    return ((accfg_device_get_id_ptr) functions_table[20].function)(device);
+}
+
 /* ------ Internal functions implementation ------ */
 
 bool own_load_configuration_functions(void *driver_instance_ptr) {
@@ -0,0 +1,404 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Emulated accelerator configuration library
+ *
+ * @details Replaces libaccel-config if QPL_HW_EMULATOR environment variable is set, its value is
+ *          a comma-separated list of the following properties, all of them are optional:
+ *          - devices=<n>                number of devices, 1 by default
+ *          - wqs=<n>                    number of work queues per device, 1 by default
+ *          - numa=<id>[:<id>...]        NUMA nodes of the devices, device i is on the node i modulo the list length
+ *          - gencap=<value>             GENCAP register of the devices
+ *          - wq_size=<n>                number of descriptors a work queue holds, 32 by default
+ *          - max_transfer=<n>[:<n>...]  maximum transfer sizes of the work queues, work queue j of a device
+ *                                       has the size j modulo the list length, 2GB by default
+ *          - busy_period=<n>            every n-th enqueue to a work queue is rejected as if it was full
+ *          - latency_ns=<n>             time before the execution of an enqueued descriptor
+ *
+ *          Descriptors are executed by the software portal, see hw_emulated_portal.
+ */
+
+#if defined( linux ) && defined( QPL_HW_EMULATOR )
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "hw_configuration_driver.h"
+
+namespace {
+
+constexpr const char *emulator_variable_name = "QPL_HW_EMULATOR";
+
+/**
+ * @brief GENCAP with overlapping copy, decompression and indexing support, 2GB transfers and sets of 16 elements
+ */
+constexpr uint64_t default_gen_cap = 0x0007BF00001F0002ull;
+
+constexpr uint32_t     default_wq_size           = 32u;
+constexpr uint64_t     default_max_transfer_size = 1ull << 31u;
+constexpr unsigned int emulated_version          = 0x100u;
+constexpr int32_t      emulated_priority         = 10;
+
+struct emulator_configuration_t {
+    uint32_t                          devices_count      = 1u;
+    uint32_t                          wqs_count          = 1u;
+    std::vector<int>                  numa_nodes         = {0};
+    std::vector<uint64_t>             max_transfer_sizes = {default_max_transfer_size};
+    uint64_t                          gen_cap            = default_gen_cap;
+    hw_emulated_work_queue_properties wq_properties      = {default_wq_size, 0u, 0u};
+};
+
+bool is_emulator_loaded = false;
+
+auto parse_number(const std::string &value, uint64_t &result) noexcept -> bool {
+    if (value.empty()) {
+        return false;
+    }
+
+    char *end_ptr = nullptr;
+    result = std::strtoull(value.c_str(), &end_ptr, 0);
+
+    return '\0' == *end_ptr;
+}
+
+template <class value_t>
+auto parse_list(const std::string &value, std::vector<value_t> &list) noexcept -> bool {
+    list.clear();
+
+    size_t begin = 0u;
+
+    while (begin <= value.size()) {
+        const size_t end = std::min(value.find(':', begin), value.size());
+
+        uint64_t number = 0u;
+
+        if (!parse_number(value.substr(begin, end - begin), number)) {
+            return false;
+        }
+
+        list.push_back(static_cast<value_t>(number));
+        begin = end + 1u;
+    }
+
+    return true;
+}
+
+auto parse_property(const std::string &property, emulator_configuration_t &configuration) noexcept -> bool {
+    const size_t separator = property.find('=');
+
+    if (std::string::npos == separator) {
+        return false;
+    }
+
+    const std::string name  = property.substr(0u, separator);
+    const std::string value = property.substr(separator + 1u);
+
+    if ("numa" == name) {
+        return parse_list(value, configuration.numa_nodes);
+    }
+
+    if ("max_transfer" == name) {
+        auto &sizes = configuration.max_transfer_sizes;
+
+        return parse_list(value, sizes) && sizes.end() == std::find(sizes.begin(), sizes.end(), 0u);
+    }
+
+    uint64_t number = 0u;
+
+    if (!parse_number(value, number)) {
+        return false;
+    }
+
+    if ("devices" == name) {
+        configuration.devices_count = static_cast<uint32_t>(number);
+
+        return 0u < number && number <= MAX_NUM_DEV;
+    }
+
+    if ("wqs" == name) {
+        configuration.wqs_count = static_cast<uint32_t>(number);
+
+        return 0u < number && number <= MAX_NUM_WQ;
+    }
+
+    if ("gencap" == name) {
+        configuration.gen_cap = number;
+
+        return true;
+    }
+
+    if ("wq_size" == name) {
+        configuration.wq_properties.size = static_cast<uint32_t>(number);
+
+        return 0u < number && number <= UINT32_MAX;
+    }
+
+    if ("busy_period" == name) {
+        configuration.wq_properties.busy_period = static_cast<uint32_t>(number);
+
+        return number <= UINT32_MAX;
+    }
+
+    if ("latency_ns" == name) {
+        configuration.wq_properties.latency_ns = number;
+
+        return true;
+    }
+
+    return false;
+}
+
+auto parse_configuration(const char *value_ptr, emulator_configuration_t &configuration) noexcept -> bool {
+    const std::string value(value_ptr);
+
+    size_t begin = 0u;
+
+    while (begin < value.size()) {
+        const size_t end = std::min(value.find(',', begin), value.size());
+
+        if (end != begin && !parse_property(value.substr(begin, end - begin), configuration)) {
+            return false;
+        }
+
+        begin = end + 1u;
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+/**
+ * @brief Emulated work queue, shared and enabled
+ */
+struct accfg_wq {
+    accfg_device                      *device_ptr;
+    int32_t                           id;
+    char                              name[MAX_DEV_LEN];
+    uint64_t                          max_transfer_size;
+    hw_emulated_work_queue_properties properties;
+};
+
+/**
+ * @brief Emulated IAA device, enabled
+ */
+struct accfg_device {
+    accfg_ctx             *context_ptr;
+    uint32_t              index;
+    char                  name[MAX_DEV_LEN];
+    uint64_t              gen_cap;
+    int                   numa_node;
+    std::vector<accfg_wq> work_queues;
+};
+
+/**
+ * @brief Emulated configuration library context, owns all devices
+ */
+struct accfg_ctx {
+    std::vector<accfg_device> devices;
+};
+
+namespace {
+
+int emulated_new(accfg_ctx **ctx) {
+    emulator_configuration_t configuration;
+
+    if (!parse_configuration(std::getenv(emulator_variable_name), configuration)) {
+        DIAG("emulator: bad %s value\n", emulator_variable_name);
+
+        return -EINVAL;
+    }
+
+    auto *context_ptr = new (std::nothrow) accfg_ctx;
+
+    if (nullptr == context_ptr) {
+        return -ENOMEM;
+    }
+
+    context_ptr->devices.resize(configuration.devices_count);
+
+    for (uint32_t i = 0u; i < configuration.devices_count; i++) {
+        auto &device = context_ptr->devices[i];
+
+        device.context_ptr = context_ptr;
+        device.index       = i;
+        device.gen_cap     = configuration.gen_cap;
+        device.numa_node   = configuration.numa_nodes[i % configuration.numa_nodes.size()];
+        std::snprintf(device.name, sizeof(device.name), "iax%u", 2u * i + 1u);
+
+        device.work_queues.resize(configuration.wqs_count);
+
+        for (uint32_t j = 0u; j < configuration.wqs_count; j++) {
+            auto &wq = device.work_queues[j];
+
+            wq.device_ptr        = &device;
+            wq.id                = static_cast<int32_t>(j);
+            wq.properties        = configuration.wq_properties;
+            wq.max_transfer_size = configuration.max_transfer_sizes[j % configuration.max_transfer_sizes.size()];
+            std::snprintf(wq.name, sizeof(wq.name), "wq%u.%u", 2u * i + 1u, j);
+        }
+
+        DIAG("emulator: %s on NUMA node %d with %u work queues\n", device.name, device.numa_node, configuration.wqs_count);
+    }
+
+    *ctx = context_ptr;
+
+    return 0;
+}
+
+accfg_ctx *emulated_unref(accfg_ctx *ctx) {
+    delete ctx;
+
+    return nullptr;
+}
+
+accfg_device *emulated_device_get_first(accfg_ctx *ctx) {
+    return ctx->devices.empty() ? nullptr : &ctx->devices.front();
+}
+
+accfg_device *emulated_device_get_next(accfg_device *device) {
+    auto &devices = device->context_ptr->devices;
+
+    return (device->index + 1u < devices.size()) ? &devices[device->index + 1u] : nullptr;
+}
+
+const char *emulated_device_get_devname(accfg_device *device) {
+    return device->name;
+}
+
+enum accfg_device_state emulated_device_get_state(accfg_device *) {
+    return ACCFG_DEVICE_ENABLED;
+}
+
+unsigned long emulated_device_get_gen_cap(accfg_device *device) {
+    return device->gen_cap;
+}
+
+int emulated_device_get_numa_node(accfg_device *device) {
+    return device->numa_node;
+}
+
+int emulated_device_get_id(accfg_device *device) {
+    return static_cast<int>(2u * device->index + 1u);
+}
+
+unsigned int emulated_device_get_version(accfg_device *) {
+    return emulated_version;
+}
+
+accfg_wq *emulated_wq_get_first(accfg_device *device) {
+    return device->work_queues.empty() ? nullptr : &device->work_queues.front();
+}
+
+accfg_wq *emulated_wq_get_next(accfg_wq *wq) {
+    auto &work_queues = wq->device_ptr->work_queues;
+
+    return (static_cast<size_t>(wq->id) + 1u < work_queues.size()) ? &work_queues[wq->id + 1] : nullptr;
+}
+
+enum accfg_wq_state emulated_wq_get_state(accfg_wq *) {
+    return ACCFG_WQ_ENABLED;
+}
+
+enum accfg_wq_mode emulated_wq_get_mode(accfg_wq *) {
+    return ACCFG_WQ_SHARED;
+}
+
+int emulated_wq_get_id(accfg_wq *wq) {
+    return wq->id;
+}
+
+int emulated_wq_get_priority(accfg_wq *) {
+    return emulated_priority;
+}
+
+int emulated_wq_get_user_dev_path(accfg_wq *wq, char *buf, size_t size) {
+    return std::snprintf(buf, size, "emulated/%s", wq->name);
+}
+
+const char *emulated_wq_get_devname(accfg_wq *wq) {
+    return wq->name;
+}
+
+int emulated_wq_get_block_on_fault(accfg_wq *) {
+    return 0;
+}
+
+uint64_t emulated_wq_get_size(accfg_wq *wq) {
+    return wq->properties.size;
+}
+
+uint64_t emulated_wq_get_max_transfer_size(accfg_wq *wq) {
+    return wq->max_transfer_size;
+}
+
+/**
+ * @brief Emulated functions by names of libaccel-config ones
+ */
+const qpl_desc_t emulated_functions[] = {
+        {(library_function) emulated_new,                      "accfg_new"},
+        {(library_function) emulated_device_get_first,         "accfg_device_get_first"},
+        {(library_function) emulated_device_get_devname,       "accfg_device_get_devname"},
+        {(library_function) emulated_device_get_next,          "accfg_device_get_next"},
+        {(library_function) emulated_wq_get_first,             "accfg_wq_get_first"},
+        {(library_function) emulated_wq_get_next,              "accfg_wq_get_next"},
+        {(library_function) emulated_wq_get_state,             "accfg_wq_get_state"},
+        {(library_function) emulated_wq_get_mode,              "accfg_wq_get_mode"},
+        {(library_function) emulated_wq_get_id,                "accfg_wq_get_id"},
+        {(library_function) emulated_device_get_state,         "accfg_device_get_state"},
+        {(library_function) emulated_unref,                    "accfg_unref"},
+        {(library_function) emulated_device_get_gen_cap,       "accfg_device_get_gen_cap"},
+        {(library_function) emulated_device_get_numa_node,     "accfg_device_get_numa_node"},
+        {(library_function) emulated_wq_get_priority,          "accfg_wq_get_priority"},
+        {(library_function) emulated_wq_get_user_dev_path,     "accfg_wq_get_user_dev_path"},
+        {(library_function) emulated_wq_get_devname,           "accfg_wq_get_devname"},
+        {(library_function) emulated_device_get_version,       "accfg_device_get_version"},
+        {(library_function) emulated_wq_get_block_on_fault,    "accfg_wq_get_block_on_fault"},
+        {(library_function) emulated_wq_get_size,              "accfg_wq_get_size"},
+        {(library_function) emulated_wq_get_max_transfer_size, "accfg_wq_get_max_transfer_size"},
+        {(library_function) emulated_device_get_id,            "accfg_device_get_id"}
+};
+
+} // anonymous namespace
+
+extern "C" bool hw_emulator_is_requested() {
+    return nullptr != std::getenv(emulator_variable_name);
+}
+
+extern "C" hw_accelerator_status hw_emulator_load_functions(qpl_desc_t *functions_table) {
+    DIAG("loading emulated driver\n");
+
+    for (uint32_t i = 0u; functions_table[i].function_name; i++) {
+        functions_table[i].function = nullptr;
+
+        for (const auto &emulated_function : emulated_functions) {
+            if (0 == std::strcmp(functions_table[i].function_name, emulated_function.function_name)) {
+                functions_table[i].function = emulated_function.function;
+            }
+        }
+
+        if (nullptr == functions_table[i].function) {
+            return HW_ACCELERATOR_LIBACCEL_NOT_FOUND;
+        }
+    }
+
+    is_emulator_loaded = true;
+
+    return HW_ACCELERATOR_STATUS_OK;
+}
+
+extern "C" const hw_emulated_work_queue_properties *hw_work_queue_get_emulated_properties(accfg_wq *wq) {
+    return is_emulator_loaded ? &wq->properties : nullptr;
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include "qplc_aggregates.h"
 #include "qplc_checksum.h"
 #include "qplc_zero_compression.h"
+#include "qplc_bitmap.h"
 
 #ifndef OWN_QPL_CORE_API_H_
 #define OWN_QPL_CORE_API_H_
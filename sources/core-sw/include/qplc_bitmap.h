@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*------- qplc_bitmap.h -------*/
+/**
+ * @date 10/18/2022
+ *
+ * @brief Contains Intel® Query Processing Library (Intel® QPL) Core API for operations on bit vectors
+ *
+ * @details Function list:
+ *          - @ref qplc_bitmap_and_8u
+ *          - @ref qplc_bitmap_or_8u
+ *          - @ref qplc_bitmap_xor_8u
+ *          - @ref qplc_bitmap_and_not_8u
+ *          - @ref qplc_bitmap_not_8u
+ *          - @ref qplc_bitmap_popcount_8u
+ *          - @ref qplc_bitmap_find_first_8u
+ *          - @ref qplc_bitmap_find_last_8u
+ */
+
+/**
+ * @defgroup SW_KERNELS_BITMAP_API Bitmap API
+ * @ingroup SW_KERNELS_PRIVATE_API
+ * @{
+ */
+
+#include "qplc_defines.h"
+
+#ifndef QPLC_BITMAP_H_
+#define QPLC_BITMAP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*qplc_bitmap_logic_t_ptr)(const uint8_t *src1_ptr,
+                                        const uint8_t *src2_ptr,
+                                        uint8_t *dst_ptr,
+                                        uint32_t length);
+
+typedef void (*qplc_bitmap_not_t_ptr)(const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length);
+
+typedef uint32_t (*qplc_bitmap_popcount_t_ptr)(const uint8_t *src_ptr, uint32_t length);
+
+typedef uint32_t (*qplc_bitmap_find_t_ptr)(const uint8_t *src_ptr, uint32_t length);
+
+/**
+ * @name qplc_bitmap_<operation>_8u
+ *
+ * @brief Bitwise AND, OR, XOR and AND NOT (src1 & ~src2) of two bit vectors
+ *
+ * @param[in]   src1_ptr  pointer to the first source bit vector
+ * @param[in]   src2_ptr  pointer to the second source bit vector
+ * @param[out]  dst_ptr   pointer to destination bit vector
+ * @param[in]   length    length of bit vectors in bytes
+ *
+ * @note Destination may be the same buffer as any of the sources
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_bitmap_and_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length))
+
+OWN_QPLC_API(void, qplc_bitmap_or_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length))
+
+OWN_QPLC_API(void, qplc_bitmap_xor_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length))
+
+OWN_QPLC_API(void, qplc_bitmap_and_not_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length))
+/** @} */
+
+/**
+ * @name qplc_bitmap_not_8u
+ *
+ * @brief Bitwise NOT of the bit vector
+ *
+ * @param[in]   src_ptr  pointer to source bit vector
+ * @param[out]  dst_ptr  pointer to destination bit vector
+ * @param[in]   length   length of bit vectors in bytes
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_bitmap_not_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length))
+/** @} */
+
+/**
+ * @name qplc_bitmap_popcount_8u
+ *
+ * @brief Counts set bits of the bit vector
+ *
+ * @param[in]  src_ptr  pointer to source bit vector
+ * @param[in]  length   length of bit vector in bytes
+ *
+ * @return
+ *      - number of set bits.
+ * @{
+ */
+OWN_QPLC_API(uint32_t, qplc_bitmap_popcount_8u, (const uint8_t *src_ptr, uint32_t length))
+/** @} */
+
+/**
+ * @name qplc_bitmap_find_<first|last>_8u
+ *
+ * @brief Finds the first or the last set bit of the bit vector, bit i is the bit (i % 8) of the byte (i / 8)
+ *
+ * @param[in]  src_ptr  pointer to source bit vector
+ * @param[in]  length   length of bit vector in bytes
+ *
+ * @return
+ *      - index of the bit, or UINT32_MAX if there are no set bits.
+ * @{
+ */
+OWN_QPLC_API(uint32_t, qplc_bitmap_find_first_8u, (const uint8_t *src_ptr, uint32_t length))
+
+OWN_QPLC_API(uint32_t, qplc_bitmap_find_last_8u, (const uint8_t *src_ptr, uint32_t length))
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QPLC_BITMAP_H_
+/** @} */
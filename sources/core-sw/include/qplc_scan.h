@@ -17,6 +17,7 @@
  * @details Scan Core APIs implement the following functionalities:
  *      -   Scan analytics operation in-place kernels for 8u, 16u and 32u input data and 8u output.
  *      -   Scan analytics operation out-of-place kernels for 8u, 16u and 32u input data and 8u output.
+ *      -   Scan analytics operation kernels for packed input data of any bit width and 1u (bit vector) output.
  *
  */
 
@@ -40,6 +41,13 @@ typedef void (*qplc_scan_t_ptr)(const uint8_t *src_ptr,
                                 uint32_t low_value,
                                 uint32_t high_value);
 
+typedef void (*qplc_scan_packed_t_ptr)(const uint8_t *src_ptr,
+                                       uint32_t length,
+                                       uint32_t bit_width,
+                                       uint8_t *dst_ptr,
+                                       uint32_t low_value,
+                                       uint32_t high_value);
+
 /**
  * @name qplc_scan_<comparison type><input bit-width><output bit-width>_i
  *
@@ -342,6 +350,42 @@ OWN_QPLC_API(void, qplc_scan_not_range_32u8u, (const uint8_t *src_ptr,
         uint32_t high_value))
 /** @} */
 
+/**
+ * @name qplc_scan_<comparison type>_nu1u
+ *
+ * @brief Scan analytics operation kernels for packed little-endian input data of 1..32 bit width and
+ *        bit vector output. Elements are compared without unpacking them to the intermediate buffer.
+ *
+ * @param[in]   src_ptr     pointer to source vector, the first element starts from the bit 0
+ * @param[in]   length      length of source vector in elements
+ * @param[in]   bit_width   bit width of source elements (1..32)
+ * @param[out]  dst_ptr     pointer to destination bit vector, (length + 7) / 8 bytes are written
+ * @param[in]   low_value   low value for scan operation
+ * @param[in]   high_value  high value for scan operation
+ *
+ * @note Scan operations are range and not range, other comparisons are expressed as a range
+ * @note Bit i of the destination is set if condition is met for the element i,
+ *       unused bits of the last destination byte are zeroed
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_scan_range_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint8_t *dst_ptr,
+        uint32_t low_value,
+        uint32_t high_value))
+
+OWN_QPLC_API(void, qplc_scan_not_range_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint8_t *dst_ptr,
+        uint32_t low_value,
+        uint32_t high_value))
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
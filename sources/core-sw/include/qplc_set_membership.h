@@ -16,6 +16,8 @@
  *
  * @details Core APIs implement the following functionalities:
  *      -   Set membership analytics operation out-of-place kernels for 8u, 16u and 32u input data and 8u output.
+ *      -   Set membership analytics operation in-place kernels for 16u and 32u input data and 8u output, that
+ *          look values up in a hash set of 32-bit keys.
  *
  */
 
@@ -34,6 +36,37 @@ typedef void (*qplc_set_membership_i_t_ptr)(uint8_t *src_dst_ptr,
                                             uint32_t shift,
                                             uint32_t mask);
 
+#define QPLC_HASH_SET_BUCKET_SIZE 16u                  /**< Number of keys in a bucket, a bucket is a cache line */
+#define QPLC_HASH_SET_EMPTY_KEY   0xFFFFFFFFu          /**< Value of free slots */
+#define QPLC_HASH_SET_MULTIPLIER  0x9E3779B1u          /**< Multiplier of the Fibonacci hashing */
+
+/**
+ * @brief Open addressing hash set of 32-bit keys
+ *
+ * @details Key is placed to the first free slot starting from the bucket @ref qplc_hash_set_bucket, buckets
+ *          are probed one after another with a wrap-around. Free slots hold @ref QPLC_HASH_SET_EMPTY_KEY,
+ *          so the key that is equal to it is not stored, its presence is marked with has_empty_key.
+ *          At least one slot must be free.
+ */
+typedef struct {
+    const uint32_t *slots_ptr;      /**< buckets_count * QPLC_HASH_SET_BUCKET_SIZE slots, 64-byte aligned */
+    uint32_t       buckets_count;   /**< Number of buckets */
+    uint32_t       has_empty_key;   /**< 1 if QPLC_HASH_SET_EMPTY_KEY belongs to the set, 0 otherwise */
+} qplc_hash_set_t;
+
+/**
+ * @brief Returns index of the first bucket to look the key up in
+ */
+static inline uint32_t qplc_hash_set_bucket(uint32_t key, uint32_t buckets_count) {
+    return (uint32_t) (((uint64_t) (key * QPLC_HASH_SET_MULTIPLIER) * buckets_count) >> 32u);
+}
+
+typedef void (*qplc_set_membership_hash_t_ptr)(uint8_t *src_dst_ptr,
+                                               uint32_t length,
+                                               uint32_t shift,
+                                               uint32_t mask,
+                                               const qplc_hash_set_t *set_ptr);
+
 /**
  * @name qplc_set_membership_<input bit-width><output bit-width>_i
  *
@@ -70,6 +103,37 @@ OWN_QPLC_API(void, qplc_set_membership_32u8u_i, (uint8_t * src_dst_ptr,
         uint32_t      mask))
 /** @} */
 
+/**
+ * @name qplc_set_membership_hash_<input bit-width><output bit-width>_i
+ *
+ * @brief Set Membership analytics operation in-place kernels for 16u and 32u input data and 8u output,
+ *        the set is a hash set of 32-bit keys
+ *
+ * @param[in,out]  src_dst_ptr  pointer to source vector #1 that is also a destination vector
+ * @param[in]      length       length of source vector #1 and destination in elements
+ * @param[in]      shift        number of low bits to drop
+ * @param[in]      mask         mask of bits that shall remain for analysis from src1_ptr[x] value
+ * @param[in]      set_ptr      pointer to the hash set
+ *
+ * @note Set membership operation sets 1 in dst if ((src1_ptr[x] >> shift) & mask) belongs to the set
+ *
+ * @return
+ *      - n/a (void).
+ * @{
+ */
+OWN_QPLC_API(void, qplc_set_membership_hash_16u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t              length,
+        uint32_t              shift,
+        uint32_t              mask,
+        const qplc_hash_set_t *set_ptr))
+
+OWN_QPLC_API(void, qplc_set_membership_hash_32u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t              length,
+        uint32_t              shift,
+        uint32_t              mask,
+        const qplc_hash_set_t *set_ptr))
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
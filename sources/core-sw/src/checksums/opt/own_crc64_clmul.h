@@ -0,0 +1,344 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains helpers for CRC64 calculation with carry-less multiplication (PCLMULQDQ)
+ * @date 10/17/2022
+ *
+ * @details Helpers are shared by AVX2 and AVX-512 implementations of CRC64 and don't use AVX-512 instructions.
+ *          See details in the article "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+ */
+
+#ifndef OWN_CRC64_CLMUL_H
+#define OWN_CRC64_CLMUL_H
+
+#include "own_qplc_defs.h"
+#include "own_qplc_data.h"
+#include "immintrin.h"
+
+OWN_QPLC_INLINE(void, own_crc64_init, (uint64_t polynomial, uint64_t *remainders, uint64_t *barrett)) {
+    // 1. calculating lookup table
+    uint64_t lookup_table[256];
+    lookup_table[0] = 0u;
+    lookup_table[1] = polynomial;
+    uint64_t crc = polynomial;
+    
+    for (uint32_t major_idx = 2u; major_idx <= 128u; major_idx <<= 1u) {
+        // calculating powers of 2
+        crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        lookup_table[major_idx] = crc;
+        // calculating other numbers based on rule:
+        // table[a ^ b] = table[a] ^ table[b]
+        for (uint32_t minor_idx = 1u; minor_idx < major_idx; ++minor_idx) {
+            lookup_table[major_idx + minor_idx] = crc ^ lookup_table[minor_idx];
+        }
+    }
+
+    // 2. calculating folding constants (x^T mod poly and x^(T + 64) mod poly)
+    // and constant for Barrett reduction (floor(x^128 / poly))
+    crc = polynomial;
+    uint64_t crc64_barrett = 0u;
+    for (uint32_t idx = 0; idx < 8u; ++idx) {
+        for (uint32_t j = 0; j < 8u; ++j) {
+            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+            crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        }
+    }
+    *barrett = crc64_barrett;
+    remainders[0] = crc; // x^128 mod poly
+
+    for (uint32_t idx = 8; idx < 16u; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56u];
+    }
+    remainders[1] = crc; // x^192 mod poly
+
+    for (uint32_t idx = 16; idx < 56u; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56u];
+    }
+    remainders[2] = crc; // x^512 mod poly
+
+    for (uint32_t idx = 56; idx < 64u; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56u];
+    }
+    remainders[3] = crc; // x^576 mod poly
+}
+
+OWN_QPLC_INLINE(void, own_crc64_init_no_unroll, (uint64_t polynomial, uint64_t *remainders, uint64_t *barrett)) {
+    uint64_t crc = polynomial;
+
+    uint64_t crc64_barrett = 0u;
+    for (uint32_t idx = 0; idx < 8u; ++idx) {
+        for (uint32_t j = 0; j < 8u; ++j) {
+            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+            crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        }
+    }
+    *barrett = crc64_barrett;
+    remainders[0] = crc; // x^128 mod poly
+
+    for (uint32_t idx = 8; idx < 16u; ++idx) {
+        for (uint32_t j = 0; j < 8u; ++j) {
+            crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        }
+    }
+    remainders[1] = crc; // x^192 mod poly
+
+}
+
+OWN_QPLC_INLINE(void, own_shift_two_lanes, (int offset, __m128i *_xmm0, __m128i *_xmm1)) {
+    __m128i xmm0 = *_xmm0;
+    __m128i xmm1 = *_xmm1;
+
+    switch (offset) {
+    case 15:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 1);
+        xmm1 = _mm_srli_si128(xmm1, 1);
+        break;
+    case 14:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 2);
+        xmm1 = _mm_srli_si128(xmm1, 2);
+        break;
+    case 13:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 3);
+        xmm1 = _mm_srli_si128(xmm1, 3);
+        break;
+    case 12:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 4);
+        xmm1 = _mm_srli_si128(xmm1, 4);
+        break;
+    case 11:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 5);
+        xmm1 = _mm_srli_si128(xmm1, 5);
+        break;
+    case 10:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 6);
+        xmm1 = _mm_srli_si128(xmm1, 6);
+        break;
+    case 9:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 7);
+        xmm1 = _mm_srli_si128(xmm1, 7);
+        break;
+    case 8:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 8);
+        xmm1 = _mm_srli_si128(xmm1, 8);
+        break;
+    case 7:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 9);
+        xmm1 = _mm_srli_si128(xmm1, 9);
+        break;
+    case 6:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 10);
+        xmm1 = _mm_srli_si128(xmm1, 10);
+        break;
+    case 5:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 11);
+        xmm1 = _mm_srli_si128(xmm1, 11);
+        break;
+    case 4:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 12);
+        xmm1 = _mm_srli_si128(xmm1, 12);
+        break;
+    case 3:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 13);
+        xmm1 = _mm_srli_si128(xmm1, 13);
+        break;
+    case 2:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 14);
+        xmm1 = _mm_srli_si128(xmm1, 14);
+        break;
+    case 1:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 15);
+        xmm1 = _mm_srli_si128(xmm1, 15);
+        break;
+    default:
+        xmm0 = _mm_alignr_epi8(xmm1, xmm0, 16);
+        xmm1 = _mm_srli_si128(xmm1, 16);
+    }
+
+    *_xmm0 = xmm0;
+    *_xmm1 = xmm1;
+}
+
+OWN_QPLC_INLINE(uint64_t, own_get_inversion, (uint64_t polynomial)) {
+    polynomial |= (polynomial << 1);
+    polynomial |= (polynomial << 2);
+    polynomial |= (polynomial << 4);
+    polynomial |= (polynomial << 8);
+    polynomial |= (polynomial << 16);
+    polynomial |= (polynomial << 32);
+
+    return polynomial;
+}
+
+OWN_QPLC_INLINE(uint64_t, bit_reflect, (uint64_t x)) {
+    uint64_t y;
+
+    y = bit_reverse_table[x >> 56];
+    y |= ((uint64_t)bit_reverse_table[(x >> 48) & 0xFF]) << 8;
+    y |= ((uint64_t)bit_reverse_table[(x >> 40) & 0xFF]) << 16;
+    y |= ((uint64_t)bit_reverse_table[(x >> 32) & 0xFF]) << 24;
+    y |= ((uint64_t)bit_reverse_table[(x >> 24) & 0xFF]) << 32;
+    y |= ((uint64_t)bit_reverse_table[(x >> 16) & 0xFF]) << 40;
+    y |= ((uint64_t)bit_reverse_table[(x >> 8) & 0xFF]) << 48;
+    y |= ((uint64_t)bit_reverse_table[(x >> 0) & 0xFF]) << 56;
+
+    return y;
+}
+
+OWN_QPLC_INLINE(void, own_crc64_init_be, (uint64_t polynomial, uint64_t *remainders, uint64_t *barrett)) {
+    // 1. calculating lookup table
+    uint64_t lookup_table[256];
+    lookup_table[0] = 0u;
+    lookup_table[1] = polynomial;
+    uint64_t crc = polynomial;
+
+    for (uint32_t major_idx = 2u; major_idx <= 128u; major_idx <<= 1u) {
+        // calculating powers of 2
+        crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        lookup_table[major_idx] = crc;
+        // calculating other numbers based on rule:
+        // table[a ^ b] = table[a] ^ table[b]
+        for (uint32_t minor_idx = 1u; minor_idx < major_idx; ++minor_idx) {
+            lookup_table[major_idx + minor_idx] = crc ^ lookup_table[minor_idx];
+        }
+    }
+
+    // 2. calculating folding constants (x^T mod poly and x^(T + 64) mod poly)
+    // and constant for Barrett reduction (floor(x^128 / poly))
+    crc = polynomial;
+    uint64_t crc64_barrett = 0u;
+    for (uint32_t idx = 0; idx < 7u; ++idx) {
+        for (uint32_t j = 0; j < 8u; ++j) {
+            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+            crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        }
+    }
+    for (uint32_t j = 0; j < 7u; ++j) {
+        crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+        crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+    }
+
+    *barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+    remainders[0] = bit_reflect(crc); // x^(128-1) mod poly
+    
+    for (uint32_t idx = 8; idx < 16u; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56u];
+    }
+    remainders[1] = bit_reflect(crc); // x^(192-1) mod poly
+
+    for (uint32_t idx = 16; idx < 56u; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56u];
+    }
+    remainders[2] = bit_reflect(crc); // x^(512-1) mod poly
+
+    for (uint32_t idx = 56; idx < 64u; ++idx) {
+        crc = (crc << 8) ^ lookup_table[crc >> 56u];
+    }
+    remainders[3] = bit_reflect(crc); // x^(576-1) mod poly
+}
+
+OWN_QPLC_INLINE(void, own_crc64_init_no_unroll_be, (uint64_t polynomial, uint64_t *remainders, uint64_t *barrett)) {
+    uint64_t crc = polynomial;
+
+    uint64_t crc64_barrett = 0u;
+    for (uint32_t idx = 0; idx < 7u; ++idx) {
+        for (uint32_t j = 0; j < 8u; ++j) {
+            crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+            crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        }
+    }
+    for (uint32_t j = 0; j < 7u; ++j) {
+        crc64_barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+        crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+    }
+
+    *barrett = (crc64_barrett << 1) ^ (crc >> 63u);
+    remainders[0] = bit_reflect(crc); // x^(128-1) mod poly
+
+    for (uint32_t idx = 8; idx < 16u; ++idx) {
+        for (uint32_t j = 0; j < 8u; ++j) {
+            crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+        }
+    }
+    remainders[1] = bit_reflect(crc); // x^192 mod poly
+
+}
+
+OWN_QPLC_INLINE(void, own_shift_two_lanes_be, (int offset, __m128i *_xmm0, __m128i *_xmm1)) {
+    __m128i xmm0 = *_xmm0;
+    __m128i xmm1 = *_xmm1;
+
+    switch (offset) {
+    case 15:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 15);
+        xmm1 = _mm_slli_si128(xmm1, 1);
+        break;
+    case 14:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 14);
+        xmm1 = _mm_slli_si128(xmm1, 2);
+        break;
+    case 13:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 13);
+        xmm1 = _mm_slli_si128(xmm1, 3);
+        break;
+    case 12:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 12);
+        xmm1 = _mm_slli_si128(xmm1, 4);
+        break;
+    case 11:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 11);
+        xmm1 = _mm_slli_si128(xmm1, 5);
+        break;
+    case 10:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 10);
+        xmm1 = _mm_slli_si128(xmm1, 6);
+        break;
+    case 9:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 9);
+        xmm1 = _mm_slli_si128(xmm1, 7);
+        break;
+    case 8:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 8);
+        xmm1 = _mm_slli_si128(xmm1, 8);
+        break;
+    case 7:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 7);
+        xmm1 = _mm_slli_si128(xmm1, 9);
+        break;
+    case 6:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 6);
+        xmm1 = _mm_slli_si128(xmm1, 10);
+        break;
+    case 5:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 5);
+        xmm1 = _mm_slli_si128(xmm1, 11);
+        break;
+    case 4:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 4);
+        xmm1 = _mm_slli_si128(xmm1, 12);
+        break;
+    case 3:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 3);
+        xmm1 = _mm_slli_si128(xmm1, 13);
+        break;
+    case 2:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 2);
+        xmm1 = _mm_slli_si128(xmm1, 14);
+        break;
+    case 1:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 1);
+        xmm1 = _mm_slli_si128(xmm1, 15);
+        break;
+    default:
+        xmm0 = _mm_alignr_epi8(xmm0, xmm1, 0);
+        xmm1 = _mm_slli_si128(xmm1, 16);
+    }
+
+    *_xmm0 = xmm0;
+    *_xmm1 = xmm1;
+}
+
+#endif // OWN_CRC64_CLMUL_H
@@ -0,0 +1,413 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+* @brief Contains AVX2 implementation of functions for checksum
+* @date 10/17/2022
+*
+*@details Function list :
+*               -@ref l9_qplc_crc64
+*               -@ref l9_qplc_crc64_be
+*
+*@note Folding is the same as in AVX-512 version, but it is done with 128-bit PCLMULQDQ only
+*      and masked loads/xors are replaced with SSE equivalents.
+*/
+
+//  See details in the article
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+
+#ifndef OWN_CHECKSUM_L9_H
+#define OWN_CHECKSUM_L9_H
+
+#include "own_qplc_defs.h"
+#include "own_qplc_data.h"
+#include "immintrin.h"
+#include "own_crc64_clmul.h"
+
+/**
+ * @brief Loads less than 16 bytes to the low part of the register without reading beyond them
+ */
+OWN_QPLC_INLINE(__m128i, own_l9_load_tail, (const uint8_t *src_ptr, uint32_t length)) {
+    OWN_ALIGNED_ARRAY(uint8_t buffer[16], 16u) = {0u};
+
+    for (uint32_t i = 0u; i < length; i++) {
+        buffer[i] = src_ptr[i];
+    }
+
+    return _mm_load_si128((const __m128i *) buffer);
+}
+
+#if defined _MSC_VER
+#if _MSC_VER > 1916
+/* if MSVC > MSVC2017 */
+#pragma optimize("", off)
+#endif
+#endif
+OWN_OPT_FUN(uint64_t, l9_qplc_crc64, (const uint8_t *src_ptr,
+                                      uint32_t length,
+                                      uint64_t polynomial,
+                                      uint8_t inversion_flag)) {
+    uint64_t crc = 0u;
+    uint64_t inversion_mask = 0u;
+
+    if (inversion_flag) {
+        inversion_mask = own_get_inversion(polynomial);
+        crc = inversion_mask;
+    }
+    
+    if (length >= 16u) {
+        uint64_t crc64_k[4];
+        uint64_t crc64_barrett;
+        if (length > 512u) {
+            own_crc64_init(polynomial, crc64_k, &crc64_barrett);
+        }
+        else {
+            own_crc64_init_no_unroll(polynomial, crc64_k, &crc64_barrett);
+        }
+        uint32_t tail = length % 16u;
+
+        __m128i xmm0, xmm1, xmm2, srcmm;
+        __m128i polymm = _mm_set1_epi64x(polynomial);
+        __m128i barrett = _mm_set1_epi64x(crc64_barrett);
+        __m128i k8 = _mm_set1_epi64x(crc64_k[0]);
+        __m128i k16 = _mm_set_epi64x(crc64_k[1], crc64_k[0]);
+        __m128i inversion = _mm_set_epi64x(inversion_mask, 0);
+        __m128i high_qword_mask = _mm_set_epi64x(-1, 0);
+        __m128i shuffle_le_mask = _mm_set_epi8(
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 
+            0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F);
+
+        xmm0 = _mm_loadu_si128((const __m128i *)src_ptr);
+        xmm0 = _mm_shuffle_epi8(xmm0, shuffle_le_mask);
+        xmm0 = _mm_xor_si128(xmm0, inversion);
+        src_ptr += 16u;
+
+        // 1. fold by 512bit until remaining length < 2 * 512bits.
+
+        if (length > 512u) {
+            __m128i xmm3, xmm4, xmm5, xmm6, xmm7;
+            __m128i srcmm1, srcmm2, srcmm3;
+            __m128i k64 = _mm_set_epi64x(crc64_k[3], crc64_k[2]);
+
+            xmm2 = _mm_loadu_si128((const __m128i *)src_ptr);
+            xmm2 = _mm_shuffle_epi8(xmm2, shuffle_le_mask);
+            xmm4 = _mm_loadu_si128((const __m128i *)(src_ptr + 16u));
+            xmm4 = _mm_shuffle_epi8(xmm4, shuffle_le_mask);
+            xmm6 = _mm_loadu_si128((const __m128i *)(src_ptr + 32u));
+            xmm6 = _mm_shuffle_epi8(xmm6, shuffle_le_mask);
+            src_ptr += 48u;
+
+            while (length >= 128u) {
+                srcmm = _mm_loadu_si128((const __m128i *)src_ptr);
+                srcmm = _mm_shuffle_epi8(srcmm, shuffle_le_mask);
+                srcmm1 = _mm_loadu_si128((const __m128i *)(src_ptr + 16u));
+                srcmm1 = _mm_shuffle_epi8(srcmm1, shuffle_le_mask);
+                srcmm2 = _mm_loadu_si128((const __m128i *)(src_ptr + 32u));
+                srcmm2 = _mm_shuffle_epi8(srcmm2, shuffle_le_mask);
+                srcmm3 = _mm_loadu_si128((const __m128i *)(src_ptr + 48u));
+                srcmm3 = _mm_shuffle_epi8(srcmm3, shuffle_le_mask);
+
+                xmm1 = xmm0;
+                xmm0 = _mm_clmulepi64_si128(xmm0, k64, 0x00);
+                xmm1 = _mm_clmulepi64_si128(xmm1, k64, 0x11);
+                xmm0 = _mm_xor_si128(xmm0, srcmm);
+                xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+                xmm3 = xmm2;
+                xmm2 = _mm_clmulepi64_si128(xmm2, k64, 0x00);
+                xmm3 = _mm_clmulepi64_si128(xmm3, k64, 0x11);
+                xmm2 = _mm_xor_si128(xmm2, srcmm1);
+                xmm2 = _mm_xor_si128(xmm2, xmm3);
+
+                xmm5 = xmm4;
+                xmm4 = _mm_clmulepi64_si128(xmm4, k64, 0x00);
+                xmm5 = _mm_clmulepi64_si128(xmm5, k64, 0x11);
+                xmm4 = _mm_xor_si128(xmm4, srcmm2);
+                xmm4 = _mm_xor_si128(xmm4, xmm5);
+
+                xmm7 = xmm6;
+                xmm6 = _mm_clmulepi64_si128(xmm6, k64, 0x00);
+                xmm7 = _mm_clmulepi64_si128(xmm7, k64, 0x11);
+                xmm6 = _mm_xor_si128(xmm6, srcmm3);
+                xmm6 = _mm_xor_si128(xmm6, xmm7);
+
+                src_ptr += 64u;
+                length -= 64u;
+            }
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, xmm2);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, xmm4);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, xmm6);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+            length -= 48u;
+        }
+
+        // 2. fold by 128bit until remaining length < 2 * 128bits.
+
+        while (length >= 32u) {
+            xmm1 = xmm0;
+            srcmm = _mm_loadu_si128((const __m128i *)src_ptr);
+            srcmm = _mm_shuffle_epi8(srcmm, shuffle_le_mask);
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, srcmm);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+            
+            src_ptr += 16u;
+            length -= 16u;
+        }
+
+        /* 3. if remaining length > 128 bits, then pad zeros to the most-significant bit to grow to 256bits length,
+         * then fold once to 128 bits. */
+
+        if (tail) {
+            srcmm = own_l9_load_tail(src_ptr, tail);
+            srcmm = _mm_shuffle_epi8(srcmm, shuffle_le_mask);
+
+            own_shift_two_lanes(tail, &srcmm, &xmm0);
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, srcmm);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+        }
+
+        // 4. Apply 64 bits fold to 64 bits + 64 bits crc(64 zero bits) 
+
+        xmm1 = _mm_clmulepi64_si128(xmm0, k8, 0x11);
+        xmm0 = _mm_slli_si128(xmm0, 8);
+        xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+        /* 5. Use Barrett Reduction algorithm to calculate the 64-bit crc.
+         * Output: C(x)  = R(x) mod P(x)
+         * Step 1: T1(x) = floor(R(x) / x^64)) * u
+         * Step 2: T2(x) = floor(T1(x) / x^64)) * P(x)
+         * Step 3: C(x)  = R(x) xor T2(x) mod x^64
+         * as u and P(x) are 65-bit values, we use clmul + xor for each multiplication */
+        xmm1 = _mm_clmulepi64_si128(xmm0, barrett, 0x11);
+        xmm1 = _mm_xor_si128(xmm1, _mm_and_si128(xmm0, high_qword_mask));
+
+        xmm2 = _mm_clmulepi64_si128(xmm1, polymm, 0x11);
+        xmm2 = _mm_xor_si128(xmm2, _mm_and_si128(xmm1, high_qword_mask));
+
+        xmm0 = _mm_xor_si128(xmm0, xmm2);
+
+        crc ^= _mm_cvtsi128_si64(xmm0);
+    }
+    else {
+        for (uint32_t i = 0; i < length; ++i) {
+            crc ^= (uint64_t)(*src_ptr++) << 56u;
+            for (uint32_t j = 0; j < 8u; ++j) {
+                crc = (crc << 1) ^ (-(int64_t)(crc >> 63u) & polynomial);
+            }
+        }
+        crc ^= inversion_mask;
+    }
+
+    return crc;
+}
+#if defined _MSC_VER
+#if _MSC_VER > 1916
+/* if MSVC > MSVC2017 */
+#pragma optimize("", on)
+#endif
+#endif
+
+#if defined _MSC_VER
+#if _MSC_VER > 1916
+/* if MSVC > MSVC2017 */
+#pragma optimize("", off)
+#endif
+#endif
+OWN_OPT_FUN(uint64_t, l9_qplc_crc64_be, (const uint8_t *src_ptr,
+                                         uint32_t length,
+                                         uint64_t polynomial,
+                                         uint8_t inversion_flag)) {
+    uint64_t crc = 0u;
+    uint64_t inversion_mask = 0u;
+
+    if (inversion_flag) {
+        inversion_mask = own_get_inversion(polynomial);
+        inversion_mask = bit_reflect(inversion_mask);
+        crc = inversion_mask;
+    }
+
+    if (length >= 16u) {
+        uint64_t crc64_k[4];
+        uint64_t crc64_barrett;
+        if (length > 512u) {
+            own_crc64_init_be(polynomial, crc64_k, &crc64_barrett);
+        }
+        else {
+            own_crc64_init_no_unroll_be(polynomial, crc64_k, &crc64_barrett);
+        }
+        uint32_t tail = length % 16u;
+
+        __m128i xmm0, xmm1, xmm2, srcmm;
+        uint8_t poly_ending = polynomial & 1u;
+        __m128i polymm = _mm_set1_epi64x(bit_reflect(polynomial) << 1);
+        __m128i barrett = _mm_set1_epi64x((bit_reflect(crc64_barrett) << 1) | 1);
+        __m128i k8 = _mm_set1_epi64x(crc64_k[0]);
+        __m128i k16 = _mm_set_epi64x(crc64_k[0], crc64_k[1]);
+        __m128i inversion = _mm_set_epi64x(0, inversion_mask);
+
+        xmm0 = _mm_loadu_si128((const __m128i *)src_ptr);
+        xmm0 = _mm_xor_si128(xmm0, inversion);
+        src_ptr += 16u;
+
+        // 1. fold by 512bit until remaining length < 2 * 512bits.
+
+        if (length > 512u) {
+            __m128i xmm3, xmm4, xmm5, xmm6, xmm7;
+            __m128i srcmm1, srcmm2, srcmm3;
+            __m128i k64 = _mm_set_epi64x(crc64_k[2], crc64_k[3]);
+
+            xmm2 = _mm_loadu_si128((const __m128i *)src_ptr);
+            xmm4 = _mm_loadu_si128((const __m128i *)(src_ptr + 16u));
+            xmm6 = _mm_loadu_si128((const __m128i *)(src_ptr + 32u));
+            src_ptr += 48u;
+
+            while (length >= 128u) {
+                srcmm = _mm_loadu_si128((const __m128i *)src_ptr);
+                srcmm1 = _mm_loadu_si128((const __m128i *)(src_ptr + 16u));
+                srcmm2 = _mm_loadu_si128((const __m128i *)(src_ptr + 32u));
+                srcmm3 = _mm_loadu_si128((const __m128i *)(src_ptr + 48u));
+
+                xmm1 = xmm0;
+                xmm0 = _mm_clmulepi64_si128(xmm0, k64, 0x00);
+                xmm1 = _mm_clmulepi64_si128(xmm1, k64, 0x11);
+                xmm0 = _mm_xor_si128(xmm0, srcmm);
+                xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+                xmm3 = xmm2;
+                xmm2 = _mm_clmulepi64_si128(xmm2, k64, 0x00);
+                xmm3 = _mm_clmulepi64_si128(xmm3, k64, 0x11);
+                xmm2 = _mm_xor_si128(xmm2, srcmm1);
+                xmm2 = _mm_xor_si128(xmm2, xmm3);
+
+                xmm5 = xmm4;
+                xmm4 = _mm_clmulepi64_si128(xmm4, k64, 0x00);
+                xmm5 = _mm_clmulepi64_si128(xmm5, k64, 0x11);
+                xmm4 = _mm_xor_si128(xmm4, srcmm2);
+                xmm4 = _mm_xor_si128(xmm4, xmm5);
+
+                xmm7 = xmm6;
+                xmm6 = _mm_clmulepi64_si128(xmm6, k64, 0x00);
+                xmm7 = _mm_clmulepi64_si128(xmm7, k64, 0x11);
+                xmm6 = _mm_xor_si128(xmm6, srcmm3);
+                xmm6 = _mm_xor_si128(xmm6, xmm7);
+
+                src_ptr += 64u;
+                length -= 64u;
+            }
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, xmm2);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, xmm4);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, xmm6);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+            length -= 48u;
+        }
+
+        // 2. fold by 128bit until remaining length < 2 * 128bits.
+
+        while (length >= 32u) {
+            xmm1 = xmm0;
+            srcmm = _mm_loadu_si128((const __m128i *)src_ptr);
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, srcmm);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+            src_ptr += 16u;
+            length -= 16u;
+        }
+
+        /* 3. if remaining length > 128 bits, then pad zeros to the most-significant bit to grow to 256bits length,
+         * then fold once to 128 bits. */
+
+        if (tail) {
+            srcmm = own_l9_load_tail(src_ptr, tail);
+
+            own_shift_two_lanes_be(tail, &srcmm, &xmm0);
+
+            xmm1 = xmm0;
+            xmm0 = _mm_clmulepi64_si128(xmm0, k16, 0x00);
+            xmm1 = _mm_clmulepi64_si128(xmm1, k16, 0x11);
+            xmm0 = _mm_xor_si128(xmm0, srcmm);
+            xmm0 = _mm_xor_si128(xmm0, xmm1);
+        }
+
+        // 4. Apply 64 bits fold to 64 bits + 64 bits crc(64 zero bits) 
+
+        xmm1 = _mm_clmulepi64_si128(xmm0, k8, 0x00);
+        xmm0 = _mm_srli_si128(xmm0, 8);
+        xmm0 = _mm_xor_si128(xmm0, xmm1);
+
+        /* 5. Use Barrett Reduction algorithm to calculate the 64-bit crc.
+         * Output: C(x)  = R(x)' mod P(x)'
+         * Step 1: T1(x)' = (R(x)' mod x^64) * u'
+         * Step 2: T2(x)' = (T1(x)' mod x^64) * P(x)'
+         * Step 3: C(x)  = R(x)' xor T2(x)' mod x^64
+         * as u and P(x) are 65-bit values, we use clmul + xor for each multiplication */
+        xmm1 = _mm_clmulepi64_si128(xmm0, barrett, 0x00);
+        xmm2 = _mm_clmulepi64_si128(xmm1, polymm, 0x00);
+        if (poly_ending) {
+            xmm2 = _mm_xor_si128(xmm2, _mm_slli_si128(xmm1, 8));
+        }
+        xmm0 = _mm_xor_si128(xmm0, xmm2);
+
+        crc ^= _mm_extract_epi64(xmm0, 0x1);
+    }
+    else {
+        polynomial = bit_reflect(polynomial);
+        for (uint32_t i = 0; i < length; ++i) {
+            crc ^= (uint64_t)(*src_ptr++);
+            for (uint32_t j = 0; j < 8u; ++j) {
+                crc = (crc >> 1) ^ (-(int64_t)(crc & 1u) & polynomial);
+            }
+        }
+        crc ^= inversion_mask;
+    }
+
+    return crc;
+}
+#if defined _MSC_VER
+#if _MSC_VER > 1916
+/* if MSVC > MSVC2017 */
+#pragma optimize("", on)
+#endif
+#endif
+
+#endif // OWN_CHECKSUM_L9_H
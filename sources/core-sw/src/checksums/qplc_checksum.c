@@ -13,6 +13,7 @@
  *          - @ref qplc_crc32_byte_8u
  *          - @ref qplc_crc32_with_polynomial_32u
  *          - @ref qplc_xor_checksum_8u
+ *          - @ref qplc_crc64
  *
  */
 
@@ -23,6 +24,10 @@
 
 #include "opt/qplc_checksum_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_checksum_l9.h"
+
 #endif
 
 /**
@@ -86,7 +91,7 @@ OWN_QPLC_FUN(uint32_t, qplc_xor_checksum_8u,
 #endif
 }
 
-#if PLATFORM < K0
+#if PLATFORM < L9
 
 /**
  * @brief helper for bits/bytes reflecting
@@ -169,10 +174,54 @@ static uint64_t own_crc64_init_crc(uint64_t polynomial, uint8_t be_flag, uint8_t
     return own_bit_byte_swap_64(polynomial);
 }
 
+/**
+ * @brief Lookup tables for CRC64 calculation by 8 bytes at once (slice-by-8)
+ *
+ * @note Tables are built for the last used polynomial and bit order and reused by the following calls
+ *       from the same thread, so only the first call with the new polynomial pays for the initialization.
+ */
+typedef struct {
+    uint64_t polynomial;         /**< Polynomial the tables are built for */
+    uint8_t  be_flag;            /**< Bit order the tables are built for */
+    uint8_t  is_initialized;     /**< Tables content is valid */
+    uint64_t table[8][256];      /**< table[k][i] is CRC of the byte i followed by k zero bytes */
+} own_crc64_tables_t;
+
+static OWN_THREAD_LOCAL own_crc64_tables_t own_crc64_tables;
+
+/**
+ * @brief Returns slice-by-8 lookup tables for the polynomial, builds them if the cached ones don't fit
+ */
+static const own_crc64_tables_t *own_crc64_get_tables(uint64_t polynomial, uint8_t be_flag) {
+    own_crc64_tables_t *tables_ptr = &own_crc64_tables;
+
+    if (tables_ptr->is_initialized && tables_ptr->polynomial == polynomial && tables_ptr->be_flag == be_flag) {
+        return tables_ptr;
+    }
+
+    own_crc64_init_lookup_table(tables_ptr->table[0], polynomial, be_flag);
+
+    for (uint32_t slice = 1u; slice < 8u; slice++) {
+        for (uint32_t i = 0u; i < 256u; i++) {
+            uint64_t crc = tables_ptr->table[slice - 1u][i];
+
+            tables_ptr->table[slice][i] = (be_flag)
+                                          ? (crc >> 8u) ^ tables_ptr->table[0][crc & 0xFFu]
+                                          : (crc << 8u) ^ tables_ptr->table[0][crc >> 56u];
+        }
+    }
+
+    tables_ptr->polynomial     = polynomial;
+    tables_ptr->be_flag        = be_flag;
+    tables_ptr->is_initialized = 1u;
+
+    return tables_ptr;
+}
+
 /**
  * @brief CRC64 calculator
  */
-static uint64_t own_crc64_update(uint8_t data, uint64_t *lookup_table, uint64_t crc, uint8_t be_flag) {
+static uint64_t own_crc64_update(uint8_t data, const uint64_t *lookup_table, uint64_t crc, uint8_t be_flag) {
     if (be_flag) {
         return lookup_table[data ^ (crc & 0xFF)] ^ (crc >> 8);
     }
@@ -181,6 +230,37 @@ static uint64_t own_crc64_update(uint8_t data, uint64_t *lookup_table, uint64_t
     }
 }
 
+/**
+ * @brief CRC64 calculator for 8 bytes at once
+ */
+static uint64_t own_crc64_update_8(const uint8_t *src_ptr, const own_crc64_tables_t *tables_ptr, uint64_t crc, uint8_t be_flag) {
+    const uint64_t (*table)[256] = tables_ptr->table;
+    uint64_t       data          = 0u;
+
+    if (be_flag) {
+        for (uint32_t i = 0u; i < 8u; i++) {
+            data |= (uint64_t) src_ptr[i] << (i * 8u);
+        }
+        crc ^= data;
+
+        return table[7][crc & 0xFF] ^ table[6][(crc >> 8) & 0xFF] ^
+               table[5][(crc >> 16) & 0xFF] ^ table[4][(crc >> 24) & 0xFF] ^
+               table[3][(crc >> 32) & 0xFF] ^ table[2][(crc >> 40) & 0xFF] ^
+               table[1][(crc >> 48) & 0xFF] ^ table[0][crc >> 56];
+    }
+    else {
+        for (uint32_t i = 0u; i < 8u; i++) {
+            data = (data << 8) | src_ptr[i];
+        }
+        crc ^= data;
+
+        return table[7][crc >> 56] ^ table[6][(crc >> 48) & 0xFF] ^
+               table[5][(crc >> 40) & 0xFF] ^ table[4][(crc >> 32) & 0xFF] ^
+               table[3][(crc >> 24) & 0xFF] ^ table[2][(crc >> 16) & 0xFF] ^
+               table[1][(crc >> 8) & 0xFF] ^ table[0][crc & 0xFF];
+    }
+}
+
 /**
  * @brief Final CRC64 step
  */
@@ -233,14 +313,28 @@ OWN_QPLC_FUN(uint64_t, qplc_crc64, (const uint8_t *src_ptr,
         crc = CALL_OPT_FUNCTION(k0_qplc_crc64)(src_ptr, length, polynomial, inversion_flag);
         return crc;
     }
+#elif PLATFORM == L9
+    if (be_flag) {
+        crc = CALL_OPT_FUNCTION(l9_qplc_crc64_be)(src_ptr, length, polynomial, inversion_flag);
+        return crc;
+    }
+    else {
+        crc = CALL_OPT_FUNCTION(l9_qplc_crc64)(src_ptr, length, polynomial, inversion_flag);
+        return crc;
+    }
 #else
-    uint64_t lookup_table[256];
+    const own_crc64_tables_t *tables_ptr = own_crc64_get_tables(polynomial, be_flag);
+    uint32_t                 length_8    = length & ~7u;
+    uint32_t                 i           = 0u;
 
-    own_crc64_init_lookup_table(lookup_table, polynomial, be_flag);
     crc = own_crc64_init_crc(polynomial, be_flag, inversion_flag);
 
-    for (uint32_t i = 0; i < length; i++) {
-        crc = own_crc64_update(src_ptr[i], lookup_table, crc, be_flag);
+    for (; i < length_8; i += 8u) {
+        crc = own_crc64_update_8(src_ptr + i, tables_ptr, crc, be_flag);
+    }
+
+    for (; i < length; i++) {
+        crc = own_crc64_update(src_ptr[i], tables_ptr->table[0], crc, be_flag);
     }
 
     crc = own_crc64_finalize(crc, polynomial, be_flag, inversion_flag);
@@ -0,0 +1,377 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "stdbool.h"
+#include "string.h"
+
+#include "igzip_lib.h"
+#include "encode_df.h"
+
+#include "own_qplc_defs.h"
+
+#include "qplc_checksum.h"
+#include "crc.h"
+
+#include "deflate_slow_utils.h"
+#include "deflate_defs.h"
+
+typedef struct deflate_icf_stream deflate_icf_stream;
+
+#include "deflate_optimal_icf.h"
+
+#if PLATFORM >= K0
+#include "immintrin.h"
+#endif
+
+#define OWN_OPTIMAL_SEGMENT_SIZE     2048u        /**> Number of positions parsed at once */
+#define OWN_OPTIMAL_MAXIMAL_MATCH    258u         /**> Maximal match length */
+#define OWN_OPTIMAL_INFINITE_COST    0xFFFFFFFFu  /**> Cost of the position that is not reached yet */
+#define OWN_OPTIMAL_MIN_STATISTICS   1024u        /**> Number of block symbols to rely on the block histogram */
+#define OWN_OPTIMAL_COST_SCALE       4u           /**> Costs are kept in 1/16 bits */
+#define OWN_OPTIMAL_LL_SYMBOLS       286u         /**> Number of literal/length symbols */
+#define OWN_OPTIMAL_D_SYMBOLS        30u          /**> Number of distance symbols */
+
+/**
+ * @brief Estimated costs of the deflate symbols including their extra bits
+ */
+typedef struct {
+    uint32_t literals[256u];
+    uint32_t lengths[OWN_OPTIMAL_MAXIMAL_MATCH + 1u];
+    uint32_t distances[OWN_OPTIMAL_D_SYMBOLS];
+} own_cost_model_t;
+
+static inline uint32_t own_hash(const uint8_t *const string_ptr, const uint32_t hash_mask) {
+#if PLATFORM >= K0
+    uint32_t value;
+    memcpy(&value, string_ptr, sizeof(value));
+
+    return _mm_crc32_u32(0u, value) & hash_mask;
+#else
+    return crc32_gzip_refl(0u, string_ptr, OWN_BYTES_FOR_HASH_CALCULATION) & hash_mask;
+#endif
+}
+
+static inline uint32_t own_compare(const uint8_t *const first_ptr,
+                                   const uint8_t *const second_ptr,
+                                   const uint32_t maximal_length) {
+    uint32_t length = 0u;
+
+    while (length + sizeof(uint64_t) <= maximal_length) {
+        uint64_t first;
+        uint64_t second;
+
+        memcpy(&first, first_ptr + length, sizeof(first));
+        memcpy(&second, second_ptr + length, sizeof(second));
+
+        if (first != second) {
+            break;
+        }
+
+        length += sizeof(uint64_t);
+    }
+
+    while (length < maximal_length && first_ptr[length] == second_ptr[length]) {
+        length++;
+    }
+
+    return length;
+}
+
+/**
+ * @brief Approximated log2(value) in 1/16 bits, value must be non-zero
+ */
+static inline uint32_t own_log2_scaled(uint32_t value) {
+    uint32_t msb = 0u;
+
+    while ((value >> msb) > 1u) {
+        msb++;
+    }
+
+    const uint32_t fraction = (msb >= OWN_OPTIMAL_COST_SCALE)
+                              ? (value >> (msb - OWN_OPTIMAL_COST_SCALE))
+                              : (value << (OWN_OPTIMAL_COST_SCALE - msb));
+
+    return (msb << OWN_OPTIMAL_COST_SCALE) + (fraction & ((1u << OWN_OPTIMAL_COST_SCALE) - 1u));
+}
+
+static inline uint32_t own_get_length_symbol(const uint32_t match_length, uint32_t *const extra_bits_count_ptr) {
+    const uint32_t value = match_length - 3u;
+
+    if (match_length == OWN_OPTIMAL_MAXIMAL_MATCH) {
+        *extra_bits_count_ptr = 0u;
+        return 285u;
+    }
+
+    if (value < 8u) {
+        *extra_bits_count_ptr = 0u;
+        return 257u + value;
+    }
+
+    uint32_t msb = 0u;
+
+    while ((value >> msb) > 1u) {
+        msb++;
+    }
+
+    *extra_bits_count_ptr = msb - 2u;
+
+    return 261u + 4u * (msb - 2u) + (value >> (msb - 2u)) - 4u;
+}
+
+static inline uint32_t own_get_distance_extra_bits_count(const uint32_t distance_code) {
+    return (distance_code < 4u) ? 0u : (distance_code >> 1u) - 1u;
+}
+
+static inline uint32_t own_get_symbol_cost(const uint32_t count, const uint32_t total_log2) {
+    const uint32_t symbol_log2 = own_log2_scaled(count + 1u);
+    const uint32_t cost        = (total_log2 > symbol_log2) ? total_log2 - symbol_log2 : 0u;
+
+    // Deflate codes are limited with 15 bits and never shorter than 1 bit
+    return QPL_MIN(QPL_MAX(cost, 1u << OWN_OPTIMAL_COST_SCALE), 15u << OWN_OPTIMAL_COST_SCALE);
+}
+
+/**
+ * @brief Builds costs with the block statistics, or with the fixed Huffman codes for a block that has just started
+ */
+static void own_build_cost_model(const isal_mod_hist *const histogram_ptr, own_cost_model_t *const model_ptr) {
+    uint32_t ll_symbol_costs[OWN_OPTIMAL_LL_SYMBOLS];
+    uint32_t d_symbol_costs[OWN_OPTIMAL_D_SYMBOLS];
+    uint32_t ll_counts[OWN_OPTIMAL_LL_SYMBOLS] = {0u};
+    uint32_t ll_total = 0u;
+    uint32_t d_total  = 0u;
+
+    for (uint32_t i = 0u; i < 257u; i++) {
+        ll_counts[i] = histogram_ptr->ll_hist[i];
+    }
+
+    for (uint32_t length = 3u; length <= OWN_OPTIMAL_MAXIMAL_MATCH; length++) {
+        uint32_t extra_bits_count = 0u;
+
+        ll_counts[own_get_length_symbol(length, &extra_bits_count)] += histogram_ptr->ll_hist[length + LEN_OFFSET];
+    }
+
+    for (uint32_t i = 0u; i < OWN_OPTIMAL_LL_SYMBOLS; i++) {
+        ll_total += ll_counts[i];
+    }
+
+    for (uint32_t i = 0u; i < OWN_OPTIMAL_D_SYMBOLS; i++) {
+        d_total += histogram_ptr->d_hist[i];
+    }
+
+    if (ll_total < OWN_OPTIMAL_MIN_STATISTICS) {
+        for (uint32_t i = 0u; i < OWN_OPTIMAL_LL_SYMBOLS; i++) {
+            const uint32_t code_length = (i < 144u) ? 8u : (i < 256u) ? 9u : (i < 280u) ? 7u : 8u;
+
+            ll_symbol_costs[i] = code_length << OWN_OPTIMAL_COST_SCALE;
+        }
+
+        for (uint32_t i = 0u; i < OWN_OPTIMAL_D_SYMBOLS; i++) {
+            d_symbol_costs[i] = 5u << OWN_OPTIMAL_COST_SCALE;
+        }
+    } else {
+        const uint32_t ll_total_log2 = own_log2_scaled(ll_total + OWN_OPTIMAL_LL_SYMBOLS);
+        const uint32_t d_total_log2  = own_log2_scaled(d_total + OWN_OPTIMAL_D_SYMBOLS);
+
+        for (uint32_t i = 0u; i < OWN_OPTIMAL_LL_SYMBOLS; i++) {
+            ll_symbol_costs[i] = own_get_symbol_cost(ll_counts[i], ll_total_log2);
+        }
+
+        for (uint32_t i = 0u; i < OWN_OPTIMAL_D_SYMBOLS; i++) {
+            d_symbol_costs[i] = own_get_symbol_cost(histogram_ptr->d_hist[i], d_total_log2);
+        }
+    }
+
+    for (uint32_t i = 0u; i < 256u; i++) {
+        model_ptr->literals[i] = ll_symbol_costs[i];
+    }
+
+    model_ptr->lengths[0u] = model_ptr->lengths[1u] = model_ptr->lengths[2u] = OWN_OPTIMAL_INFINITE_COST;
+
+    for (uint32_t length = 3u; length <= OWN_OPTIMAL_MAXIMAL_MATCH; length++) {
+        uint32_t extra_bits_count = 0u;
+        uint32_t symbol           = own_get_length_symbol(length, &extra_bits_count);
+
+        model_ptr->lengths[length] = ll_symbol_costs[symbol] + (extra_bits_count << OWN_OPTIMAL_COST_SCALE);
+    }
+
+    for (uint32_t i = 0u; i < OWN_OPTIMAL_D_SYMBOLS; i++) {
+        model_ptr->distances[i] = d_symbol_costs[i] + (own_get_distance_extra_bits_count(i) << OWN_OPTIMAL_COST_SCALE);
+    }
+}
+
+OWN_QPLC_FUN(uint32_t, optimal_deflate_icf_body, (uint8_t * current_ptr,
+        const uint8_t        *const lower_bound_ptr,
+        const uint8_t        *const upper_bound_ptr,
+        deflate_hash_table_t *hash_table_ptr,
+        isal_mod_hist        *histogram_ptr,
+        deflate_icf_stream   *icf_stream_ptr)) {
+    uint32_t costs[OWN_OPTIMAL_SEGMENT_SIZE + 1u];
+    uint16_t lengths[OWN_OPTIMAL_SEGMENT_SIZE + 1u];
+    uint16_t offsets[OWN_OPTIMAL_SEGMENT_SIZE + 1u];
+
+    own_cost_model_t model;
+
+    uint32_t *const hash_table_head = hash_table_ptr->hash_table_ptr;
+    uint32_t *const hash_story      = hash_table_ptr->hash_story_ptr;
+    const uint32_t  hash_mask       = hash_table_ptr->hash_mask;
+    const uint32_t  attempts        = QPL_MAX(hash_table_ptr->attempts, 1u);
+    const uint32_t  good_match      = hash_table_ptr->good_match;
+    const uint32_t  nice_match      = hash_table_ptr->nice_match;
+
+    uint32_t total_bytes_processed = 0u;
+
+    while (current_ptr < upper_bound_ptr && icf_stream_ptr->next_ptr < icf_stream_ptr->end_ptr - 1) {
+        // Every position of the segment produces at most one ICF entry
+        const uint32_t icf_available = (uint32_t) (icf_stream_ptr->end_ptr - icf_stream_ptr->next_ptr) - 1u;
+        const uint32_t segment_size  = QPL_MIN(QPL_MIN(OWN_OPTIMAL_SEGMENT_SIZE, icf_available),
+                                               (uint32_t) (upper_bound_ptr - current_ptr));
+        const uint32_t hashed_size   = ((uint32_t) (upper_bound_ptr - current_ptr) >= OWN_BYTES_FOR_HASH_CALCULATION)
+                                       ? QPL_MIN(segment_size,
+                                                 (uint32_t) (upper_bound_ptr - current_ptr)
+                                                 - OWN_BYTES_FOR_HASH_CALCULATION + 1u)
+                                       : 0u;
+        const uint32_t segment_index = (uint32_t) (current_ptr - lower_bound_ptr);
+
+        uint32_t skip_until = 0u;
+
+        own_build_cost_model(histogram_ptr, &model);
+
+        costs[0u] = 0u;
+        for (uint32_t i = 1u; i <= segment_size; i++) {
+            costs[i] = OWN_OPTIMAL_INFINITE_COST;
+        }
+
+        // Forward pass: every reached position is extended with a literal and with all found matches
+        for (uint32_t i = 0u; i < segment_size; i++) {
+            const uint8_t *const string_ptr = current_ptr + i;
+            const uint32_t       index      = segment_index + i;
+
+            if (i >= hashed_size) {
+                if (i >= skip_until && costs[i] != OWN_OPTIMAL_INFINITE_COST &&
+                    costs[i] + model.literals[*string_ptr] < costs[i + 1u]) {
+                    costs[i + 1u]   = costs[i] + model.literals[*string_ptr];
+                    lengths[i + 1u] = 1u;
+                }
+                continue;
+            }
+
+            const uint32_t hash_value = own_hash(string_ptr, hash_mask);
+            uint32_t       candidate  = hash_table_head[hash_value];
+
+            hash_story[index & hash_mask] = candidate;
+            hash_table_head[hash_value]   = index;
+
+            if (i < skip_until || costs[i] == OWN_OPTIMAL_INFINITE_COST) {
+                continue;
+            }
+
+            if (costs[i] + model.literals[*string_ptr] < costs[i + 1u]) {
+                costs[i + 1u]   = costs[i] + model.literals[*string_ptr];
+                lengths[i + 1u] = 1u;
+            }
+
+            const uint32_t maximal_length = QPL_MIN(OWN_OPTIMAL_MAXIMAL_MATCH, segment_size - i);
+
+            if (maximal_length < OWN_MINIMAL_MATCH_LENGTH) {
+                continue;
+            }
+
+            uint32_t best_length    = OWN_MINIMAL_MATCH_LENGTH - 1u;
+            uint32_t chain_length   = attempts;
+
+            for (uint32_t attempt = 0u; attempt < chain_length; attempt++) {
+                const uint32_t offset = index - candidate;
+
+                if (offset == 0u || offset > OWN_MAXIMAL_OFFSET) {
+                    break;
+                }
+
+                const uint8_t *const match_ptr = string_ptr - offset;
+
+                if (match_ptr[best_length] == string_ptr[best_length]) {
+                    const uint32_t match_length = own_compare(match_ptr, string_ptr, maximal_length);
+
+                    if (match_length > best_length) {
+                        uint32_t distance_code = 0u;
+                        uint32_t extra_bits    = 0u;
+
+                        get_distance_icf_code(offset, &distance_code, &extra_bits);
+
+                        // Shorter lengths are relaxed with the closest offset that reaches them
+                        const uint32_t match_cost = costs[i] + model.distances[distance_code];
+
+                        for (uint32_t length = best_length + 1u; length <= match_length; length++) {
+                            if (match_cost + model.lengths[length] < costs[i + length]) {
+                                costs[i + length]   = match_cost + model.lengths[length];
+                                lengths[i + length] = (uint16_t) length;
+                                offsets[i + length] = (uint16_t) offset;
+                            }
+                        }
+
+                        best_length = match_length;
+
+                        if (best_length >= nice_match || best_length == maximal_length) {
+                            break;
+                        }
+
+                        // Perform a "good match" logic from Zlib: the search depth is decreased in 4 times
+                        if (best_length >= good_match && chain_length == attempts) {
+                            chain_length >>= 2u;
+                        }
+                    }
+                }
+
+                candidate = hash_story[candidate & hash_mask];
+
+                // Links of the overwritten history don't lead further back
+                if (index - candidate <= offset) {
+                    break;
+                }
+            }
+
+            // Long matches are taken as is, positions covered by them are only hashed
+            if (best_length >= nice_match) {
+                skip_until = i + best_length;
+            }
+        }
+
+        // Backward pass: the cheapest path is unrolled into the beginnings of its steps
+        for (uint32_t position = segment_size; position > 0u;) {
+            const uint32_t length = lengths[position];
+            const uint32_t offset = (length > 1u) ? offsets[position] : 0u;
+
+            position -= length;
+
+            costs[position] = length | (offset << 16u);
+        }
+
+        for (uint32_t position = 0u; position < segment_size;) {
+            const uint32_t length = costs[position] & 0xFFFFu;
+
+            if (length == 1u) {
+                update_histogram_for_literal(histogram_ptr, current_ptr[position]);
+                write_deflate_icf(icf_stream_ptr->next_ptr, current_ptr[position], LITERAL_DISTANCE_IN_ICF, 0u);
+            } else {
+                uint32_t distance_code = 0u;
+                uint32_t extra_bits    = 0u;
+
+                get_distance_icf_code(costs[position] >> 16u, &distance_code, &extra_bits);
+
+                histogram_ptr->ll_hist[length + LEN_OFFSET]++;
+                histogram_ptr->d_hist[distance_code]++;
+                write_deflate_icf(icf_stream_ptr->next_ptr, length + LEN_OFFSET, distance_code, extra_bits);
+            }
+
+            icf_stream_ptr->next_ptr++;
+            position += length;
+        }
+
+        current_ptr           += segment_size;
+        total_bytes_processed += segment_size;
+    }
+
+    return total_bytes_processed;
+}
@@ -109,7 +109,7 @@ static inline deflate_match_t get_best_match(const deflate_hash_table_t *const h
 #endif
             best_match.offset = (uint32_t) (string_ptr - current_match_ptr);
 
-            if (best_match.length >= 258u) {
+            if (best_match.length >= hash_table_ptr->nice_match) {
                 break;
             }
         }
@@ -130,7 +130,13 @@ deflate_match_t get_lazy_best_match(const deflate_hash_table_t *const hash_table
     const uint8_t *current_ptr = string_ptr + 1u;
 
     // Getting initial matches for "lazy matching" logic from Zlib
-    deflate_match_t longest_match      = get_best_match(hash_table_ptr, lower_bound_ptr, string_ptr, upper_bound_ptr);
+    deflate_match_t longest_match = get_best_match(hash_table_ptr, lower_bound_ptr, string_ptr, upper_bound_ptr);
+
+    // Long enough match is taken as is, that makes the search greedy for the small lazy_match values
+    if (longest_match.length >= hash_table_ptr->lazy_match) {
+        return longest_match;
+    }
+
     deflate_match_t next_longest_match = get_best_match(hash_table_ptr, lower_bound_ptr, current_ptr, upper_bound_ptr);
 
     // Searching for the longest match
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPLC_DEFLATE_OPTIMAL_ICF_H_
+#define QPLC_DEFLATE_OPTIMAL_ICF_H_
+
+#include "huff_codes.h"
+#include "bitbuf2.h"
+
+#include "igzip_level_buf_structs.h"
+
+#include "deflate_hash_table.h"
+#include "deflate_defs.h"
+
+#include "own_qplc_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct isal_mod_hist isal_mod_hist;
+
+/**
+ * @brief Compresses the source into ICF stream choosing the cheapest sequence of literals and matches
+ *
+ * Source is parsed by segments: all matches of every position are searched in the hash chains
+ * (up to hash_table_ptr->attempts candidates), then the sequence with the minimal estimated bit cost is chosen.
+ * Bit costs are estimated with the statistics already gathered into the block histogram,
+ * or with fixed Huffman codes when the block has just started.
+ *
+ * @return Number of processed source bytes
+ */
+OWN_QPLC_FUN(uint32_t, optimal_deflate_icf_body, (uint8_t* current_ptr,
+    const uint8_t* const lower_bound_ptr,
+    const uint8_t        * const upper_bound_ptr,
+    deflate_hash_table_t * hash_table_ptr,
+    isal_mod_hist        * histogram_ptr,
+    deflate_icf_stream* icf_stream_ptr));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // QPLC_DEFLATE_OPTIMAL_ICF_H_
@@ -15,6 +15,7 @@
 
 #define MAX_MATCH   258
 #define MIN_MATCH4  4
+#define MAX_CHAIN_LENGTH 256
 #define _CMP_MATCH_LENGTH MIN_MATCH4
 
 static inline uint32_t hash_crc(const uint8_t* p_src)
@@ -125,9 +126,8 @@ OWN_OPT_FUN(uint32_t,k0_slow_deflate_icf_body,(uint8_t* current_ptr,
     uint8_t              length;
 
     {
-        /* The general case has been replaced with a fixed case for perfpormance reason. */
-        //int chain_length_current = hash_table_ptr->attempts;
-        int chain_length_current = 256;
+        /* Chain length is capped for performance reason, lower levels set shorter chains */
+        int chain_length_current = QPL_MIN((int)hash_table_ptr->attempts, MAX_CHAIN_LENGTH);
 
         int good_match = hash_table_ptr->good_match;
         int nice_match = hash_table_ptr->nice_match;
@@ -15,6 +15,7 @@
 
 #define MAX_MATCH   258
 #define MIN_MATCH4  4
+#define MAX_CHAIN_LENGTH 256
 #define CMP_MATCH_LENGTH MIN_MATCH4
 
 static inline uint32_t hash_crc(const uint8_t* p_src)
@@ -143,8 +144,8 @@ OWN_OPT_FUN(uint32_t, k0_slow_deflate_body,(uint8_t* current_ptr,
     uint32_t win_size = QPLC_DEFLATE_MAXIMAL_OFFSET;
 
     {
-        //        int chain_length_current = hash_table_ptr->attempts;
-        int chain_length_current = 256; /* temporary */
+        /* Chain length is capped for performance reason, lower levels set shorter chains */
+        int chain_length_current = QPL_MIN((int)hash_table_ptr->attempts, MAX_CHAIN_LENGTH);
         int good_match = hash_table_ptr->good_match;
         int nice_match = hash_table_ptr->nice_match;
         int lazy_match = hash_table_ptr->lazy_match;
@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 helpers shared by unpack kernels for the nominal bit widths 1..32
+ * @date 10/17/2022
+ *
+ * @details Every group of 8 elements occupies exactly bit_width bytes, so the position of the element
+ *          inside the group does not depend on the group number. Every element is fetched as 64-bit
+ *          value starting from the byte where its first bit is located, aligned with the variable shift
+ *          and masked. 7 + 32 bits always fit into 64 bits, so one fetch is enough for any bit width.
+ */
+
+#ifndef OWN_UNPACK_L9_H
+#define OWN_UNPACK_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Precalculated byte shuffles and shifts to extract 8 elements of the fixed bit width
+ */
+typedef struct {
+    uint32_t byte_offset[4];  /**< Offsets of 128-bit lane loads (for elements 0, 2, 4 and 6) */
+    __m256i  shuffle_low;     /**< Byte shuffle for elements 0..3 */
+    __m256i  shuffle_high;    /**< Byte shuffle for elements 4..7 */
+    __m256i  shift_low;       /**< Bit shifts for elements 0..3 */
+    __m256i  shift_high;      /**< Bit shifts for elements 4..7 */
+    __m256i  mask;            /**< Mask of the bit width */
+} own_l9_unpack_state_t;
+
+OWN_QPLC_INLINE(void, own_l9_unpack_init, (own_l9_unpack_state_t *state_ptr,
+                                           uint32_t start_bit,
+                                           uint32_t bit_width)) {
+    OWN_ALIGNED_ARRAY(uint8_t shuffle[64], 32u);
+    OWN_ALIGNED_ARRAY(uint64_t shift[8], 32u);
+
+    for (uint32_t element = 0u; element < 8u; element++) {
+        uint32_t bit_offset  = start_bit + element * bit_width;
+        uint32_t lane_offset = (start_bit + (element & (~1u)) * bit_width) / OWN_BYTE_WIDTH;
+        uint32_t delta       = bit_offset / OWN_BYTE_WIDTH - lane_offset;
+
+        for (uint32_t i = 0u; i < 8u; i++) {
+            shuffle[element * 8u + i] = (uint8_t) (delta + i);
+        }
+        shift[element] = bit_offset % OWN_BYTE_WIDTH;
+
+        if (0u == (element & 1u)) {
+            state_ptr->byte_offset[element / 2u] = lane_offset;
+        }
+    }
+
+    state_ptr->shuffle_low  = _mm256_load_si256((const __m256i *) shuffle);
+    state_ptr->shuffle_high = _mm256_load_si256((const __m256i *) (shuffle + 32u));
+    state_ptr->shift_low    = _mm256_load_si256((const __m256i *) shift);
+    state_ptr->shift_high   = _mm256_load_si256((const __m256i *) (shift + 4u));
+    state_ptr->mask         = _mm256_set1_epi64x((int64_t) OWN_BIT_MASK(bit_width));
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_load_2x128, (const uint8_t *low_ptr, const uint8_t *high_ptr)) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) low_ptr)),
+                                   _mm_loadu_si128((const __m128i *) high_ptr), 1);
+}
+
+/**
+ * @brief Unpacks 8 elements to 32-bit values
+ */
+OWN_QPLC_INLINE(__m256i, own_l9_unpack_8_elements, (const uint8_t *src_ptr,
+                                                    const own_l9_unpack_state_t *state_ptr)) {
+    __m256i low  = own_l9_load_2x128(src_ptr + state_ptr->byte_offset[0], src_ptr + state_ptr->byte_offset[1]);
+    __m256i high = own_l9_load_2x128(src_ptr + state_ptr->byte_offset[2], src_ptr + state_ptr->byte_offset[3]);
+
+    low  = _mm256_shuffle_epi8(low, state_ptr->shuffle_low);
+    high = _mm256_shuffle_epi8(high, state_ptr->shuffle_high);
+    low  = _mm256_and_si256(_mm256_srlv_epi64(low, state_ptr->shift_low), state_ptr->mask);
+    high = _mm256_and_si256(_mm256_srlv_epi64(high, state_ptr->shift_high), state_ptr->mask);
+
+    // Low dwords are gathered as (0, 1, 4, 5 | 2, 3, 6, 7), so qwords 1 and 2 are swapped after that
+    __m256 result = _mm256_shuffle_ps(_mm256_castsi256_ps(low), _mm256_castsi256_ps(high), 0x88);
+
+    return _mm256_permute4x64_epi64(_mm256_castps_si256(result), 0xD8);
+}
+
+/**
+ * @brief Unpacks as many groups of 8 elements as can be read without crossing the end of the source
+ *
+ * @return number of unpacked elements
+ */
+OWN_QPLC_INLINE(uint32_t, own_l9_unpack_bulk, (const uint8_t *src_ptr,
+                                               uint32_t num_elements,
+                                               uint32_t start_bit,
+                                               uint32_t bit_width,
+                                               uint8_t *dst_ptr,
+                                               uint32_t dst_width)) {
+    own_l9_unpack_state_t state;
+    uint32_t              unpacked = 0u;
+
+    own_l9_unpack_init(&state, start_bit, bit_width);
+
+    // The last lane load reads 16 bytes starting from byte_offset[3]
+    while ((num_elements - unpacked) >= 8u
+           && ((uint64_t) (num_elements - unpacked) * bit_width + start_bit) / OWN_BYTE_WIDTH
+              >= (uint64_t) state.byte_offset[3] + 16u) {
+        __m256i result = own_l9_unpack_8_elements(src_ptr, &state);
+
+        if (sizeof(uint32_t) == dst_width) {
+            _mm256_storeu_si256((__m256i *) dst_ptr, result);
+        } else {
+            __m128i result_16u = _mm_packus_epi32(_mm256_castsi256_si128(result),
+                                                  _mm256_extracti128_si256(result, 1));
+            if (sizeof(uint16_t) == dst_width) {
+                _mm_storeu_si128((__m128i *) dst_ptr, result_16u);
+            } else {
+                _mm_storel_epi64((__m128i *) dst_ptr, _mm_packus_epi16(result_16u, result_16u));
+            }
+        }
+
+        src_ptr += bit_width;
+        dst_ptr += 8u * dst_width;
+        unpacked += 8u;
+    }
+
+    return unpacked;
+}
+
+/**
+ * @brief Unpacks remaining elements one by one without reading beyond the last source byte
+ */
+OWN_QPLC_INLINE(void, own_l9_unpack_tail, (const uint8_t *src_ptr,
+                                           uint32_t num_elements,
+                                           uint32_t start_bit,
+                                           uint32_t bit_width,
+                                           uint8_t *dst_ptr,
+                                           uint32_t dst_width)) {
+    uint64_t mask        = OWN_BIT_MASK(bit_width);
+    uint64_t src         = 0u;
+    uint32_t bits_in_buf = 0u;
+
+    if (0u == num_elements) {
+        return;
+    }
+
+    src         = (uint64_t) (*src_ptr++) >> start_bit;
+    bits_in_buf = OWN_BYTE_WIDTH - start_bit;
+
+    for (uint32_t idx = 0u; idx < num_elements; idx++) {
+        while (bit_width > bits_in_buf) {
+            src |= (uint64_t) (*src_ptr++) << bits_in_buf;
+            bits_in_buf += OWN_BYTE_WIDTH;
+        }
+
+        if (sizeof(uint32_t) == dst_width) {
+            ((uint32_t *) dst_ptr)[idx] = (uint32_t) (src & mask);
+        } else if (sizeof(uint16_t) == dst_width) {
+            ((uint16_t *) dst_ptr)[idx] = (uint16_t) (src & mask);
+        } else {
+            dst_ptr[idx] = (uint8_t) (src & mask);
+        }
+        src >>= bit_width;
+        bits_in_buf -= bit_width;
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_unpack_Nu, (const uint8_t *src_ptr,
+                                         uint32_t num_elements,
+                                         uint32_t start_bit,
+                                         uint32_t bit_width,
+                                         uint8_t *dst_ptr,
+                                         uint32_t dst_width)) {
+    uint32_t unpacked = own_l9_unpack_bulk(src_ptr, num_elements, start_bit, bit_width, dst_ptr, dst_width);
+
+    own_l9_unpack_tail(src_ptr + (unpacked / 8u) * bit_width,
+                       num_elements - unpacked,
+                       start_bit,
+                       bit_width,
+                       dst_ptr + unpacked * dst_width,
+                       dst_width);
+}
+
+/**
+ * @brief Unpacks 1-bit elements: every source byte is broadcast to 8 bytes and tested against bit masks
+ */
+OWN_QPLC_INLINE(void, own_l9_unpack_1u8u, (const uint8_t *src_ptr,
+                                           uint32_t num_elements,
+                                           uint32_t start_bit,
+                                           uint8_t *dst_ptr)) {
+    const __m256i byte_shuffle = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                                  2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i bit_masks    = _mm256_set1_epi64x(0x8040201008040201LL);
+    const __m256i one          = _mm256_set1_epi8(1);
+
+    // Align to byte boundary
+    if (0u < start_bit) {
+        uint32_t unaligned_elements = OWN_BYTE_WIDTH - start_bit;
+
+        unaligned_elements = (num_elements < unaligned_elements) ? num_elements : unaligned_elements;
+        own_l9_unpack_tail(src_ptr, unaligned_elements, start_bit, 1u, dst_ptr, sizeof(uint8_t));
+
+        src_ptr++;
+        dst_ptr += unaligned_elements;
+        num_elements -= unaligned_elements;
+    }
+
+    for (; num_elements >= 32u; num_elements -= 32u) {
+        __m256i data = _mm256_set1_epi32(*(const int32_t *) src_ptr);
+
+        data = _mm256_and_si256(_mm256_shuffle_epi8(data, byte_shuffle), bit_masks);
+        data = _mm256_and_si256(_mm256_cmpeq_epi8(data, bit_masks), one);
+        _mm256_storeu_si256((__m256i *) dst_ptr, data);
+
+        src_ptr += sizeof(uint32_t);
+        dst_ptr += 32u;
+    }
+
+    own_l9_unpack_tail(src_ptr, num_elements, 0u, 1u, dst_ptr, sizeof(uint8_t));
+}
+
+#endif // OWN_UNPACK_L9_H
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for vector aggregates calculation
+ * @date 10/17/2022
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_bit_aggregates_8u
+ *          - @ref l9_qplc_aggregates_8u
+ *          - @ref l9_qplc_aggregates_16u
+ *          - @ref l9_qplc_aggregates_32u
+ */
+#ifndef OWN_AGGREGATES_L9_H
+#define OWN_AGGREGATES_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+OWN_QPLC_INLINE(uint64_t, own_l9_reduce_add_64u, (__m256i data)) {
+    __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(data), _mm256_extracti128_si256(data, 1));
+
+    return (uint64_t) _mm_cvtsi128_si64(sum) + (uint64_t) _mm_extract_epi64(sum, 1);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_add_32u, (__m256i data)) {
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(data), _mm256_extracti128_si256(data, 1));
+
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+
+    return (uint32_t) _mm_cvtsi128_si32(sum);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_min_32u, (__m256i data)) {
+    __m128i min = _mm_min_epu32(_mm256_castsi256_si128(data), _mm256_extracti128_si256(data, 1));
+
+    min = _mm_min_epu32(min, _mm_shuffle_epi32(min, 0x4E));
+    min = _mm_min_epu32(min, _mm_shuffle_epi32(min, 0xB1));
+
+    return (uint32_t) _mm_cvtsi128_si32(min);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_l9_reduce_max_32u, (__m256i data)) {
+    __m128i max = _mm_max_epu32(_mm256_castsi256_si128(data), _mm256_extracti128_si256(data, 1));
+
+    max = _mm_max_epu32(max, _mm_shuffle_epi32(max, 0x4E));
+    max = _mm_max_epu32(max, _mm_shuffle_epi32(max, 0xB1));
+
+    return (uint32_t) _mm_cvtsi128_si32(max);
+}
+
+OWN_OPT_FUN(void, l9_qplc_bit_aggregates_8u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr,
+        uint32_t *index_ptr)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  zero     = _mm256_setzero_si256();
+    __m256i        sum      = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i  data     = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        uint32_t non_zero = ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, zero));
+
+        if (non_zero) {
+            sum = _mm256_add_epi64(sum, _mm256_sad_epu8(data, zero));
+            if (OWN_MAX_32U == *min_value_ptr) {
+                *min_value_ptr = idx + *index_ptr + (uint32_t) _tzcnt_u32(non_zero);
+            }
+            *max_value_ptr = idx + *index_ptr + 31u - (uint32_t) _lzcnt_u32(non_zero);
+        }
+    }
+    *sum_ptr += (uint32_t) own_l9_reduce_add_64u(sum);
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        *sum_ptr += src_ptr[idx];
+        if (OWN_MAX_32U == *min_value_ptr) {
+            *min_value_ptr = (0u == src_ptr[idx]) ? *min_value_ptr : idx + *index_ptr;
+        }
+        *max_value_ptr = (0u == src_ptr[idx]) ? *max_value_ptr : idx + *index_ptr;
+    }
+    *index_ptr += length;
+}
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_8u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  zero     = _mm256_setzero_si256();
+    __m256i        min      = _mm256_set1_epi8((char) 0xFF);
+    __m256i        max      = _mm256_setzero_si256();
+    __m256i        sum      = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i data = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+
+        min = _mm256_min_epu8(min, data);
+        max = _mm256_max_epu8(max, data);
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(data, zero));
+    }
+
+    if (length32) {
+        __m128i  min_128   = _mm_min_epu8(_mm256_castsi256_si128(min), _mm256_extracti128_si256(min, 1));
+        uint32_t min_value = own_l9_reduce_min_32u(_mm256_min_epu32(_mm256_cvtepu8_epi32(min_128),
+                                                                    _mm256_cvtepu8_epi32(_mm_srli_si128(min_128, 8))));
+        __m128i  max_128   = _mm_max_epu8(_mm256_castsi256_si128(max), _mm256_extracti128_si256(max, 1));
+        uint32_t max_value = own_l9_reduce_max_32u(_mm256_max_epu32(_mm256_cvtepu8_epi32(max_128),
+                                                                    _mm256_cvtepu8_epi32(_mm_srli_si128(max_128, 8))));
+
+        *min_value_ptr = (min_value < *min_value_ptr) ? min_value : *min_value_ptr;
+        *max_value_ptr = (max_value > *max_value_ptr) ? max_value : *max_value_ptr;
+        *sum_ptr += (uint32_t) own_l9_reduce_add_64u(sum);
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        *sum_ptr += src_ptr[idx];
+        *min_value_ptr = (src_ptr[idx] < *min_value_ptr) ? src_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_ptr[idx] > *max_value_ptr) ? src_ptr[idx] : *max_value_ptr;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_16u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    const uint32_t length16     = length & (-16);
+    __m256i        min          = _mm256_set1_epi16((short) 0xFFFF);
+    __m256i        max          = _mm256_setzero_si256();
+    __m256i        sum          = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length16; idx += 16u) {
+        __m256i data = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx));
+
+        min = _mm256_min_epu16(min, data);
+        max = _mm256_max_epu16(max, data);
+        sum = _mm256_add_epi32(sum, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(data)));
+        sum = _mm256_add_epi32(sum, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(data, 1)));
+    }
+
+    if (length16) {
+        uint32_t min_value = own_l9_reduce_min_32u(_mm256_min_epu32(
+                _mm256_cvtepu16_epi32(_mm256_castsi256_si128(min)),
+                _mm256_cvtepu16_epi32(_mm256_extracti128_si256(min, 1))));
+        uint32_t max_value = own_l9_reduce_max_32u(_mm256_max_epu32(
+                _mm256_cvtepu16_epi32(_mm256_castsi256_si128(max)),
+                _mm256_cvtepu16_epi32(_mm256_extracti128_si256(max, 1))));
+
+        *min_value_ptr = (min_value < *min_value_ptr) ? min_value : *min_value_ptr;
+        *max_value_ptr = (max_value > *max_value_ptr) ? max_value : *max_value_ptr;
+        *sum_ptr += own_l9_reduce_add_32u(sum);
+    }
+
+    for (uint32_t idx = length16; idx < length; idx++) {
+        *sum_ptr += src_16u_ptr[idx];
+        *min_value_ptr = (src_16u_ptr[idx] < *min_value_ptr) ? src_16u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_16u_ptr[idx] > *max_value_ptr) ? src_16u_ptr[idx] : *max_value_ptr;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_aggregates_32u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t *min_value_ptr,
+        uint32_t *max_value_ptr,
+        uint32_t *sum_ptr)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    const uint32_t length8      = length & (-8);
+    __m256i        min          = _mm256_set1_epi32((int) OWN_MAX_32U);
+    __m256i        max          = _mm256_setzero_si256();
+    __m256i        sum          = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length8; idx += 8u) {
+        __m256i data = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx));
+
+        min = _mm256_min_epu32(min, data);
+        max = _mm256_max_epu32(max, data);
+        sum = _mm256_add_epi32(sum, data);
+    }
+
+    if (length8) {
+        uint32_t min_value = own_l9_reduce_min_32u(min);
+        uint32_t max_value = own_l9_reduce_max_32u(max);
+
+        *min_value_ptr = (min_value < *min_value_ptr) ? min_value : *min_value_ptr;
+        *max_value_ptr = (max_value > *max_value_ptr) ? max_value : *max_value_ptr;
+        *sum_ptr += own_l9_reduce_add_32u(sum);
+    }
+
+    for (uint32_t idx = length8; idx < length; idx++) {
+        *sum_ptr += src_32u_ptr[idx];
+        *min_value_ptr = (src_32u_ptr[idx] < *min_value_ptr) ? src_32u_ptr[idx] : *min_value_ptr;
+        *max_value_ptr = (src_32u_ptr[idx] > *max_value_ptr) ? src_32u_ptr[idx] : *max_value_ptr;
+    }
+}
+
+#endif // OWN_AGGREGATES_L9_H
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX-512 implementation of functions for operations on bit vectors
+ * @date 10/18/2022
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_bitmap_and_8u
+ *          - @ref k0_qplc_bitmap_or_8u
+ *          - @ref k0_qplc_bitmap_xor_8u
+ *          - @ref k0_qplc_bitmap_and_not_8u
+ *          - @ref k0_qplc_bitmap_not_8u
+ *          - @ref k0_qplc_bitmap_popcount_8u
+ *          - @ref k0_qplc_bitmap_find_first_8u
+ *          - @ref k0_qplc_bitmap_find_last_8u
+ *
+ * @note Tails are processed with masked loads and stores. The K0 target does not enable VPOPCNTDQ/BITALG,
+ *       so population count uses the nibble lookup with byte shuffle, counts of bytes are summed with SAD.
+ */
+
+#ifndef OWN_BITMAP_K0_H
+#define OWN_BITMAP_K0_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+#define OWN_K0_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, vector_expression)                   \
+    {                                                                                               \
+        const uint32_t length64 = (length) & (-64);                                                 \
+        const uint32_t tail     = (length) - length64;                                              \
+                                                                                                    \
+        for (uint32_t idx = 0u; idx < length64; idx += 64u) {                                       \
+            const __m512i a = _mm512_loadu_si512((const void *) ((src1_ptr) + idx));                \
+            const __m512i b = _mm512_loadu_si512((const void *) ((src2_ptr) + idx));                \
+            _mm512_storeu_si512((void *) ((dst_ptr) + idx), (vector_expression));                   \
+        }                                                                                           \
+                                                                                                    \
+        if (tail) {                                                                                 \
+            const __mmask64 mask = _bzhi_u64((uint64_t) -1, tail);                                  \
+            const __m512i   a    = _mm512_maskz_loadu_epi8(mask, (const void *) ((src1_ptr) + length64)); \
+            const __m512i   b    = _mm512_maskz_loadu_epi8(mask, (const void *) ((src2_ptr) + length64)); \
+            _mm512_mask_storeu_epi8((void *) ((dst_ptr) + length64), mask, (vector_expression));    \
+        }                                                                                           \
+    }
+
+OWN_OPT_FUN(void, k0_qplc_bitmap_and_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_K0_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm512_and_si512(a, b))
+}
+
+OWN_OPT_FUN(void, k0_qplc_bitmap_or_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_K0_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm512_or_si512(a, b))
+}
+
+OWN_OPT_FUN(void, k0_qplc_bitmap_xor_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_K0_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm512_xor_si512(a, b))
+}
+
+OWN_OPT_FUN(void, k0_qplc_bitmap_and_not_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_K0_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm512_andnot_si512(b, a))
+}
+
+OWN_OPT_FUN(void, k0_qplc_bitmap_not_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
+    const uint32_t length64 = length & (-64);
+    const uint32_t tail     = length - length64;
+    const __m512i  ones     = _mm512_set1_epi8((char) 0xFF);
+
+    for (uint32_t idx = 0u; idx < length64; idx += 64u) {
+        const __m512i data = _mm512_loadu_si512((const void *) (src_ptr + idx));
+        _mm512_storeu_si512((void *) (dst_ptr + idx), _mm512_xor_si512(data, ones));
+    }
+
+    if (tail) {
+        const __mmask64 mask = _bzhi_u64((uint64_t) -1, tail);
+        const __m512i   data = _mm512_maskz_loadu_epi8(mask, (const void *) (src_ptr + length64));
+        _mm512_mask_storeu_epi8((void *) (dst_ptr + length64), mask, _mm512_xor_si512(data, ones));
+    }
+}
+
+OWN_QPLC_INLINE(__m512i, own_k0_popcount_8u, (__m512i data, __m512i lookup, __m512i low_mask)) {
+    const __m512i low  = _mm512_shuffle_epi8(lookup, _mm512_and_si512(data, low_mask));
+    const __m512i high = _mm512_shuffle_epi8(lookup, _mm512_and_si512(_mm512_srli_epi16(data, 4), low_mask));
+
+    return _mm512_add_epi8(low, high);
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_bitmap_popcount_8u, (const uint8_t *src_ptr, uint32_t length)) {
+    const uint32_t length64 = length & (-64);
+    const uint32_t tail     = length - length64;
+    const __m512i  lookup   = _mm512_set4_epi32(0x04030302, 0x03020201, 0x03020201, 0x02010100);
+    const __m512i  low_mask = _mm512_set1_epi8(0x0F);
+    const __m512i  zero     = _mm512_setzero_si512();
+    __m512i        sum      = _mm512_setzero_si512();
+
+    for (uint32_t idx = 0u; idx < length64; idx += 64u) {
+        const __m512i data = _mm512_loadu_si512((const void *) (src_ptr + idx));
+
+        sum = _mm512_add_epi64(sum, _mm512_sad_epu8(own_k0_popcount_8u(data, lookup, low_mask), zero));
+    }
+
+    if (tail) {
+        const __mmask64 mask = _bzhi_u64((uint64_t) -1, tail);
+        const __m512i   data = _mm512_maskz_loadu_epi8(mask, (const void *) (src_ptr + length64));
+
+        sum = _mm512_add_epi64(sum, _mm512_sad_epu8(own_k0_popcount_8u(data, lookup, low_mask), zero));
+    }
+
+    return (uint32_t) _mm512_reduce_add_epi64(sum);
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_bitmap_find_first_8u, (const uint8_t *src_ptr, uint32_t length)) {
+    for (uint32_t idx = 0u; idx < length; idx += 64u) {
+        const __mmask64 mask     = _bzhi_u64((uint64_t) -1, QPL_MIN(length - idx, 64u));
+        const __m512i   data     = _mm512_maskz_loadu_epi8(mask, (const void *) (src_ptr + idx));
+        const uint64_t  non_zero = (uint64_t) _mm512_test_epi8_mask(data, data);
+
+        if (non_zero) {
+            const uint32_t byte_idx = idx + (uint32_t) _tzcnt_u64(non_zero);
+
+            return byte_idx * OWN_BYTE_WIDTH + (uint32_t) _tzcnt_u32(src_ptr[byte_idx]);
+        }
+    }
+
+    return OWN_MAX_32U;
+}
+
+OWN_OPT_FUN(uint32_t, k0_qplc_bitmap_find_last_8u, (const uint8_t *src_ptr, uint32_t length)) {
+    uint32_t idx = length;
+
+    while (idx > 0u) {
+        const uint32_t  chunk    = QPL_MIN(idx, 64u);
+        const __mmask64 mask     = _bzhi_u64((uint64_t) -1, chunk);
+        const __m512i   data     = _mm512_maskz_loadu_epi8(mask, (const void *) (src_ptr + idx - chunk));
+        const uint64_t  non_zero = (uint64_t) _mm512_test_epi8_mask(data, data);
+
+        if (non_zero) {
+            const uint32_t byte_idx = idx - chunk + 63u - (uint32_t) _lzcnt_u64(non_zero);
+
+            return byte_idx * OWN_BYTE_WIDTH + 31u - (uint32_t) _lzcnt_u32(src_ptr[byte_idx]);
+        }
+
+        idx -= chunk;
+    }
+
+    return OWN_MAX_32U;
+}
+
+#endif // OWN_BITMAP_K0_H
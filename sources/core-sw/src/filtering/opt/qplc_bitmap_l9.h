@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for operations on bit vectors
+ * @date 10/18/2022
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_bitmap_and_8u
+ *          - @ref l9_qplc_bitmap_or_8u
+ *          - @ref l9_qplc_bitmap_xor_8u
+ *          - @ref l9_qplc_bitmap_and_not_8u
+ *          - @ref l9_qplc_bitmap_not_8u
+ *          - @ref l9_qplc_bitmap_popcount_8u
+ *          - @ref l9_qplc_bitmap_find_first_8u
+ *          - @ref l9_qplc_bitmap_find_last_8u
+ *
+ * @note Population count uses the nibble lookup with byte shuffle, counts of bytes are summed with SAD.
+ */
+
+#ifndef OWN_BITMAP_L9_H
+#define OWN_BITMAP_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+#define OWN_L9_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, vector_expression, scalar_expression)  \
+    {                                                                                                 \
+        const uint32_t length32 = (length) & (-32);                                                   \
+                                                                                                      \
+        for (uint32_t idx = 0u; idx < length32; idx += 32u) {                                         \
+            const __m256i a = _mm256_loadu_si256((const __m256i *) ((src1_ptr) + idx));               \
+            const __m256i b = _mm256_loadu_si256((const __m256i *) ((src2_ptr) + idx));               \
+            _mm256_storeu_si256((__m256i *) ((dst_ptr) + idx), (vector_expression));                 \
+        }                                                                                             \
+                                                                                                      \
+        for (uint32_t idx = length32; idx < (length); idx++) {                                        \
+            const uint8_t a = (src1_ptr)[idx];                                                        \
+            const uint8_t b = (src2_ptr)[idx];                                                        \
+            (dst_ptr)[idx] = (uint8_t) (scalar_expression);                                           \
+        }                                                                                             \
+    }
+
+OWN_OPT_FUN(void, l9_qplc_bitmap_and_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_L9_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm256_and_si256(a, b), a & b)
+}
+
+OWN_OPT_FUN(void, l9_qplc_bitmap_or_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_L9_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm256_or_si256(a, b), a | b)
+}
+
+OWN_OPT_FUN(void, l9_qplc_bitmap_xor_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_L9_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm256_xor_si256(a, b), a ^ b)
+}
+
+OWN_OPT_FUN(void, l9_qplc_bitmap_and_not_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+    OWN_L9_BITMAP_LOGIC(src1_ptr, src2_ptr, dst_ptr, length, _mm256_andnot_si256(b, a), a & ~b)
+}
+
+OWN_OPT_FUN(void, l9_qplc_bitmap_not_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  ones     = _mm256_set1_epi8((char) 0xFF);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        const __m256i data = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        _mm256_storeu_si256((__m256i *) (dst_ptr + idx), _mm256_xor_si256(data, ones));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = (uint8_t) ~src_ptr[idx];
+    }
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_bitmap_popcount_8u, (const uint8_t *src_ptr, uint32_t length)) {
+    const uint32_t length32    = length & (-32);
+    const __m256i  lookup      = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i  low_mask    = _mm256_set1_epi8(0x0F);
+    const __m256i  zero        = _mm256_setzero_si256();
+    __m256i        sum         = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        const __m256i data   = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        const __m256i low    = _mm256_shuffle_epi8(lookup, _mm256_and_si256(data, low_mask));
+        const __m256i high   = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(data, 4), low_mask));
+
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_add_epi8(low, high), zero));
+    }
+
+    uint32_t count = (uint32_t) (_mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1)
+                                 + _mm256_extract_epi64(sum, 2) + _mm256_extract_epi64(sum, 3));
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        count += (uint32_t) _mm_popcnt_u32(src_ptr[idx]);
+    }
+
+    return count;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_bitmap_find_first_8u, (const uint8_t *src_ptr, uint32_t length)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  zero     = _mm256_setzero_si256();
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        const __m256i  data     = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        const uint32_t non_zero = ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, zero));
+
+        if (non_zero) {
+            const uint32_t byte_idx = idx + (uint32_t) _tzcnt_u32(non_zero);
+
+            return byte_idx * OWN_BYTE_WIDTH + (uint32_t) _tzcnt_u32(src_ptr[byte_idx]);
+        }
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (src_ptr[idx]) {
+            return idx * OWN_BYTE_WIDTH + (uint32_t) _tzcnt_u32(src_ptr[idx]);
+        }
+    }
+
+    return OWN_MAX_32U;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_bitmap_find_last_8u, (const uint8_t *src_ptr, uint32_t length)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  zero     = _mm256_setzero_si256();
+
+    for (uint32_t idx = length; idx > length32; idx--) {
+        if (src_ptr[idx - 1u]) {
+            return (idx - 1u) * OWN_BYTE_WIDTH + 31u - (uint32_t) _lzcnt_u32(src_ptr[idx - 1u]);
+        }
+    }
+
+    for (uint32_t idx = length32; idx > 0u; idx -= 32u) {
+        const __m256i  data     = _mm256_loadu_si256((const __m256i *) (src_ptr + idx - 32u));
+        const uint32_t non_zero = ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, zero));
+
+        if (non_zero) {
+            const uint32_t byte_idx = idx - 32u + 31u - (uint32_t) _lzcnt_u32(non_zero);
+
+            return byte_idx * OWN_BYTE_WIDTH + 31u - (uint32_t) _lzcnt_u32(src_ptr[byte_idx]);
+        }
+    }
+
+    return OWN_MAX_32U;
+}
+
+#endif // OWN_BITMAP_L9_H
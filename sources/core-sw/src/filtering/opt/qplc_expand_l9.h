@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of functions for expand
+  * @date 10/17/2022
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_qplc_expand_8u
+  *          - @ref l9_qplc_qplc_expand_16u
+  *          - @ref l9_qplc_qplc_expand_32u
+  *
+  * @note AVX2 has no expand instruction, so 8u and 16u elements are expanded with BMI2 pdep
+  *       over 64-bit chunks and 32u elements are expanded with a cross-lane permutation.
+  */
+#ifndef OWN_EXPAND_L9_H
+#define OWN_EXPAND_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Expands every bit of the 8-bit mask to a byte in 64-bit value (bit 1 -> 0xFF)
+ */
+OWN_QPLC_INLINE(uint64_t, own_l9_expand_bits_to_bytes, (uint32_t mask)) {
+    return _pdep_u64(mask, 0x0101010101010101ULL) * 0xFFu;
+}
+
+/**
+ * @brief Returns bit mask of non-zero bytes for 8 bytes of the second source
+ */
+OWN_QPLC_INLINE(uint32_t, own_l9_expand_mask_8u, (const uint8_t *src2_ptr)) {
+    __m128i data = _mm_loadl_epi64((const __m128i *) src2_ptr);
+
+    return (~(uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_setzero_si128()))) & 0xFFu;
+}
+
+// ********************** 8u ****************************** //
+OWN_OPT_FUN(uint32_t, l9_qplc_qplc_expand_8u, (const uint8_t *src1_ptr,
+    uint32_t length_1,
+    const uint8_t *src2_ptr,
+    uint32_t *length_2_ptr,
+    uint8_t *dst_ptr)) {
+    uint32_t length_2 = *length_2_ptr;
+    uint32_t expanded = 0u;
+    uint32_t idx      = 0u;
+
+    // Vector path is used while 8 source elements can be read without crossing the source end
+    for (; ((idx + 8u) <= length_2) && ((expanded + 8u) <= length_1); idx += 8u) {
+        uint32_t mask = own_l9_expand_mask_8u(src2_ptr + idx);
+        uint64_t data = *(const uint64_t *) (src1_ptr + expanded);
+
+        *(uint64_t *) (dst_ptr + idx) = _pdep_u64(data, own_l9_expand_bits_to_bytes(mask));
+        expanded += (uint32_t) _mm_popcnt_u32(mask);
+    }
+
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_ptr[idx] = src1_ptr[expanded++];
+        } else {
+            dst_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
+
+// ********************** 16u ****************************** //
+OWN_OPT_FUN(uint32_t, l9_qplc_qplc_expand_16u, (const uint8_t *src1_ptr,
+    uint32_t length_1,
+    const uint8_t *src2_ptr,
+    uint32_t *length_2_ptr,
+    uint8_t *dst_ptr)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src1_ptr;
+    uint16_t       *dst_16u_ptr = (uint16_t *) dst_ptr;
+    uint32_t       length_2     = *length_2_ptr;
+    uint32_t       expanded     = 0u;
+    uint32_t       idx          = 0u;
+
+    for (; ((idx + 8u) <= length_2) && ((expanded + 8u) <= length_1); idx += 8u) {
+        uint32_t mask = own_l9_expand_mask_8u(src2_ptr + idx);
+
+        for (uint32_t half = 0u; half < 2u; half++, mask >>= 4u) {
+            // Every element occupies two bytes, so every mask bit is doubled
+            uint32_t mask4 = mask & 0x0Fu;
+            uint64_t data  = *(const uint64_t *) (src_16u_ptr + expanded);
+
+            *(uint64_t *) (dst_16u_ptr + idx + half * 4u) =
+                    _pdep_u64(data, own_l9_expand_bits_to_bytes(_pdep_u32(mask4, 0x55u) * 3u));
+            expanded += (uint32_t) _mm_popcnt_u32(mask4);
+        }
+    }
+
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_16u_ptr[idx] = src_16u_ptr[expanded++];
+        } else {
+            dst_16u_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
+
+// ********************** 32u ****************************** //
+OWN_OPT_FUN(uint32_t, l9_qplc_qplc_expand_32u, (const uint8_t *src1_ptr,
+    uint32_t length_1,
+    const uint8_t *src2_ptr,
+    uint32_t *length_2_ptr,
+    uint8_t *dst_ptr)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src1_ptr;
+    uint32_t       *dst_32u_ptr = (uint32_t *) dst_ptr;
+    uint32_t       length_2     = *length_2_ptr;
+    uint32_t       expanded     = 0u;
+    uint32_t       idx          = 0u;
+
+    for (; ((idx + 8u) <= length_2) && ((expanded + 8u) <= length_1); idx += 8u) {
+        uint32_t mask       = own_l9_expand_mask_8u(src2_ptr + idx);
+        uint64_t mask_bytes = own_l9_expand_bits_to_bytes(mask);
+
+        // Permutation indices of the consecutive source elements are spread to the selected lanes with pdep
+        __m256i  indices    = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((int64_t) _pdep_u64(0x0706050403020100ULL,
+                                                                                           mask_bytes)));
+        __m256i  lanes      = _mm256_cvtepi8_epi32(_mm_cvtsi64_si128((int64_t) mask_bytes));
+        __m256i  data       = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + expanded));
+
+        data = _mm256_and_si256(_mm256_permutevar8x32_epi32(data, indices), lanes);
+        _mm256_storeu_si256((__m256i *) (dst_32u_ptr + idx), data);
+        expanded += (uint32_t) _mm_popcnt_u32(mask);
+    }
+
+    for (; idx < length_2; idx++) {
+        if (src2_ptr[idx]) {
+            OWN_CONDITION_BREAK(expanded >= length_1);
+            dst_32u_ptr[idx] = src_32u_ptr[expanded++];
+        } else {
+            dst_32u_ptr[idx] = 0u;
+        }
+    }
+    *length_2_ptr -= idx;
+    return expanded;
+}
+
+#endif // OWN_EXPAND_L9_H
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of functions for vector packing byte integers to 1...7-bit integers
+ * @date 10/17/2022
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_pack_8u16u
+ *          - @ref l9_qplc_pack_8u32u
+ *
+ * @note Packing to 1...7 bits is implemented with inline @ref own_l9_pack_8u_nu: 1-bit elements are gathered
+ *       with byte movemask, other widths are squeezed with BMI2 pext, 8 elements (bit_width bytes) at once.
+ */
+
+#ifndef OWN_PACK_8U_L9_H
+#define OWN_PACK_8U_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+OWN_QPLC_INLINE(void, own_l9_pack_flush_64u, (uint8_t **dst_pptr,
+                                              uint64_t *bit_buf_ptr,
+                                              uint32_t *bits_in_buf_ptr,
+                                              uint64_t packed,
+                                              uint32_t packed_bits)) {
+    *bit_buf_ptr |= packed << *bits_in_buf_ptr;
+    *bits_in_buf_ptr += packed_bits;
+
+    if (*bits_in_buf_ptr >= 64u) {
+        *(uint64_t *) (*dst_pptr) = *bit_buf_ptr;
+        *dst_pptr += sizeof(uint64_t);
+        *bits_in_buf_ptr -= 64u;
+        // packed_bits is never 64, so the shift below is always well-defined
+        *bit_buf_ptr = (0u == *bits_in_buf_ptr) ? 0u : packed >> (packed_bits - *bits_in_buf_ptr);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_pack_8u_nu, (const uint8_t *src_ptr,
+                                          uint32_t num_elements,
+                                          uint32_t bit_width,
+                                          uint8_t *dst_ptr,
+                                          uint32_t start_bit)) {
+    const uint64_t mask        = OWN_BIT_MASK(bit_width);
+    const uint64_t mask_bytes  = mask * 0x0101010101010101ULL;
+    uint64_t       bit_buf     = (uint64_t) (*dst_ptr) & OWN_BIT_MASK(start_bit);
+    uint32_t       bits_in_buf = start_bit;
+
+    if (1u == bit_width) {
+        for (; num_elements >= 32u; num_elements -= 32u, src_ptr += 32u) {
+            // Move the least significant bit of every byte to the sign position
+            __m256i  data   = _mm256_slli_epi16(_mm256_loadu_si256((const __m256i *) src_ptr), 7);
+            uint32_t packed = (uint32_t) _mm256_movemask_epi8(data);
+
+            own_l9_pack_flush_64u(&dst_ptr, &bit_buf, &bits_in_buf, packed, 32u);
+        }
+    }
+
+    for (; num_elements >= 8u; num_elements -= 8u, src_ptr += 8u) {
+        uint64_t packed = _pext_u64(*(const uint64_t *) src_ptr, mask_bytes);
+
+        own_l9_pack_flush_64u(&dst_ptr, &bit_buf, &bits_in_buf, packed, 8u * bit_width);
+    }
+
+    for (uint32_t i = 0u; i < num_elements; i++) {
+        own_l9_pack_flush_64u(&dst_ptr, &bit_buf, &bits_in_buf, src_ptr[i] & mask, bit_width);
+    }
+
+    while (bits_in_buf > 0u) {
+        *dst_ptr++ = (uint8_t) bit_buf;
+        bit_buf >>= OWN_BYTE_WIDTH;
+        bits_in_buf = (bits_in_buf > OWN_BYTE_WIDTH) ? bits_in_buf - OWN_BYTE_WIDTH : 0u;
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_pack_8u16u, (const uint8_t *src_ptr, uint32_t num_elements, uint8_t *dst_ptr)) {
+    uint16_t       *dst_16u_ptr = (uint16_t *) dst_ptr;
+    const uint32_t num_elements_16 = num_elements & (-16);
+
+    for (uint32_t i = 0u; i < num_elements_16; i += 16u) {
+        __m128i data = _mm_loadu_si128((const __m128i *) (src_ptr + i));
+        _mm256_storeu_si256((__m256i *) (dst_16u_ptr + i), _mm256_cvtepu8_epi16(data));
+    }
+
+    for (uint32_t i = num_elements_16; i < num_elements; i++) {
+        dst_16u_ptr[i] = src_ptr[i];
+    }
+}
+
+OWN_OPT_FUN(void, l9_qplc_pack_8u32u, (const uint8_t *src_ptr, uint32_t num_elements, uint8_t *dst_ptr)) {
+    uint32_t       *dst_32u_ptr = (uint32_t *) dst_ptr;
+    const uint32_t num_elements_8 = num_elements & (-8);
+
+    for (uint32_t i = 0u; i < num_elements_8; i += 8u) {
+        __m128i data = _mm_loadl_epi64((const __m128i *) (src_ptr + i));
+        _mm256_storeu_si256((__m256i *) (dst_32u_ptr + i), _mm256_cvtepu8_epi32(data));
+    }
+
+    for (uint32_t i = num_elements_8; i < num_elements; i++) {
+        dst_32u_ptr[i] = src_ptr[i];
+    }
+}
+
+#endif // OWN_PACK_8U_L9_H
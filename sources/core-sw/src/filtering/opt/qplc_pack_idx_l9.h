@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of functions for vector packing byte integers indexes
+  * @date 10/18/2022
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_pack_index_8u
+  *          - @ref l9_qplc_pack_index_8u16u
+  *          - @ref l9_qplc_pack_index_8u32u
+  *
+  * @note Non-zero elements are found with a compare mask over 32 elements. 8u and 16u indexes of the chunk
+  *       are compressed with BMI2 pext from the vector of all chunk indexes, 32u indexes are taken from
+  *       the mask with tzcnt. Chunks that may overflow the index or the destination are left to the scalar code
+  *       to keep its exact status and output.
+  */
+
+#ifndef OWN_PACK_INDEX_L9_H
+#define OWN_PACK_INDEX_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+#define OWN_L9_PACK_INDEX_CHUNK 32u
+
+/**
+ * @brief Returns bit mask of non-zero bytes for 32 bytes of the source
+ */
+OWN_QPLC_INLINE(uint32_t, own_l9_pack_index_mask, (const uint8_t *src_ptr)) {
+    __m256i data = _mm256_loadu_si256((const __m256i *) src_ptr);
+
+    return ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, _mm256_setzero_si256()));
+}
+
+/**
+ * @brief Packs indexes of the non-zero elements one by one, it is used for the tail and near the limits
+ */
+OWN_QPLC_INLINE(qplc_status_t, own_l9_pack_index_scalar, (const uint8_t *src_ptr,
+    uint32_t num_elements,
+    uint8_t **pp_dst,
+    uint8_t *end_ptr,
+    uint32_t element_size,
+    uint64_t max_index,
+    uint64_t *index_ptr)) {
+    uint64_t index    = *index_ptr;
+    uint8_t  *dst_ptr = *pp_dst;
+
+    for (uint32_t i = 0u; i < num_elements; i++) {
+        if (0u < src_ptr[i]) {
+            if (max_index < index) {
+                *pp_dst    = dst_ptr;
+                *index_ptr = index;
+                return QPLC_STS_OUTPUT_OVERFLOW_ERR;
+            }
+            if (dst_ptr + element_size > end_ptr) {
+                *pp_dst    = dst_ptr;
+                *index_ptr = index;
+                return QPLC_STS_DST_IS_SHORT_ERR;
+            }
+            switch (element_size) {
+                case 1u: *dst_ptr = (uint8_t) index; break;
+                case 2u: *(uint16_t *) dst_ptr = (uint16_t) index; break;
+                default: *(uint32_t *) dst_ptr = (uint32_t) index; break;
+            }
+            dst_ptr += element_size;
+        }
+        index++;
+    }
+
+    *pp_dst    = dst_ptr;
+    *index_ptr = index;
+    return QPLC_STS_OK;
+}
+
+OWN_OPT_FUN(qplc_status_t, l9_qplc_pack_index_8u, (const uint8_t *src_ptr,
+    uint32_t num_elements,
+    uint8_t **pp_dst,
+    uint32_t dst_length,
+    uint32_t *index_ptr)) {
+    uint64_t index      = *index_ptr;
+    uint8_t  *dst_ptr   = *pp_dst;
+    uint8_t  *end_ptr   = dst_ptr + dst_length;
+    uint32_t num_chunks = num_elements / OWN_L9_PACK_INDEX_CHUNK;
+    uint32_t i          = 0u;
+
+    for (; i < num_chunks * OWN_L9_PACK_INDEX_CHUNK; i += OWN_L9_PACK_INDEX_CHUNK) {
+        uint32_t mask = own_l9_pack_index_mask(src_ptr + i);
+
+        if (0u == mask) {
+            index += OWN_L9_PACK_INDEX_CHUNK;
+            continue;
+        }
+        if ((UINT8_MAX + 1u < index + OWN_L9_PACK_INDEX_CHUNK)
+            || ((uint32_t) (end_ptr - dst_ptr) < (uint32_t) _mm_popcnt_u32(mask))) {
+            break;
+        }
+
+        /* Indexes of 8 elements are bytes of one 64-bit value, the selected ones are extracted with pext */
+        uint64_t indexes = 0x0706050403020100ULL + index * 0x0101010101010101ULL;
+
+        for (; 0u != mask; mask >>= 8u, indexes += 0x0808080808080808ULL) {
+            uint32_t mask8    = mask & 0xFFu;
+            uint64_t selected = _pext_u64(indexes, _pdep_u64(mask8, 0x0101010101010101ULL) * 0xFFu);
+
+            for (uint32_t count = (uint32_t) _mm_popcnt_u32(mask8); 0u < count; count--, selected >>= 8u) {
+                *dst_ptr++ = (uint8_t) selected;
+            }
+        }
+        index += OWN_L9_PACK_INDEX_CHUNK;
+    }
+
+    qplc_status_t status = own_l9_pack_index_scalar(src_ptr + i, num_elements - i, &dst_ptr, end_ptr,
+                                                    sizeof(uint8_t), UINT8_MAX, &index);
+
+    *pp_dst    = dst_ptr;
+    *index_ptr = (uint32_t) index;
+    return status;
+}
+
+OWN_OPT_FUN(qplc_status_t, l9_qplc_pack_index_8u16u, (const uint8_t *src_ptr,
+    uint32_t num_elements,
+    uint8_t **pp_dst,
+    uint32_t dst_length,
+    uint32_t *index_ptr)) {
+    uint64_t index      = *index_ptr;
+    uint8_t  *dst_ptr   = *pp_dst;
+    uint8_t  *end_ptr   = dst_ptr + (dst_length & ~1u);
+    uint32_t num_chunks = num_elements / OWN_L9_PACK_INDEX_CHUNK;
+    uint32_t i          = 0u;
+
+    for (; i < num_chunks * OWN_L9_PACK_INDEX_CHUNK; i += OWN_L9_PACK_INDEX_CHUNK) {
+        uint32_t mask = own_l9_pack_index_mask(src_ptr + i);
+
+        if (0u == mask) {
+            index += OWN_L9_PACK_INDEX_CHUNK;
+            continue;
+        }
+        if ((OWN_MAX_16U + 1u < index + OWN_L9_PACK_INDEX_CHUNK)
+            || ((uint32_t) (end_ptr - dst_ptr) < (uint32_t) _mm_popcnt_u32(mask) * sizeof(uint16_t))) {
+            break;
+        }
+
+        /* Indexes of 4 elements are words of one 64-bit value, the selected ones are extracted with pext */
+        uint64_t indexes = 0x0003000200010000ULL + index * 0x0001000100010001ULL;
+
+        for (; 0u != mask; mask >>= 4u, indexes += 0x0004000400040004ULL) {
+            uint32_t mask4    = mask & 0xFu;
+            uint64_t selected = _pext_u64(indexes, _pdep_u64(mask4, 0x0001000100010001ULL) * 0xFFFFu);
+
+            for (uint32_t count = (uint32_t) _mm_popcnt_u32(mask4); 0u < count; count--, selected >>= 16u) {
+                *(uint16_t *) dst_ptr = (uint16_t) selected;
+                dst_ptr += sizeof(uint16_t);
+            }
+        }
+        index += OWN_L9_PACK_INDEX_CHUNK;
+    }
+
+    qplc_status_t status = own_l9_pack_index_scalar(src_ptr + i, num_elements - i, &dst_ptr, end_ptr,
+                                                    sizeof(uint16_t), OWN_MAX_16U, &index);
+
+    *pp_dst    = dst_ptr;
+    *index_ptr = (uint32_t) index;
+    return status;
+}
+
+OWN_OPT_FUN(qplc_status_t, l9_qplc_pack_index_8u32u, (const uint8_t *src_ptr,
+    uint32_t num_elements,
+    uint8_t **pp_dst,
+    uint32_t dst_length,
+    uint32_t *index_ptr)) {
+    uint64_t index      = *index_ptr;
+    uint8_t  *dst_ptr   = *pp_dst;
+    uint8_t  *end_ptr   = dst_ptr + (dst_length & ~3u);
+    uint32_t num_chunks = num_elements / OWN_L9_PACK_INDEX_CHUNK;
+    uint32_t i          = 0u;
+
+    for (; i < num_chunks * OWN_L9_PACK_INDEX_CHUNK; i += OWN_L9_PACK_INDEX_CHUNK) {
+        uint32_t mask = own_l9_pack_index_mask(src_ptr + i);
+
+        if (0u == mask) {
+            index += OWN_L9_PACK_INDEX_CHUNK;
+            continue;
+        }
+        if (((uint64_t) OWN_MAX_32U + 1u < index + OWN_L9_PACK_INDEX_CHUNK)
+            || ((uint32_t) (end_ptr - dst_ptr) < (uint32_t) _mm_popcnt_u32(mask) * sizeof(uint32_t))) {
+            break;
+        }
+
+        /* Two 32u indexes don't gain from pext, positions are taken from the mask directly */
+        for (; 0u != mask; mask = _blsr_u32(mask)) {
+            *(uint32_t *) dst_ptr = (uint32_t) index + _tzcnt_u32(mask);
+            dst_ptr += sizeof(uint32_t);
+        }
+        index += OWN_L9_PACK_INDEX_CHUNK;
+    }
+
+    qplc_status_t status = own_l9_pack_index_scalar(src_ptr + i, num_elements - i, &dst_ptr, end_ptr,
+                                                    sizeof(uint32_t), OWN_MAX_32U, &index);
+
+    *pp_dst    = dst_ptr;
+    *index_ptr = (uint32_t) index;
+    return status;
+}
+
+#endif // OWN_PACK_INDEX_L9_H
@@ -0,0 +1,384 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of all functions for scan analytics operation
+ * @date 10/17/2022
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_scan_lt_8u
+ *          - @ref l9_qplc_scan_lt_16u8u
+ *          - @ref l9_qplc_scan_lt_32u8u
+ *          - @ref l9_qplc_scan_le_8u
+ *          - @ref l9_qplc_scan_le_16u8u
+ *          - @ref l9_qplc_scan_le_32u8u
+ *          - @ref l9_qplc_scan_gt_8u
+ *          - @ref l9_qplc_scan_gt_16u8u
+ *          - @ref l9_qplc_scan_gt_32u8u
+ *          - @ref l9_qplc_scan_ge_8u
+ *          - @ref l9_qplc_scan_ge_16u8u
+ *          - @ref l9_qplc_scan_ge_32u8u
+ *          - @ref l9_qplc_scan_eq_8u
+ *          - @ref l9_qplc_scan_eq_16u8u
+ *          - @ref l9_qplc_scan_eq_32u8u
+ *          - @ref l9_qplc_scan_ne_8u
+ *          - @ref l9_qplc_scan_ne_16u8u
+ *          - @ref l9_qplc_scan_ne_32u8u
+ *          - @ref l9_qplc_scan_range_8u
+ *          - @ref l9_qplc_scan_range_16u8u
+ *          - @ref l9_qplc_scan_range_32u8u
+ *          - @ref l9_qplc_scan_not_range_8u
+ *          - @ref l9_qplc_scan_not_range_16u8u
+ *          - @ref l9_qplc_scan_not_range_32u8u
+ *
+ * @note AVX2 has no unsigned comparisons, so every predicate is reduced to min/max + equality:
+ *       x >= v <=> max(x, v) == x and x <= v <=> min(x, v) == x. The remaining predicates are
+ *       the negations of EQ, GE, LE and RANGE.
+ */
+
+#ifndef OWN_SCAN_L9_H
+#define OWN_SCAN_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Base predicates evaluated by AVX2 scan kernels
+ */
+typedef enum {
+    own_l9_scan_eq    = 0u,
+    own_l9_scan_le    = 1u,
+    own_l9_scan_ge    = 2u,
+    own_l9_scan_range = 3u
+} own_l9_scan_predicate_t;
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_8u_kernel, (__m256i src,
+                                                 __m256i low,
+                                                 __m256i high,
+                                                 own_l9_scan_predicate_t predicate)) {
+    switch (predicate) {
+        case own_l9_scan_eq:
+            return _mm256_cmpeq_epi8(src, low);
+        case own_l9_scan_le:
+            return _mm256_cmpeq_epi8(_mm256_min_epu8(src, low), src);
+        case own_l9_scan_ge:
+            return _mm256_cmpeq_epi8(_mm256_max_epu8(src, low), src);
+        default:
+            return _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(src, low), src),
+                                    _mm256_cmpeq_epi8(_mm256_min_epu8(src, high), src));
+    }
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_16u_kernel, (__m256i src,
+                                                  __m256i low,
+                                                  __m256i high,
+                                                  own_l9_scan_predicate_t predicate)) {
+    switch (predicate) {
+        case own_l9_scan_eq:
+            return _mm256_cmpeq_epi16(src, low);
+        case own_l9_scan_le:
+            return _mm256_cmpeq_epi16(_mm256_min_epu16(src, low), src);
+        case own_l9_scan_ge:
+            return _mm256_cmpeq_epi16(_mm256_max_epu16(src, low), src);
+        default:
+            return _mm256_and_si256(_mm256_cmpeq_epi16(_mm256_max_epu16(src, low), src),
+                                    _mm256_cmpeq_epi16(_mm256_min_epu16(src, high), src));
+    }
+}
+
+OWN_QPLC_INLINE(__m256i, own_l9_scan_32u_kernel, (__m256i src,
+                                                  __m256i low,
+                                                  __m256i high,
+                                                  own_l9_scan_predicate_t predicate)) {
+    switch (predicate) {
+        case own_l9_scan_eq:
+            return _mm256_cmpeq_epi32(src, low);
+        case own_l9_scan_le:
+            return _mm256_cmpeq_epi32(_mm256_min_epu32(src, low), src);
+        case own_l9_scan_ge:
+            return _mm256_cmpeq_epi32(_mm256_max_epu32(src, low), src);
+        default:
+            return _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(src, low), src),
+                                    _mm256_cmpeq_epi32(_mm256_min_epu32(src, high), src));
+    }
+}
+
+OWN_QPLC_INLINE(uint8_t, own_l9_scan_scalar, (uint32_t value,
+                                              uint32_t low_value,
+                                              uint32_t high_value,
+                                              own_l9_scan_predicate_t predicate,
+                                              uint32_t invert)) {
+    uint32_t result;
+
+    switch (predicate) {
+        case own_l9_scan_eq:
+            result = (value == low_value);
+            break;
+        case own_l9_scan_le:
+            result = (value <= low_value);
+            break;
+        case own_l9_scan_ge:
+            result = (value >= low_value);
+            break;
+        default:
+            result = (low_value <= value) && (value <= high_value);
+    }
+
+    return (uint8_t) (result ^ invert);
+}
+
+/**
+ * @brief Converts 0xFF/0x00 byte mask to 1/0 bytes, inverting the predicate if required
+ */
+OWN_QPLC_INLINE(__m256i, own_l9_scan_mask_to_bytes, (__m256i mask, uint32_t invert)) {
+    const __m256i one = _mm256_set1_epi8(1);
+
+    return (invert) ? _mm256_andnot_si256(mask, one) : _mm256_and_si256(mask, one);
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_8u, (const uint8_t *src_ptr,
+                                       uint8_t *dst_ptr,
+                                       uint32_t length,
+                                       uint32_t low_value,
+                                       uint32_t high_value,
+                                       own_l9_scan_predicate_t predicate,
+                                       uint32_t invert)) {
+    const uint32_t length32 = length & (-32);
+    const __m256i  low      = _mm256_set1_epi8((char) low_value);
+    const __m256i  high     = _mm256_set1_epi8((char) high_value);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i src  = _mm256_loadu_si256((const __m256i *) (src_ptr + idx));
+        __m256i mask = own_l9_scan_8u_kernel(src, low, high, predicate);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + idx), own_l9_scan_mask_to_bytes(mask, invert));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_ptr[idx], low_value, high_value, predicate, invert);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_16u8u, (const uint8_t *src_ptr,
+                                          uint8_t *dst_ptr,
+                                          uint32_t length,
+                                          uint32_t low_value,
+                                          uint32_t high_value,
+                                          own_l9_scan_predicate_t predicate,
+                                          uint32_t invert)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    const uint32_t length32     = length & (-32);
+    const __m256i  low          = _mm256_set1_epi16((short) low_value);
+    const __m256i  high         = _mm256_set1_epi16((short) high_value);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i src_0  = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx));
+        __m256i src_1  = _mm256_loadu_si256((const __m256i *) (src_16u_ptr + idx + 16u));
+        __m256i mask_0 = own_l9_scan_16u_kernel(src_0, low, high, predicate);
+        __m256i mask_1 = own_l9_scan_16u_kernel(src_1, low, high, predicate);
+
+        // Pack works within 128-bit lanes, so restore the element order with qword permutation
+        __m256i mask = _mm256_permute4x64_epi64(_mm256_packs_epi16(mask_0, mask_1), 0xD8);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + idx), own_l9_scan_mask_to_bytes(mask, invert));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_16u_ptr[idx], low_value, high_value, predicate, invert);
+    }
+}
+
+OWN_QPLC_INLINE(void, own_l9_scan_32u8u, (const uint8_t *src_ptr,
+                                          uint8_t *dst_ptr,
+                                          uint32_t length,
+                                          uint32_t low_value,
+                                          uint32_t high_value,
+                                          own_l9_scan_predicate_t predicate,
+                                          uint32_t invert)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    const uint32_t length32     = length & (-32);
+    const __m256i  low          = _mm256_set1_epi32((int) low_value);
+    const __m256i  high         = _mm256_set1_epi32((int) high_value);
+    const __m256i  permutation  = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        __m256i mask_0 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx)),
+                                                low, high, predicate);
+        __m256i mask_1 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx + 8u)),
+                                                low, high, predicate);
+        __m256i mask_2 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx + 16u)),
+                                                low, high, predicate);
+        __m256i mask_3 = own_l9_scan_32u_kernel(_mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx + 24u)),
+                                                low, high, predicate);
+
+        __m256i mask_01 = _mm256_packs_epi32(mask_0, mask_1);
+        __m256i mask_23 = _mm256_packs_epi32(mask_2, mask_3);
+        __m256i mask    = _mm256_permutevar8x32_epi32(_mm256_packs_epi16(mask_01, mask_23), permutation);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + idx), own_l9_scan_mask_to_bytes(mask, invert));
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        dst_ptr[idx] = own_l9_scan_scalar(src_32u_ptr[idx], low_value, high_value, predicate, invert);
+    }
+}
+
+// ********************** EQ / NE ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_eq_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ne_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_eq, 1u);
+}
+
+// ********************** LT / GE ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_lt_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_ge_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_ge, 0u);
+}
+
+// ********************** LE / GT ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_le_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_gt_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, low_value, own_l9_scan_le, 1u);
+}
+
+// ********************** RANGE / NOT_RANGE ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_range_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range, 0u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_16u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_16u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range, 1u);
+}
+
+OWN_OPT_FUN(void, l9_qplc_scan_not_range_32u8u, (const uint8_t *src_ptr, uint8_t *dst_ptr,
+    uint32_t length,
+    uint32_t low_value,
+    uint32_t high_value)) {
+    own_l9_scan_32u8u(src_ptr, dst_ptr, length, low_value, high_value, own_l9_scan_range, 1u);
+}
+
+#endif // OWN_SCAN_L9_H
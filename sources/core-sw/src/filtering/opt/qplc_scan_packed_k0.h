@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX-512 implementation of scan functions for packed input data of any bit width
+ * @date 10/17/2022
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_scan_range_nu1u
+ *
+ * @note Words covering every 128-bit lane are gathered from the single masked load with 16-bit permute
+ *       (AVX-512BW), then bytes of elements are placed to 16-bit (elements of up to 9 bits, 32 elements per vector),
+ *       32-bit (up to 25 bits, 16 elements per vector) or 64-bit (8 elements per vector) lanes with in-lane byte
+ *       shuffle. Loads never cross the end of the last processed group, results of comparison are taken from
+ *       the mask register and written to the destination bit vector directly.
+ */
+
+#ifndef OWN_SCAN_PACKED_K0_H
+#define OWN_SCAN_PACKED_K0_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+#define OWN_K0_SCAN_PACKED_MAX_16U_WIDTH 9u  /**< Max bit width that fits into 16-bit lane with any bit offset */
+#define OWN_K0_SCAN_PACKED_MAX_32U_WIDTH 25u /**< Max bit width that fits into 32-bit lane with any bit offset */
+
+/**
+ * @brief Precalculated permutations and shifts to extract a group of elements of the fixed bit width
+ */
+typedef struct {
+    __m512i   permutation; /**< Indices of words of every 128-bit lane */
+    __m512i   shuffle;     /**< In-lane byte shuffle */
+    __m512i   shift;       /**< Bit shifts */
+    __mmask64 load_mask;   /**< Mask of source bytes of the group */
+} own_k0_scan_packed_state_t;
+
+/**
+ * @brief Initializes state for extraction of (64 / element_bytes) elements to lanes of element_bytes size
+ */
+OWN_QPLC_INLINE(void, own_k0_scan_packed_init, (own_k0_scan_packed_state_t *state_ptr,
+                                                uint32_t bit_width,
+                                                uint32_t element_bytes)) {
+    OWN_ALIGNED_64_ARRAY(uint16_t permutation[32]);
+    OWN_ALIGNED_64_ARRAY(uint8_t shuffle[64]);
+    OWN_ALIGNED_64_ARRAY(uint8_t shift[64]);
+    const uint32_t elements_per_lane = 16u / element_bytes;
+
+    for (uint32_t lane = 0u; lane < 4u; lane++) {
+        const uint32_t lane_word = (lane * elements_per_lane * bit_width) / 16u;
+
+        for (uint32_t i = 0u; i < 8u; i++) {
+            permutation[lane * 8u + i] = (uint16_t) (lane_word + i);
+        }
+
+        for (uint32_t element = 0u; element < elements_per_lane; element++) {
+            const uint32_t bit_offset = (lane * elements_per_lane + element) * bit_width;
+            const uint32_t delta      = bit_offset / OWN_BYTE_WIDTH - 2u * lane_word;
+            const uint32_t position   = (lane * elements_per_lane + element) * element_bytes;
+
+            for (uint32_t i = 0u; i < element_bytes; i++) {
+                shuffle[position + i] = (uint8_t) (delta + i);
+                shift[position + i]   = 0u;
+            }
+            shift[position] = (uint8_t) (bit_offset % OWN_BYTE_WIDTH);
+        }
+    }
+
+    state_ptr->permutation = _mm512_load_si512((const void *) permutation);
+    state_ptr->shuffle     = _mm512_load_si512((const void *) shuffle);
+    state_ptr->shift       = _mm512_load_si512((const void *) shift);
+    state_ptr->load_mask   = (__mmask64) OWN_BIT_MASK((64u / element_bytes) * bit_width / OWN_BYTE_WIDTH);
+}
+
+OWN_QPLC_INLINE(__m512i, own_k0_scan_packed_load, (const uint8_t *src_ptr,
+                                                   const own_k0_scan_packed_state_t *state_ptr)) {
+    __m512i values = _mm512_maskz_loadu_epi8(state_ptr->load_mask, (const void *) src_ptr);
+
+    values = _mm512_permutexvar_epi16(state_ptr->permutation, values);
+
+    return _mm512_shuffle_epi8(values, state_ptr->shuffle);
+}
+
+/**
+ * @brief Scans groups of 32, 16 or 8 elements depending on the bit width
+ *
+ * @return number of processed elements (multiple of 8)
+ */
+OWN_OPT_FUN(uint32_t, k0_qplc_scan_range_nu1u, (const uint8_t *src_ptr,
+                                                uint32_t length,
+                                                uint32_t bit_width,
+                                                uint8_t *dst_ptr,
+                                                uint32_t low_value,
+                                                uint32_t high_value,
+                                                uint8_t invert_mask)) {
+    own_k0_scan_packed_state_t state;
+    uint32_t                   processed = 0u;
+
+    if (bit_width <= OWN_K0_SCAN_PACKED_MAX_16U_WIDTH) {
+        const __m512i  mask        = _mm512_set1_epi16((int16_t) OWN_BIT_MASK(bit_width));
+        const __m512i  low_value_v = _mm512_set1_epi16((int16_t) low_value);
+        const __m512i  range_v     = _mm512_set1_epi16((int16_t) (high_value - low_value));
+        const uint32_t invert_32u  = invert_mask * 0x01010101u;
+
+        own_k0_scan_packed_init(&state, bit_width, sizeof(uint16_t));
+
+        // Group of 32 elements occupies 4 * bit_width bytes
+        for (; processed + 32u <= length; processed += 32u) {
+            __m512i values = own_k0_scan_packed_load(src_ptr, &state);
+
+            values = _mm512_and_si512(_mm512_srlv_epi16(values, state.shift), mask);
+
+            __mmask32 matches = _mm512_cmple_epu16_mask(_mm512_sub_epi16(values, low_value_v), range_v);
+
+            *(uint32_t *) dst_ptr = _cvtmask32_u32(matches) ^ invert_32u;
+            src_ptr += 4u * bit_width;
+            dst_ptr += sizeof(uint32_t);
+        }
+    } else if (bit_width <= OWN_K0_SCAN_PACKED_MAX_32U_WIDTH) {
+        const __m512i  mask        = _mm512_set1_epi32((int32_t) OWN_BIT_MASK(bit_width));
+        const __m512i  low_value_v = _mm512_set1_epi32((int32_t) low_value);
+        const __m512i  range_v     = _mm512_set1_epi32((int32_t) (high_value - low_value));
+        const uint16_t invert_16u  = (uint16_t) (invert_mask * 0x0101u);
+
+        own_k0_scan_packed_init(&state, bit_width, sizeof(uint32_t));
+
+        // Group of 16 elements occupies 2 * bit_width bytes
+        for (; processed + 16u <= length; processed += 16u) {
+            __m512i values = own_k0_scan_packed_load(src_ptr, &state);
+
+            values = _mm512_and_si512(_mm512_srlv_epi32(values, state.shift), mask);
+
+            __mmask16 matches = _mm512_cmple_epu32_mask(_mm512_sub_epi32(values, low_value_v), range_v);
+
+            *(uint16_t *) dst_ptr = (uint16_t) (_cvtmask16_u32(matches) ^ invert_16u);
+            src_ptr += 2u * bit_width;
+            dst_ptr += sizeof(uint16_t);
+        }
+    } else {
+        const __m512i  mask        = _mm512_set1_epi64((int64_t) OWN_BIT_MASK(bit_width));
+        const __m512i  low_value_v = _mm512_set1_epi64((int64_t) low_value);
+        const __m512i  range_v     = _mm512_set1_epi64((int64_t) (high_value - low_value));
+        const uint16_t invert_16u  = (uint16_t) (invert_mask * 0x0101u);
+
+        own_k0_scan_packed_init(&state, bit_width, sizeof(uint64_t));
+
+        // Two groups of 8 elements are processed at once to write 16-bit results
+        for (; processed + 16u <= length; processed += 16u) {
+            __m512i values_low  = own_k0_scan_packed_load(src_ptr, &state);
+            __m512i values_high = own_k0_scan_packed_load(src_ptr + bit_width, &state);
+
+            values_low  = _mm512_and_si512(_mm512_srlv_epi64(values_low, state.shift), mask);
+            values_high = _mm512_and_si512(_mm512_srlv_epi64(values_high, state.shift), mask);
+
+            __mmask8 matches_low  = _mm512_cmple_epu64_mask(_mm512_sub_epi64(values_low, low_value_v), range_v);
+            __mmask8 matches_high = _mm512_cmple_epu64_mask(_mm512_sub_epi64(values_high, low_value_v), range_v);
+
+            *(uint16_t *) dst_ptr = (uint16_t) ((_cvtmask8_u32(matches_low) | (_cvtmask8_u32(matches_high) << 8u))
+                                                ^ invert_16u);
+            src_ptr += 2u * bit_width;
+            dst_ptr += sizeof(uint16_t);
+        }
+
+        if (processed + 8u <= length) {
+            __m512i values = own_k0_scan_packed_load(src_ptr, &state);
+
+            values = _mm512_and_si512(_mm512_srlv_epi64(values, state.shift), mask);
+
+            __mmask8 matches = _mm512_cmple_epu64_mask(_mm512_sub_epi64(values, low_value_v), range_v);
+
+            *dst_ptr = (uint8_t) (_cvtmask8_u32(matches) ^ invert_mask);
+            processed += 8u;
+        }
+    }
+
+    return processed;
+}
+
+#endif // OWN_SCAN_PACKED_K0_H
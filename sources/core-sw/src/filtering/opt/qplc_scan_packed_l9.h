@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of scan functions for packed input data of any bit width
+ * @date 10/17/2022
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_scan_range_nu1u
+ *
+ * @note Elements of up to 25 bits are extracted to 32-bit lanes (4 elements per 128-bit lane),
+ *       wider elements are extracted to 64-bit lanes with @ref own_l9_unpack_8_elements.
+ */
+
+#ifndef OWN_SCAN_PACKED_L9_H
+#define OWN_SCAN_PACKED_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+#include "own_unpack_l9.h"
+
+#define OWN_L9_SCAN_PACKED_MAX_32U_WIDTH 25u /**< Max bit width that fits into 32-bit lane with any bit offset */
+
+/**
+ * @brief Precalculated byte shuffle and shifts to extract 8 elements of up to 25 bits to 32-bit lanes
+ */
+typedef struct {
+    uint32_t high_lane_offset; /**< Byte offset of the 128-bit load for elements 4..7 */
+    __m256i  shuffle;          /**< Byte shuffle */
+    __m256i  shift;            /**< Bit shifts */
+    __m256i  mask;             /**< Mask of the bit width */
+} own_l9_scan_packed_state_t;
+
+OWN_QPLC_INLINE(void, own_l9_scan_packed_init, (own_l9_scan_packed_state_t *state_ptr, uint32_t bit_width)) {
+    OWN_ALIGNED_ARRAY(uint8_t shuffle[32], 32u);
+    OWN_ALIGNED_ARRAY(uint32_t shift[8], 32u);
+
+    state_ptr->high_lane_offset = (4u * bit_width) / OWN_BYTE_WIDTH;
+
+    for (uint32_t element = 0u; element < 8u; element++) {
+        uint32_t bit_offset  = element * bit_width;
+        uint32_t lane_offset = (element < 4u) ? 0u : state_ptr->high_lane_offset;
+        uint32_t delta       = bit_offset / OWN_BYTE_WIDTH - lane_offset;
+
+        for (uint32_t i = 0u; i < 4u; i++) {
+            shuffle[element * 4u + i] = (uint8_t) (delta + i);
+        }
+        shift[element] = bit_offset % OWN_BYTE_WIDTH;
+    }
+
+    state_ptr->shuffle = _mm256_load_si256((const __m256i *) shuffle);
+    state_ptr->shift   = _mm256_load_si256((const __m256i *) shift);
+    state_ptr->mask    = _mm256_set1_epi32((int32_t) OWN_BIT_MASK(bit_width));
+}
+
+/**
+ * @brief Returns 8-bit mask of elements for which (value - low_value) <= range
+ */
+OWN_QPLC_INLINE(uint32_t, own_l9_scan_packed_compare, (__m256i values, __m256i low_value, __m256i range)) {
+    __m256i distance = _mm256_sub_epi32(values, low_value);
+    __m256i matches  = _mm256_cmpeq_epi32(_mm256_min_epu32(distance, range), distance);
+
+    return (uint32_t) _mm256_movemask_ps(_mm256_castsi256_ps(matches));
+}
+
+/**
+ * @brief Scans groups of 8 elements while 128-bit loads don't cross the end of the source
+ *
+ * @return number of processed elements (multiple of 8)
+ */
+OWN_OPT_FUN(uint32_t, l9_qplc_scan_range_nu1u, (const uint8_t *src_ptr,
+                                                uint32_t length,
+                                                uint32_t bit_width,
+                                                uint8_t *dst_ptr,
+                                                uint32_t low_value,
+                                                uint32_t high_value,
+                                                uint8_t invert_mask)) {
+    const __m256i  low_value_v = _mm256_set1_epi32((int32_t) low_value);
+    const __m256i  range_v     = _mm256_set1_epi32((int32_t) (high_value - low_value));
+    const uint32_t group_count = length / 8u;
+    uint32_t       last_load   = 0u;
+    uint32_t       group       = 0u;
+
+    if (bit_width <= OWN_L9_SCAN_PACKED_MAX_32U_WIDTH) {
+        own_l9_scan_packed_state_t state;
+
+        own_l9_scan_packed_init(&state, bit_width);
+        last_load = state.high_lane_offset + 16u;
+
+        for (; (group * bit_width + last_load) <= (group_count * bit_width); group++) {
+            __m256i values = own_l9_load_2x128(src_ptr, src_ptr + state.high_lane_offset);
+
+            values = _mm256_shuffle_epi8(values, state.shuffle);
+            values = _mm256_and_si256(_mm256_srlv_epi32(values, state.shift), state.mask);
+
+            *dst_ptr++ = (uint8_t) (own_l9_scan_packed_compare(values, low_value_v, range_v) ^ invert_mask);
+            src_ptr += bit_width;
+        }
+    } else {
+        own_l9_unpack_state_t state;
+
+        own_l9_unpack_init(&state, 0u, bit_width);
+        last_load = state.byte_offset[3] + 16u;
+
+        for (; (group * bit_width + last_load) <= (group_count * bit_width); group++) {
+            __m256i values = own_l9_unpack_8_elements(src_ptr, &state);
+
+            *dst_ptr++ = (uint8_t) (own_l9_scan_packed_compare(values, low_value_v, range_v) ^ invert_mask);
+            src_ptr += bit_width;
+        }
+    }
+
+    return group * 8u;
+}
+
+#endif // OWN_SCAN_PACKED_L9_H
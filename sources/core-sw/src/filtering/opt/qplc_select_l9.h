@@ -0,0 +1,159 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of all functions for select analytics operation
+  * @date 10/17/2022
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_select_8u
+  *          - @ref l9_qplc_select_16u
+  *          - @ref l9_qplc_select_32u
+  *
+  * @note AVX2 has no compress instruction, so 8u and 16u elements are compressed with BMI2 pext
+  *       over 64-bit chunks and 32u elements are compressed with a cross-lane permutation.
+  */
+
+#ifndef OWN_SELECT_L9_H
+#define OWN_SELECT_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+/**
+ * @brief Returns bit mask of non-zero bytes for 32 bytes of the second source
+ */
+OWN_QPLC_INLINE(uint32_t, own_l9_non_zero_mask_8u, (const uint8_t *src2_ptr)) {
+    __m256i data = _mm256_loadu_si256((const __m256i *) src2_ptr);
+
+    return ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(data, _mm256_setzero_si256()));
+}
+
+/**
+ * @brief Expands every bit of the 8-bit mask to a byte in 64-bit value (bit 1 -> 0xFF)
+ */
+OWN_QPLC_INLINE(uint64_t, own_l9_bits_to_bytes, (uint32_t mask)) {
+    return _pdep_u64(mask, 0x0101010101010101ULL) * 0xFFu;
+}
+
+/**
+ * @brief Stores first `count` bytes of `value` without touching the memory beyond them
+ */
+OWN_QPLC_INLINE(void, own_l9_store_bytes, (uint8_t *dst_ptr, uint64_t value, uint32_t count)) {
+    for (uint32_t i = 0u; i < count; i++) {
+        dst_ptr[i] = (uint8_t) (value >> (i * 8u));
+    }
+}
+
+/******** out-of-place select functions ********/
+OWN_OPT_FUN(uint32_t, l9_qplc_select_8u, (const uint8_t *src_ptr,
+    const uint8_t *src2_ptr,
+    uint8_t *dst_ptr,
+    uint32_t length)) {
+    uint32_t selected = 0u;
+    uint32_t length32 = length & (-32);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        uint32_t mask = own_l9_non_zero_mask_8u(src2_ptr + idx);
+
+        for (uint32_t idx_inloop = idx; (mask != 0u); idx_inloop += 8u, mask >>= 8u) {
+            uint32_t mask8 = mask & 0xFFu;
+
+            if (mask8 != 0u) {
+                uint64_t data     = *(const uint64_t *) (src_ptr + idx_inloop);
+                uint32_t num_data = (uint32_t) _mm_popcnt_u32(mask8);
+
+                own_l9_store_bytes(dst_ptr + selected, _pext_u64(data, own_l9_bits_to_bytes(mask8)), num_data);
+                selected += num_data;
+            }
+        }
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (src2_ptr[idx]) {
+            dst_ptr[selected++] = src_ptr[idx];
+        }
+    }
+    return selected;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_select_16u, (const uint8_t *src_ptr,
+    const uint8_t *src2_ptr,
+    uint8_t *dst_ptr,
+    uint32_t length)) {
+    const uint16_t *src_16u_ptr = (const uint16_t *) src_ptr;
+    uint16_t       *dst_16u_ptr = (uint16_t *) dst_ptr;
+    uint32_t       selected     = 0u;
+    uint32_t       length32     = length & (-32);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        uint32_t mask = own_l9_non_zero_mask_8u(src2_ptr + idx);
+
+        for (uint32_t idx_inloop = idx; (mask != 0u); idx_inloop += 4u, mask >>= 4u) {
+            uint32_t mask4 = mask & 0x0Fu;
+
+            if (mask4 != 0u) {
+                // Every element occupies two bytes, so every mask bit is doubled
+                uint32_t mask8    = _pdep_u32(mask4, 0x55u) * 3u;
+                uint64_t data     = *(const uint64_t *) (src_16u_ptr + idx_inloop);
+                uint32_t num_data = (uint32_t) _mm_popcnt_u32(mask4);
+
+                own_l9_store_bytes((uint8_t *) (dst_16u_ptr + selected),
+                                   _pext_u64(data, own_l9_bits_to_bytes(mask8)),
+                                   num_data * sizeof(uint16_t));
+                selected += num_data;
+            }
+        }
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (src2_ptr[idx]) {
+            dst_16u_ptr[selected++] = src_16u_ptr[idx];
+        }
+    }
+    return selected;
+}
+
+OWN_OPT_FUN(uint32_t, l9_qplc_select_32u, (const uint8_t *src_ptr,
+    const uint8_t *src2_ptr,
+    uint8_t *dst_ptr,
+    uint32_t length)) {
+    const uint32_t *src_32u_ptr = (const uint32_t *) src_ptr;
+    uint32_t       *dst_32u_ptr = (uint32_t *) dst_ptr;
+    uint32_t       selected     = 0u;
+    uint32_t       length32     = length & (-32);
+
+    for (uint32_t idx = 0u; idx < length32; idx += 32u) {
+        uint32_t mask = own_l9_non_zero_mask_8u(src2_ptr + idx);
+
+        for (uint32_t idx_inloop = idx; (mask != 0u); idx_inloop += 8u, mask >>= 8u) {
+            uint32_t mask8 = mask & 0xFFu;
+
+            if (mask8 != 0u) {
+                // Permutation indices of the selected elements are packed to the low bytes with pext
+                uint64_t indices  = _pext_u64(0x0706050403020100ULL, own_l9_bits_to_bytes(mask8));
+                uint32_t num_data = (uint32_t) _mm_popcnt_u32(mask8);
+                __m256i  data     = _mm256_loadu_si256((const __m256i *) (src_32u_ptr + idx_inloop));
+                __m256i  store_mask;
+
+                data       = _mm256_permutevar8x32_epi32(data, _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((int64_t) indices)));
+                store_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int) num_data),
+                                                _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+                _mm256_maskstore_epi32((int *) (dst_32u_ptr + selected), store_mask, data);
+                selected += num_data;
+            }
+        }
+    }
+
+    for (uint32_t idx = length32; idx < length; idx++) {
+        if (src2_ptr[idx]) {
+            dst_32u_ptr[selected++] = src_32u_ptr[idx];
+        }
+    }
+    return selected;
+}
+
+#endif // OWN_SELECT_L9_H
@@ -0,0 +1,45 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX-512 implementation of the hash set lookup for set membership analytics operation
+ * @date 10/18/2022
+ *
+ * @details Function list:
+ *          - @ref k0_qplc_hash_set_contains
+ *
+ * @note All 16 slots of a bucket are compared with the key and with the free slot value at once.
+ */
+
+#ifndef OWN_SET_MEMBERSHIP_HASH_K0_H
+#define OWN_SET_MEMBERSHIP_HASH_K0_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+#include "qplc_set_membership.h"
+
+OWN_QPLC_INLINE(uint8_t, k0_qplc_hash_set_contains, (const qplc_hash_set_t *set_ptr, uint32_t key)) {
+    const __m512i z_key   = _mm512_set1_epi32((int32_t) key);
+    const __m512i z_empty = _mm512_set1_epi32((int32_t) QPLC_HASH_SET_EMPTY_KEY);
+
+    uint32_t bucket = qplc_hash_set_bucket(key, set_ptr->buckets_count);
+
+    while (1) {
+        __m512i z_slots = _mm512_load_si512((const void *) (set_ptr->slots_ptr + bucket * QPLC_HASH_SET_BUCKET_SIZE));
+
+        if (_mm512_cmpeq_epi32_mask(z_slots, z_key)) {
+            return 1u;
+        }
+
+        if (_mm512_cmpeq_epi32_mask(z_slots, z_empty)) {
+            return 0u;
+        }
+
+        bucket = (bucket + 1u == set_ptr->buckets_count) ? 0u : bucket + 1u;
+    }
+}
+
+#endif // OWN_SET_MEMBERSHIP_HASH_K0_H
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains AVX2 implementation of the hash set lookup for set membership analytics operation
+ * @date 10/18/2022
+ *
+ * @details Function list:
+ *          - @ref l9_qplc_hash_set_contains
+ *
+ * @note A bucket is compared as two 256-bit halves, the halves are merged before the mask is extracted.
+ */
+
+#ifndef OWN_SET_MEMBERSHIP_HASH_L9_H
+#define OWN_SET_MEMBERSHIP_HASH_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+#include "qplc_set_membership.h"
+
+OWN_QPLC_INLINE(uint8_t, l9_qplc_hash_set_contains, (const qplc_hash_set_t *set_ptr, uint32_t key)) {
+    const __m256i y_key   = _mm256_set1_epi32((int32_t) key);
+    const __m256i y_empty = _mm256_set1_epi32((int32_t) QPLC_HASH_SET_EMPTY_KEY);
+
+    uint32_t bucket = qplc_hash_set_bucket(key, set_ptr->buckets_count);
+
+    while (1) {
+        const __m256i *slots_ptr = (const __m256i *) (set_ptr->slots_ptr + bucket * QPLC_HASH_SET_BUCKET_SIZE);
+
+        __m256i y_low  = _mm256_load_si256(slots_ptr);
+        __m256i y_high = _mm256_load_si256(slots_ptr + 1);
+
+        __m256i y_hit  = _mm256_or_si256(_mm256_cmpeq_epi32(y_low, y_key), _mm256_cmpeq_epi32(y_high, y_key));
+        __m256i y_free = _mm256_or_si256(_mm256_cmpeq_epi32(y_low, y_empty), _mm256_cmpeq_epi32(y_high, y_empty));
+
+        if (!_mm256_testz_si256(y_hit, y_hit)) {
+            return 1u;
+        }
+
+        if (!_mm256_testz_si256(y_free, y_free)) {
+            return 0u;
+        }
+
+        bucket = (bucket + 1u == set_ptr->buckets_count) ? 0u : bucket + 1u;
+    }
+}
+
+#endif // OWN_SET_MEMBERSHIP_HASH_L9_H
@@ -0,0 +1,229 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for operations on bit vectors
+ * @date 10/18/2022
+ *
+ * @details Function list:
+ *          - @ref qplc_bitmap_and_8u
+ *          - @ref qplc_bitmap_or_8u
+ *          - @ref qplc_bitmap_xor_8u
+ *          - @ref qplc_bitmap_and_not_8u
+ *          - @ref qplc_bitmap_not_8u
+ *          - @ref qplc_bitmap_popcount_8u
+ *          - @ref qplc_bitmap_find_first_8u
+ *          - @ref qplc_bitmap_find_last_8u
+ *
+ * @note Bit vectors are processed as 64-bit words, bit i of the word is the bit (i % 8) of the byte (i / 8)
+ *       on little-endian platforms, so indices of set bits are taken from the words directly.
+ */
+
+#include "own_qplc_defs.h"
+
+#if PLATFORM >= K0
+
+#include "opt/qplc_bitmap_k0.h"
+
+#elif PLATFORM == L9
+
+#include "opt/qplc_bitmap_l9.h"
+
+#endif
+
+#define OWN_BITMAP_LOGIC_PX(src1_ptr, src2_ptr, dst_ptr, length, expression)    \
+    {                                                                          \
+        const uint64_t *src1_64u_ptr = (const uint64_t *) (src1_ptr);          \
+        const uint64_t *src2_64u_ptr = (const uint64_t *) (src2_ptr);          \
+        uint64_t       *dst_64u_ptr  = (uint64_t *) (dst_ptr);                 \
+        uint32_t       length_64u    = (length) / sizeof(uint64_t);            \
+                                                                               \
+        for (uint32_t i = 0u; i < length_64u; i++) {                           \
+            const uint64_t a = src1_64u_ptr[i];                                \
+            const uint64_t b = src2_64u_ptr[i];                                \
+            dst_64u_ptr[i] = (expression);                                     \
+        }                                                                      \
+                                                                               \
+        for (uint32_t i = length_64u * sizeof(uint64_t); i < (length); i++) {  \
+            const uint8_t a = (src1_ptr)[i];                                   \
+            const uint8_t b = (src2_ptr)[i];                                   \
+            (dst_ptr)[i] = (uint8_t) (expression);                             \
+        }                                                                      \
+    }
+
+OWN_QPLC_INLINE(uint32_t, own_popcount_64u, (uint64_t value)) {
+    value = value - ((value >> 1u) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2u) & 0x3333333333333333ULL);
+    value = (value + (value >> 4u)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return (uint32_t) ((value * 0x0101010101010101ULL) >> 56u);
+}
+
+OWN_QPLC_INLINE(uint32_t, own_lowest_bit_64u, (uint64_t value)) {
+    uint32_t index = 0u;
+
+    while (0u == (value & 1u)) {
+        value >>= 1u;
+        index++;
+    }
+
+    return index;
+}
+
+OWN_QPLC_INLINE(uint32_t, own_highest_bit_64u, (uint64_t value)) {
+    uint32_t index = 63u;
+
+    while (0u == (value & (QPL_ONE_64U << 63u))) {
+        value <<= 1u;
+        index--;
+    }
+
+    return index;
+}
+
+OWN_QPLC_FUN(void, qplc_bitmap_and_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_bitmap_and_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_bitmap_and_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#else
+    OWN_BITMAP_LOGIC_PX(src1_ptr, src2_ptr, dst_ptr, length, a & b)
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_bitmap_or_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_bitmap_or_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_bitmap_or_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#else
+    OWN_BITMAP_LOGIC_PX(src1_ptr, src2_ptr, dst_ptr, length, a | b)
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_bitmap_xor_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_bitmap_xor_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_bitmap_xor_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#else
+    OWN_BITMAP_LOGIC_PX(src1_ptr, src2_ptr, dst_ptr, length, a ^ b)
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_bitmap_and_not_8u, (const uint8_t *src1_ptr,
+        const uint8_t *src2_ptr,
+        uint8_t *dst_ptr,
+        uint32_t length)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_bitmap_and_not_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_bitmap_and_not_8u)(src1_ptr, src2_ptr, dst_ptr, length);
+#else
+    OWN_BITMAP_LOGIC_PX(src1_ptr, src2_ptr, dst_ptr, length, a & ~b)
+#endif
+}
+
+OWN_QPLC_FUN(void, qplc_bitmap_not_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
+#if PLATFORM >= K0
+    CALL_OPT_FUNCTION(k0_qplc_bitmap_not_8u)(src_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_bitmap_not_8u)(src_ptr, dst_ptr, length);
+#else
+    const uint64_t *src_64u_ptr = (const uint64_t *) src_ptr;
+    uint64_t       *dst_64u_ptr = (uint64_t *) dst_ptr;
+    uint32_t       length_64u   = length / sizeof(uint64_t);
+
+    for (uint32_t i = 0u; i < length_64u; i++) {
+        dst_64u_ptr[i] = ~src_64u_ptr[i];
+    }
+
+    for (uint32_t i = length_64u * sizeof(uint64_t); i < length; i++) {
+        dst_ptr[i] = (uint8_t) ~src_ptr[i];
+    }
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_bitmap_popcount_8u, (const uint8_t *src_ptr, uint32_t length)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_bitmap_popcount_8u)(src_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_bitmap_popcount_8u)(src_ptr, length);
+#else
+    const uint64_t *src_64u_ptr = (const uint64_t *) src_ptr;
+    uint32_t       length_64u   = length / sizeof(uint64_t);
+    uint32_t       count        = 0u;
+
+    for (uint32_t i = 0u; i < length_64u; i++) {
+        count += own_popcount_64u(src_64u_ptr[i]);
+    }
+
+    for (uint32_t i = length_64u * sizeof(uint64_t); i < length; i++) {
+        count += own_popcount_64u(src_ptr[i]);
+    }
+
+    return count;
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_bitmap_find_first_8u, (const uint8_t *src_ptr, uint32_t length)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_bitmap_find_first_8u)(src_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_bitmap_find_first_8u)(src_ptr, length);
+#else
+    const uint64_t *src_64u_ptr = (const uint64_t *) src_ptr;
+    uint32_t       length_64u   = length / sizeof(uint64_t);
+
+    for (uint32_t i = 0u; i < length_64u; i++) {
+        if (0u != src_64u_ptr[i]) {
+            return i * OWN_QWORD_WIDTH + own_lowest_bit_64u(src_64u_ptr[i]);
+        }
+    }
+
+    for (uint32_t i = length_64u * sizeof(uint64_t); i < length; i++) {
+        if (0u != src_ptr[i]) {
+            return i * OWN_BYTE_WIDTH + own_lowest_bit_64u(src_ptr[i]);
+        }
+    }
+
+    return OWN_MAX_32U;
+#endif
+}
+
+OWN_QPLC_FUN(uint32_t, qplc_bitmap_find_last_8u, (const uint8_t *src_ptr, uint32_t length)) {
+#if PLATFORM >= K0
+    return CALL_OPT_FUNCTION(k0_qplc_bitmap_find_last_8u)(src_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_bitmap_find_last_8u)(src_ptr, length);
+#else
+    const uint64_t *src_64u_ptr = (const uint64_t *) src_ptr;
+    uint32_t       length_64u   = length / sizeof(uint64_t);
+
+    for (uint32_t i = length; i > length_64u * sizeof(uint64_t); i--) {
+        if (0u != src_ptr[i - 1u]) {
+            return (i - 1u) * OWN_BYTE_WIDTH + own_highest_bit_64u(src_ptr[i - 1u]);
+        }
+    }
+
+    for (uint32_t i = length_64u; i > 0u; i--) {
+        if (0u != src_64u_ptr[i - 1u]) {
+            return (i - 1u) * OWN_QWORD_WIDTH + own_highest_bit_64u(src_64u_ptr[i - 1u]);
+        }
+    }
+
+    return OWN_MAX_32U;
+#endif
+}
@@ -20,6 +20,10 @@
 
 #include "opt/qplc_expand_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_expand_l9.h"
+
 #endif
 
 
@@ -32,6 +36,8 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_8u, (const uint8_t *src1_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_qplc_expand_8u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_qplc_expand_8u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
 #else
 
     uint32_t expanded = 0u;
@@ -57,6 +63,8 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_16u, (const uint8_t *src1_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_qplc_expand_16u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_qplc_expand_16u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
 #else
 
     uint16_t *src_16u_ptr = (uint16_t *) src1_ptr;
@@ -84,6 +92,8 @@ OWN_QPLC_FUN(uint32_t, qplc_expand_32u, (const uint8_t *src1_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_qplc_expand_32u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_qplc_expand_32u)(src1_ptr, length_1, src2_ptr, length_2_ptr, dst_ptr);
 #else
 
     uint32_t *src_32u_ptr = (uint32_t *) src1_ptr;
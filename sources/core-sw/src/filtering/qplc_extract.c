@@ -15,6 +15,9 @@
  *          - @ref qplc_extract_8u
  *          - @ref qplc_extract_16u
  *          - @ref qplc_extract_32u
+ *
+ *          Extract is a range check followed by a memory move, so there are no opt/ kernels for it:
+ *          the AVX2 and AVX-512 builds of this file use the vectorized qplc_move_8u of their tier.
  */
 
 #include "own_qplc_defs.h"
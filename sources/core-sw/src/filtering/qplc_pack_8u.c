@@ -25,6 +25,8 @@
 
 #if PLATFORM >= K0
 #include "opt/qplc_pack_8u_k0.h"
+#elif PLATFORM == L9
+#include "opt/qplc_pack_8u_l9.h"
 #endif
 
 // ********************** 1u ****************************** //
@@ -36,6 +38,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u1u, (const uint8_t *src_ptr,
 
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u1u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM == L9
+    own_l9_pack_8u_nu(src_ptr, num_elements, 1u, dst_ptr, start_bit);
 #else
     uint32_t i;
 
@@ -124,6 +128,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u2u, (const uint8_t *src_ptr,
         uint32_t start_bit)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u2u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM == L9
+    own_l9_pack_8u_nu(src_ptr, num_elements, 2u, dst_ptr, start_bit);
 #else
     uint32_t i;
 
@@ -212,6 +218,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u3u, (const uint8_t *src_ptr,
         uint32_t start_bit)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u3u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM == L9
+    own_l9_pack_8u_nu(src_ptr, num_elements, 3u, dst_ptr, start_bit);
 #else
     dst_ptr[0] &= OWN_BIT_MASK(start_bit);
     while (0u != start_bit) {
@@ -357,6 +365,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u4u, (const uint8_t *src_ptr,
         uint32_t start_bit)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u4u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM == L9
+    own_l9_pack_8u_nu(src_ptr, num_elements, 4u, dst_ptr, start_bit);
 #else
     uint32_t i;
 
@@ -444,6 +454,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u5u, (const uint8_t *src_ptr,
         uint32_t start_bit)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u5u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM == L9
+    own_l9_pack_8u_nu(src_ptr, num_elements, 5u, dst_ptr, start_bit);
 #else
     dst_ptr[0] &= OWN_BIT_MASK(start_bit);
     while (0u != start_bit) {
@@ -631,6 +643,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u6u, (const uint8_t *src_ptr,
         uint32_t start_bit)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u6u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM == L9
+    own_l9_pack_8u_nu(src_ptr, num_elements, 6u, dst_ptr, start_bit);
 #else
     qplc_pack_8u_nu(src_ptr, num_elements, 6u, dst_ptr, start_bit);
 #endif
@@ -642,6 +656,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u7u, (const uint8_t *src_ptr,
         uint32_t start_bit)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u7u)(src_ptr, num_elements, dst_ptr, start_bit);
+#elif PLATFORM == L9
+    own_l9_pack_8u_nu(src_ptr, num_elements, 7u, dst_ptr, start_bit);
 #else
     qplc_pack_8u_nu(src_ptr, num_elements, 7u, dst_ptr, start_bit);
 #endif
@@ -660,6 +676,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u16u, (const uint8_t *src_ptr,
         uint32_t UNREFERENCED_PARAMETER(start_bit))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u16u)(src_ptr, num_elements, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_pack_8u16u)(src_ptr, num_elements, dst_ptr);
 #else
     uint16_t *dst_16u_ptr = (uint16_t *) dst_ptr;
 
@@ -675,6 +693,8 @@ OWN_QPLC_FUN(void, qplc_pack_8u32u, (const uint8_t *src_ptr,
         uint32_t UNREFERENCED_PARAMETER(start_bit))) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_pack_8u32u)(src_ptr, num_elements, dst_ptr);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_pack_8u32u)(src_ptr, num_elements, dst_ptr);
 #else
     uint32_t *dst_32u_ptr = (uint32_t *) dst_ptr;
 
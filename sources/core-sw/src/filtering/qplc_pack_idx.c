@@ -23,6 +23,10 @@
 
 #include "opt/qplc_pack_idx_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_pack_idx_l9.h"
+
 #endif
 
 
@@ -46,6 +50,8 @@ OWN_QPLC_FUN(qplc_status_t, qplc_pack_index_8u, (const uint8_t *src_ptr,
         uint32_t *index_ptr)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_pack_index_8u)(src_ptr, num_elements, pp_dst, dst_length, index_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_pack_index_8u)(src_ptr, num_elements, pp_dst, dst_length, index_ptr);
 #else
     uint32_t      index    = *index_ptr;
     qplc_status_t status   = QPLC_STS_OK;
@@ -53,6 +59,13 @@ OWN_QPLC_FUN(qplc_status_t, qplc_pack_index_8u, (const uint8_t *src_ptr,
     uint8_t       *end_ptr = dst_ptr + dst_length;
 
     for (uint32_t i = 0u; i < num_elements; i++) {
+        /* Results of selective predicates are sparse, 8 unset elements are skipped at once */
+        if ((0u == (i & (sizeof(uint64_t) - 1u))) && (i + sizeof(uint64_t) <= num_elements)
+            && (0u == *(const uint64_t *) (src_ptr + i))) {
+            i     += sizeof(uint64_t) - 1u;
+            index += sizeof(uint64_t);
+            continue;
+        }
         if (0u < src_ptr[i]) {
             if (UINT8_MAX < index) {
                 status = QPLC_STS_OUTPUT_OVERFLOW_ERR;
@@ -82,6 +95,8 @@ OWN_QPLC_FUN(qplc_status_t, qplc_pack_index_8u16u, (const uint8_t *src_ptr,
 
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_pack_index_8u16u)(src_ptr, num_elements, pp_dst, dst_length, index_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_pack_index_8u16u)(src_ptr, num_elements, pp_dst, dst_length, index_ptr);
 #else
     uint32_t      index    = *index_ptr;
     qplc_status_t status   = QPLC_STS_OK;
@@ -89,6 +104,13 @@ OWN_QPLC_FUN(qplc_status_t, qplc_pack_index_8u16u, (const uint8_t *src_ptr,
     uint16_t      *end_ptr = dst_ptr + (dst_length >> 1);
 
     for (uint32_t i = 0u; i < num_elements; i++) {
+        /* Results of selective predicates are sparse, 8 unset elements are skipped at once */
+        if ((0u == (i & (sizeof(uint64_t) - 1u))) && (i + sizeof(uint64_t) <= num_elements)
+            && (0u == *(const uint64_t *) (src_ptr + i))) {
+            i     += sizeof(uint64_t) - 1u;
+            index += sizeof(uint64_t);
+            continue;
+        }
         if (0u < src_ptr[i]) {
             if (OWN_MAX_16U < index) {
                 status = QPLC_STS_OUTPUT_OVERFLOW_ERR;
@@ -117,6 +139,8 @@ OWN_QPLC_FUN(qplc_status_t, qplc_pack_index_8u32u, (const uint8_t *src_ptr,
 
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_pack_index_8u32u)(src_ptr, num_elements, pp_dst, dst_length, index_ptr);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_pack_index_8u32u)(src_ptr, num_elements, pp_dst, dst_length, index_ptr);
 #else
     uint64_t      index = (uint64_t)*index_ptr;
     qplc_status_t status = QPLC_STS_OK;
@@ -124,6 +148,13 @@ OWN_QPLC_FUN(qplc_status_t, qplc_pack_index_8u32u, (const uint8_t *src_ptr,
     uint32_t* end_ptr = dst_ptr + (dst_length >> 2);
 
     for (uint32_t i = 0u; i < num_elements; i++) {
+        /* Results of selective predicates are sparse, 8 unset elements are skipped at once */
+        if ((0u == (i & (sizeof(uint64_t) - 1u))) && (i + sizeof(uint64_t) <= num_elements)
+            && (0u == *(const uint64_t *) (src_ptr + i))) {
+            i     += sizeof(uint64_t) - 1u;
+            index += sizeof(uint64_t);
+            continue;
+        }
         if (0u < src_ptr[i]) {
             if (OWN_MAX_32U < index) {
                 status = QPLC_STS_OUTPUT_OVERFLOW_ERR;
@@ -0,0 +1,211 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of scan functions for packed input data of any bit width
+ * @date 10/17/2022
+ *
+ * @details Function list:
+ *          - @ref qplc_scan_range_nu1u
+ *          - @ref qplc_scan_not_range_nu1u
+ *
+ * @note Elements are compared right after extraction from the packed source and results are written
+ *       to the bit vector directly, so the source is read once and no intermediate buffers are used.
+ *       Every comparison is done as (value - low_value) <= (high_value - low_value) in unsigned arithmetic.
+ */
+
+#include "own_qplc_defs.h"
+
+#if PLATFORM >= K0
+
+#include "opt/qplc_scan_packed_k0.h"
+
+#elif PLATFORM == L9
+
+#include "opt/qplc_scan_packed_l9.h"
+
+#endif
+
+/**
+ * @brief Compares 8 elements of up to 8 bits at once with SWAR technique
+ *
+ * @details Group of 8 elements occupies bit_width bytes, so it is loaded as a single 64-bit value with the
+ *          element i located at the bit i * bit_width. Elements are compared to the low and high values
+ *          without borrows between them, comparison results are collected from the highest bits of elements.
+ */
+OWN_QPLC_INLINE(uint32_t, own_scan_range_swar_8_elements, (uint64_t src,
+                                                           uint32_t bit_width,
+                                                           uint64_t low_values,
+                                                           uint64_t high_values,
+                                                           uint64_t high_bits)) {
+    // Per-element greater-or-equal: the highest bits are compared directly, lower ones - with the subtraction
+    uint64_t low_ge  = ((src | high_bits) - (low_values & ~high_bits)) & high_bits;
+    uint64_t high_ge = ((high_values | high_bits) - (src & ~high_bits)) & high_bits;
+
+    low_ge  = ((src & ~low_values) | (~(src ^ low_values) & low_ge)) & high_bits;
+    high_ge = ((high_values & ~src) | (~(src ^ high_values) & high_ge)) & high_bits;
+
+    uint64_t matches = (low_ge & high_ge) >> (bit_width - 1u);
+    uint32_t result  = 0u;
+
+    for (uint32_t i = 0u; i < 8u; i++) {
+        result |= (uint32_t) ((matches >> (i * bit_width)) & 1u) << i;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Scans packed elements in groups of 8 without reading beyond the last source byte
+ *
+ * @return number of processed elements (multiple of 8)
+ */
+OWN_QPLC_INLINE(uint32_t, own_scan_range_nu1u_bulk, (const uint8_t *src_ptr,
+                                                     uint32_t length,
+                                                     uint32_t bit_width,
+                                                     uint8_t *dst_ptr,
+                                                     uint32_t low_value,
+                                                     uint32_t high_value,
+                                                     uint8_t invert_mask)) {
+    const uint64_t mask        = OWN_BIT_MASK(bit_width);
+    const uint32_t range       = high_value - low_value;
+    const uint32_t group_count = length / 8u;
+    // The last group is handled by the tail to keep 8-byte loads inside of the source
+    const uint32_t safe_groups = (group_count > (8u / bit_width + 1u)) ? group_count - (8u / bit_width + 1u) : 0u;
+
+    if (bit_width <= OWN_BYTE_WIDTH) {
+        uint64_t element_bits = 0u;
+
+        for (uint32_t i = 0u; i < 8u; i++) {
+            element_bits |= QPL_ONE_64U << (i * bit_width);
+        }
+
+        const uint64_t group_mask  = (OWN_BYTE_WIDTH == bit_width) ? UINT64_MAX : OWN_BIT_MASK(8u * bit_width);
+        const uint64_t high_bits   = element_bits << (bit_width - 1u);
+        const uint64_t low_values  = element_bits * low_value;
+        const uint64_t high_values = element_bits * high_value;
+
+        for (uint32_t group = 0u; group < safe_groups; group++) {
+            uint64_t src = *(const uint64_t *) src_ptr & group_mask;
+
+            *dst_ptr++ = (uint8_t) own_scan_range_swar_8_elements(src, bit_width, low_values, high_values, high_bits)
+                         ^ invert_mask;
+            src_ptr += bit_width;
+        }
+    } else {
+        for (uint32_t group = 0u; group < safe_groups; group++) {
+            uint32_t result = 0u;
+
+            for (uint32_t i = 0u; i < 8u; i++) {
+                uint32_t bit_offset = i * bit_width;
+                uint64_t src        = *(const uint64_t *) (src_ptr + bit_offset / OWN_BYTE_WIDTH);
+                uint32_t value      = (uint32_t) ((src >> (bit_offset % OWN_BYTE_WIDTH)) & mask);
+
+                result |= (uint32_t) ((value - low_value) <= range) << i;
+            }
+
+            *dst_ptr++ = (uint8_t) result ^ invert_mask;
+            src_ptr += bit_width;
+        }
+    }
+
+    return safe_groups * 8u;
+}
+
+/**
+ * @brief Scans remaining elements one by one without reading beyond the last source byte
+ */
+OWN_QPLC_INLINE(void, own_scan_range_nu1u_tail, (const uint8_t *src_ptr,
+                                                 uint32_t length,
+                                                 uint32_t bit_width,
+                                                 uint8_t *dst_ptr,
+                                                 uint32_t low_value,
+                                                 uint32_t high_value,
+                                                 uint8_t invert_mask)) {
+    const uint64_t mask        = OWN_BIT_MASK(bit_width);
+    const uint32_t range       = high_value - low_value;
+    uint64_t       bit_buf     = 0u;
+    uint32_t       bits_in_buf = 0u;
+
+    for (uint32_t idx = 0u; idx < length; idx += 8u) {
+        uint32_t elements = QPL_MIN(length - idx, 8u);
+        uint32_t result   = 0u;
+
+        for (uint32_t i = 0u; i < elements; i++) {
+            while (bits_in_buf < bit_width) {
+                bit_buf |= (uint64_t) (*src_ptr++) << bits_in_buf;
+                bits_in_buf += OWN_BYTE_WIDTH;
+            }
+
+            uint32_t value = (uint32_t) (bit_buf & mask);
+
+            bit_buf >>= bit_width;
+            bits_in_buf -= bit_width;
+            result |= (uint32_t) ((value - low_value) <= range) << i;
+        }
+
+        *dst_ptr++ = (uint8_t) ((result ^ invert_mask) & OWN_BIT_MASK(elements));
+    }
+}
+
+OWN_QPLC_INLINE(void, own_scan_range_nu1u, (const uint8_t *src_ptr,
+                                            uint32_t length,
+                                            uint32_t bit_width,
+                                            uint8_t *dst_ptr,
+                                            uint32_t low_value,
+                                            uint32_t high_value,
+                                            uint8_t invert_mask)) {
+    uint32_t processed = 0u;
+
+    high_value = (uint32_t) QPL_MIN(high_value, OWN_BIT_MASK(bit_width));
+
+    // Empty range, condition is never met
+    if (low_value > high_value) {
+        for (uint32_t i = 0u; i < length / 8u; i++) {
+            dst_ptr[i] = invert_mask;
+        }
+        if (length % 8u) {
+            dst_ptr[length / 8u] = invert_mask & (uint8_t) OWN_BIT_MASK(length % 8u);
+        }
+        return;
+    }
+
+#if PLATFORM >= K0
+    processed = CALL_OPT_FUNCTION(k0_qplc_scan_range_nu1u)(src_ptr, length, bit_width, dst_ptr,
+                                                           low_value, high_value, invert_mask);
+#elif PLATFORM == L9
+    processed = CALL_OPT_FUNCTION(l9_qplc_scan_range_nu1u)(src_ptr, length, bit_width, dst_ptr,
+                                                           low_value, high_value, invert_mask);
+#else
+    processed = own_scan_range_nu1u_bulk(src_ptr, length, bit_width, dst_ptr, low_value, high_value, invert_mask);
+#endif
+
+    own_scan_range_nu1u_tail(src_ptr + (processed / 8u) * bit_width,
+                             length - processed,
+                             bit_width,
+                             dst_ptr + processed / 8u,
+                             low_value,
+                             high_value,
+                             invert_mask);
+}
+
+OWN_QPLC_FUN(void, qplc_scan_range_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint8_t *dst_ptr,
+        uint32_t low_value,
+        uint32_t high_value)) {
+    own_scan_range_nu1u(src_ptr, length, bit_width, dst_ptr, low_value, high_value, 0u);
+}
+
+OWN_QPLC_FUN(void, qplc_scan_not_range_nu1u, (const uint8_t *src_ptr,
+        uint32_t length,
+        uint32_t bit_width,
+        uint8_t *dst_ptr,
+        uint32_t low_value,
+        uint32_t high_value)) {
+    own_scan_range_nu1u(src_ptr, length, bit_width, dst_ptr, low_value, high_value, 0xFFu);
+}
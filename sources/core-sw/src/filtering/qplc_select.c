@@ -24,11 +24,17 @@
 
 #include "opt/qplc_select_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_select_l9.h"
+
 #endif
 
 OWN_QPLC_FUN(uint32_t, qplc_select_8u_i, (uint8_t * src_dst_ptr, const uint8_t *src2_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_8u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_8u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
 #else
     uint8_t  *src_ptr = src_dst_ptr;
     uint8_t  *dst_ptr = src_dst_ptr;
@@ -46,6 +52,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_8u_i, (uint8_t * src_dst_ptr, const uint8_t *
 OWN_QPLC_FUN(uint32_t, qplc_select_16u_i, (uint8_t * src_dst_ptr, const uint8_t *src2_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_16u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_16u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
 #else
     uint16_t *src_ptr = (uint16_t *) src_dst_ptr;
     uint16_t *dst_ptr = (uint16_t *) src_dst_ptr;
@@ -63,6 +71,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_16u_i, (uint8_t * src_dst_ptr, const uint8_t
 OWN_QPLC_FUN(uint32_t, qplc_select_32u_i, (uint8_t * src_dst_ptr, const uint8_t *src2_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_32u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_32u)((const uint8_t*)src_dst_ptr, src2_ptr, src_dst_ptr, length);
 #else
     uint32_t *src_ptr = (uint32_t *) src_dst_ptr;
     uint32_t *dst_ptr = (uint32_t *) src_dst_ptr;
@@ -85,6 +95,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_8u, (const uint8_t *src_ptr,
         uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_8u)(src_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_8u)(src_ptr, src2_ptr, dst_ptr, length);
 #else
     uint32_t selected = 0u;
 
@@ -103,6 +115,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_16u, (const uint8_t *src_ptr,
         uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_16u)(src_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_16u)(src_ptr, src2_ptr, dst_ptr, length);
 #else
     uint16_t *src_16u_ptr = (uint16_t *) src_ptr;
     uint16_t *dst_16u_ptr = (uint16_t *) dst_ptr;
@@ -123,6 +137,8 @@ OWN_QPLC_FUN(uint32_t, qplc_select_32u, (const uint8_t *src_ptr,
         uint32_t length)) {
 #if PLATFORM >= K0
     return CALL_OPT_FUNCTION(k0_qplc_select_32u)(src_ptr, src2_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    return CALL_OPT_FUNCTION(l9_qplc_select_32u)(src_ptr, src2_ptr, dst_ptr, length);
 #else
     uint32_t *src_32u_ptr = (uint32_t *) src_ptr;
     uint32_t *dst_32u_ptr = (uint32_t *) dst_ptr;
@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains implementation of functions for set_membership analytics operation with a hash set
+ * @date 10/18/2022
+ *
+ * @details Function list:
+ *          - @ref qplc_set_membership_hash_16u8u_i
+ *          - @ref qplc_set_membership_hash_32u8u_i
+ *
+ */
+
+#include "own_qplc_defs.h"
+#include "qplc_set_membership.h"
+
+#if PLATFORM >= K0
+
+#include "opt/qplc_set_membership_hash_k0.h"
+
+#elif PLATFORM == L9
+
+#include "opt/qplc_set_membership_hash_l9.h"
+
+#endif
+
+/**
+ * Number of elements the bucket is prefetched ahead of the lookup. Source is read ahead of the destination
+ * byte being written, so prefetching is safe in-place
+ */
+#define OWN_PREFETCH_DISTANCE 16u
+
+OWN_QPLC_INLINE(void, own_hash_set_prefetch, (const qplc_hash_set_t *set_ptr, uint32_t key)) {
+#if PLATFORM >= L9
+    const uint32_t bucket = qplc_hash_set_bucket(key, set_ptr->buckets_count);
+    _mm_prefetch((const char *) (set_ptr->slots_ptr + bucket * QPLC_HASH_SET_BUCKET_SIZE), _MM_HINT_T0);
+#else
+    (void) set_ptr;
+    (void) key;
+#endif
+}
+
+OWN_QPLC_INLINE(uint8_t, own_hash_set_contains, (const qplc_hash_set_t *set_ptr, uint32_t key)) {
+    if (QPLC_HASH_SET_EMPTY_KEY == key) {
+        return (uint8_t) set_ptr->has_empty_key;
+    }
+
+#if PLATFORM >= K0
+    return k0_qplc_hash_set_contains(set_ptr, key);
+#elif PLATFORM == L9
+    return l9_qplc_hash_set_contains(set_ptr, key);
+#else
+    uint32_t bucket = qplc_hash_set_bucket(key, set_ptr->buckets_count);
+
+    while (1) {
+        const uint32_t *slots_ptr = set_ptr->slots_ptr + bucket * QPLC_HASH_SET_BUCKET_SIZE;
+
+        for (uint32_t idx = 0u; idx < QPLC_HASH_SET_BUCKET_SIZE; idx++) {
+            if (key == slots_ptr[idx]) {
+                return 1u;
+            }
+
+            if (QPLC_HASH_SET_EMPTY_KEY == slots_ptr[idx]) {
+                return 0u;
+            }
+        }
+
+        bucket = (bucket + 1u == set_ptr->buckets_count) ? 0u : bucket + 1u;
+    }
+#endif
+}
+
+/******** in-place set membership functions ********/
+
+OWN_QPLC_FUN(void, qplc_set_membership_hash_16u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t              length,
+        uint32_t              shift,
+        uint32_t              mask,
+        const qplc_hash_set_t *set_ptr)) {
+    uint16_t *src_16u_ptr = (uint16_t *) src_dst_ptr;
+    uint8_t  *dst_ptr     = src_dst_ptr;
+    uint32_t key;
+
+    for (uint32_t idx = 0u; idx < length; idx++) {
+        if (idx + OWN_PREFETCH_DISTANCE < length) {
+            own_hash_set_prefetch(set_ptr, (src_16u_ptr[idx + OWN_PREFETCH_DISTANCE] >> shift) & mask);
+        }
+
+        key = (src_16u_ptr[idx] >> shift) & mask;
+        dst_ptr[idx] = own_hash_set_contains(set_ptr, key);
+    }
+}
+
+OWN_QPLC_FUN(void, qplc_set_membership_hash_32u8u_i, (uint8_t * src_dst_ptr,
+        uint32_t              length,
+        uint32_t              shift,
+        uint32_t              mask,
+        const qplc_hash_set_t *set_ptr)) {
+    uint32_t *src_32u_ptr = (uint32_t *) src_dst_ptr;
+    uint8_t  *dst_ptr     = src_dst_ptr;
+    uint32_t key;
+
+    for (uint32_t idx = 0u; idx < length; idx++) {
+        if (idx + OWN_PREFETCH_DISTANCE < length) {
+            own_hash_set_prefetch(set_ptr, (src_32u_ptr[idx + OWN_PREFETCH_DISTANCE] >> shift) & mask);
+        }
+
+        key = (src_32u_ptr[idx] >> shift) & mask;
+        dst_ptr[idx] = own_hash_set_contains(set_ptr, key);
+    }
+}
@@ -36,6 +36,10 @@
 
 #include "opt/qplc_unpack_32u_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/own_unpack_l9.h"
+
 #else
 
 OWN_QPLC_INLINE(void, qplc_unpack_Nu32u, (const uint8_t *src_ptr,
@@ -112,6 +116,8 @@ OWN_QPLC_FUN(void, qplc_unpack_17u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_17u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 17u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 17u, dst_ptr);
 #endif
@@ -125,6 +131,8 @@ OWN_QPLC_FUN(void, qplc_unpack_18u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_18u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 18u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 18u, dst_ptr);
 #endif
@@ -138,6 +146,8 @@ OWN_QPLC_FUN(void, qplc_unpack_19u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_19u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 19u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 19u, dst_ptr);
 #endif
@@ -151,6 +161,8 @@ OWN_QPLC_FUN(void, qplc_unpack_20u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_20u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 20u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 20u, dst_ptr);
 #endif
@@ -164,6 +176,8 @@ OWN_QPLC_FUN(void, qplc_unpack_21u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_21u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 21u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 21u, dst_ptr);
 #endif
@@ -177,6 +191,8 @@ OWN_QPLC_FUN(void, qplc_unpack_22u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_22u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 22u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 22u, dst_ptr);
 #endif
@@ -190,6 +206,8 @@ OWN_QPLC_FUN(void, qplc_unpack_23u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_23u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 23u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 23u, dst_ptr);
 #endif
@@ -203,6 +221,8 @@ OWN_QPLC_FUN(void, qplc_unpack_24u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_24u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 24u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 24u, dst_ptr);
 #endif
@@ -216,6 +236,8 @@ OWN_QPLC_FUN(void, qplc_unpack_25u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_25u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 25u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 25u, dst_ptr);
 #endif
@@ -229,6 +251,8 @@ OWN_QPLC_FUN(void, qplc_unpack_26u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_26u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 26u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 26u, dst_ptr);
 #endif
@@ -242,6 +266,8 @@ OWN_QPLC_FUN(void, qplc_unpack_27u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_27u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 27u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 27u, dst_ptr);
 #endif
@@ -255,6 +281,8 @@ OWN_QPLC_FUN(void, qplc_unpack_28u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_28u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 28u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 28u, dst_ptr);
 #endif
@@ -268,6 +296,8 @@ OWN_QPLC_FUN(void, qplc_unpack_29u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_29u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 29u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 29u, dst_ptr);
 #endif
@@ -281,6 +311,8 @@ OWN_QPLC_FUN(void, qplc_unpack_30u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_30u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 30u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 30u, dst_ptr);
 #endif
@@ -294,6 +326,8 @@ OWN_QPLC_FUN(void, qplc_unpack_31u32u, (const uint8_t *src_ptr,
         uint8_t *dst_ptr)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_unpack_31u32u)(src_ptr, num_elements, start_bit, dst_ptr);
+#elif PLATFORM == L9
+    own_l9_unpack_Nu(src_ptr, num_elements, start_bit, 31u, dst_ptr, sizeof(uint32_t));
 #else
     qplc_unpack_Nu32u(src_ptr, num_elements, start_bit, 31u, dst_ptr);
 #endif
@@ -61,6 +61,15 @@ extern "C" {
 
 #define OWN_ALIGNED_64_ARRAY(array_declaration) OWN_ALIGNED_ARRAY(array_declaration, 64u)
 
+/**
+ * @brief Defines variable with thread storage duration
+ */
+#if defined(_MSC_VER)
+#define OWN_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define OWN_THREAD_LOCAL __thread
+#endif
+
 #define QPL_MAX(a, b) (((a) > (b)) ? (a) : (b))    /**< Simple minimal value idiom */
 #define QPL_MIN(a, b) (((a) < (b)) ? (a) : (b))    /**< Simple maximal value idiom */
 
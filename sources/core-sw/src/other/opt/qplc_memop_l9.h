@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+ /**
+  * @brief Contains AVX2 implementation of functions for Intel® Query Processing Library (Intel® QPL)
+  * memory group functions
+  *
+  * @date 10/17/2022
+  *
+  * @details Function list:
+  *          - @ref l9_qplc_zero_8u
+  *          - @ref l9_qplc_copy_8u
+  *          - @ref l9_qplc_move_8u
+  */
+
+#ifndef OWN_MEMOP_L9_H
+#define OWN_MEMOP_L9_H
+
+#include "own_qplc_defs.h"
+#include "immintrin.h"
+
+// ********************** Zero ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_zero_8u, (uint8_t* dst_ptr, uint32_t length))
+{
+    const __m256i zero = _mm256_setzero_si256();
+
+    uint32_t length_256u = length / sizeof(__m256i);
+
+    while (length_256u > 3u) {
+        _mm256_storeu_si256((__m256i *) dst_ptr, zero);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + 32u), zero);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + 64u), zero);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + 96u), zero);
+        dst_ptr += 128u;
+        length_256u -= 4u;
+    }
+
+    while (length_256u > 0u) {
+        _mm256_storeu_si256((__m256i *) dst_ptr, zero);
+        dst_ptr += 32u;
+        --length_256u;
+    }
+
+    uint32_t remaining_bytes = length % sizeof(__m256i);
+
+    for (uint32_t i = 0u; i < remaining_bytes; i++) {
+        dst_ptr[i] = 0u;
+    }
+}
+
+// ********************** Copy ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_copy_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
+    uint32_t length_256u = length / sizeof(__m256i);
+    uint32_t tail        = length % sizeof(__m256i);
+
+    while (length_256u > 3u) {
+        __m256i ymm0 = _mm256_loadu_si256((const __m256i *) src_ptr);
+        __m256i ymm1 = _mm256_loadu_si256((const __m256i *) (src_ptr + 32u));
+        __m256i ymm2 = _mm256_loadu_si256((const __m256i *) (src_ptr + 64u));
+        __m256i ymm3 = _mm256_loadu_si256((const __m256i *) (src_ptr + 96u));
+        _mm256_storeu_si256((__m256i *) dst_ptr, ymm0);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + 32u), ymm1);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + 64u), ymm2);
+        _mm256_storeu_si256((__m256i *) (dst_ptr + 96u), ymm3);
+        src_ptr += 128u;
+        dst_ptr += 128u;
+        length_256u -= 4u;
+    }
+
+    while (length_256u > 0u) {
+        _mm256_storeu_si256((__m256i *) dst_ptr, _mm256_loadu_si256((const __m256i *) src_ptr));
+        src_ptr += 32u;
+        dst_ptr += 32u;
+        --length_256u;
+    }
+
+    for (uint32_t i = 0u; i < tail; ++i) {
+        dst_ptr[i] = src_ptr[i];
+    }
+}
+
+// ********************** Move ****************************** //
+
+OWN_OPT_FUN(void, l9_qplc_move_8u, (const uint8_t* src_ptr, uint8_t* dst_ptr, uint32_t length)) {
+    uint32_t length_256u = length / sizeof(__m256i);
+    uint32_t tail        = length % sizeof(__m256i);
+
+    if (OWN_QPLC_UINT_PTR(src_ptr) < OWN_QPLC_UINT_PTR(dst_ptr)) {
+        // Destination is above the source, so copy from the end to never overwrite unread data
+        for (uint32_t i = 0u; i < tail; i++) {
+            dst_ptr[length - 1u - i] = src_ptr[length - 1u - i];
+        }
+        for (uint32_t i = length_256u; i > 0u; i--) {
+            __m256i ymm0 = _mm256_loadu_si256((const __m256i *) (src_ptr + (i - 1u) * 32u));
+            _mm256_storeu_si256((__m256i *) (dst_ptr + (i - 1u) * 32u), ymm0);
+        }
+    } else {
+        for (uint32_t i = 0u; i < length_256u; i++) {
+            __m256i ymm0 = _mm256_loadu_si256((const __m256i *) (src_ptr + i * 32u));
+            _mm256_storeu_si256((__m256i *) (dst_ptr + i * 32u), ymm0);
+        }
+        for (uint32_t i = length - tail; i < length; i++) {
+            dst_ptr[i] = src_ptr[i];
+        }
+    }
+}
+
+#endif // OWN_MEMOP_L9_H
@@ -26,6 +26,10 @@
 
 #include "opt/qplc_memop_k0.h"
 
+#elif PLATFORM == L9
+
+#include "opt/qplc_memop_l9.h"
+
 #endif
 
 OWN_QPLC_FUN(void, qplc_set_8u, (uint8_t value, uint8_t * dst_ptr, uint32_t length)) {
@@ -49,6 +53,8 @@ OWN_QPLC_FUN(void, qplc_set_32u, (uint32_t value, uint32_t * dst_ptr, uint32_t l
 OWN_QPLC_FUN(void, qplc_copy_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_copy_8u)(src_ptr, dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_copy_8u)(src_ptr, dst_ptr, length);
 #else
     const uint64_t *src_64u_ptr = (uint64_t *)src_ptr;
     uint64_t *dst_64u_ptr = (uint64_t *)dst_ptr;
@@ -94,6 +100,8 @@ OWN_QPLC_FUN(void, qplc_copy_32u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uin
 OWN_QPLC_FUN(void, qplc_zero_8u, (uint8_t* dst_ptr, uint32_t length)) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_zero_8u)(dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_zero_8u)(dst_ptr, length);
 #else
     uint32_t length_64u = length / sizeof(uint64_t);
 
@@ -136,6 +144,8 @@ OWN_QPLC_FUN(void, qplc_zero_8u, (uint8_t* dst_ptr, uint32_t length)) {
 OWN_QPLC_FUN(void, qplc_move_8u, (const uint8_t *src_ptr, uint8_t *dst_ptr, uint32_t length )) {
 #if PLATFORM >= K0
     CALL_OPT_FUNCTION(k0_qplc_move_8u)(src_ptr,dst_ptr, length);
+#elif PLATFORM == L9
+    CALL_OPT_FUNCTION(l9_qplc_move_8u)(src_ptr,dst_ptr, length);
 #else
     if (OWN_QPLC_UINT_PTR(src_ptr) < OWN_QPLC_UINT_PTR(dst_ptr)) {
         for (uint32_t i = 0u; i < length; i++) {
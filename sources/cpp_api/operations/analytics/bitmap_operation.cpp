@@ -0,0 +1,221 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "qpl/cpp_api/operations/analytics/bitmap_operation.hpp"
+#include "analytics/bitmap.hpp"
+#include "qpl/cpp_api/util/qpl_util.hpp"
+#include "util/checkers.hpp"
+#include "util/util.hpp"
+
+namespace qpl {
+
+namespace internal {
+
+static inline auto is_binary_operation(const bitmap_operations operation) noexcept -> bool {
+    return operation <= bitmap_and_not;
+}
+
+static inline auto is_logic_operation(const bitmap_operations operation) noexcept -> bool {
+    return operation <= bitmap_not;
+}
+
+static inline auto get_bitmap_operation(const bitmap_operations operation) noexcept -> ml::analytics::bitmap_operation_t {
+    using namespace qpl::ml::analytics;
+
+    switch (operation) {
+        case bitmap_and:
+            return bitmap_operation_t::and_op;
+        case bitmap_or:
+            return bitmap_operation_t::or_op;
+        case bitmap_xor:
+            return bitmap_operation_t::xor_op;
+        case bitmap_and_not:
+            return bitmap_operation_t::and_not_op;
+        case bitmap_not:
+            return bitmap_operation_t::not_op;
+        default:
+            return bitmap_operation_t::count;
+    }
+}
+
+template <execution_path path>
+auto validate_operation(bitmap_operation &operation) -> uint32_t {
+    using namespace qpl::ml;
+
+    if constexpr (path == execution_path::hardware) {
+        return status_list::not_supported_err;
+    }
+
+    if (operation.operation_ > bitmap_last_set) {
+        return status_list::status_invalid_params;
+    }
+
+    if (operation.input_vector_bit_width_ != 1) {
+        return status_list::bit_width_error;
+    }
+
+    if (operation.parser_ != parsers::little_endian_packed_array || operation.is_decompression_enabled_) {
+        return status_list::not_supported_err;
+    }
+
+    if (operation.source_size_ == 0) {
+        return status_list::size_error;
+    }
+
+    const size_t number_of_input_elements = operation.number_of_input_elements_ ?
+            static_cast<size_t>(operation.number_of_input_elements_) :
+            operation.source_size_ * byte_bits_size;
+
+    const size_t byte_length = ml::util::bit_to_byte(number_of_input_elements);
+
+    if (byte_length > operation.source_size_ || number_of_input_elements > std::numeric_limits<uint32_t>::max()) {
+        return status_list::source_is_short_error;
+    }
+
+    if (is_binary_operation(operation.operation_)) {
+        if (nullptr == operation.bitmap_) {
+            return status_list::nullptr_error;
+        }
+
+        if (byte_length > operation.bitmap_byte_length_) {
+            return status_list::source_2_is_short_error;
+        }
+
+        if (bad_argument::buffers_overlap(operation.bitmap_,
+                                          operation.bitmap_byte_length_,
+                                          operation.destination_,
+                                          operation.destination_size_)) {
+            return status_list::buffers_overlap;
+        }
+    }
+
+    if (is_logic_operation(operation.operation_)) {
+        if (byte_length > operation.destination_size_) {
+            return status_list::destination_is_short_error;
+        }
+
+        if (bad_argument::buffers_overlap(operation.source_,
+                                          operation.source_size_,
+                                          operation.destination_,
+                                          operation.destination_size_)) {
+            return status_list::buffers_overlap;
+        }
+    }
+
+    return status_list::ok;
+}
+
+template <execution_path path>
+auto execute(bitmap_operation &operation,
+             int32_t UNREFERENCED_PARAMETER(numa_id),
+             uint8_t *UNREFERENCED_PARAMETER(buffer_ptr),
+             size_t UNREFERENCED_PARAMETER(buffer_size)) -> execution_result<uint32_t, sync> {
+    using namespace qpl::ml;
+
+    auto status = validate_operation<path>(operation);
+    if (status != status_list::ok) {
+        return execution_result<uint32_t, sync>(status, 0);
+    }
+
+    const auto number_of_input_elements = operation.number_of_input_elements_ ?
+            operation.number_of_input_elements_ :
+            static_cast<uint32_t>(operation.source_size_ * byte_bits_size);
+
+    const bool is_logic = is_logic_operation(operation.operation_);
+
+    auto result = analytics::call_bitmap(get_bitmap_operation(operation.operation_),
+                                         operation.source_,
+                                         operation.bitmap_,
+                                         operation.destination_,
+                                         number_of_input_elements,
+                                         is_logic);
+
+    uint32_t value = 0u;
+
+    switch (operation.operation_) {
+        case bitmap_popcount: {
+            value = result.aggregates_.sum_;
+            break;
+        }
+        case bitmap_first_set: {
+            value = (result.aggregates_.sum_) ? result.aggregates_.min_value_ : number_of_input_elements;
+            break;
+        }
+        case bitmap_last_set: {
+            value = (result.aggregates_.sum_) ? result.aggregates_.max_value_ : number_of_input_elements;
+            break;
+        }
+        default: {
+            value = number_of_input_elements;
+        }
+    }
+
+    return execution_result<uint32_t, sync>(result.status_code_, value);
+}
+
+template <execution_path path>
+auto execute(bitmap_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    return execute<path>(operation, numa_id, nullptr, 0u);
+}
+
+template
+auto execute<execution_path::software>(bitmap_operation &operation,
+                                       int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::software>(bitmap_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::hardware>(bitmap_operation &operation,
+                                       int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::hardware>(bitmap_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::auto_detect>(bitmap_operation &operation,
+                                          int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::auto_detect>(bitmap_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+} // namespace qpl::internal
+
+auto bitmap_operation::get_output_vector_width() const noexcept -> uint32_t {
+    return 1u;
+}
+
+void bitmap_operation::set_job_buffer(uint8_t * /* buffer */) noexcept {
+    // will be removed after ML introduction
+}
+
+auto bitmap_operation::bitmap_operation_builder::bitmap(const uint8_t *bitmap, size_t bitmap_byte_length)
+-> bitmap_operation_builder & {
+    parent_builder::operation_.bitmap_             = bitmap;
+    parent_builder::operation_.bitmap_byte_length_ = bitmap_byte_length;
+
+    return *this;
+}
+
+namespace util {
+
+template <>
+auto get_buffer_size<bitmap_operation>() -> uint32_t {
+    return 0u;
+}
+
+} // namespace util
+
+} // namespace qpl
@@ -12,6 +12,8 @@
 namespace qpl {
 namespace internal {
 
+constexpr uint32_t unpack_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+
 template <execution_path path>
 auto validate_operation(expand_operation &operation) -> uint32_t {
     using namespace qpl::ml;
@@ -74,7 +76,10 @@ auto validate_operation(expand_operation &operation) -> uint32_t {
 }
 
 template <execution_path path>
-auto execute(expand_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+auto execute(expand_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
     using namespace qpl::ml;
 
     uint32_t input_bit_width = operation.input_vector_bit_width_;
@@ -98,9 +103,11 @@ auto execute(expand_operation &operation, int32_t numa_id) -> execution_result<u
     const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
     const auto output_stream_format = analytics::stream_format_t::le_format;
 
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> src_buffer{};
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> msk_buffer{};
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> dst_buffer{};
+    const auto part_size = buffer_size / 3u;
+
+    auto *src_buffer = buffer_ptr;
+    auto *msk_buffer = src_buffer + part_size;
+    auto *dst_buffer = msk_buffer + part_size;
 
     auto *src_begin  = const_cast<uint8_t *>(operation.source_);
     auto *src_end    = const_cast<uint8_t *>(operation.source_ + operation.source_size_);
@@ -128,11 +135,11 @@ auto execute(expand_operation &operation, int32_t numa_id) -> execution_result<u
             .nominal(input_bit_width == bit_bit_length)
             .build<actual_path>();
 
-    limited_buffer_t source_buffer(src_buffer.data(),
-                                   src_buffer.data() + src_buffer.size(),
+    limited_buffer_t source_buffer(src_buffer,
+                                   src_buffer + part_size,
                                    input_stream.bit_width());
-    limited_buffer_t mask_buffer(msk_buffer.data(), msk_buffer.data() + msk_buffer.size(), byte_bits_size);
-    limited_buffer_t output_buffer(dst_buffer.data(), dst_buffer.data() + dst_buffer.size(), bit_bit_length);
+    limited_buffer_t mask_buffer(msk_buffer, msk_buffer + part_size, byte_bits_size);
+    limited_buffer_t output_buffer(dst_buffer, dst_buffer + part_size, bit_bit_length);
 
     auto extract_result = analytics::call_expand<actual_path>(input_stream,
                                                               mask_stream,
@@ -150,18 +157,43 @@ auto execute(expand_operation &operation, int32_t numa_id) -> execution_result<u
     return execution_result<uint32_t, sync>(extract_result.status_code_, output_elements_count);
 }
 
+template <execution_path path>
+auto execute(expand_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, 3u * unpack_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
 template
 auto execute<execution_path::software>(expand_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::software>(expand_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::hardware>(expand_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::hardware>(expand_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::auto_detect>(expand_operation &operation,
                                           int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::auto_detect>(expand_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 }
 
 void expand_operation::reset_mask(const uint8_t *mask, size_t mask_byte_length) noexcept {
@@ -173,4 +205,13 @@ void expand_operation::set_job_buffer(uint8_t * /* buffer */) noexcept {
     // will be removed after ML introduction
 }
 
+namespace util {
+
+template <>
+auto get_buffer_size<expand_operation>() -> uint32_t {
+    return 3u * internal::unpack_buffer_size;
+}
+
+} // namespace util
+
 } // namespace qpl
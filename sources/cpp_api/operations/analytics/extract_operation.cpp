@@ -14,6 +14,8 @@
 namespace qpl {
 namespace internal {
 
+constexpr uint32_t unpack_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+
 static inline auto get_output_bit_width(uint32_t input_bit_width, uint32_t output_bit_width) -> uint32_t {
     switch (output_bit_width) {
         case 1: {
@@ -106,7 +108,10 @@ auto validate_operation(extract_operation &operation) -> uint32_t {
 }
 
 template <execution_path path>
-auto execute(extract_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+auto execute(extract_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
     using namespace qpl::ml;
 
     uint32_t input_bit_width = operation.input_vector_bit_width_;
@@ -140,8 +145,6 @@ auto execute(extract_operation &operation, int32_t numa_id) -> execution_result<
     const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
     const auto output_stream_format = analytics::stream_format_t::le_format;
 
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> buffer{};
-
     auto *src_begin = const_cast<uint8_t *>(operation.source_);
     auto *src_end   = const_cast<uint8_t *>(operation.source_ + operation.source_size_);
     auto *dst_begin = const_cast<uint8_t *>(operation.destination_);
@@ -171,7 +174,7 @@ auto execute(extract_operation &operation, int32_t numa_id) -> execution_result<
             .initial_output_index(operation.initial_output_index_)
             .build<actual_path>();
 
-    limited_buffer_t temporary_buffer(buffer.data(), buffer.data() + buffer.size(), input_stream.bit_width());
+    limited_buffer_t temporary_buffer(buffer_ptr, buffer_ptr + buffer_size, input_stream.bit_width());
 
     auto extract_result = analytics::call_extract<actual_path>(input_stream,
                                                                output_stream,
@@ -188,18 +191,43 @@ auto execute(extract_operation &operation, int32_t numa_id) -> execution_result<
     return execution_result<uint32_t, sync>(extract_result.status_code_, output_elements_count);
 }
 
+template <execution_path path>
+auto execute(extract_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, unpack_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
 template
 auto execute<execution_path::software>(extract_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::software>(extract_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::hardware>(extract_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::hardware>(extract_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::auto_detect>(extract_operation &operation,
                                           int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::auto_detect>(extract_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 } // namespace qpl::internal
 
 void extract_operation::set_job_buffer(uint8_t * /* buffer */) noexcept {
@@ -218,4 +246,13 @@ auto extract_operation::extract_operation_builder::upper_index(uint32_t value) -
     return *this;
 }
 
+namespace util {
+
+template <>
+auto get_buffer_size<extract_operation>() -> uint32_t {
+    return internal::unpack_buffer_size;
+}
+
+} // namespace util
+
 } // namespace qpl
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+
 #include "analytics/find_unique.hpp"
 #include "qpl/cpp_api/operations/analytics/find_unique_operation.hpp"
 #include "qpl/cpp_api/util/qpl_util.hpp"
@@ -13,6 +15,9 @@ namespace qpl {
 
 namespace internal {
 
+constexpr uint32_t unpack_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+constexpr uint32_t set_buffer_size    = 1u << 16u;                   /**< Size of the set buffer */
+
 template <execution_path path>
 auto validate_operation(find_unique_operation &operation) -> uint32_t {
     using namespace qpl::ml;
@@ -76,7 +81,10 @@ auto validate_operation(find_unique_operation &operation) -> uint32_t {
 }
 
 template <execution_path path>
-auto execute(find_unique_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+auto execute(find_unique_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
     using namespace qpl::ml;
 
     uint32_t input_bit_width = operation.input_vector_bit_width_;
@@ -102,8 +110,15 @@ auto execute(find_unique_operation &operation, int32_t numa_id) -> execution_res
 
     constexpr auto actual_path = static_cast<execution_path_t>(path);
 
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> src_buffer{};
-    std::array<uint8_t, 1u << 16u>               msk_buffer{};
+    auto *src_buffer = buffer_ptr;
+    auto *msk_buffer = buffer_ptr + unpack_buffer_size;
+
+    const uint32_t set_size = 1u << (input_bit_width -
+                                     operation.number_low_order_bits_ignored_ -
+                                     operation.number_high_order_bits_ignored_);
+
+    // Only the part of the set buffer that is addressed by the kernel has to be cleared
+    std::fill(msk_buffer, msk_buffer + set_size, 0u);
 
     const auto input_stream_format  = qpl::util::parser_to_ml_parser(operation.parser_);
     const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
@@ -129,8 +144,8 @@ auto execute(find_unique_operation &operation, int32_t numa_id) -> execution_res
             .initial_output_index(operation.initial_output_index_)
             .build<actual_path>();
 
-    limited_buffer_t unpack_buffer(src_buffer.data(), src_buffer.data() + src_buffer.size(), input_stream.bit_width());
-    limited_buffer_t set_buffer(msk_buffer.data(), msk_buffer.data() + msk_buffer.size(), bit_bit_length);
+    limited_buffer_t unpack_buffer(src_buffer, src_buffer + unpack_buffer_size, input_stream.bit_width());
+    limited_buffer_t set_buffer(msk_buffer, buffer_ptr + buffer_size, bit_bit_length);
 
     auto find_unique_result = analytics::call_find_unique<actual_path>(input_stream,
                                                                        output_stream,
@@ -147,18 +162,43 @@ auto execute(find_unique_operation &operation, int32_t numa_id) -> execution_res
     return execution_result<uint32_t, sync>(find_unique_result.status_code_, output_elements_count);
 }
 
+template <execution_path path>
+auto execute(find_unique_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, unpack_buffer_size + set_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
 template
 auto execute<execution_path::software>(find_unique_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::software>(find_unique_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::hardware>(find_unique_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::hardware>(find_unique_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::auto_detect>(find_unique_operation &operation,
                                           int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::auto_detect>(find_unique_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 } // namespace qpl::internal
 
 auto find_unique_operation::get_output_vector_width() const noexcept -> uint32_t {
@@ -183,4 +223,13 @@ auto find_unique_operation::find_unique_operation_builder::number_high_order_bit
     return *this;
 }
 
+namespace util {
+
+template <>
+auto get_buffer_size<find_unique_operation>() -> uint32_t {
+    return internal::unpack_buffer_size + internal::set_buffer_size;
+}
+
+} // namespace util
+
 } // namespace qpl
@@ -15,6 +15,8 @@ namespace qpl {
 
 namespace internal {
 
+constexpr uint32_t unpack_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+
 template <execution_path path>
 auto validate_operation(scan_operation &operation) -> uint32_t {
     using namespace qpl::ml;
@@ -82,7 +84,10 @@ auto validate_operation(scan_operation &operation) -> uint32_t {
 }
 
 template <execution_path path>
-auto execute(scan_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+auto execute(scan_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
     using namespace qpl::ml;
 
     uint32_t input_bit_width = operation.input_vector_bit_width_;
@@ -100,8 +105,6 @@ auto execute(scan_operation &operation, int32_t numa_id) -> execution_result<uin
             operation.number_of_input_elements_ :
             (operation.source_size_ * byte_bits_size) / input_bit_width;
 
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> buffer{};
-
     constexpr auto actual_path = static_cast<execution_path_t>(path);
 
     const auto input_stream_format  = qpl::util::parser_to_ml_parser(operation.parser_);
@@ -128,7 +131,7 @@ auto execute(scan_operation &operation, int32_t numa_id) -> execution_result<uin
             .initial_output_index(operation.initial_output_index_)
             .build<actual_path>();
 
-    limited_buffer_t temporary_buffer(buffer.data(), buffer.data() + buffer.size(), input_stream.bit_width());
+    limited_buffer_t temporary_buffer(buffer_ptr, buffer_ptr + buffer_size, input_stream.bit_width());
 
     analytics::analytic_operation_result_t scan_result;
 
@@ -201,16 +204,41 @@ auto execute(scan_operation &operation, int32_t numa_id) -> execution_result<uin
     return execution_result<uint32_t, sync>(scan_result.status_code_, output_elements_count);
 }
 
+template <execution_path path>
+auto execute(scan_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, unpack_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
 template
 auto execute<execution_path::software>(scan_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::software>(scan_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::hardware>(scan_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::hardware>(scan_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::auto_detect>(scan_operation &operation,
                                           int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::auto_detect>(scan_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 } // namespace qpl::internal
 
 auto scan_operation::get_output_vector_width() const noexcept -> uint32_t {
@@ -239,4 +267,13 @@ auto scan_operation::scan_operation_builder::is_inclusive(bool value) -> scan_op
     return *this;
 }
 
+namespace util {
+
+template <>
+auto get_buffer_size<scan_operation>() -> uint32_t {
+    return internal::unpack_buffer_size;
+}
+
+} // namespace util
+
 } // namespace qpl
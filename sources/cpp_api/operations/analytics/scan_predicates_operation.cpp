@@ -0,0 +1,278 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <array>
+
+#include "qpl/cpp_api/operations/analytics/scan_predicates_operation.hpp"
+#include "analytics/scan_predicates.hpp"
+#include "qpl/cpp_api/util/qpl_util.hpp"
+#include "util/checkers.hpp"
+
+namespace qpl {
+
+namespace internal {
+
+constexpr uint32_t unpack_buffer_size  = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+constexpr uint32_t results_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of each of the buffers for results */
+
+/**
+ * Unpack buffer, results of the program and results of the current predicate
+ */
+constexpr uint32_t scan_predicates_buffer_size = unpack_buffer_size + 2u * results_buffer_size;
+
+static_assert(scan_predicates_operation::max_predicates == ml::limits::max_scan_predicates,
+              "Limits of the number of predicates are different");
+
+static inline auto get_comparator(const scan_predicate &predicate) noexcept -> ml::analytics::comparator_t {
+    using namespace qpl::ml::analytics;
+
+    switch (predicate.comparator) {
+        case comparators::less:
+            return (predicate.is_inclusive) ? comparator_t::less_equals : comparator_t::less_than;
+        case comparators::greater:
+            return (predicate.is_inclusive) ? comparator_t::greater_equals : comparator_t::greater_than;
+        case comparators::not_equals:
+            return comparator_t::not_equals;
+        default:
+            return comparator_t::equals;
+    }
+}
+
+template <execution_path path>
+auto validate_operation(scan_predicates_operation &operation) -> uint32_t {
+    using namespace qpl::ml;
+
+    if constexpr (path == execution_path::hardware) {
+        return status_list::not_supported_err;
+    }
+
+    if (0u == operation.predicates_count_ || operation.predicates_count_ > scan_predicates_operation::max_predicates) {
+        return status_list::size_error;
+    }
+
+    if (bad_argument::buffers_overlap(operation.source_,
+                                      operation.source_size_,
+                                      operation.destination_,
+                                      operation.destination_size_)) {
+        return status_list::buffers_overlap;
+    }
+
+    uint32_t input_bit_width = operation.input_vector_bit_width_;
+
+    if (operation.parser_ == parsers::parquet_rle && !operation.is_decompression_enabled_) {
+        input_bit_width = *const_cast<uint8_t *>(operation.source_);
+    }
+
+    if (input_bit_width < 1 || input_bit_width > 32) {
+        return status_list::bit_width_error;
+    }
+
+    if (operation.is_decompression_enabled_) {
+        return status_list::not_supported_err;
+    }
+
+    if (operation.destination_size_ == 0) {
+        return status_list::destination_is_short_error;
+    }
+
+    size_t number_of_input_elements = static_cast<size_t>(operation.number_of_input_elements_);
+
+    if (operation.output_vector_bit_width_ == 1) {
+        if (ml::util::bit_to_byte(number_of_input_elements) > operation.destination_size_) {
+            return status_list::destination_is_short_error;
+        }
+    }
+
+    if (operation.parser_ != parsers::parquet_rle) {
+        if (ml::util::bit_to_byte(number_of_input_elements * input_bit_width) > operation.source_size_) {
+            return status_list::source_is_short_error;
+        }
+    }
+
+    const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
+
+    if (analytics::output_bit_width_format_t::same_as_input != out_bit_width_format) {
+        uint32_t max_possible_index = std::numeric_limits<uint32_t>::max();
+
+        if (analytics::output_bit_width_format_t::bits_32 != out_bit_width_format) {
+            max_possible_index = (analytics::output_bit_width_format_t::bits_8 == out_bit_width_format) ? 0xFF : 0xFFFF;
+        }
+
+        if ((static_cast<size_t>(operation.initial_output_index_) + number_of_input_elements - 1u)
+                > static_cast<size_t>(max_possible_index)) {
+            return status_list::output_overflow_error;
+        }
+    }
+
+    return status_list::ok;
+}
+
+template <execution_path path>
+auto execute(scan_predicates_operation &operation,
+             int32_t UNREFERENCED_PARAMETER(numa_id),
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
+    using namespace qpl::ml;
+
+    auto status = validate_operation<path>(operation);
+    if (status != status_list::ok) {
+        return execution_result<uint32_t, sync>(status, 0);
+    }
+
+    if (buffer_size < scan_predicates_buffer_size) {
+        return execution_result<uint32_t, sync>(status_list::size_error, 0);
+    }
+
+    uint32_t input_bit_width = operation.input_vector_bit_width_;
+
+    if (operation.parser_ == parsers::parquet_rle) {
+        input_bit_width = *const_cast<uint8_t *>(operation.source_);
+    }
+
+    const auto number_of_input_elements = operation.number_of_input_elements_ ?
+            operation.number_of_input_elements_ :
+            (operation.source_size_ * byte_bits_size) / input_bit_width;
+
+    const auto input_stream_format  = qpl::util::parser_to_ml_parser(operation.parser_);
+    const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
+    const auto output_stream_format = analytics::stream_format_t::le_format;
+
+    auto *src_begin = const_cast<uint8_t *>(operation.source_);
+    auto *src_end   = const_cast<uint8_t *>(operation.source_ + operation.source_size_);
+    auto *dst_begin = const_cast<uint8_t *>(operation.destination_);
+    auto *dst_end   = const_cast<uint8_t *>(operation.destination_ + operation.destination_size_);
+
+    auto input_stream = analytics::input_stream_t::builder(src_begin, src_end)
+            .element_count(number_of_input_elements)
+            .omit_checksums(true)
+            .omit_aggregates(true)
+            .stream_format(input_stream_format, input_bit_width)
+            .build<execution_path_t::software>();
+
+    auto output_stream = analytics::output_stream_t<analytics::bit_stream>::builder(dst_begin, dst_end)
+            .stream_format(output_stream_format)
+            .bit_format(out_bit_width_format, bit_bit_length)
+            .nominal(true)
+            .initial_output_index(operation.initial_output_index_)
+            .build<execution_path_t::software>();
+
+    std::array<analytics::scan_predicate_t, ml::limits::max_scan_predicates> predicates{};
+
+    for (uint32_t i = 0u; i < operation.predicates_count_; i++) {
+        predicates[i].comparator  = get_comparator(operation.predicates_[i]);
+        predicates[i].param_low   = operation.predicates_[i].boundary;
+        predicates[i].param_high  = operation.predicates_[i].boundary;
+        predicates[i].combination = static_cast<analytics::predicate_combination_t>(operation.predicates_[i].combination);
+    }
+
+    auto *results_buffer_ptr   = buffer_ptr + unpack_buffer_size;
+    auto *predicate_buffer_ptr = results_buffer_ptr + results_buffer_size;
+
+    limited_buffer_t unpack_buffer(buffer_ptr, buffer_ptr + unpack_buffer_size, input_stream.bit_width());
+    limited_buffer_t results_buffer(results_buffer_ptr, results_buffer_ptr + results_buffer_size, byte_bits_size);
+    limited_buffer_t predicate_buffer(predicate_buffer_ptr,
+                                      predicate_buffer_ptr + results_buffer_size,
+                                      byte_bits_size);
+
+    auto scan_result = analytics::call_scan_predicates(input_stream,
+                                                       output_stream,
+                                                       predicates.data(),
+                                                       operation.predicates_count_,
+                                                       unpack_buffer,
+                                                       results_buffer,
+                                                       predicate_buffer);
+
+    auto output_elements_count = qpl::util::get_output_elements_as_bits(&scan_result,
+                                                                        out_bit_width_format,
+                                                                        operation.output_vector_bit_width_);
+
+    return execution_result<uint32_t, sync>(scan_result.status_code_, output_elements_count);
+}
+
+template <execution_path path>
+auto execute(scan_predicates_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, scan_predicates_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
+template
+auto execute<execution_path::software>(scan_predicates_operation &operation,
+                                       int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::software>(scan_predicates_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::hardware>(scan_predicates_operation &operation,
+                                       int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::hardware>(scan_predicates_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::auto_detect>(scan_predicates_operation &operation,
+                                          int32_t numa_id) -> execution_result<uint32_t, sync>;
+
+template
+auto execute<execution_path::auto_detect>(scan_predicates_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
+} // namespace qpl::internal
+
+auto scan_predicates_operation::get_output_vector_width() const noexcept -> uint32_t {
+    return output_vector_bit_width_;
+}
+
+void scan_predicates_operation::set_job_buffer(uint8_t * /* buffer */) noexcept {
+    // will be removed after ML introduction
+}
+
+auto scan_predicates_operation::scan_predicates_operation_builder::predicate(predicate_combinations combination,
+                                                                             comparators comparator,
+                                                                             uint32_t boundary,
+                                                                             bool is_inclusive)
+-> scan_predicates_operation_builder & {
+    auto &operation = parent_builder::operation_;
+
+    if (operation.predicates_count_ < max_predicates) {
+        operation.predicates_[operation.predicates_count_] = scan_predicate{comparator, boundary, is_inclusive, combination};
+    }
+
+    operation.predicates_count_++;
+
+    return *this;
+}
+
+auto scan_predicates_operation::scan_predicates_operation_builder::is_inclusive(bool value)
+-> scan_predicates_operation_builder & {
+    auto &operation = parent_builder::operation_;
+
+    if (0u != operation.predicates_count_ && operation.predicates_count_ <= max_predicates) {
+        operation.predicates_[operation.predicates_count_ - 1u].is_inclusive = value;
+    }
+
+    return *this;
+}
+
+namespace util {
+
+template <>
+auto get_buffer_size<scan_predicates_operation>() -> uint32_t {
+    return internal::scan_predicates_buffer_size;
+}
+
+} // namespace util
+
+} // namespace qpl
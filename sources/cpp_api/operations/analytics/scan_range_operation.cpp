@@ -13,6 +13,8 @@ namespace qpl {
 
 namespace internal {
 
+constexpr uint32_t unpack_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+
 template <execution_path path>
 auto validate_operation(scan_range_operation &operation) -> uint32_t {
     using namespace qpl::ml;
@@ -80,7 +82,10 @@ auto validate_operation(scan_range_operation &operation) -> uint32_t {
 }
 
 template <execution_path path>
-auto execute(scan_range_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+auto execute(scan_range_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
     using namespace qpl::ml;
 
     uint32_t input_bit_width = operation.input_vector_bit_width_;
@@ -100,8 +105,6 @@ auto execute(scan_range_operation &operation, int32_t numa_id) -> execution_resu
 
     constexpr auto actual_path = static_cast<execution_path_t>(path);
 
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> buffer{};
-
     const auto input_stream_format  = qpl::util::parser_to_ml_parser(operation.parser_);
     const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
     const auto output_stream_format = analytics::stream_format_t::le_format;
@@ -126,7 +129,7 @@ auto execute(scan_range_operation &operation, int32_t numa_id) -> execution_resu
             .initial_output_index(operation.initial_output_index_)
             .build<actual_path>();
 
-    limited_buffer_t temporary_buffer(buffer.data(), buffer.data() + buffer.size(), input_stream.bit_width());
+    limited_buffer_t temporary_buffer(buffer_ptr, buffer_ptr + buffer_size, input_stream.bit_width());
 
     analytics::analytic_operation_result_t scan_range_result;
 
@@ -156,19 +159,44 @@ auto execute(scan_range_operation &operation, int32_t numa_id) -> execution_resu
     return execution_result<uint32_t, sync>(scan_range_result.status_code_, output_elements_count);
 }
 
+template <execution_path path>
+auto execute(scan_range_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, unpack_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
 template
 auto execute<execution_path::software>(scan_range_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::software>(scan_range_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::hardware>(scan_range_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::hardware>(scan_range_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 // @todo Currently auto == software
 template
 auto execute<execution_path::auto_detect>(scan_range_operation &operation,
                                           int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::auto_detect>(scan_range_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 } // namespace qpl::internal
 
 void scan_range_operation::set_job_buffer(uint8_t * /* buffer */) noexcept {
@@ -199,4 +227,13 @@ auto scan_range_operation::scan_range_operation_builder::is_inclusive(bool value
     return *this;
 }
 
+namespace util {
+
+template <>
+auto get_buffer_size<scan_range_operation>() -> uint32_t {
+    return internal::unpack_buffer_size;
+}
+
+} // namespace util
+
 } // namespace qpl
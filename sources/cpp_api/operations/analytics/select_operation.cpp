@@ -12,6 +12,8 @@
 namespace qpl {
 namespace internal {
 
+constexpr uint32_t unpack_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+
 template <execution_path path>
 auto validate_operation(select_operation &operation) -> uint32_t {
     using namespace qpl::ml;
@@ -77,7 +79,10 @@ auto validate_operation(select_operation &operation) -> uint32_t {
 }
 
 template <execution_path path>
-auto execute(select_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+auto execute(select_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
     using namespace qpl::ml;
 
     uint32_t input_bit_width = operation.input_vector_bit_width_;
@@ -103,9 +108,11 @@ auto execute(select_operation &operation, int32_t numa_id) -> execution_result<u
 
     constexpr auto actual_path = static_cast<execution_path_t>(path);
 
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> src_buffer{};
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> msk_buffer{};
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> dst_buffer{};
+    const auto part_size = buffer_size / 3u;
+
+    auto *src_buffer = buffer_ptr;
+    auto *msk_buffer = src_buffer + part_size;
+    auto *dst_buffer = msk_buffer + part_size;
 
     const auto input_stream_format  = qpl::util::parser_to_ml_parser(operation.parser_);
     const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
@@ -137,11 +144,11 @@ auto execute(select_operation &operation, int32_t numa_id) -> execution_result<u
             .nominal(input_bit_width == bit_bit_length)
             .build<actual_path>();
 
-    limited_buffer_t source_buffer(src_buffer.data(),
-                                   src_buffer.data() + src_buffer.size(),
+    limited_buffer_t source_buffer(src_buffer,
+                                   src_buffer + part_size,
                                    input_stream.bit_width());
-    limited_buffer_t mask_buffer(msk_buffer.data(), msk_buffer.data() + msk_buffer.size(), byte_bits_size);
-    limited_buffer_t output_buffer(dst_buffer.data(), dst_buffer.data() + dst_buffer.size(), bit_bit_length);
+    limited_buffer_t mask_buffer(msk_buffer, msk_buffer + part_size, byte_bits_size);
+    limited_buffer_t output_buffer(dst_buffer, dst_buffer + part_size, bit_bit_length);
 
     auto extract_result = analytics::call_select<actual_path>(input_stream,
                                                               mask_stream,
@@ -159,18 +166,43 @@ auto execute(select_operation &operation, int32_t numa_id) -> execution_result<u
     return execution_result<uint32_t, sync>(extract_result.status_code_, output_elements_count);
 }
 
+template <execution_path path>
+auto execute(select_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, 3u * unpack_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
 template
 auto execute<execution_path::software>(select_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::software>(select_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::hardware>(select_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::hardware>(select_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::auto_detect>(select_operation &operation,
                                           int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::auto_detect>(select_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 }
 
 void select_operation::reset_mask(const uint8_t *mask, size_t mask_byte_length) noexcept {
@@ -182,4 +214,13 @@ void select_operation::set_job_buffer(uint8_t * /* buffer */) noexcept {
     // will be removed after ML introduction
 }
 
+namespace util {
+
+template <>
+auto get_buffer_size<select_operation>() -> uint32_t {
+    return 3u * internal::unpack_buffer_size;
+}
+
+} // namespace util
+
 } // namespace qpl
@@ -12,6 +12,9 @@
 namespace qpl {
 namespace internal {
 
+constexpr uint32_t unpack_buffer_size = 4096u * sizeof(uint32_t);    /**< Size of the unpack buffer */
+constexpr uint32_t set_buffer_size    = 1u << 16u;                   /**< Size of the set buffer */
+
 template <execution_path path>
 auto validate_operation(set_membership_operation &operation) -> uint32_t {
     using namespace qpl::ml;
@@ -92,7 +95,10 @@ auto validate_operation(set_membership_operation &operation) -> uint32_t {
 }
 
 template <execution_path path>
-auto execute(set_membership_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+auto execute(set_membership_operation &operation,
+             int32_t numa_id,
+             uint8_t *buffer_ptr,
+             size_t buffer_size) -> execution_result<uint32_t, sync> {
     using namespace qpl::ml;
 
     uint32_t input_bit_width = operation.input_vector_bit_width_;
@@ -112,8 +118,8 @@ auto execute(set_membership_operation &operation, int32_t numa_id) -> execution_
 
     constexpr auto actual_path = static_cast<execution_path_t>(path);
 
-    std::array<uint8_t, 4_kb * sizeof(uint32_t)> src_buffer{};
-    std::array<uint8_t, 1u << 16u>               msk_buffer{};
+    auto *src_buffer = buffer_ptr;
+    auto *msk_buffer = buffer_ptr + unpack_buffer_size;
 
     const auto input_stream_format  = qpl::util::parser_to_ml_parser(operation.parser_);
     const auto out_bit_width_format = qpl::util::integer_to_output_format(operation.output_vector_bit_width_);
@@ -150,13 +156,13 @@ auto execute(set_membership_operation &operation, int32_t numa_id) -> execution_
             .stream_format(analytics::stream_format_t::le_format, bit_bit_length)
             .build<actual_path>();
 
-    limited_buffer_t unpack_buffer(src_buffer.data(),
-                                   src_buffer.data() + src_buffer.size(),
+    limited_buffer_t unpack_buffer(src_buffer,
+                                   src_buffer + unpack_buffer_size,
                                    input_stream.bit_width());
 
     const auto set_buffer_width = ml::util::bit_width_to_bytes(bit_bit_length) * byte_bit_length;
 
-    limited_buffer_t set_buffer(msk_buffer.data(), msk_buffer.data() + msk_buffer.size(), set_buffer_width);
+    limited_buffer_t set_buffer(msk_buffer, buffer_ptr + buffer_size, set_buffer_width);
 
     auto set_membership_result = analytics::call_set_membership<actual_path>(input_stream,
                                                                              set_stream,
@@ -174,18 +180,43 @@ auto execute(set_membership_operation &operation, int32_t numa_id) -> execution_
     return execution_result<uint32_t, sync>(set_membership_result.status_code_, output_elements_count);
 }
 
+template <execution_path path>
+auto execute(set_membership_operation &operation, int32_t numa_id) -> execution_result<uint32_t, sync> {
+    std::array<uint8_t, unpack_buffer_size + set_buffer_size> buffer{};
+
+    return execute<path>(operation, numa_id, buffer.data(), buffer.size());
+}
+
 template
 auto execute<execution_path::software>(set_membership_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::software>(set_membership_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::hardware>(set_membership_operation &operation,
                                        int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::hardware>(set_membership_operation &operation,
+                                       int32_t numa_id,
+                                       uint8_t *buffer_ptr,
+                                       size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 template
 auto execute<execution_path::auto_detect>(set_membership_operation &operation,
                                           int32_t numa_id) -> execution_result<uint32_t, sync>;
 
+template
+auto execute<execution_path::auto_detect>(set_membership_operation &operation,
+                                          int32_t numa_id,
+                                          uint8_t *buffer_ptr,
+                                          size_t buffer_size) -> execution_result<uint32_t, sync>;
+
 }
 
 auto set_membership_operation::get_output_vector_width() const noexcept -> uint32_t {
@@ -215,4 +246,13 @@ void set_membership_operation::set_job_buffer(uint8_t * /* buffer */) noexcept {
     // will be removed after ML introduction
 }
 
+namespace util {
+
+template <>
+auto get_buffer_size<set_membership_operation>() -> uint32_t {
+    return internal::unpack_buffer_size + internal::set_buffer_size;
+}
+
+} // namespace util
+
 } // namespace qpl
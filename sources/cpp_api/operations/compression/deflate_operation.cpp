@@ -4,18 +4,254 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "qpl/cpp_api/operations/operation.hpp"
 #include "qpl/cpp_api/operations/compression/deflate_operation.hpp"
+#include "qpl/cpp_api/util/task_pool.hpp"
 
 #include "compression/deflate/deflate.hpp"
 #include "compression/deflate/streams/deflate_state_builder.hpp"
+#include "compression/dictionary/dictionary_utils.hpp"
 #include "compression/stream_decorators/default_decorator.hpp"
 #include "compression/stream_decorators/gzip_decorator.hpp"
 #include "util/checkers.hpp"
+#include "util/checksum.hpp"
 
 namespace qpl {
 namespace internal {
 
+namespace {
+
+constexpr uint32_t stored_block_max_size    = 65535u;    /**< Maximum number of bytes in one stored block */
+constexpr uint32_t stored_block_header_size = 5u;        /**< Block type byte, LEN and NLEN fields */
+constexpr uint32_t segment_output_slope     = 1024u;     /**< Extra space for the compressor output */
+
+/**
+ * @brief Shared state of one parallel compression, workers take segments one by one
+ *        until all of them are compressed
+ */
+struct parallel_deflate_task {
+    const uint8_t                        *source_ptr        = nullptr;
+    uint32_t                             source_size        = 0u;
+    uint32_t                             segment_size       = 0u;
+    uint32_t                             segments_count     = 0u;
+    ml::compression::compression_level_t level              = ml::compression::default_level;
+    compression_modes                    mode               = dynamic_mode;
+    qpl_compression_huffman_table        *huffman_table_ptr = nullptr;
+
+    std::vector<std::vector<uint8_t>> outputs;    /**< Compressed segments */
+    std::vector<uint32_t>             crcs;       /**< CRC32 of the source segments */
+
+    std::atomic<uint32_t>   next_segment{0u};     /**< Index of the segment that should be taken next */
+    std::mutex              mutex;                /**< Protects completed segments counter */
+    std::condition_variable condition;            /**< Wakes up the caller when a segment is completed */
+    uint32_t                completed_segments = 0u;
+};
+
+void write_stored_blocks(const uint8_t *source_ptr,
+                         uint32_t source_size,
+                         bool is_final,
+                         std::vector<uint8_t> &output) {
+    output.clear();
+
+    do {
+        const auto block_size = std::min(source_size, stored_block_max_size);
+        const auto nlen       = static_cast<uint16_t>(~block_size);
+
+        source_size -= block_size;
+
+        // Stored block header is byte-aligned as the previous segment ends with the sync flush
+        output.push_back((is_final && source_size == 0u) ? 1u : 0u);
+        output.push_back(static_cast<uint8_t>(block_size));
+        output.push_back(static_cast<uint8_t>(block_size >> 8u));
+        output.push_back(static_cast<uint8_t>(nlen));
+        output.push_back(static_cast<uint8_t>(nlen >> 8u));
+        output.insert(output.end(), source_ptr, source_ptr + block_size);
+
+        source_ptr += block_size;
+    } while (source_size);
+}
+
+void deflate_segment(parallel_deflate_task &task, uint32_t index, uint8_t *buffer_ptr, size_t buffer_size) {
+    using namespace qpl::ml;
+    using namespace qpl::ml::compression;
+
+    const auto offset     = index * task.segment_size;
+    const auto size       = std::min(task.segment_size, task.source_size - offset);
+    const bool is_last    = (index + 1u == task.segments_count);
+    auto       source_ptr = const_cast<uint8_t *>(task.source_ptr + offset);
+
+    // Segment that doesn't fit into the size of stored blocks is written as stored blocks anyway
+    auto &output = task.outputs[index];
+    output.resize(size + stored_block_header_size * (size / stored_block_max_size + 1u) + segment_output_slope);
+
+    ml::util::set_zeros(buffer_ptr, static_cast<uint32_t>(buffer_size));
+
+    allocation_buffer_t state_buffer(buffer_ptr, buffer_ptr + buffer_size);
+
+    const ml::util::linear_allocator allocator(state_buffer);
+
+    auto builder = deflate_state_builder<execution_path_t::software>::create(allocator);
+
+    builder.output(output.data(), static_cast<uint32_t>(output.size()))
+           .compression_level(task.level)
+           .terminate(is_last)
+           .sync_flush(!is_last)
+           .load_current_position(0);
+
+    if (task.mode == compression_modes::dynamic_mode) {
+        builder.collect_statistics_step(true);
+    } else {
+        builder.start_new_block(true);
+
+        if (task.mode == compression_modes::static_mode) {
+            builder.compression_table(task.huffman_table_ptr);
+        }
+    }
+
+    // The tail of the previous segment is used as a history, so matches can cross the segments boundary
+    alignas(qpl_dictionary) std::array<uint8_t, sizeof(qpl_dictionary) + max_history_size> dictionary_buffer{};
+
+    if (offset) {
+        auto       &dictionary  = *reinterpret_cast<qpl_dictionary *>(dictionary_buffer.data());
+        const auto history_size = std::min(offset, max_history_size);
+
+        build_dictionary(dictionary,
+                         software_compression_level::SW_NONE,
+                         hardware_compression_level::HW_NONE,
+                         source_ptr - history_size,
+                         history_size);
+
+        builder.dictionary(dictionary);
+    }
+
+    auto state = builder.build();
+
+    auto result = deflate<execution_path_t::software, deflate_mode_t::deflate_default>(state, source_ptr, size);
+
+    if (result.status_code_ == status_list::ok && result.completed_bytes_ == size) {
+        output.resize(result.output_bytes_);
+        task.crcs[index] = result.checksums_.crc32_;
+    } else {
+        write_stored_blocks(source_ptr, size, is_last, output);
+        task.crcs[index] = ml::util::crc32_gzip(source_ptr, source_ptr + size, 0u);
+    }
+}
+
+void process_segments(parallel_deflate_task &task, uint8_t *buffer_ptr, size_t buffer_size) {
+    for (auto index = task.next_segment++; index < task.segments_count; index = task.next_segment++) {
+        deflate_segment(task, index, buffer_ptr, buffer_size);
+
+        {
+            std::lock_guard<std::mutex> lock(task.mutex);
+            task.completed_segments++;
+        }
+
+        task.condition.notify_all();
+    }
+}
+
+auto call_parallel_deflate(deflate_properties &properties,
+                           uint32_t segment_size,
+                           const uint8_t *source_ptr,
+                           uint32_t source_size,
+                           uint8_t *destination_ptr,
+                           uint32_t destination_size,
+                           uint8_t *buffer_ptr,
+                           size_t buffer_size) -> std::pair<uint32_t, uint32_t> {
+    using namespace qpl::ml;
+    using namespace qpl::ml::compression;
+
+    auto task = std::make_shared<parallel_deflate_task>();
+
+    task->source_ptr        = source_ptr;
+    task->source_size       = source_size;
+    task->segment_size      = segment_size;
+    task->segments_count    = (source_size + task->segment_size - 1u) / task->segment_size;
+    task->level             = static_cast<compression_level_t>(properties.compression_level_);
+    task->mode              = properties.compression_mode_;
+    task->huffman_table_ptr = properties.huffman_table_.get_table_data();
+
+    task->outputs.resize(task->segments_count);
+    task->crcs.resize(task->segments_count);
+
+    const auto threads_count = std::min(properties.parallel_threads_
+                                        ? properties.parallel_threads_
+                                        : std::max(1u, std::thread::hardware_concurrency()),
+                                        task->segments_count);
+
+    // Helpers that start after all segments are taken exit immediately, so the caller never waits for them
+    for (uint32_t i = 1u; i < threads_count; i++) {
+        qpl::util::submit_task([task]() -> void {
+            if (task->next_segment.load() >= task->segments_count) {
+                return;
+            }
+
+            const auto state_size = deflate_state<execution_path_t::software>::required_buffer_size();
+            auto       buffer     = std::make_unique<uint8_t[]>(state_size);
+
+            process_segments(*task, buffer.get(), state_size);
+        });
+    }
+
+    process_segments(*task, buffer_ptr, buffer_size);
+
+    {
+        std::unique_lock<std::mutex> lock(task->mutex);
+        task->condition.wait(lock, [&task]() -> bool {
+            return task->completed_segments == task->segments_count;
+        });
+    }
+
+    const uint32_t header_size  = properties.gzip_mode_ ? OWN_GZIP_HEADER_LENGTH : 0u;
+    const uint32_t trailer_size = properties.gzip_mode_ ? sizeof(gzip_decorator::gzip_trailer) : 0u;
+
+    size_t output_size = header_size + trailer_size;
+
+    for (auto &output : task->outputs) {
+        output_size += output.size();
+    }
+
+    if (output_size > destination_size) {
+        return {status_list::more_output_needed, 0u};
+    }
+
+    auto *current_ptr = destination_ptr;
+
+    if (properties.gzip_mode_) {
+        gzip_decorator::write_header_unsafe(current_ptr, header_size);
+        current_ptr += header_size;
+    }
+
+    uint32_t crc = 0u;
+
+    for (uint32_t index = 0u; index < task->segments_count; index++) {
+        const auto &output     = task->outputs[index];
+        const auto source_part = std::min(segment_size, source_size - index * segment_size);
+
+        current_ptr = std::copy(output.begin(), output.end(), current_ptr);
+        crc         = ml::util::crc32_combine(crc, task->crcs[index], source_part);
+    }
+
+    if (properties.gzip_mode_) {
+        gzip_decorator::gzip_trailer trailer{crc, source_size};
+
+        gzip_decorator::write_trailer_unsafe(current_ptr, trailer_size, trailer);
+    }
+
+    return {status_list::ok, static_cast<uint32_t>(output_size)};
+}
+
+} // anonymous namespace
+
 template <execution_path path>
 auto call_deflate(deflate_operation &operation,
                   uint8_t *buffer_ptr,
@@ -29,10 +265,31 @@ auto call_deflate(deflate_operation &operation,
         return {status_list::buffers_overlap, 0u};
     }
 
+    if constexpr (path == software) {
+        auto       &properties  = operation.properties_;
+        const auto segment_size = properties.parallel_segment_size_
+                                  ? properties.parallel_segment_size_
+                                  : parallel_segment_size;
+
+        if (properties.parallel_threads_ != 1u &&
+            properties.mini_block_size_ == mini_block_sizes::mini_block_size_none &&
+            properties.compression_mode_ != compression_modes::canned_mode &&
+            operation.source_size_ > segment_size) {
+            return call_parallel_deflate(properties,
+                                         segment_size,
+                                         operation.source_,
+                                         static_cast<uint32_t>(operation.source_size_),
+                                         const_cast<uint8_t *>(operation.destination_),
+                                         static_cast<uint32_t>(operation.destination_size_),
+                                         buffer_ptr,
+                                         buffer_size);
+        }
+    }
+
     constexpr const auto actual_path = static_cast<execution_path_t>(path);
 
     if constexpr(path == hardware) {
-        if (operation.properties_.compression_level_ == high_level) {
+        if (operation.properties_.compression_level_ != default_level) {
             return {status_list::not_supported_err, 0};
         }
     } else {
@@ -173,6 +430,14 @@ auto deflate_operation::deflate_operation_builder::compression_level(compression
     return *this;
 }
 
+auto deflate_operation::deflate_operation_builder::parallel(uint32_t thread_count, uint32_t segment_size)
+-> deflate_operation_builder & {
+    parent_builder::operation_.properties_.parallel_threads_      = thread_count;
+    parent_builder::operation_.properties_.parallel_segment_size_ = segment_size;
+
+    return *this;
+}
+
 auto deflate_operation::get_gzip_mode() -> bool {
     return properties_.gzip_mode_;
 }
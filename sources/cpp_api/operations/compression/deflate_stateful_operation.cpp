@@ -41,7 +41,7 @@ void deflate_stateful_operation::set_proper_flags() noexcept {
     }
 
     // Configuring compression level
-    job->level = properties_.compression_level_ == default_level ? qpl_default_level : qpl_high_level;
+    job->level = static_cast<qpl_compression_levels>(properties_.compression_level_);
 }
 
 void deflate_stateful_operation::set_buffers() noexcept {
@@ -69,6 +69,10 @@ auto deflate_stateful_operation::execute() -> std::pair<uint32_t, uint32_t> {
     auto const job  = reinterpret_cast<qpl_job *>(buffer_);
     auto job_status = qpl_submit_job(job);
 
+    if (QPL_STS_OK == job_status) {
+        job_status = qpl_wait_job(job);
+    }
+
     std::pair<uint32_t, uint32_t> result(job_status, job->total_out);
     return result;
 }
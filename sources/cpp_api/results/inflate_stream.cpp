@@ -4,8 +4,13 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <limits>
+
+#include "qpl/qpl.h"
 #include "qpl/cpp_api/results/inflate_stream.hpp"
 #include "qpl/cpp_api/operations/compression/inflate_stateful_operation.hpp"
+#include "qpl/cpp_api/util/constants.hpp"
 #include "qpl/cpp_api/util/status_handler.hpp"
 
 template <qpl::execution_path path>
@@ -41,6 +46,83 @@ auto qpl::inflate_stream<path>::extract_impl(uint8_t *destination_begin,
     return *this;
 }
 
+template <qpl::execution_path path>
+auto qpl::inflate_stream<path>::extract(segment_sink &sink) -> inflate_stream & {
+    // Accelerator writes complete qwords on non-last jobs, so the segment with less free bytes is considered full
+    constexpr size_t min_free_size = sizeof(uint64_t);
+
+    bool is_first = this->state_ == compression_stream_state::initial;
+
+    this->state_ = compression_stream_state::basic;
+
+    if (this->buffer_current_ >= this->buffer_end_) {
+        throw operation_process_exception("Source buffer has no more bytes");
+    }
+
+    // The last chunk flag requires the output to hold the rest of the stream,
+    // so the jobs are submitted as middle chunks until the output stops filling the segment
+    const auto *job_ptr = reinterpret_cast<const qpl_job *>(this->job_buffer_.get());
+
+    bool   is_done    = false;
+    bool   is_stalled = false;
+    size_t min_size   = min_free_size;
+
+    do {
+        const auto segment      = sink.acquire(min_size);
+        const auto segment_size = std::min<size_t>(segment.size, std::numeric_limits<uint32_t>::max());
+
+        // The first chunk resets the number of processed bytes
+        const uint32_t previous_total_in  = is_first ? 0u : job_ptr->total_in;
+        const uint32_t previous_total_out = is_first ? 0u : job_ptr->total_out;
+
+        operation_->first_chunk(is_first);
+        operation_->last_chunk(false);
+        operation_->set_proper_flags();
+
+        auto result = internal::execute<path>(*operation_,
+                                              this->buffer_current_,
+                                              this->buffer_end_,
+                                              segment.data,
+                                              segment.data + segment_size);
+
+        bool is_more_output_needed = false;
+
+        result.if_absent([&is_more_output_needed](uint32_t status) -> void {
+            if (QPL_STS_MORE_OUTPUT_NEEDED == status) {
+                is_more_output_needed = true;
+            } else {
+                util::handle_status(status);
+            }
+        });
+
+        const size_t input_size  = job_ptr->total_in - previous_total_in;
+        const size_t output_size = job_ptr->total_out - previous_total_out;
+
+        sink.commit(output_size);
+        this->buffer_current_ = this->destination_buffer_.get() + operation_->get_processed_bytes();
+
+        const bool is_output_full = is_more_output_needed || segment_size - output_size < min_free_size;
+
+        is_done  = !is_output_full && this->buffer_current_ >= this->buffer_end_;
+        is_first = false;
+
+        // The rest of the segment may be too small for the decompressor, the next segment must be larger
+        if (!is_done && 0u == input_size && 0u == output_size) {
+            if (is_stalled) {
+                throw short_destination_exception(messages::short_destination);
+            }
+
+            is_stalled = true;
+            min_size   = segment_size + 1u;
+        } else {
+            is_stalled = false;
+            min_size   = min_free_size;
+        }
+    } while (!is_done);
+
+    return *this;
+}
+
 template <qpl::execution_path path>
 void qpl::inflate_stream<path>::constructor_impl(uint8_t *source_begin,
                                                  size_t source_size) {
@@ -58,6 +140,12 @@ template
 void qpl::inflate_stream<qpl::execution_path::hardware>::constructor_impl(uint8_t *source_begin,
                                                                           size_t source_size);
 
+template
+auto qpl::inflate_stream<qpl::execution_path::software>::extract(segment_sink &sink) -> inflate_stream &;
+
+template
+auto qpl::inflate_stream<qpl::execution_path::hardware>::extract(segment_sink &sink) -> inflate_stream &;
+
 template
 auto qpl::inflate_stream<qpl::execution_path::software>::extract_impl(uint8_t *destination_begin,
                                                                       size_t destination_size) -> inflate_stream &;
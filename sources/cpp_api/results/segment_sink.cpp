@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include "qpl/cpp_api/results/segment_sink.hpp"
+#include "qpl/cpp_api/util/constants.hpp"
+#include "qpl/cpp_api/util/exceptions.hpp"
+
+namespace qpl {
+
+segment_sink::segment_sink(size_t segment_size)
+        : segment_size_(segment_size) {
+    if (segment_size < min_segment_size) {
+        throw invalid_argument_exception(messages::short_segment_size);
+    }
+}
+
+segment_sink::segment_sink(provider_t provider) noexcept
+        : provider_(std::move(provider)) {
+    // Empty constructor
+}
+
+auto segment_sink::segments() const noexcept -> const std::vector<output_segment> & {
+    return written_segments_;
+}
+
+auto segment_sink::size() const noexcept -> size_t {
+    return total_size_;
+}
+
+auto segment_sink::acquire(size_t min_size) -> output_segment {
+    const size_t free_size = current_segment_.size - current_size_;
+
+    if (free_size >= min_size && 0u != free_size) {
+        return {current_segment_.data + current_size_, free_size};
+    }
+
+    output_segment segment{};
+
+    if (provider_) {
+        segment = provider_(min_size);
+
+        if (nullptr == segment.data || segment.size < min_size || 0u == segment.size) {
+            throw short_destination_exception(messages::short_segment);
+        }
+    } else {
+        segment.size = std::max({segment_size_, min_size, size_t(1u)});
+        segment.data = allocated_segments_.emplace_back(new uint8_t[segment.size]).get();
+    }
+
+    // The entry for the written part of the segment is reserved here, so committing never allocates
+    if (written_segments_.size() == written_segments_.capacity()) {
+        written_segments_.reserve(2u * written_segments_.size() + 1u);
+    }
+
+    current_segment_ = segment;
+    current_size_    = 0u;
+
+    return segment;
+}
+
+void segment_sink::commit(size_t size) noexcept {
+    if (0u == size) {
+        return;
+    }
+
+    // The first bytes of the segment start the new entry of the list
+    if (0u == current_size_) {
+        written_segments_.push_back({current_segment_.data, 0u});
+    }
+
+    written_segments_.back().size += size;
+    current_size_ += size;
+    total_size_ += size;
+}
+
+} // namespace qpl
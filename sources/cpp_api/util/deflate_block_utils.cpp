@@ -4,14 +4,56 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "qpl/cpp_api/operations/compression/inflate_stateful_operation.hpp"
 #include "qpl/cpp_api/util/deflate_block_utils.hpp"
+#include "qpl/cpp_api/util/qpl_service_functions_wrapper.hpp"
 #include "qpl/cpp_api/util/status_handler.hpp"
+#include "qpl/cpp_api/util/task_pool.hpp"
+
+#include "util/checksum.hpp"
 
 namespace qpl::util {
 
+namespace {
+
+/**
+ * @brief Shared state of one parallel decompression, workers take ranges of mini-blocks one by one
+ *        until all of them are decompressed
+ */
+struct mini_blocks_task {
+    const uint8_t         *source            = nullptr;
+    uint8_t               *destination       = nullptr;
+    uint32_t              uncompressed_size  = 0u;
+    uint32_t              mini_block_size    = 0u;    /**< Size of one mini-block in bytes */
+    uint32_t              range_size         = 0u;    /**< Number of mini-blocks in one range */
+    uint32_t              ranges_count       = 0u;
+    const internal::index *index_array       = nullptr;
+    execution_path        path               = execution_path::software;
+    uint8_t               *job_buffers       = nullptr;   /**< Job buffers of the workers allocated by the caller */
+    uint32_t              job_buffer_size    = 0u;
+
+    std::vector<uint32_t> crcs;                       /**< CRC32 of the decompressed ranges */
+    std::exception_ptr    error;                      /**< The first exception thrown by workers */
+
+    std::atomic<uint32_t>   next_range{0u};           /**< Index of the range that should be taken next */
+    std::atomic<uint32_t>   next_job_buffer{0u};      /**< Index of the job buffer for the next worker */
+    std::mutex              mutex;                    /**< Protects completed ranges counter and error */
+    std::condition_variable condition;                /**< Wakes up the caller when a range is completed */
+    uint32_t                completed_ranges = 0u;
+};
+
+} // anonymous namespace
+
 static inline auto get_start_bit_offset(const uint32_t first_bit_index) noexcept -> uint32_t {
     return first_bit_index & (byte_bit_length - 1u);
 }
@@ -99,4 +141,141 @@ void read_mini_block(const uint8_t *source,
                      operation);
 }
 
+static void process_mini_blocks(mini_blocks_task &task) {
+    uint8_t                              *job_buffer = nullptr;
+    internal::inflate_stateful_operation operation;
+
+    for (auto range = task.next_range++; range < task.ranges_count; range = task.next_range++) {
+        try {
+            const auto first_byte  = range * task.range_size * task.mini_block_size;
+            const auto last_byte   = std::min(task.uncompressed_size,
+                                              first_byte + task.range_size * task.mini_block_size);
+            const auto first_block = range * task.range_size;
+
+            // Every worker parses the block header once and then decompresses mini-blocks with its own job,
+            // there are no more workers with a range than ranges, so each of them gets a separate buffer
+            if (!job_buffer) {
+                job_buffer = task.job_buffers + task.next_job_buffer++ * task.job_buffer_size;
+
+                operation.set_job_buffer(job_buffer);
+                operation.init_job(task.path);
+
+                read_header(task.source,
+                            task.destination + first_byte,
+                            last_byte - first_byte,
+                            const_cast<internal::index *>(task.index_array),
+                            operation);
+            }
+
+            for (auto offset = first_byte, block = first_block;
+                 offset < last_byte;
+                 offset += task.mini_block_size, block++) {
+                read_mini_block(task.source,
+                                task.destination + offset,
+                                std::min(task.mini_block_size, last_byte - offset),
+                                block,
+                                task.index_array,
+                                operation);
+            }
+
+            task.crcs[range] = ml::util::crc32_gzip(task.destination + first_byte, task.destination + last_byte, 0u);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(task.mutex);
+
+            if (!task.error) {
+                task.error = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(task.mutex);
+            task.completed_ranges++;
+        }
+
+        task.condition.notify_all();
+    }
+}
+
+auto get_mini_blocks_threads_count(const uint32_t uncompressed_size,
+                                   const mini_block_sizes mini_block_size,
+                                   const uint32_t thread_count) noexcept -> uint32_t {
+    const auto mini_blocks_count = get_number_of_mini_blocks(uncompressed_size, mini_block_size);
+
+    return std::min(thread_count ? thread_count : std::max(1u, std::thread::hardware_concurrency()),
+                    mini_blocks_count);
+}
+
+void read_mini_blocks(const uint8_t *source,
+                      uint8_t *destination,
+                      const uint32_t destination_size,
+                      const uint32_t uncompressed_size,
+                      const mini_block_sizes mini_block_size,
+                      const internal::index *index_array,
+                      const execution_path path,
+                      const uint32_t thread_count,
+                      uint8_t *job_buffers) {
+    if (destination_size < uncompressed_size) {
+        throw short_destination_exception(messages::short_destination);
+    }
+
+    const auto mini_blocks_count = get_number_of_mini_blocks(uncompressed_size, mini_block_size);
+
+    if (mini_blocks_count == 0u) {
+        return;
+    }
+
+    const auto threads_count = get_mini_blocks_threads_count(uncompressed_size, mini_block_size, thread_count);
+
+    auto task = std::make_shared<mini_blocks_task>();
+
+    task->source            = source;
+    task->destination       = destination;
+    task->uncompressed_size = uncompressed_size;
+    task->mini_block_size   = convert_mini_block_size(mini_block_size);
+    task->range_size        = (mini_blocks_count + threads_count - 1u) / threads_count;
+    task->ranges_count      = (mini_blocks_count + task->range_size - 1u) / task->range_size;
+    task->index_array       = index_array;
+    task->path              = path;
+    task->job_buffers       = job_buffers;
+    task->job_buffer_size   = get_job_size();
+
+    task->crcs.resize(task->ranges_count);
+
+    // Helpers that start after all ranges are taken exit immediately, so the caller never waits for them
+    for (uint32_t i = 1u; i < task->ranges_count; i++) {
+        submit_task([task]() -> void {
+            if (task->next_range.load() < task->ranges_count) {
+                process_mini_blocks(*task);
+            }
+        });
+    }
+
+    process_mini_blocks(*task);
+
+    {
+        std::unique_lock<std::mutex> lock(task->mutex);
+        task->condition.wait(lock, [&task]() -> bool {
+            return task->completed_ranges == task->ranges_count;
+        });
+    }
+
+    if (task->error) {
+        std::rethrow_exception(task->error);
+    }
+
+    // Index entry that follows the last mini-block keeps CRC of the whole stream
+    uint32_t crc = 0u;
+
+    for (uint32_t range = 0u; range < task->ranges_count; range++) {
+        const auto first_byte = range * task->range_size * task->mini_block_size;
+        const auto last_byte  = std::min(uncompressed_size, first_byte + task->range_size * task->mini_block_size);
+
+        crc = ml::util::crc32_combine(crc, task->crcs[range], last_byte - first_byte);
+    }
+
+    if (crc != index_array[mini_blocks_count + 1u].crc) {
+        throw invalid_data_exception(messages::index_crc_mismatch);
+    }
+}
+
 } // namespace qpl::util
@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <memory>
+
+#include "qpl/cpp_api/util/task_pool.hpp"
+#include "qpl/cpp_api/util/status_handler.hpp"
+
+// Middle layer headers
+#include "util/executor.hpp"
+
+namespace qpl::util {
+
+namespace {
+
+/**
+ * @brief Callable submitted to the workers of the library, it is released once it is called
+ */
+struct function_task_t {
+    ml::util::executor_task_t executor_task;     /**< Node of the executor queue */
+    std::function<void()>     function;
+};
+
+void run_function_task(void *context) {
+    std::unique_ptr<function_task_t> task(reinterpret_cast<function_task_t *>(context));
+
+    task->function();
+}
+
+} // anonymous namespace
+
+void submit_task(std::function<void()> task) {
+    auto function_task = std::make_unique<function_task_t>();
+
+    function_task->executor_task.routine = run_function_task;
+    function_task->executor_task.context = function_task.get();
+    function_task->function              = std::move(task);
+
+    const auto status = ml::util::execute_async(&function_task->executor_task);
+
+    if (ml::status_list::ok != status) {
+        handle_status(status);
+    }
+
+    // The task is owned by the worker from now on
+    function_task.release();
+}
+
+} // namespace qpl::util
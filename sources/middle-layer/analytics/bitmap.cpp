@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "bitmap.hpp"
+
+#include "dispatcher/dispatcher.hpp"
+#include "util/util.hpp"
+
+namespace qpl::ml::analytics {
+
+namespace {
+
+/**
+ * @brief Calculates aggregates of the bit vector, bits of the last byte that are beyond bit_length are ignored
+ */
+inline auto calculate_aggregates(const uint8_t *src_ptr, const uint32_t bit_length) noexcept -> aggregates_t {
+    const auto &kernels      = dispatcher::kernels_dispatcher::get_instance();
+    const auto popcount_impl = kernels.get_bitmap_popcount_table()[0];
+    const auto find_table    = kernels.get_bitmap_find_table();
+
+    const uint32_t full_bytes = bit_length / byte_bits_size;
+    const uint32_t tail_bits  = bit_length & max_bit_index;
+    const uint8_t  tail_byte  = (tail_bits) ? src_ptr[full_bytes] & static_cast<uint8_t>((1u << tail_bits) - 1u) : 0u;
+
+    aggregates_t aggregates;
+
+    aggregates.sum_ = popcount_impl(src_ptr, full_bytes) + popcount_impl(&tail_byte, 1u);
+
+    if (0u == aggregates.sum_) {
+        return aggregates;
+    }
+
+    const uint32_t first_index = find_table[0](src_ptr, full_bytes);
+
+    aggregates.min_value_ = (std::numeric_limits<uint32_t>::max() != first_index)
+                            ? first_index
+                            : full_bytes * byte_bits_size + find_table[0](&tail_byte, 1u);
+
+    const uint32_t last_tail_index = find_table[1](&tail_byte, 1u);
+
+    aggregates.max_value_ = (std::numeric_limits<uint32_t>::max() != last_tail_index)
+                            ? full_bytes * byte_bits_size + last_tail_index
+                            : find_table[1](src_ptr, full_bytes);
+
+    return aggregates;
+}
+
+} // anonymous namespace
+
+auto call_bitmap(const bitmap_operation_t operation,
+                 const uint8_t *src1_ptr,
+                 const uint8_t *src2_ptr,
+                 uint8_t *dst_ptr,
+                 const uint32_t bit_length,
+                 const bool omit_aggregates) noexcept -> analytic_operation_result_t {
+    const auto     &kernels    = dispatcher::kernels_dispatcher::get_instance();
+    const uint32_t byte_length = util::bit_to_byte(bit_length);
+    const uint32_t tail_bits   = bit_length & max_bit_index;
+
+    analytic_operation_result_t operation_result{};
+
+    if (bitmap_operation_t::count == operation) {
+        if (!omit_aggregates) {
+            operation_result.aggregates_ = calculate_aggregates(src1_ptr, bit_length);
+        }
+
+        return operation_result;
+    }
+
+    if (bitmap_operation_t::not_op == operation) {
+        kernels.get_bitmap_not_table()[0](src1_ptr, dst_ptr, byte_length);
+    } else {
+        const auto logic_impl = kernels.get_bitmap_logic_table()[static_cast<uint32_t>(operation)];
+
+        logic_impl(src1_ptr, src2_ptr, dst_ptr, byte_length);
+    }
+
+    // Bits beyond the vector are not defined in the sources, so are zeroed in the result
+    if (tail_bits) {
+        dst_ptr[byte_length - 1u] &= static_cast<uint8_t>((1u << tail_bits) - 1u);
+    }
+
+    if (!omit_aggregates) {
+        operation_result.aggregates_ = calculate_aggregates(dst_ptr, bit_length);
+    }
+
+    operation_result.output_bytes_    = byte_length;
+    operation_result.last_bit_offset_ = static_cast<uint8_t>(tail_bits);
+
+    return operation_result;
+}
+
+} // namespace qpl::ml::analytics
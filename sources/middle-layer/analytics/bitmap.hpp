@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_BITMAP_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_BITMAP_HPP_
+
+#include "analytics_defs.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Operations on bit vectors, values of binary operations are indices in the bitmap logic table
+ */
+enum class bitmap_operation_t : uint32_t {
+    and_op     = 0u,
+    or_op      = 1u,
+    xor_op     = 2u,
+    and_not_op = 3u,
+    not_op     = 4u,
+    count      = 5u
+};
+
+/**
+ * @brief Performs the operation over bit vectors of bit_length bits, bit i is the bit (i % 8) of the byte (i / 8)
+ *
+ * @details Logic operations write util::bit_to_byte(bit_length) bytes to dst_ptr, unused bits of the last byte
+ *          are zeroed. Count writes nothing, src2_ptr and dst_ptr are ignored for it, as src2_ptr is for NOT.
+ *          Aggregates are taken from the result of the logic operation or from src1_ptr for count:
+ *          sum is the number of set bits, min and max are indices of the first and the last set bits
+ *          (UINT32_MAX and 0 if there are no set bits).
+ */
+auto call_bitmap(bitmap_operation_t operation,
+                 const uint8_t *src1_ptr,
+                 const uint8_t *src2_ptr,
+                 uint8_t *dst_ptr,
+                 uint32_t bit_length,
+                 bool omit_aggregates = false) noexcept -> analytic_operation_result_t;
+
+} // namespace qpl::ml::analytics
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_BITMAP_HPP_
@@ -4,9 +4,15 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <cstring>
+#include <new>
+
 #include "find_unique.hpp"
+#include "hash_set.hpp"
 #include "descriptor_builder.hpp"
 #include "util/descriptor_processing.hpp"
+#include "util/memory.hpp"
 
 namespace qpl::ml::analytics {
 
@@ -70,6 +76,194 @@ static inline auto find_unique(input_stream_t &input_stream,
     return status_list::ok;
 }
 
+/**
+ * @brief Unpacks the input chunk by chunk and passes every chunk to the callback
+ */
+template <analytic_pipeline pipeline_t, class callback_t>
+static inline auto for_each_unpacked_chunk(input_stream_t &input_stream,
+                                           limited_buffer_t &unpack_buffer,
+                                           callback_t &callback) noexcept -> uint32_t {
+    auto drop_initial_bytes_status = input_stream.skip_prologue(unpack_buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    while (!input_stream.is_processed()) {
+        auto unpack_result = input_stream.unpack<pipeline_t>(unpack_buffer);
+
+        if (status_list::ok != unpack_result.status) {
+            return unpack_result.status;
+        }
+
+        const uint32_t status = callback(unpack_result.unpacked_elements);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+    }
+
+    return status_list::ok;
+}
+
+template <class callback_t>
+static inline auto for_each_unpacked_chunk(input_stream_t &input_stream,
+                                           limited_buffer_t &unpack_buffer,
+                                           callback_t &callback) noexcept -> uint32_t {
+    if (input_stream.stream_format() == stream_format_t::prle_format) {
+        return (input_stream.is_compressed())
+               ? for_each_unpacked_chunk<analytic_pipeline::inflate_prle>(input_stream, unpack_buffer, callback)
+               : for_each_unpacked_chunk<analytic_pipeline::prle>(input_stream, unpack_buffer, callback);
+    }
+
+    return (input_stream.is_compressed())
+           ? for_each_unpacked_chunk<analytic_pipeline::inflate>(input_stream, unpack_buffer, callback)
+           : for_each_unpacked_chunk<analytic_pipeline::simple>(input_stream, unpack_buffer, callback);
+}
+
+/**
+ * @brief Sorts distinct values and writes them to the output as 32-bit little-endian integers
+ */
+static inline auto store_unique_list(uint32_t *values_ptr,
+                                     uint32_t values_count,
+                                     uint8_t *destination_begin,
+                                     uint8_t *destination_end,
+                                     aggregates_t &aggregates,
+                                     uint32_t &output_bytes) noexcept -> uint32_t {
+    const uint64_t required_bytes = static_cast<uint64_t>(values_count) * sizeof(uint32_t);
+
+    if (required_bytes > static_cast<uint64_t>(destination_end - destination_begin)) {
+        return status_list::destination_is_short_error;
+    }
+
+    std::sort(values_ptr, values_ptr + values_count);
+    std::memcpy(destination_begin, values_ptr, required_bytes);
+
+    // Same values as the aggregates of the byte per value set give
+    if (0u != values_count) {
+        aggregates.min_value_ = values_ptr[0];
+        aggregates.max_value_ = values_ptr[values_count - 1u];
+    }
+    aggregates.sum_ = values_count;
+
+    output_bytes = static_cast<uint32_t>(required_bytes);
+
+    return status_list::ok;
+}
+
+static inline auto find_unique_list(input_stream_t &input_stream,
+                                    uint8_t *destination_begin,
+                                    uint8_t *destination_end,
+                                    uint32_t bits_shift,
+                                    uint32_t set_bit_width,
+                                    limited_buffer_t &unpack_buffer,
+                                    limited_buffer_t &set_buffer,
+                                    aggregates_t &aggregates,
+                                    uint32_t &output_bytes) noexcept -> uint32_t {
+    const uint32_t bits_set_mask = (limits::max_bit_width == set_bit_width)
+                                   ? std::numeric_limits<uint32_t>::max()
+                                   : (1u << set_bit_width) - 1u;
+
+    // Narrow domains are marked in the byte per value array by the usual kernels
+    if (set_bit_width <= limits::max_set_size) {
+        auto find_unique_table  = dispatcher::kernels_dispatcher::get_instance().get_find_unique_table();
+        auto find_unique_index  = dispatcher::get_find_unique_index(input_stream.bit_width());
+        auto find_unique_kernel = find_unique_table[find_unique_index];
+
+        const uint32_t bits_set_size = 1u << set_bit_width;
+
+        auto mark_values = [&](uint32_t elements_count) -> uint32_t {
+            find_unique_kernel(unpack_buffer.data(), set_buffer.data(), elements_count, bits_shift, bits_set_mask);
+            return status_list::ok;
+        };
+
+        auto status = for_each_unpacked_chunk(input_stream, unpack_buffer, mark_values);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+
+        uint32_t values_count = 0u;
+
+        for (uint32_t value = 0u; value < bits_set_size; value++) {
+            values_count += set_buffer.data()[value];
+        }
+
+        const uint64_t required_bytes = static_cast<uint64_t>(values_count) * sizeof(uint32_t);
+
+        if (required_bytes > static_cast<uint64_t>(destination_end - destination_begin)) {
+            return status_list::destination_is_short_error;
+        }
+
+        // Values are ascending already, the destination is filled directly
+        uint8_t *current_ptr = destination_begin;
+
+        for (uint32_t value = 0u; value < bits_set_size; value++) {
+            if (set_buffer.data()[value]) {
+                std::memcpy(current_ptr, &value, sizeof(uint32_t));
+                current_ptr += sizeof(uint32_t);
+
+                if (std::numeric_limits<uint32_t>::max() == aggregates.min_value_) {
+                    aggregates.min_value_ = value;
+                }
+                aggregates.max_value_ = value;
+            }
+        }
+
+        aggregates.sum_ = values_count;
+        output_bytes    = static_cast<uint32_t>(required_bytes);
+
+        return status_list::ok;
+    }
+
+    hash_set_t hash_set;
+
+    auto insert_values = [&](uint32_t elements_count) -> uint32_t {
+        const uint8_t *values_ptr = unpack_buffer.data();
+
+        for (uint32_t i = 0u; i < elements_count; i++) {
+            uint32_t value = 0u;
+
+            // Domains wider than limits::max_set_size bits come from 16u and 32u unpacked inputs only
+            if (input_stream.bit_width() <= 16u) {
+                value = reinterpret_cast<const uint16_t *>(values_ptr)[i];
+            } else {
+                value = reinterpret_cast<const uint32_t *>(values_ptr)[i];
+            }
+
+            if (!hash_set.insert((value >> bits_shift) & bits_set_mask)) {
+                return status_list::memory_allocation_error;
+            }
+        }
+
+        return status_list::ok;
+    };
+
+    auto status = for_each_unpacked_chunk(input_stream, unpack_buffer, insert_values);
+
+    if (status_list::ok != status) {
+        return status;
+    }
+
+    auto *values_ptr = new (std::nothrow) uint32_t[std::max(hash_set.size(), 1u)];
+
+    if (nullptr == values_ptr) {
+        return status_list::memory_allocation_error;
+    }
+
+    hash_set.copy_keys(values_ptr);
+
+    status = store_unique_list(values_ptr,
+                               hash_set.size(),
+                               destination_begin,
+                               destination_end,
+                               aggregates,
+                               output_bytes);
+
+    delete[] values_ptr;
+
+    return status;
+}
+
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstack-usage=4096"
@@ -212,4 +406,37 @@ auto call_find_unique<execution_path_t::auto_detect>(input_stream_t &input_strea
     return hw_result;
 }
 
+auto call_find_unique_list(input_stream_t &input_stream,
+                           uint8_t *destination_begin,
+                           uint8_t *destination_end,
+                           uint32_t low_bits_to_ignore,
+                           uint32_t high_bits_to_ignore,
+                           limited_buffer_t &unpack_buffer,
+                           limited_buffer_t &set_buffer) noexcept -> analytic_operation_result_t {
+    aggregates_t aggregates{};
+    uint32_t     output_bytes = 0u;
+
+    const uint32_t status_code = find_unique_list(input_stream,
+                                                  destination_begin,
+                                                  destination_end,
+                                                  low_bits_to_ignore,
+                                                  input_stream.bit_width() - low_bits_to_ignore - high_bits_to_ignore,
+                                                  unpack_buffer,
+                                                  set_buffer,
+                                                  aggregates,
+                                                  output_bytes);
+
+    input_stream.calculate_checksums();
+
+    analytic_operation_result_t operation_result{};
+
+    operation_result.status_code_      = status_code;
+    operation_result.aggregates_       = (input_stream.are_aggregates_disabled()) ? aggregates_t{} : aggregates;
+    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
+    operation_result.checksums_.xor_   = input_stream.xor_checksum();
+    operation_result.output_bytes_     = output_bytes;
+
+    return operation_result;
+}
+
 } // namespace qpl::ml::analytics
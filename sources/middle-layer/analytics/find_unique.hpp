@@ -21,6 +21,20 @@ auto call_find_unique(input_stream_t &input_stream,
                       limited_buffer_t &set_buffer,
                       int32_t numa_id = -1) noexcept -> analytic_operation_result_t;
 
+/**
+ * @brief Software find unique that writes distinct values as an ascending list of 32-bit little-endian integers
+ *
+ * @details Domains of up to limits::max_set_size bits are marked in the byte per value array in set_buffer,
+ *          wider domains are collected to a hash set
+ */
+auto call_find_unique_list(input_stream_t &input_stream,
+                           uint8_t *destination_begin,
+                           uint8_t *destination_end,
+                           uint32_t low_bits_to_ignore,
+                           uint32_t high_bits_to_ignore,
+                           limited_buffer_t &unpack_buffer,
+                           limited_buffer_t &set_buffer) noexcept -> analytic_operation_result_t;
+
 } // namespace qpl::ml::analytics
 
 #endif // FIND_UNIQUE_OPERATION_HPP
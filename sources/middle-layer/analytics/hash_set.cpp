@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <new>
+
+#include "hash_set.hpp"
+
+namespace qpl::ml::analytics {
+
+namespace {
+constexpr uint32_t min_buckets_count = 4u;
+
+/**
+ * @brief Returns the number of buckets that keeps the set at most half full
+ */
+auto get_buckets_count(uint64_t keys_count) noexcept -> uint64_t {
+    uint64_t buckets_count = min_buckets_count;
+
+    while (buckets_count * QPLC_HASH_SET_BUCKET_SIZE < 2u * keys_count) {
+        buckets_count *= 2u;
+    }
+
+    return buckets_count;
+}
+} // anonymous namespace
+
+hash_set_t::~hash_set_t() noexcept {
+    delete[] buckets_ptr_;
+}
+
+auto hash_set_t::reserve(uint32_t keys_count) noexcept -> bool {
+    return rehash(static_cast<uint32_t>(get_buckets_count(keys_count)));
+}
+
+auto hash_set_t::insert(uint32_t key) noexcept -> bool {
+    if (QPLC_HASH_SET_EMPTY_KEY == key) {
+        has_empty_key_ = true;
+        return true;
+    }
+
+    if (2u * static_cast<uint64_t>(keys_count_ + 1u) > static_cast<uint64_t>(buckets_count_) * QPLC_HASH_SET_BUCKET_SIZE) {
+        if (!rehash(static_cast<uint32_t>(get_buckets_count(keys_count_ + 1u)))) {
+            return false;
+        }
+    }
+
+    uint32_t bucket = qplc_hash_set_bucket(key, buckets_count_);
+
+    while (true) {
+        for (auto &slot : buckets_ptr_[bucket].slots) {
+            if (key == slot) {
+                return true;
+            }
+
+            if (QPLC_HASH_SET_EMPTY_KEY == slot) {
+                slot = key;
+                keys_count_++;
+
+                return true;
+            }
+        }
+
+        bucket = (bucket + 1u == buckets_count_) ? 0u : bucket + 1u;
+    }
+}
+
+auto hash_set_t::size() const noexcept -> uint32_t {
+    return keys_count_ + (has_empty_key_ ? 1u : 0u);
+}
+
+void hash_set_t::copy_keys(uint32_t *destination_ptr) const noexcept {
+    for (uint32_t i = 0u; i < buckets_count_; i++) {
+        for (auto slot : buckets_ptr_[i].slots) {
+            if (QPLC_HASH_SET_EMPTY_KEY != slot) {
+                *destination_ptr++ = slot;
+            }
+        }
+    }
+
+    if (has_empty_key_) {
+        *destination_ptr = QPLC_HASH_SET_EMPTY_KEY;
+    }
+}
+
+auto hash_set_t::view() const noexcept -> qplc_hash_set_t {
+    return {reinterpret_cast<const uint32_t *>(buckets_ptr_), buckets_count_, has_empty_key_ ? 1u : 0u};
+}
+
+auto hash_set_t::rehash(uint32_t buckets_count) noexcept -> bool {
+    if (buckets_count <= buckets_count_) {
+        return true;
+    }
+
+    auto *buckets_ptr = new (std::nothrow) bucket_t[buckets_count];
+
+    if (nullptr == buckets_ptr) {
+        return false;
+    }
+
+    for (uint32_t i = 0u; i < buckets_count; i++) {
+        for (auto &slot : buckets_ptr[i].slots) {
+            slot = QPLC_HASH_SET_EMPTY_KEY;
+        }
+    }
+
+    auto *previous_buckets_ptr  = buckets_ptr_;
+    auto previous_buckets_count = buckets_count_;
+
+    buckets_ptr_   = buckets_ptr;
+    buckets_count_ = buckets_count;
+    keys_count_    = 0u;
+
+    for (uint32_t i = 0u; i < previous_buckets_count; i++) {
+        for (auto slot : previous_buckets_ptr[i].slots) {
+            if (QPLC_HASH_SET_EMPTY_KEY != slot) {
+                insert(slot);
+            }
+        }
+    }
+
+    delete[] previous_buckets_ptr;
+
+    return true;
+}
+
+} // namespace qpl::ml::analytics
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_HASH_SET_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_HASH_SET_HPP_
+
+#include <cstdint>
+
+#include "qplc_set_membership.h"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Growable hash set of 32-bit keys in the layout of @ref qplc_hash_set_t
+ *
+ * @details Every bucket takes one cache line, so a lookup usually touches a single line.
+ *          The set is rehashed to twice as many buckets once it is half full.
+ */
+class hash_set_t final {
+public:
+    hash_set_t() noexcept = default;
+
+    hash_set_t(const hash_set_t &other) = delete;
+
+    auto operator=(const hash_set_t &other) -> hash_set_t & = delete;
+
+    ~hash_set_t() noexcept;
+
+    /**
+     * @brief Allocates buckets for the given number of keys in advance
+     *
+     * @return false if memory cannot be allocated
+     */
+    auto reserve(uint32_t keys_count) noexcept -> bool;
+
+    /**
+     * @brief Adds the key to the set, nothing is done if the key is already there
+     *
+     * @return false if memory cannot be allocated
+     */
+    auto insert(uint32_t key) noexcept -> bool;
+
+    /**
+     * @brief Returns the number of distinct keys in the set
+     */
+    [[nodiscard]] auto size() const noexcept -> uint32_t;
+
+    /**
+     * @brief Writes keys of the set in an unspecified order, destination must hold @ref size() keys
+     */
+    void copy_keys(uint32_t *destination_ptr) const noexcept;
+
+    /**
+     * @brief Returns the description of the set for the core kernels
+     */
+    [[nodiscard]] auto view() const noexcept -> qplc_hash_set_t;
+
+private:
+    struct alignas(64u) bucket_t {
+        uint32_t slots[QPLC_HASH_SET_BUCKET_SIZE];
+    };
+
+    auto rehash(uint32_t buckets_count) noexcept -> bool;
+
+    bucket_t *buckets_ptr_    = nullptr;    /**< Buckets, every free slot holds QPLC_HASH_SET_EMPTY_KEY */
+    uint32_t buckets_count_   = 0u;         /**< Number of buckets */
+    uint32_t keys_count_      = 0u;         /**< Number of keys stored in buckets */
+    bool     has_empty_key_   = false;      /**< QPLC_HASH_SET_EMPTY_KEY is in the set */
+};
+
+} // namespace qpl::ml::analytics
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_HASH_SET_HPP_
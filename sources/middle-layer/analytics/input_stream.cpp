@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <cstring>
+
 #include "input_stream.hpp"
 
 namespace qpl::ml::analytics {
@@ -88,6 +90,10 @@ auto input_stream_t::unpack<analytic_pipeline::prle>(limited_buffer_t &output_bu
 template <>
 auto input_stream_t::unpack<analytic_pipeline::inflate>(limited_buffer_t &output_buffer,
                                                         size_t required_elements) noexcept -> unpack_result_t {
+    if (is_resumable_) {
+        return unpack_resumable(output_buffer, static_cast<uint32_t>(required_elements));
+    }
+
     auto elements_to_decompress = (required_elements >> 3u) << 3u;
     auto bytes_to_decompress    = (elements_to_decompress * bit_width_) / byte_bits_size;
 
@@ -185,6 +191,51 @@ auto input_stream_t::unpack<analytic_pipeline::inflate_prle>(limited_buffer_t &o
     return input_stream_t::unpack<analytic_pipeline::inflate_prle>(output_buffer, output_buffer.max_elements_count());
 }
 
+auto input_stream_t::unpack_resumable(limited_buffer_t &output_buffer,
+                                      uint32_t required_elements) noexcept -> unpack_result_t {
+    required_elements = std::min(required_elements, current_number_of_elements_);
+
+    // Decompressed chunk always consists of whole bytes, the last one may be incomplete
+    const uint32_t elements_to_decompress = (required_elements + max_bit_index) & ~max_bit_index;
+    const uint32_t bytes_to_decompress    = (elements_to_decompress * bit_width_) / byte_bits_size;
+    uint32_t       decompressed_bytes     = position_.pending_bytes;
+
+    if (decompressed_bytes < bytes_to_decompress) {
+        auto result = ml::compression::default_decorator::unwrap(
+                ml::compression::inflate<execution_path_t::software, compression::inflate_mode_t::inflate_default>,
+                state_.output(decompress_begin_ + decompressed_bytes, decompress_begin_ + bytes_to_decompress),
+                compression::end_processing_condition_t::stop_and_check_for_bfinal_eob);
+
+        if (status_list::ok != result.status_code_ && status_list::more_output_needed != result.status_code_) {
+            return unpack_result_t(result.status_code_);
+        }
+
+        decompressed_bytes += result.output_bytes_;
+    }
+
+    auto elements_to_unpack = std::min((decompressed_bytes * byte_bits_size) / bit_width_, required_elements);
+
+    // Incomplete chunk waits for the rest of the source, so the next one starts at byte boundary
+    if (elements_to_unpack < current_number_of_elements_) {
+        elements_to_unpack &= ~max_bit_index;
+    }
+
+    const uint32_t unpacked_bytes = util::bit_to_byte(elements_to_unpack * bit_width_);
+
+    unpack_kernel_(decompress_begin_, elements_to_unpack, 0, output_buffer.data());
+
+    position_.pending_bytes = decompressed_bytes - unpacked_bytes;
+
+    if (0u != position_.pending_bytes && 0u != unpacked_bytes) {
+        // Ranges may overlap
+        std::memmove(decompress_begin_, decompress_begin_ + unpacked_bytes, position_.pending_bytes);
+    }
+
+    input_stream_t::add_elements_processed(elements_to_unpack);
+
+    return unpack_result_t(status_list::ok, elements_to_unpack, unpacked_bytes);
+}
+
 auto input_stream_t::initialize_sw_kernels() noexcept -> void {
     auto unpack_table      = dispatcher::kernels_dispatcher::get_instance().get_unpack_table();
     auto unpack_prle_table = dispatcher::kernels_dispatcher::get_instance().get_unpack_prle_table();
@@ -64,6 +64,14 @@ public:
         iscsi = 1
     };
 
+    /**
+     * @brief Position of the compressed stream that is processed by a sequence of jobs
+     */
+    struct stream_position_t {
+        uint32_t     pending_bytes = 0u;    /**< Decompressed bytes of incomplete chunk kept at the decompress buffer begin */
+        aggregates_t aggregates    = {};    /**< Aggregates of the elements processed before, index_ is their number */
+    };
+
     template <analytic_pipeline pipeline>
     auto unpack(limited_buffer_t &output_buffer) noexcept -> unpack_result_t;
 
@@ -187,6 +195,25 @@ public:
         return decompression_status_;
     }
 
+    [[nodiscard]] inline auto is_resumable() const noexcept -> bool {
+        return is_resumable_;
+    }
+
+    [[nodiscard]] inline auto is_last_part() const noexcept -> bool {
+        return is_last_part_;
+    }
+
+    [[nodiscard]] inline auto position() const noexcept -> stream_position_t {
+        return position_;
+    }
+
+    /**
+     * @brief Number of compressed source bytes that are taken by the decompression state
+     */
+    [[nodiscard]] inline auto compressed_bytes_consumed() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(std::distance(data(), state_.get_input_data()));
+    }
+
 protected:
     template <class iterator_t>
     input_stream_t(iterator_t begin, iterator_t end) noexcept
@@ -197,6 +224,11 @@ protected:
 private:
     auto initialize_sw_kernels() noexcept -> void;
 
+    /**
+     * @brief Unpacks the next chunk of resumable stream, elements of incomplete chunk are left for the next part
+     */
+    auto unpack_resumable(limited_buffer_t &output_buffer, uint32_t required_elements) noexcept -> unpack_result_t;
+
     dispatcher::unpack_table_t::value_type unpack_kernel_           = nullptr;
     dispatcher::unpack_prle_table_t::value_type unpack_prle_kernel_ = nullptr;
 
@@ -223,6 +255,10 @@ private:
     stream_format_t    stream_format_               = stream_format_t::le_format;
     compression_meta_t compression_meta_            = {};
     uint32_t           decompression_status_        = status_list::ok;
+    bool               is_resumable_                = false;
+    bool               is_first_part_               = true;
+    bool               is_last_part_                = true;
+    stream_position_t  position_                    = {};
 };
 
 class input_stream_t::builder {
@@ -265,6 +301,24 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Makes compressed stream resumable: the source is a part of the stream, decompression state
+     *        and pending decompressed bytes are kept in the buffers between the parts
+     *
+     * @param value     the stream is resumable, other parameters are ignored otherwise
+     * @param is_first  the source starts the stream, decompression state is reset
+     * @param is_last   the source ends the stream
+     * @param position  position that is reached by the previous parts
+     */
+    inline auto resumable(bool value, bool is_first, bool is_last, stream_position_t position) noexcept -> builder & {
+        stream_.is_resumable_  = value;
+        stream_.is_first_part_ = !value || is_first;
+        stream_.is_last_part_  = !value || is_last;
+        stream_.position_      = (stream_.is_first_part_) ? stream_position_t{} : position;
+
+        return *this;
+    }
+
     inline auto stream_format(stream_format_t format, uint32_t bit_width) noexcept -> builder & {
         stream_.stream_format_ = format;
         stream_.bit_width_     = bit_width;
@@ -307,8 +361,16 @@ public:
             if (stream_.is_compressed_) {
                 const ml::util::linear_allocator allocator(buffer);
 
-                stream_.state_ = compression::inflate_state<execution_path_t::software>::create<true>(allocator)
-                        .input(stream_.current_source_ptr_, stream_.current_source_ptr_ + stream_.current_source_size_);
+                if (!stream_.is_first_part_) {
+                    // Prologue is skipped by the first part only
+                    stream_.prologue_size_ = 0u;
+                    stream_.state_ = compression::inflate_state<execution_path_t::software>::restore(allocator);
+                } else {
+                    stream_.state_ = compression::inflate_state<execution_path_t::software>::create<true>(allocator);
+                }
+
+                stream_.state_.input(stream_.current_source_ptr_,
+                                     stream_.current_source_ptr_ + stream_.current_source_size_);
 
                 if (stream_.stream_format_ == stream_format_t::prle_format) {
                     stream_.state_.output(&stream_.bit_width_, &stream_.bit_width_ + 1);
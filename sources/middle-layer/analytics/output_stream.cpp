@@ -4,10 +4,136 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 #include "output_stream.hpp"
 
 namespace qpl::ml::analytics {
 
+namespace {
+
+constexpr uint32_t mask_elements_count = 64u;
+constexpr uint32_t word_size           = sizeof(uint64_t);
+constexpr uint64_t low_bits_mask_64u   = 0x7F7F7F7F7F7F7F7FULL;
+constexpr uint64_t lowest_bits_64u     = 0x0101010101010101ULL;
+constexpr uint64_t gather_bits_64u     = 0x0102040810204080ULL;
+
+/**
+ * @brief Returns bit mask of non-zero bytes of the word
+ */
+inline auto non_zero_mask(uint64_t bytes) noexcept -> uint64_t {
+    // Lowest bit of every byte tells if the byte is non-zero, then these bits are gathered to one byte
+    const uint64_t non_zero_bits = ((((bytes & low_bits_mask_64u) + low_bits_mask_64u) | bytes)
+                                    >> max_bit_index) & lowest_bits_64u;
+
+    return (non_zero_bits * gather_bits_64u) >> 56u;
+}
+
+/**
+ * @brief Returns bit mask of non-zero bytes among elements_count ones, up to 64
+ */
+inline auto non_zero_mask(const uint8_t *source_ptr, uint32_t elements_count) noexcept -> uint64_t {
+    uint64_t words[mask_elements_count / word_size] = {};
+
+    if (mask_elements_count == elements_count) {
+        std::memcpy(words, source_ptr, mask_elements_count);
+    } else {
+        std::memcpy(words, source_ptr, elements_count);
+    }
+
+    uint64_t any_bytes = 0u;
+
+    for (auto word : words) {
+        any_bytes |= word;
+    }
+
+    // Results of selective predicates are mostly zeroes
+    if (0u == any_bytes) {
+        return 0u;
+    }
+
+    uint64_t mask = 0u;
+
+    for (uint32_t i = 0u; i < mask_elements_count / word_size; i++) {
+        mask |= non_zero_mask(words[i]) << (i * word_size);
+    }
+
+    return mask;
+}
+
+} // anonymous namespace
+
+template <>
+template <class output_t>
+auto output_stream_t<bit_stream>::write_range(uint32_t run_index, uint32_t run_length) noexcept -> uint32_t {
+    constexpr uint32_t max_length = std::numeric_limits<output_t>::max();
+    constexpr uint32_t pair_size  = 2u * sizeof(output_t);
+
+    // Run continues the last written one
+    if (0u != range_length_ && range_end_ == run_index && range_length_ < max_length) {
+        const uint32_t extension  = std::min(max_length - range_length_, run_length);
+        auto           length_ptr = reinterpret_cast<output_t *>(destination_current_ptr_) - 1u;
+
+        range_length_ += extension;
+        *length_ptr = static_cast<output_t>(range_length_);
+        run_index += extension;
+        run_length -= extension;
+    }
+
+    while (0u != run_length) {
+        if (run_index > max_length) {
+            return status_list::output_overflow_error;
+        }
+        if (bytes_available() < pair_size) {
+            return status_list::destination_is_short_error;
+        }
+
+        auto *pair_ptr = reinterpret_cast<output_t *>(destination_current_ptr_);
+
+        range_length_ = std::min(max_length, run_length);
+        pair_ptr[0] = static_cast<output_t>(run_index);
+        pair_ptr[1] = static_cast<output_t>(range_length_);
+        destination_current_ptr_ += pair_size;
+        run_index += range_length_;
+        run_length -= range_length_;
+    }
+
+    range_end_ = run_index;
+
+    return status_list::ok;
+}
+
+template <>
+template <class output_t>
+auto output_stream_t<bit_stream>::pack_ranges(const uint8_t *buffer_ptr,
+                                              const uint32_t elements_count) noexcept -> uint32_t {
+    for (uint32_t offset = 0u; offset < elements_count; offset += mask_elements_count) {
+        const uint32_t mask_size = std::min(mask_elements_count, elements_count - offset);
+        uint64_t       mask      = non_zero_mask(buffer_ptr + offset, mask_size);
+
+        while (0u != mask) {
+            const uint32_t run_begin  = util::trailing_zeros(mask);
+            const uint64_t run_bits   = ~(mask >> run_begin);
+            const uint32_t run_length = (0u == run_bits) ? mask_elements_count : util::trailing_zeros(run_bits);
+            const uint32_t run_end    = run_begin + run_length;
+
+            const auto status = write_range<output_t>(current_output_index_ + offset + run_begin, run_length);
+
+            if (status_list::ok != status) {
+                return status;
+            }
+
+            mask = (run_end < mask_elements_count) ? mask & (~0ULL << run_end) : 0u;
+        }
+    }
+
+    current_output_index_ += elements_count;
+
+    return status_list::ok;
+}
+
 template <>
 auto output_stream_t<bit_stream>::perform_pack(const uint8_t *buffer_ptr,
                                                const uint32_t elements_count,
@@ -26,6 +152,18 @@ auto output_stream_t<bit_stream>::perform_pack(const uint8_t *buffer_ptr,
                                    &current_output_index_);
 
         start_bit_ = (start_bit_ + elements_count) & 7u;
+    } else if (is_ranges_) {
+        switch (bit_width_format_) {
+            case output_bit_width_format_t::bits_8:
+                status = pack_ranges<uint8_t>(buffer_ptr, elements_count);
+                break;
+            case output_bit_width_format_t::bits_16:
+                status = pack_ranges<uint16_t>(buffer_ptr, elements_count);
+                break;
+            default:
+                status = pack_ranges<uint32_t>(buffer_ptr, elements_count);
+                break;
+        }
     } else {
         // Pack array of indices, destination overflow
         status = pack_index_kernel(buffer_ptr,
@@ -41,6 +179,23 @@ auto output_stream_t<bit_stream>::perform_pack(const uint8_t *buffer_ptr,
     return status;
 }
 
+template <>
+auto output_stream_t<bit_stream>::reserve_bits(const uint32_t elements_count) noexcept -> uint8_t * {
+    if (elements_count > capacity_) {
+        return nullptr;
+    }
+
+    auto *reserved_ptr = destination_current_ptr_;
+
+    destination_current_ptr_ += util::bit_to_byte(elements_count);
+    start_bit_ = elements_count & max_bit_index;
+
+    elements_written_ += elements_count;
+    capacity_ -= elements_count;
+
+    return reserved_ptr;
+}
+
 template <>
 uint32_t output_stream_t<array_stream>::perform_pack(const uint8_t *buffer_ptr,
                                                      const uint32_t elements_count,
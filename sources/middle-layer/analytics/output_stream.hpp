@@ -33,6 +33,19 @@ public:
                       uint32_t elements_count,
                       bool is_start_bit_used = true) noexcept -> uint32_t;
 
+    /**
+     * @brief Reserves place for elements_count bits that are written to the destination directly
+     *
+     * @note Only for little-endian bit vector output that is currently aligned to byte boundary
+     *
+     * @return pointer to the reserved place or nullptr if destination is short
+     */
+    auto reserve_bits(uint32_t elements_count) noexcept -> uint8_t *;
+
+    [[nodiscard]] inline auto is_byte_aligned_bit_vector() const noexcept -> bool {
+        return 1u == actual_bit_width_ && stream_format_t::le_format == stream_format_ && 0u == start_bit_;
+    }
+
     [[nodiscard]] inline auto elements_written() -> uint32_t {
         return elements_written_;
     }
@@ -53,6 +66,16 @@ public:
         return size() - bytes_written();
     }
 
+    /**
+     * @brief Number of elements whose results are guaranteed to fit the rest of the destination
+     *
+     * @note Destination is expected to be aligned to byte boundary
+     */
+    [[nodiscard]] auto elements_available() const noexcept -> uint32_t {
+        return static_cast<uint32_t>((static_cast<uint64_t>(bytes_available()) * byte_bits_size)
+                                     / actual_bit_width_);
+    }
+
     [[nodiscard]] auto output_bit_width_format() const noexcept -> output_bit_width_format_t {
         return bit_width_format_;
     }
@@ -77,10 +100,23 @@ protected:
     }
 
 private:
+    /**
+     * @brief Writes runs of non-zero elements as pairs of the first index and the length
+     */
+    template <class output_t>
+    auto pack_ranges(const uint8_t *buffer_ptr, uint32_t elements_count) noexcept -> uint32_t;
+
+    /**
+     * @brief Writes the run as one or several pairs, the run that continues the last written one extends it
+     */
+    template <class output_t>
+    auto write_range(uint32_t run_index, uint32_t run_length) noexcept -> uint32_t;
+
     dispatcher::pack_index_table_t::value_type pack_index_kernel    = nullptr;
     uint8_t                               *destination_current_ptr_ = nullptr;
     bool                                  is_inverted_              = false;
     bool                                  is_nominal_               = false;
+    bool                                  is_ranges_                = false;
     stream_format_t                       stream_format_            = stream_format_t::le_format;
     output_bit_width_format_t             bit_width_format_         = output_bit_width_format_t::same_as_input;
     uint32_t                              start_bit_                = 0u;
@@ -89,6 +125,8 @@ private:
     uint8_t                               actual_bit_width_         = 0u;
     uint8_t                               input_buffer_bit_width_   = 0u;
     uint32_t                              elements_written_         = 0u;
+    uint32_t                              range_end_                = 0u;     /**< Index after the last written run */
+    uint32_t                              range_length_             = 0u;     /**< Length of the last written run */
     size_t                                capacity_                 = 0u;
 };
 
@@ -144,6 +182,12 @@ public:
         return *this;
     }
 
+    inline auto ranges(bool value) noexcept -> builder & {
+        stream_.is_ranges_ = value;
+
+        return *this;
+    }
+
     inline auto inverted(bool value) noexcept -> builder & {
         stream_.is_inverted_ = value;
 
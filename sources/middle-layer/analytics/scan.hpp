@@ -7,6 +7,8 @@
 #ifndef SCAN_OPERATION_HPP
 #define SCAN_OPERATION_HPP
 
+#include <cstring>
+
 #include "input_stream.hpp"
 #include "output_stream.hpp"
 #include "descriptor_builder.hpp"
@@ -124,6 +126,212 @@ static inline auto scan(input_stream_t &input_stream,
     return status_list::ok;
 }
 
+/**
+ * @brief Scans the part of resumable compressed stream
+ *
+ * Every chunk except the last one of the stream is a multiple of 8 elements, so results of the next part
+ * start at byte boundary. Chunk is limited by the space left in the destination.
+ *
+ * @return status_list::more_output_needed if the destination is full before the source part is consumed
+ */
+template <comparator_t comparator>
+static inline auto scan_resumable(input_stream_t &input_stream,
+                                  limited_buffer_t &buffer,
+                                  output_stream_t<bit_stream> &output_stream,
+                                  dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                  aggregates_t &aggregates,
+                                  uint32_t param_low,
+                                  uint32_t param_high) noexcept -> uint32_t {
+    auto table     = dispatcher::kernels_dispatcher::get_instance().get_scan_i_table();
+    auto index     = dispatcher::get_scan_index(input_stream.bit_width(), static_cast<uint32_t>(comparator));
+    auto scan_impl = table[index];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    while (!input_stream.is_processed()) {
+        auto required_elements = std::min(buffer.max_elements_count(), output_stream.elements_available());
+
+        if (required_elements < input_stream.elements_left()) {
+            required_elements &= ~max_bit_index;
+        }
+
+        if (0u == required_elements) {
+            return status_list::more_output_needed;
+        }
+
+        auto unpack_result = input_stream.unpack<analytic_pipeline::inflate>(buffer, required_elements);
+
+        if (status_list::ok != unpack_result.status) {
+            return unpack_result.status;
+        }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        // Source part is consumed
+        if (0u == elements_to_process) {
+            return (input_stream.is_last_part()) ? status_list::source_is_short_error : status_list::ok;
+        }
+
+        scan_impl(buffer.data(), elements_to_process, param_low, param_high);
+
+        aggregates_callback(buffer.data(),
+                            elements_to_process,
+                            &aggregates.min_value_,
+                            &aggregates.max_value_,
+                            &aggregates.sum_,
+                            &aggregates.index_);
+
+        auto status = output_stream.perform_pack(buffer.data(), elements_to_process);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+    }
+
+    return status_list::ok;
+}
+
+static inline auto bit_count_64u(uint64_t value) noexcept -> uint32_t {
+    value = value - ((value >> 1u) & 0x5555555555555555ULL);
+    value = (value & 0x3333333333333333ULL) + ((value >> 2u) & 0x3333333333333333ULL);
+    value = (value + (value >> 4u)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return static_cast<uint32_t>((value * 0x0101010101010101ULL) >> 56u);
+}
+
+/**
+ * @brief Updates aggregates with the bit vector of scan results, gives the same values as the 1-bit aggregates kernel
+ *        for the unpacked results
+ */
+static inline void bit_vector_aggregates(const uint8_t *bits_ptr,
+                                         uint32_t elements_count,
+                                         aggregates_t &aggregates) noexcept {
+    const uint32_t bytes_count = util::bit_to_byte(elements_count);
+
+    for (uint32_t offset = 0u; offset < bytes_count; offset += sizeof(uint64_t)) {
+        uint64_t bits = 0u;
+
+        std::memcpy(&bits, bits_ptr + offset, std::min<uint32_t>(sizeof(uint64_t), bytes_count - offset));
+
+        if (0u == bits) {
+            continue;
+        }
+
+        uint32_t first_bit = 0u;
+        uint32_t last_bit  = 63u;
+
+        while (0u == ((bits >> first_bit) & 1u)) {
+            first_bit++;
+        }
+        while (0u == ((bits >> last_bit) & 1u)) {
+            last_bit--;
+        }
+
+        if (std::numeric_limits<uint32_t>::max() == aggregates.min_value_) {
+            aggregates.min_value_ = aggregates.index_ + offset * byte_bits_size + first_bit;
+        }
+        aggregates.max_value_ = aggregates.index_ + offset * byte_bits_size + last_bit;
+        aggregates.sum_ += bit_count_64u(bits);
+    }
+
+    aggregates.index_ += elements_count;
+}
+
+/**
+ * @brief Scans packed little-endian input with the fused kernel that writes results to the bit vector output directly
+ */
+static inline auto scan_packed(input_stream_t &input_stream,
+                               limited_buffer_t &buffer,
+                               output_stream_t<bit_stream> &output_stream,
+                               dispatcher::scan_packed_function_ptr scan_kernel,
+                               aggregates_t &aggregates,
+                               uint32_t low_value,
+                               uint32_t high_value) noexcept -> uint32_t {
+    auto drop_initial_bytes_status = input_stream.skip_prologue(buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    const uint32_t bit_width  = input_stream.bit_width();
+    // Every chunk except the last one ends at byte boundary of both source and destination
+    const uint32_t chunk_size = std::max(buffer.max_elements_count() & ~max_bit_index, byte_bits_size);
+
+    while (!input_stream.is_processed()) {
+        auto elements_to_process = std::min(chunk_size, input_stream.elements_left());
+        auto destination_ptr     = output_stream.reserve_bits(elements_to_process);
+
+        if (nullptr == destination_ptr) {
+            return status_list::destination_is_short_error;
+        }
+
+        scan_kernel(input_stream.current_ptr(), elements_to_process, bit_width, destination_ptr, low_value, high_value);
+
+        if (!input_stream.are_aggregates_disabled()) {
+            bit_vector_aggregates(destination_ptr, elements_to_process, aggregates);
+        }
+
+        input_stream.shift_current_ptr(util::bit_to_byte(elements_to_process * bit_width));
+        input_stream.add_elements_processed(elements_to_process);
+    }
+
+    return status_list::ok;
+}
+
+template <comparator_t comparator>
+constexpr static inline auto own_get_scan_range(const uint32_t low_limit,
+                                                const uint32_t high_limit,
+                                                const uint32_t element_bit_width) noexcept -> scan_range_t {
+    scan_range_t   range{};
+    const auto     range_mask = (uint32_t) ((1ULL << element_bit_width) - 1u);
+    const uint32_t param_low  = low_limit & range_mask;
+
+    if constexpr (comparator == equals || comparator == not_equals) {
+        range.low  = param_low;
+        range.high = param_low;
+    }
+
+    if constexpr (comparator == less_equals) {
+        range.low  = 0;
+        range.high = param_low;
+    }
+
+    if constexpr (comparator == less_than) {
+        if (0 == param_low) {
+            range.low  = 1;
+            range.high = 0;
+        } else {
+            range.low  = 0;
+            range.high = param_low - 1;
+        }
+    }
+
+    if constexpr (comparator == greater_equals) {
+        range.low  = param_low;
+        range.high = std::numeric_limits<uint32_t>::max();
+    }
+
+    if constexpr (comparator == greater_than) {
+        if (param_low == range_mask) {
+            range.low  = 1;
+            range.high = 0;
+        } else {
+            range.low  = param_low + 1;
+            range.high = std::numeric_limits<uint32_t>::max();
+        }
+    }
+
+    if constexpr (comparator == in_range || comparator == out_of_range) {
+        const uint32_t param_high = high_limit & range_mask;
+        range.low  = param_low;
+        range.high = param_high;
+    }
+
+    return range;
+}
+
 template <comparator_t comparator>
 static inline auto call_scan_sw(input_stream_t &input_stream,
                                 output_stream_t<bit_stream> &output_stream,
@@ -135,7 +343,7 @@ static inline auto call_scan_sw(input_stream_t &input_stream,
     auto number_of_elements = input_stream.elements_left();
 
     analytic_operation_result_t operation_result{};
-    aggregates_t                aggregates{};
+    aggregates_t                aggregates = input_stream.position().aggregates;
 
     uint32_t status_code = status_list::ok;
 
@@ -164,6 +372,32 @@ static inline auto call_scan_sw(input_stream_t &input_stream,
                                                       aggregates,
                                                       corrected_param_low,
                                                       corrected_param_high);
+    } else if (input_stream.stream_format() == stream_format_t::le_format &&
+               !input_stream.is_compressed() &&
+               output_stream.is_byte_aligned_bit_vector()) {
+        // Unpacking, scan and pack of results are fused for other bit widths
+        const auto range = own_get_scan_range<comparator>(param_low, param_high, input_bit_width);
+
+        auto scan_packed_table  = dispatcher::kernels_dispatcher::get_instance().get_scan_packed_table();
+        auto scan_packed_kernel = (comparator == not_equals || comparator == out_of_range) ?
+                                  scan_packed_table[1] :
+                                  scan_packed_table[0];
+
+        status_code = scan_packed(input_stream,
+                                  temporary_buffer,
+                                  output_stream,
+                                  scan_packed_kernel,
+                                  aggregates,
+                                  range.low,
+                                  range.high);
+    } else if (input_stream.is_resumable()) {
+        status_code = scan_resumable<comparator>(input_stream,
+                                                 temporary_buffer,
+                                                 output_stream,
+                                                 aggregates_callback,
+                                                 aggregates,
+                                                 corrected_param_low,
+                                                 corrected_param_high);
     } else {
         if (input_stream.stream_format() == stream_format_t::prle_format) {
             if (input_stream.is_compressed()) {
@@ -210,64 +444,14 @@ static inline auto call_scan_sw(input_stream_t &input_stream,
     operation_result.aggregates_       = aggregates;
     operation_result.checksums_.crc32_ = input_stream.crc_checksum();
     operation_result.checksums_.xor_   = input_stream.xor_checksum();
-    operation_result.last_bit_offset_  = (1u == output_bit_width) ? number_of_elements & max_bit_index : 0u;
+    operation_result.last_bit_offset_  = (1u == output_bit_width)
+                                         ? (number_of_elements - input_stream.elements_left()) & max_bit_index
+                                         : 0u;
     operation_result.output_bytes_     = output_stream.bytes_written();
 
     return operation_result;
 }
 
-template <comparator_t comparator>
-constexpr static inline auto own_get_scan_range(const uint32_t low_limit,
-                                                const uint32_t high_limit,
-                                                const uint32_t element_bit_width) noexcept -> scan_range_t {
-    scan_range_t   range{};
-    const auto     range_mask = (uint32_t) ((1ULL << element_bit_width) - 1u);
-    const uint32_t param_low  = low_limit & range_mask;
-
-    if constexpr (comparator == equals || comparator == not_equals) {
-        range.low  = param_low;
-        range.high = param_low;
-    }
-
-    if constexpr (comparator == less_equals) {
-        range.low  = 0;
-        range.high = param_low;
-    }
-
-    if constexpr (comparator == less_than) {
-        if (0 == param_low) {
-            range.low  = 1;
-            range.high = 0;
-        } else {
-            range.low  = 0;
-            range.high = param_low - 1;
-        }
-    }
-
-    if constexpr (comparator == greater_equals) {
-        range.low  = param_low;
-        range.high = std::numeric_limits<uint32_t>::max();
-    }
-
-    if constexpr (comparator == greater_than) {
-        if (param_low == range_mask) {
-            range.low  = 1;
-            range.high = 0;
-        } else {
-            range.low  = param_low + 1;
-            range.high = std::numeric_limits<uint32_t>::max();
-        }
-    }
-
-    if constexpr (comparator == in_range || comparator == out_of_range) {
-        const uint32_t param_high = high_limit & range_mask;
-        range.low  = param_low;
-        range.high = param_high;
-    }
-
-    return range;
-}
-
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstack-usage=4096"
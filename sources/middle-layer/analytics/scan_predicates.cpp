@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <array>
+
+#include "scan_predicates.hpp"
+
+namespace qpl::ml::analytics {
+
+namespace {
+
+/**
+ * @brief Predicate with the scan kernel chosen and parameters truncated to the source bit width
+ */
+struct compiled_predicate_t {
+    dispatcher::scan_function_ptr kernel     = nullptr;
+    uint32_t                      param_low  = 0u;
+    uint32_t                      param_high = 0u;
+    bool                          is_or      = false;
+};
+
+using scan_program_t = std::array<compiled_predicate_t, limits::max_scan_predicates>;
+
+constexpr auto get_opposite_comparator(const comparator_t comparator) noexcept -> comparator_t {
+    switch (comparator) {
+        case equals:
+            return not_equals;
+        case not_equals:
+            return equals;
+        case less_than:
+            return greater_equals;
+        case less_equals:
+            return greater_than;
+        case greater_than:
+            return less_equals;
+        case greater_equals:
+            return less_than;
+        case in_range:
+            return out_of_range;
+        default:
+            return in_range;
+    }
+}
+
+inline void compile_program(const scan_predicate_t *predicates_ptr,
+                            const uint32_t predicates_count,
+                            const uint32_t bit_width,
+                            scan_program_t &program) noexcept {
+    const auto &scan_table = dispatcher::kernels_dispatcher::get_instance().get_scan_table();
+
+    for (uint32_t i = 0u; i < predicates_count; i++) {
+        const auto &predicate  = predicates_ptr[i];
+        const bool is_negation = predicate_combination_t::and_not_with == predicate.combination ||
+                                 predicate_combination_t::or_not_with == predicate.combination;
+        const auto comparator  = (is_negation && 0u != i) ? get_opposite_comparator(predicate.comparator)
+                                                          : predicate.comparator;
+
+        program[i].kernel     = scan_table[dispatcher::get_scan_index(bit_width, static_cast<uint32_t>(comparator))];
+        program[i].param_low  = correct_input_param(bit_width, predicate.param_low);
+        program[i].param_high = correct_input_param(bit_width, predicate.param_high);
+        program[i].is_or      = predicate_combination_t::or_with == predicate.combination ||
+                                predicate_combination_t::or_not_with == predicate.combination;
+    }
+}
+
+/**
+ * @brief Writes 0 or 1 for every element of the chunk to results_ptr
+ */
+inline void evaluate_program(const scan_program_t &program,
+                             const uint32_t predicates_count,
+                             const uint8_t *elements_ptr,
+                             const uint32_t elements_count,
+                             uint8_t *results_ptr,
+                             uint8_t *predicate_results_ptr) noexcept {
+    program[0].kernel(elements_ptr, results_ptr, elements_count, program[0].param_low, program[0].param_high);
+
+    for (uint32_t i = 1u; i < predicates_count; i++) {
+        const auto &predicate = program[i];
+
+        predicate.kernel(elements_ptr, predicate_results_ptr, elements_count, predicate.param_low, predicate.param_high);
+
+        // Results are 0 or 1, so bytes are combined by bitwise operations that the compiler vectorizes
+        if (predicate.is_or) {
+            for (uint32_t j = 0u; j < elements_count; j++) {
+                results_ptr[j] |= predicate_results_ptr[j];
+            }
+        } else {
+            for (uint32_t j = 0u; j < elements_count; j++) {
+                results_ptr[j] &= predicate_results_ptr[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Evaluates the program right over the source of unpacked little-endian elements
+ */
+inline auto scan_source(input_stream_t &input_stream,
+                        output_stream_t<bit_stream> &output_stream,
+                        const scan_program_t &program,
+                        const uint32_t predicates_count,
+                        const uint32_t chunk_size,
+                        uint8_t *results_ptr,
+                        uint8_t *predicate_results_ptr,
+                        dispatcher::aggregates_function_ptr_t aggregates_callback,
+                        aggregates_t &aggregates) noexcept -> uint32_t {
+    while (!input_stream.is_processed()) {
+        const uint32_t elements_count = std::min(chunk_size, input_stream.elements_left());
+
+        evaluate_program(program,
+                         predicates_count,
+                         input_stream.current_ptr(),
+                         elements_count,
+                         results_ptr,
+                         predicate_results_ptr);
+
+        aggregates_callback(results_ptr,
+                            elements_count,
+                            &aggregates.min_value_,
+                            &aggregates.max_value_,
+                            &aggregates.sum_,
+                            &aggregates.index_);
+
+        auto status = output_stream.perform_pack(results_ptr, elements_count);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+
+        input_stream.shift_current_ptr(util::bit_to_byte(elements_count * input_stream.bit_width()));
+        input_stream.add_elements_processed(elements_count);
+    }
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Unpacks every chunk of the source once and evaluates the program over the unpacked elements
+ */
+template <analytic_pipeline pipeline>
+inline auto scan_unpacked(input_stream_t &input_stream,
+                          output_stream_t<bit_stream> &output_stream,
+                          const scan_program_t &program,
+                          const uint32_t predicates_count,
+                          const uint32_t chunk_size,
+                          limited_buffer_t &unpack_buffer,
+                          uint8_t *results_ptr,
+                          uint8_t *predicate_results_ptr,
+                          dispatcher::aggregates_function_ptr_t aggregates_callback,
+                          aggregates_t &aggregates) noexcept -> uint32_t {
+    while (!input_stream.is_processed()) {
+        auto unpack_result = input_stream.unpack<pipeline>(unpack_buffer, chunk_size);
+
+        if (status_list::ok != unpack_result.status) {
+            return unpack_result.status;
+        }
+
+        const uint32_t elements_count = unpack_result.unpacked_elements;
+
+        evaluate_program(program,
+                         predicates_count,
+                         unpack_buffer.data(),
+                         elements_count,
+                         results_ptr,
+                         predicate_results_ptr);
+
+        aggregates_callback(results_ptr,
+                            elements_count,
+                            &aggregates.min_value_,
+                            &aggregates.max_value_,
+                            &aggregates.sum_,
+                            &aggregates.index_);
+
+        auto status = output_stream.perform_pack(results_ptr, elements_count);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+    }
+
+    return status_list::ok;
+}
+
+} // anonymous namespace
+
+auto call_scan_predicates(input_stream_t &input_stream,
+                          output_stream_t<bit_stream> &output_stream,
+                          const scan_predicate_t *predicates_ptr,
+                          const uint32_t predicates_count,
+                          limited_buffer_t &unpack_buffer,
+                          limited_buffer_t &results_buffer,
+                          limited_buffer_t &predicate_buffer) noexcept -> analytic_operation_result_t {
+    analytic_operation_result_t operation_result{};
+
+    if (0u == predicates_count || predicates_count > limits::max_scan_predicates) {
+        operation_result.status_code_ = status_list::status_invalid_params;
+
+        return operation_result;
+    }
+
+    const auto input_bit_width    = input_stream.bit_width();
+    const auto number_of_elements = input_stream.elements_left();
+
+    aggregates_t aggregates = input_stream.position().aggregates;
+
+    auto aggregates_table    = dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
+    auto aggregates_callback = (input_stream.are_aggregates_disabled()) ?
+                               &aggregates_empty_callback :
+                               aggregates_table[dispatcher::get_aggregates_index(1u)];
+
+    scan_program_t program{};
+    compile_program(predicates_ptr, predicates_count, input_bit_width, program);
+
+    const uint32_t chunk_size = std::min({unpack_buffer.max_elements_count(),
+                                          results_buffer.max_elements_count(),
+                                          predicate_buffer.max_elements_count()});
+
+    uint32_t status_code = input_stream.skip_prologue(unpack_buffer);
+
+    if (status_list::ok == status_code) {
+        const bool is_little_endian = stream_format_t::le_format == input_stream.stream_format();
+
+        if ((8u == input_bit_width || 16u == input_bit_width || 32u == input_bit_width) &&
+            is_little_endian && !input_stream.is_compressed()) {
+            status_code = scan_source(input_stream,
+                                      output_stream,
+                                      program,
+                                      predicates_count,
+                                      chunk_size,
+                                      results_buffer.data(),
+                                      predicate_buffer.data(),
+                                      aggregates_callback,
+                                      aggregates);
+        } else if (stream_format_t::prle_format == input_stream.stream_format()) {
+            status_code = (input_stream.is_compressed())
+                          ? scan_unpacked<analytic_pipeline::inflate_prle>(input_stream,
+                                                                           output_stream,
+                                                                           program,
+                                                                           predicates_count,
+                                                                           chunk_size,
+                                                                           unpack_buffer,
+                                                                           results_buffer.data(),
+                                                                           predicate_buffer.data(),
+                                                                           aggregates_callback,
+                                                                           aggregates)
+                          : scan_unpacked<analytic_pipeline::prle>(input_stream,
+                                                                   output_stream,
+                                                                   program,
+                                                                   predicates_count,
+                                                                   chunk_size,
+                                                                   unpack_buffer,
+                                                                   results_buffer.data(),
+                                                                   predicate_buffer.data(),
+                                                                   aggregates_callback,
+                                                                   aggregates);
+        } else {
+            status_code = (input_stream.is_compressed())
+                          ? scan_unpacked<analytic_pipeline::inflate>(input_stream,
+                                                                      output_stream,
+                                                                      program,
+                                                                      predicates_count,
+                                                                      chunk_size,
+                                                                      unpack_buffer,
+                                                                      results_buffer.data(),
+                                                                      predicate_buffer.data(),
+                                                                      aggregates_callback,
+                                                                      aggregates)
+                          : scan_unpacked<analytic_pipeline::simple>(input_stream,
+                                                                     output_stream,
+                                                                     program,
+                                                                     predicates_count,
+                                                                     chunk_size,
+                                                                     unpack_buffer,
+                                                                     results_buffer.data(),
+                                                                     predicate_buffer.data(),
+                                                                     aggregates_callback,
+                                                                     aggregates);
+        }
+    }
+
+    input_stream.calculate_checksums();
+
+    operation_result.status_code_      = status_code;
+    operation_result.aggregates_       = aggregates;
+    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
+    operation_result.checksums_.xor_   = input_stream.xor_checksum();
+    operation_result.last_bit_offset_  = (1u == output_stream.bit_width())
+                                         ? (number_of_elements - input_stream.elements_left()) & max_bit_index
+                                         : 0u;
+    operation_result.output_bytes_     = output_stream.bytes_written();
+
+    return operation_result;
+}
+
+} // namespace qpl::ml::analytics
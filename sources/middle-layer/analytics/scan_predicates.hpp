@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_PREDICATES_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_PREDICATES_HPP_
+
+#include "analytics_defs.hpp"
+#include "input_stream.hpp"
+#include "output_stream.hpp"
+#include "scan.hpp"
+#include "common/limited_buffer.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Combination of the predicate result with the result of the previous predicates
+ */
+enum class predicate_combination_t : uint32_t {
+    and_with     = 0u,
+    or_with      = 1u,
+    and_not_with = 2u,
+    or_not_with  = 3u
+};
+
+struct scan_predicate_t {
+    comparator_t            comparator  = equals;
+    uint32_t                param_low   = 0u;
+    uint32_t                param_high  = 0u;
+    predicate_combination_t combination = predicate_combination_t::and_with;
+};
+
+/**
+ * @brief Scans the source with a program of predicates that are combined from left to right,
+ *        the combination of the first predicate is ignored
+ *
+ * @note The source is unpacked once per chunk, every predicate is evaluated over the unpacked chunk
+ *       by the scan kernel of its comparator. Negated predicates use the kernel of the opposite comparator,
+ *       so results of a chunk are combined with a single vectorized AND or OR per predicate.
+ *       Chunk is limited by the number of elements that fit each of the buffers, results are kept as bytes.
+ *
+ * @return status_list::status_invalid_params if the number of predicates is out of 1..limits::max_scan_predicates
+ */
+auto call_scan_predicates(input_stream_t &input_stream,
+                          output_stream_t<bit_stream> &output_stream,
+                          const scan_predicate_t *predicates_ptr,
+                          uint32_t predicates_count,
+                          limited_buffer_t &unpack_buffer,
+                          limited_buffer_t &results_buffer,
+                          limited_buffer_t &predicate_buffer) noexcept -> analytic_operation_result_t;
+
+} // namespace qpl::ml::analytics
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SCAN_PREDICATES_HPP_
@@ -4,8 +4,12 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+
 #include "set_membership.hpp"
+#include "hash_set.hpp"
 #include "descriptor_builder.hpp"
+#include "util/memory.hpp"
 #include "util/descriptor_processing.hpp"
 #include "util/multi_descriptor_processing.hpp"
 
@@ -66,6 +70,124 @@ static inline auto set_membership(input_stream_t &input_stream,
     return status_list::ok;
 }
 
+template <analytic_pipeline pipeline_t>
+static inline auto set_membership_hash(input_stream_t &input_stream,
+                                       limited_buffer_t &unpack_buffer,
+                                       output_stream_t<bit_stream> &output_stream,
+                                       const qplc_hash_set_t &hash_set,
+                                       uint32_t bits_shift,
+                                       uint32_t bits_set_mask) noexcept -> uint32_t {
+    // Domains wider than limits::max_set_size bits come from 16u and 32u unpacked inputs only
+    const auto table               = dispatcher::kernels_dispatcher::get_instance().get_set_membership_hash_table();
+    const auto index               = dispatcher::get_set_membership_index(input_stream.bit_width()) - 1u;
+    const auto set_membership_impl = table[index];
+
+    auto drop_initial_bytes_status = input_stream.skip_prologue(unpack_buffer);
+    if (QPL_STS_OK != drop_initial_bytes_status) {
+        return drop_initial_bytes_status;
+    }
+
+    while (!input_stream.is_processed()) {
+        auto unpack_result = input_stream.unpack<pipeline_t>(unpack_buffer);
+
+        if (status_list::ok != unpack_result.status) {
+            return unpack_result.status;
+        }
+
+        const uint32_t elements_to_process = unpack_result.unpacked_elements;
+
+        set_membership_impl(unpack_buffer.data(),
+                            elements_to_process,
+                            bits_shift,
+                            bits_set_mask,
+                            &hash_set);
+
+        auto status = output_stream.perform_pack(unpack_buffer.data(), elements_to_process);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+    }
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Runs set membership with the set unpacked to the byte per key array
+ */
+static inline auto set_membership_dense(input_stream_t &input_stream,
+                                        limited_buffer_t &unpack_buffer,
+                                        limited_buffer_t &set_buffer,
+                                        output_stream_t<bit_stream> &output_stream,
+                                        dispatcher::aggregates_function_ptr_t aggregates_callback,
+                                        aggregates_t &aggregates,
+                                        uint32_t bits_shift,
+                                        uint32_t bits_set_size) noexcept -> uint32_t {
+    if (input_stream.stream_format() == stream_format_t::prle_format) {
+        if (input_stream.is_compressed()) {
+            return set_membership<analytic_pipeline::inflate_prle>(input_stream,
+                                                                   unpack_buffer,
+                                                                   set_buffer,
+                                                                   output_stream,
+                                                                   aggregates_callback,
+                                                                   aggregates,
+                                                                   bits_shift,
+                                                                   bits_set_size);
+        } else {
+            return set_membership<analytic_pipeline::prle>(input_stream,
+                                                           unpack_buffer,
+                                                           set_buffer,
+                                                           output_stream,
+                                                           aggregates_callback,
+                                                           aggregates,
+                                                           bits_shift,
+                                                           bits_set_size);
+        }
+    } else {
+        if (input_stream.is_compressed()) {
+            return set_membership<analytic_pipeline::inflate>(input_stream,
+                                                              unpack_buffer,
+                                                              set_buffer,
+                                                              output_stream,
+                                                              aggregates_callback,
+                                                              aggregates,
+                                                              bits_shift,
+                                                              bits_set_size);
+        } else {
+            return set_membership<analytic_pipeline::simple>(input_stream,
+                                                             unpack_buffer,
+                                                             set_buffer,
+                                                             output_stream,
+                                                             aggregates_callback,
+                                                             aggregates,
+                                                             bits_shift,
+                                                             bits_set_size);
+        }
+    }
+}
+
+static inline auto make_software_result(input_stream_t &input_stream,
+                                        output_stream_t<bit_stream> &output_stream,
+                                        uint32_t status_code,
+                                        const aggregates_t &aggregates) noexcept -> analytic_operation_result_t {
+    input_stream.calculate_checksums();
+
+    analytic_operation_result_t operation_result{};
+
+    // Store operations result
+    operation_result.status_code_      = status_code;
+    operation_result.aggregates_       = aggregates;
+    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
+    operation_result.checksums_.xor_   = input_stream.xor_checksum();
+    operation_result.output_bytes_     = output_stream.bytes_written();
+
+    operation_result.last_bit_offset_ = (1u == output_stream.bit_width())
+                                        ? input_stream.elements_left() & max_bit_index
+                                        : 0u;
+
+    return operation_result;
+}
+
 template <>
 auto call_set_membership<execution_path_t::software>(input_stream_t &input_stream,
                                                      input_stream_t &set_stream,
@@ -85,67 +207,127 @@ auto call_set_membership<execution_path_t::software>(input_stream_t &input_strea
     uint32_t     bits_set_size = 1u << (input_stream.bit_width() - low_bits_to_ignore - high_bits_to_ignore);
     aggregates_t aggregates{};
 
-    uint32_t status_code = status_list::ok;
     set_stream.unpack<analytic_pipeline::simple>(set_buffer);
 
+    const uint32_t status_code = set_membership_dense(input_stream,
+                                                      unpack_buffer,
+                                                      set_buffer,
+                                                      output_stream,
+                                                      aggregates_callback,
+                                                      aggregates,
+                                                      low_bits_to_ignore,
+                                                      bits_set_size);
+
+    return make_software_result(input_stream, output_stream, status_code, aggregates);
+}
+
+auto call_set_membership_list(input_stream_t &input_stream,
+                              const uint32_t *keys_ptr,
+                              uint32_t keys_count,
+                              output_stream_t<bit_stream> &output_stream,
+                              uint32_t low_bits_to_ignore,
+                              uint32_t high_bits_to_ignore,
+                              limited_buffer_t &unpack_buffer,
+                              limited_buffer_t &set_buffer) noexcept -> analytic_operation_result_t {
+    auto aggregates_table    = dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
+    auto aggregates_index    = dispatcher::get_aggregates_index(1u);
+    auto aggregates_callback = (input_stream.are_aggregates_disabled()) ?
+                                &aggregates_empty_callback :
+                                aggregates_table[aggregates_index];
+
+    const uint32_t set_bit_width = input_stream.bit_width() - low_bits_to_ignore - high_bits_to_ignore;
+    const uint32_t bits_set_mask = (limits::max_bit_width == set_bit_width)
+                                   ? std::numeric_limits<uint32_t>::max()
+                                   : (1u << set_bit_width) - 1u;
+    aggregates_t   aggregates{};
+
+    // Narrow domains fit the byte per key array, so the list is turned to it and the usual kernels are used
+    if (set_bit_width <= limits::max_set_size) {
+        const uint32_t bits_set_size = 1u << set_bit_width;
+
+        util::set_zeros(set_buffer.data(), bits_set_size);
+
+        for (uint32_t i = 0u; i < keys_count; i++) {
+            if (keys_ptr[i] <= bits_set_mask) {
+                set_buffer.data()[keys_ptr[i]] = 1u;
+            }
+        }
+
+        const uint32_t status_code = set_membership_dense(input_stream,
+                                                          unpack_buffer,
+                                                          set_buffer,
+                                                          output_stream,
+                                                          aggregates_callback,
+                                                          aggregates,
+                                                          low_bits_to_ignore,
+                                                          bits_set_size);
+
+        return make_software_result(input_stream, output_stream, status_code, aggregates);
+    }
+
+    hash_set_t hash_set;
+
+    if (!hash_set.reserve(keys_count)) {
+        return make_software_result(input_stream, output_stream, status_list::memory_allocation_error, aggregates);
+    }
+
+    for (uint32_t i = 0u; i < keys_count; i++) {
+        if (keys_ptr[i] <= bits_set_mask) {
+            if (!hash_set.insert(keys_ptr[i])) {
+                return make_software_result(input_stream, output_stream, status_list::memory_allocation_error, aggregates);
+            }
+
+            // Same values as the aggregates of the byte per key set give
+            aggregates.min_value_ = std::min(aggregates.min_value_, keys_ptr[i]);
+            aggregates.max_value_ = std::max(aggregates.max_value_, keys_ptr[i]);
+        }
+    }
+
+    if (input_stream.are_aggregates_disabled()) {
+        aggregates = aggregates_t{};
+    } else {
+        aggregates.sum_ = hash_set.size();
+    }
+
+    const auto set_view = hash_set.view();
+
+    uint32_t status_code = status_list::ok;
+
     if (input_stream.stream_format() == stream_format_t::prle_format) {
         if (input_stream.is_compressed()) {
-            status_code = set_membership<analytic_pipeline::inflate_prle>(input_stream,
-                                                                          unpack_buffer,
-                                                                          set_buffer,
-                                                                          output_stream,
-                                                                          aggregates_callback,
-                                                                          aggregates,
-                                                                          low_bits_to_ignore,
-                                                                          bits_set_size);
+            status_code = set_membership_hash<analytic_pipeline::inflate_prle>(input_stream,
+                                                                               unpack_buffer,
+                                                                               output_stream,
+                                                                               set_view,
+                                                                               low_bits_to_ignore,
+                                                                               bits_set_mask);
         } else {
-            status_code = set_membership<analytic_pipeline::prle>(input_stream,
-                                                                  unpack_buffer,
-                                                                  set_buffer,
-                                                                  output_stream,
-                                                                  aggregates_callback,
-                                                                  aggregates,
-                                                                  low_bits_to_ignore,
-                                                                  bits_set_size);
+            status_code = set_membership_hash<analytic_pipeline::prle>(input_stream,
+                                                                       unpack_buffer,
+                                                                       output_stream,
+                                                                       set_view,
+                                                                       low_bits_to_ignore,
+                                                                       bits_set_mask);
         }
     } else {
         if (input_stream.is_compressed()) {
-            status_code = set_membership<analytic_pipeline::inflate>(input_stream,
-                                                                     unpack_buffer,
-                                                                     set_buffer,
-                                                                     output_stream,
-                                                                     aggregates_callback,
-                                                                     aggregates,
-                                                                     low_bits_to_ignore,
-                                                                     bits_set_size);
+            status_code = set_membership_hash<analytic_pipeline::inflate>(input_stream,
+                                                                          unpack_buffer,
+                                                                          output_stream,
+                                                                          set_view,
+                                                                          low_bits_to_ignore,
+                                                                          bits_set_mask);
         } else {
-            status_code = set_membership<analytic_pipeline::simple>(input_stream,
-                                                                    unpack_buffer,
-                                                                    set_buffer,
-                                                                    output_stream,
-                                                                    aggregates_callback,
-                                                                    aggregates,
-                                                                    low_bits_to_ignore,
-                                                                    bits_set_size);
+            status_code = set_membership_hash<analytic_pipeline::simple>(input_stream,
+                                                                         unpack_buffer,
+                                                                         output_stream,
+                                                                         set_view,
+                                                                         low_bits_to_ignore,
+                                                                         bits_set_mask);
         }
     }
 
-    input_stream.calculate_checksums();
-
-    analytic_operation_result_t operation_result{};
-
-    // Store operations result
-    operation_result.status_code_      = status_code;
-    operation_result.aggregates_       = aggregates;
-    operation_result.checksums_.crc32_ = input_stream.crc_checksum();
-    operation_result.checksums_.xor_   = input_stream.xor_checksum();
-    operation_result.output_bytes_     = output_stream.bytes_written();
-
-    operation_result.last_bit_offset_ = (1u == output_stream.bit_width())
-                                        ? input_stream.elements_left() & max_bit_index
-                                        : 0u;
-
-    return operation_result;
+    return make_software_result(input_stream, output_stream, status_code, aggregates);
 }
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -22,6 +22,21 @@ auto call_set_membership(input_stream_t &input_stream,
                          limited_buffer_t &set_buffer,
                          int32_t numa_id = -1) noexcept -> analytic_operation_result_t;
 
+/**
+ * @brief Software set membership with the set given as a list of 32-bit keys
+ *
+ * @details Domains of up to limits::max_set_size bits are looked up in the byte per key array built in set_buffer,
+ *          wider domains are looked up in a hash set. Keys that are out of the domain never match.
+ */
+auto call_set_membership_list(input_stream_t &input_stream,
+                              const uint32_t *keys_ptr,
+                              uint32_t keys_count,
+                              output_stream_t<bit_stream> &output_stream,
+                              uint32_t low_bits_to_ignore,
+                              uint32_t high_bits_to_ignore,
+                              limited_buffer_t &unpack_buffer,
+                              limited_buffer_t &set_buffer) noexcept -> analytic_operation_result_t;
+
 } // namespace qpl::ml::analytics
 
 #endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_SET_MEMBERSHIP_HPP_
@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "wide_elements.hpp"
+#include "util/checksum.hpp"
+
+namespace qpl::ml::analytics {
+
+namespace {
+
+using wide_scan_function_t = void (*)(const wide_stream_t &input_stream,
+                                      uint32_t first_index,
+                                      uint32_t elements_count,
+                                      uint8_t *destination_ptr,
+                                      uint64_t param_low,
+                                      uint64_t param_high);
+
+template <comparator_t comparator>
+inline auto compare(const uint64_t value, const uint64_t param_low, const uint64_t param_high) noexcept -> uint8_t {
+    switch (comparator) {
+        case equals:
+            return value == param_low;
+        case not_equals:
+            return value != param_low;
+        case less_than:
+            return value < param_low;
+        case less_equals:
+            return value <= param_low;
+        case greater_than:
+            return value > param_low;
+        case greater_equals:
+            return value >= param_low;
+        case in_range:
+            return param_low <= value && value <= param_high;
+        default:
+            return value < param_low || param_high < value;
+    }
+}
+
+/**
+ * @brief Writes the comparison result of every element to a byte
+ */
+template <comparator_t comparator>
+void scan_elements(const wide_stream_t &input_stream,
+                   const uint32_t first_index,
+                   const uint32_t elements_count,
+                   uint8_t *destination_ptr,
+                   const uint64_t param_low,
+                   const uint64_t param_high) noexcept {
+    for (uint32_t i = 0u; i < elements_count; i++) {
+        destination_ptr[i] = compare<comparator>(input_stream.element(first_index + i), param_low, param_high);
+    }
+}
+
+inline auto get_scan_function(const comparator_t comparator) noexcept -> wide_scan_function_t {
+    switch (comparator) {
+        case equals:
+            return &scan_elements<equals>;
+        case not_equals:
+            return &scan_elements<not_equals>;
+        case less_than:
+            return &scan_elements<less_than>;
+        case less_equals:
+            return &scan_elements<less_equals>;
+        case greater_than:
+            return &scan_elements<greater_than>;
+        case greater_equals:
+            return &scan_elements<greater_equals>;
+        case in_range:
+            return &scan_elements<in_range>;
+        default:
+            return &scan_elements<out_of_range>;
+    }
+}
+
+inline auto is_mask_bit_set(const uint8_t *mask_ptr, const stream_format_t mask_format, const uint32_t index) noexcept
+-> bool {
+    const uint32_t bit_index = (stream_format_t::be_format == mask_format)
+                               ? max_bit_index - (index & max_bit_index)
+                               : index & max_bit_index;
+
+    return (mask_ptr[index >> bit_len_to_byte_shift_offset] >> bit_index) & 1u;
+}
+
+inline void update_aggregates(wide_aggregates_t &aggregates, const uint64_t value) noexcept {
+    aggregates.min_value_ = std::min(aggregates.min_value_, value);
+    aggregates.max_value_ = std::max(aggregates.max_value_, value);
+    aggregates.sum_ += value;
+}
+
+/**
+ * @brief Fills the result of an operation that writes elements, 32-bit aggregates are the lower halves of wide ones
+ */
+inline auto make_result(const uint32_t status, const wide_aggregates_t &aggregates,
+                        const wide_output_stream_t &output_stream) noexcept -> wide_operation_result_t {
+    wide_operation_result_t result{};
+
+    result.status_code_           = status;
+    result.output_bytes_          = output_stream.bytes_written();
+    result.wide_aggregates_       = aggregates;
+    result.aggregates_.min_value_ = static_cast<uint32_t>(aggregates.min_value_);
+    result.aggregates_.max_value_ = static_cast<uint32_t>(aggregates.max_value_);
+    result.aggregates_.sum_       = static_cast<uint32_t>(aggregates.sum_);
+
+    return result;
+}
+
+} // anonymous namespace
+
+auto calculate_wide_checksums(const wide_stream_t &input_stream, const bool is_crc32c) noexcept -> checksums_t {
+    checksums_t checksums{};
+
+    checksums.crc32_ = (is_crc32c)
+                       ? util::crc32_iscsi_inv(input_stream.begin(), input_stream.end(), checksums.crc32_)
+                       : util::crc32_gzip(input_stream.begin(), input_stream.end(), checksums.crc32_);
+    checksums.xor_   = util::xor_checksum(input_stream.begin(), input_stream.end(), checksums.xor_);
+
+    return checksums;
+}
+
+auto call_wide_scan(const comparator_t comparator,
+                    const wide_stream_t &input_stream,
+                    const uint32_t elements_count,
+                    output_stream_t<bit_stream> &output_stream,
+                    uint64_t param_low,
+                    uint64_t param_high,
+                    limited_buffer_t &temporary_buffer,
+                    const bool omit_aggregates) noexcept -> wide_operation_result_t {
+    const uint64_t value_mask = std::numeric_limits<uint64_t>::max() >> (long_bits_size - input_stream.bit_width());
+
+    param_low &= value_mask;
+    param_high &= value_mask;
+
+    auto scan_function       = get_scan_function(comparator);
+    auto aggregates_table    = dispatcher::kernels_dispatcher::get_instance().get_aggregates_table();
+    auto aggregates_callback = (omit_aggregates) ?
+                               &aggregates_empty_callback :
+                               aggregates_table[dispatcher::get_aggregates_index(1u)];
+
+    aggregates_t aggregates{};
+    uint32_t     status = status_list::ok;
+
+    for (uint32_t index = 0u; index < elements_count && status_list::ok == status;) {
+        const uint32_t chunk_size = std::min(temporary_buffer.max_elements_count(), elements_count - index);
+
+        scan_function(input_stream, index, chunk_size, temporary_buffer.data(), param_low, param_high);
+
+        aggregates_callback(temporary_buffer.data(),
+                            chunk_size,
+                            &aggregates.min_value_,
+                            &aggregates.max_value_,
+                            &aggregates.sum_,
+                            &aggregates.index_);
+
+        status = output_stream.perform_pack(temporary_buffer.data(), chunk_size);
+        index += chunk_size;
+    }
+
+    wide_operation_result_t result{};
+
+    result.status_code_                = status;
+    result.output_bytes_               = output_stream.bytes_written();
+    result.last_bit_offset_            = (1u == output_stream.bit_width()) ? elements_count & max_bit_index : 0u;
+    result.aggregates_                 = aggregates;
+    result.wide_aggregates_.min_value_ = aggregates.min_value_;
+    result.wide_aggregates_.max_value_ = aggregates.max_value_;
+    result.wide_aggregates_.sum_       = aggregates.sum_;
+
+    return result;
+}
+
+auto call_wide_extract(const wide_stream_t &input_stream,
+                       const uint32_t elements_count,
+                       wide_output_stream_t &output_stream,
+                       const uint32_t param_low,
+                       const uint32_t param_high,
+                       const bool omit_aggregates) noexcept -> wide_operation_result_t {
+    wide_aggregates_t aggregates{};
+
+    const uint32_t last_index = std::min(param_high, elements_count - 1u);
+
+    if (param_low <= last_index) {
+        if (last_index - param_low + 1u > output_stream.capacity()) {
+            return make_result(status_list::destination_is_short_error, aggregates, output_stream);
+        }
+
+        for (uint32_t index = param_low; index <= last_index; index++) {
+            const uint64_t value = input_stream.element(index);
+
+            output_stream.push(value);
+
+            if (!omit_aggregates) {
+                update_aggregates(aggregates, value);
+            }
+        }
+
+        output_stream.flush();
+    }
+
+    return make_result(status_list::ok, aggregates, output_stream);
+}
+
+auto call_wide_select(const wide_stream_t &input_stream,
+                      const uint8_t *mask_ptr,
+                      const stream_format_t mask_format,
+                      const uint32_t elements_count,
+                      wide_output_stream_t &output_stream,
+                      const bool omit_aggregates) noexcept -> wide_operation_result_t {
+    wide_aggregates_t aggregates{};
+
+    const uint32_t capacity         = output_stream.capacity();
+    uint32_t       elements_written = 0u;
+
+    for (uint32_t index = 0u; index < elements_count; index++) {
+        if (!is_mask_bit_set(mask_ptr, mask_format, index)) {
+            continue;
+        }
+
+        if (elements_written == capacity) {
+            output_stream.flush();
+
+            return make_result(status_list::destination_is_short_error, aggregates, output_stream);
+        }
+
+        const uint64_t value = input_stream.element(index);
+
+        output_stream.push(value);
+        elements_written++;
+
+        if (!omit_aggregates) {
+            update_aggregates(aggregates, value);
+        }
+    }
+
+    output_stream.flush();
+
+    return make_result(status_list::ok, aggregates, output_stream);
+}
+
+auto call_wide_expand(const wide_stream_t &input_stream,
+                      const uint8_t *mask_ptr,
+                      const stream_format_t mask_format,
+                      const uint32_t elements_count,
+                      wide_output_stream_t &output_stream,
+                      const bool omit_aggregates) noexcept -> wide_operation_result_t {
+    wide_aggregates_t aggregates{};
+
+    if (elements_count > output_stream.capacity()) {
+        return make_result(status_list::destination_is_short_error, aggregates, output_stream);
+    }
+
+    const uint32_t source_elements_count = input_stream.elements_count();
+    uint32_t       source_index          = 0u;
+
+    for (uint32_t index = 0u; index < elements_count; index++) {
+        uint64_t value = 0u;
+
+        if (is_mask_bit_set(mask_ptr, mask_format, index)) {
+            if (source_index == source_elements_count) {
+                output_stream.flush();
+
+                return make_result(status_list::source_is_short_error, aggregates, output_stream);
+            }
+
+            value = input_stream.element(source_index++);
+        }
+
+        output_stream.push(value);
+
+        if (!omit_aggregates) {
+            update_aggregates(aggregates, value);
+        }
+    }
+
+    output_stream.flush();
+
+    return make_result(status_list::ok, aggregates, output_stream);
+}
+
+} // namespace qpl::ml::analytics
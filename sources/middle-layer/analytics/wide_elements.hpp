@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_WIDE_ELEMENTS_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_WIDE_ELEMENTS_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "analytics_defs.hpp"
+#include "output_stream.hpp"
+#include "scan.hpp"
+#include "common/bit_reverse.hpp"
+#include "common/buffer.hpp"
+
+namespace qpl::ml::analytics {
+
+/**
+ * @brief Aggregates of elements of 33-64 bits
+ */
+struct wide_aggregates_t {
+    uint64_t min_value_ = std::numeric_limits<uint64_t>::max();
+    uint64_t max_value_ = 0u;
+    uint64_t sum_       = 0u;
+};
+
+struct wide_operation_result_t : public analytic_operation_result_t {
+    wide_aggregates_t wide_aggregates_;
+};
+
+/**
+ * @brief Packed array of elements of 33-64 bits in little- or big-endian format
+ *
+ * @note Elements are read one by one, there are no unpack kernels for these bit widths
+ */
+class wide_stream_t final : public buffer_t {
+public:
+    template <class iterator_t>
+    wide_stream_t(iterator_t begin,
+                  iterator_t end,
+                  uint32_t bit_width,
+                  stream_format_t stream_format,
+                  uint32_t ignore_bytes = 0u)
+            : buffer_t(begin, end),
+              elements_ptr_(data() + ignore_bytes),
+              bit_width_(bit_width),
+              stream_format_(stream_format) {
+    }
+
+    [[nodiscard]] inline auto bit_width() const noexcept -> uint32_t {
+        return bit_width_;
+    }
+
+    /**
+     * @brief Number of elements that are entirely in the buffer
+     */
+    [[nodiscard]] inline auto elements_count() const noexcept -> uint32_t {
+        const auto bytes_count = static_cast<uint64_t>(end() - elements_ptr_);
+
+        return static_cast<uint32_t>((bytes_count * byte_bits_size) / bit_width_);
+    }
+
+    [[nodiscard]] inline auto element(uint32_t index) const noexcept -> uint64_t {
+        const uint64_t bit_index = static_cast<uint64_t>(index) * bit_width_;
+        const uint8_t  *byte_ptr = elements_ptr_ + (bit_index >> bit_len_to_byte_shift_offset);
+        const uint32_t bit_shift = static_cast<uint32_t>(bit_index & max_bit_index);
+        const bool     is_split  = (bit_shift + bit_width_ > long_bits_size);
+
+        uint64_t word = load_word(byte_ptr);
+
+        if (stream_format_t::be_format == stream_format_) {
+            word = swap_bytes(word) << bit_shift;
+
+            if (is_split) {
+                word |= byte_ptr[sizeof(uint64_t)] >> (byte_bits_size - bit_shift);
+            }
+
+            return word >> (long_bits_size - bit_width_);
+        }
+
+        word >>= bit_shift;
+
+        if (is_split) {
+            word |= static_cast<uint64_t>(byte_ptr[sizeof(uint64_t)]) << (long_bits_size - bit_shift);
+        }
+
+        return word & (std::numeric_limits<uint64_t>::max() >> (long_bits_size - bit_width_));
+    }
+
+private:
+    [[nodiscard]] inline auto load_word(const uint8_t *byte_ptr) const noexcept -> uint64_t {
+        const auto bytes_left = static_cast<size_t>(end() - byte_ptr);
+
+        uint64_t word = 0u;
+        std::memcpy(&word, byte_ptr, std::min(bytes_left, sizeof(uint64_t)));
+
+        return word;
+    }
+
+    uint8_t         *elements_ptr_ = nullptr;
+    uint32_t        bit_width_     = 0u;
+    stream_format_t stream_format_ = stream_format_t::le_format;
+};
+
+/**
+ * @brief Writes elements of 33-64 bits one by one to a packed array in little- or big-endian format
+ */
+class wide_output_stream_t final : public buffer_t {
+public:
+    template <class iterator_t>
+    wide_output_stream_t(iterator_t begin, iterator_t end, uint32_t bit_width, stream_format_t stream_format)
+            : buffer_t(begin, end),
+              destination_current_ptr_(data()),
+              bit_width_(bit_width),
+              stream_format_(stream_format) {
+    }
+
+    /**
+     * @brief Number of elements that fit the destination
+     */
+    [[nodiscard]] inline auto capacity() const noexcept -> uint32_t {
+        return static_cast<uint32_t>((static_cast<uint64_t>(size()) * byte_bits_size) / bit_width_);
+    }
+
+    /**
+     * @brief Appends the element, no more than capacity() elements may be written
+     */
+    inline void push(uint64_t value) noexcept {
+        const uint32_t bits_count = accumulated_bits_ + bit_width_;
+
+        if (bits_count < long_bits_size) {
+            accumulator_ |= (stream_format_t::be_format == stream_format_)
+                            ? value << (long_bits_size - bits_count)
+                            : value << accumulated_bits_;
+            accumulated_bits_ = bits_count;
+
+            return;
+        }
+
+        const uint32_t bits_left = bits_count - long_bits_size;
+
+        if (stream_format_t::be_format == stream_format_) {
+            accumulator_ |= value >> bits_left;
+            store_word(swap_bytes(accumulator_));
+            accumulator_ = (0u != bits_left) ? value << (long_bits_size - bits_left) : 0u;
+        } else {
+            accumulator_ |= value << accumulated_bits_;
+            store_word(accumulator_);
+            accumulator_ = (0u != bits_left) ? value >> (bit_width_ - bits_left) : 0u;
+        }
+
+        accumulated_bits_ = bits_left;
+    }
+
+    /**
+     * @brief Writes bits that are left in the accumulator, the last byte is padded with zeroes
+     */
+    inline void flush() noexcept {
+        const uint64_t word = (stream_format_t::be_format == stream_format_) ? swap_bytes(accumulator_)
+                                                                             : accumulator_;
+
+        std::memcpy(destination_current_ptr_, &word, util::bit_to_byte(accumulated_bits_));
+        destination_current_ptr_ += util::bit_to_byte(accumulated_bits_);
+        accumulator_      = 0u;
+        accumulated_bits_ = 0u;
+    }
+
+    [[nodiscard]] inline auto bytes_written() const noexcept -> uint32_t {
+        return static_cast<uint32_t>(std::distance(data(), destination_current_ptr_));
+    }
+
+private:
+    inline void store_word(uint64_t word) noexcept {
+        std::memcpy(destination_current_ptr_, &word, sizeof(uint64_t));
+        destination_current_ptr_ += sizeof(uint64_t);
+    }
+
+    uint8_t         *destination_current_ptr_ = nullptr;
+    uint64_t        accumulator_              = 0u;
+    uint32_t        accumulated_bits_         = 0u;
+    uint32_t        bit_width_                = 0u;
+    stream_format_t stream_format_            = stream_format_t::le_format;
+};
+
+/**
+ * @brief Calculates checksums of the whole source buffer, including ignored bytes
+ */
+auto calculate_wide_checksums(const wide_stream_t &input_stream, bool is_crc32c) noexcept -> checksums_t;
+
+/**
+ * @brief Scans elements_count elements of 33-64 bits, the parameters are truncated to the bit width
+ *
+ * @note Results are packed by the usual bit stream, so every output format of scan is supported.
+ *       Aggregates are the index of the first match, the index of the last match and the number of matches
+ */
+auto call_wide_scan(comparator_t comparator,
+                    const wide_stream_t &input_stream,
+                    uint32_t elements_count,
+                    output_stream_t<bit_stream> &output_stream,
+                    uint64_t param_low,
+                    uint64_t param_high,
+                    limited_buffer_t &temporary_buffer,
+                    bool omit_aggregates) noexcept -> wide_operation_result_t;
+
+/**
+ * @brief Copies elements with indices from param_low to param_high among the first elements_count ones
+ */
+auto call_wide_extract(const wide_stream_t &input_stream,
+                       uint32_t elements_count,
+                       wide_output_stream_t &output_stream,
+                       uint32_t param_low,
+                       uint32_t param_high,
+                       bool omit_aggregates) noexcept -> wide_operation_result_t;
+
+/**
+ * @brief Copies elements whose bits in the 1-bit mask are set
+ */
+auto call_wide_select(const wide_stream_t &input_stream,
+                      const uint8_t *mask_ptr,
+                      stream_format_t mask_format,
+                      uint32_t elements_count,
+                      wide_output_stream_t &output_stream,
+                      bool omit_aggregates) noexcept -> wide_operation_result_t;
+
+/**
+ * @brief Writes the next source element for every set bit of the 1-bit mask and zero for every clear one
+ */
+auto call_wide_expand(const wide_stream_t &input_stream,
+                      const uint8_t *mask_ptr,
+                      stream_format_t mask_format,
+                      uint32_t elements_count,
+                      wide_output_stream_t &output_stream,
+                      bool omit_aggregates) noexcept -> wide_operation_result_t;
+
+} // namespace qpl::ml::analytics
+
+#endif //QPL_SOURCES_MIDDLE_LAYER_ANALYTICS_WIDE_ELEMENTS_HPP_
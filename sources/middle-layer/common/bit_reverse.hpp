@@ -115,4 +115,9 @@ static inline uint32_t swap_bytes(uint32_t x) {
 
     return z.uint;
 }
+
+static inline uint64_t swap_bytes(uint64_t x) {
+    return (static_cast<uint64_t>(swap_bytes(static_cast<uint32_t>(x))) << 32u)
+           | swap_bytes(static_cast<uint32_t>(x >> 32u));
+}
 #endif // QPL_BIT_REV_HPP
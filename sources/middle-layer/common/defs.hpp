@@ -48,6 +48,7 @@ constexpr qpl_ml_status invalid_rle_count                  = QPL_STS_INVALID_RLE
 constexpr qpl_ml_status output_overflow_error              = QPL_STS_OUTPUT_OVERFLOW_ERR;
 constexpr qpl_ml_status buffers_overlap                    = QPL_STS_BUFFER_OVERLAP_ERR;
 constexpr qpl_ml_status compression_reference_before_start = QPL_STS_REF_BEFORE_START_ERR;
+constexpr qpl_ml_status memory_allocation_error            = QPL_STS_NO_MEM_ERR;
 
 }
 
@@ -73,17 +74,20 @@ constexpr uint32_t bit_bits_size                = 1;
 constexpr uint32_t byte_bits_size               = 8;
 constexpr uint32_t short_bits_size              = 16;
 constexpr uint32_t int_bits_size                = 32;
+constexpr uint32_t long_bits_size               = 64;
 constexpr uint32_t bit_len_to_byte_shift_offset = 3;
 constexpr uint32_t max_bit_index                = 7;
 constexpr uint32_t qpl_1k                       = 1024;
 constexpr uint32_t max_history_size             = 4 * qpl_1k;
 
 namespace limits {
-constexpr uint32_t max_bit_width    = int_bits_size;
-constexpr uint32_t min_bit_width    = bit_bits_size;
-constexpr uint32_t max_set_size     = 15u;
-constexpr uint32_t set_buf_bit_size = (1u << max_set_size);
-constexpr uint32_t set_buf_size     = set_buf_bit_size / byte_bits_size;
+constexpr uint32_t max_bit_width       = int_bits_size;
+constexpr uint32_t max_wide_bit_width  = long_bits_size; /**< Wider elements are processed on the software path only */
+constexpr uint32_t min_bit_width       = bit_bits_size;
+constexpr uint32_t max_set_size        = 15u;
+constexpr uint32_t set_buf_bit_size    = (1u << max_set_size);
+constexpr uint32_t set_buf_size        = set_buf_bit_size / byte_bits_size;
+constexpr uint32_t max_scan_predicates = 16u;
 
 static_assert(set_buf_size == 4096u, "Intermediate buffer for size is too small");
 }
@@ -205,6 +205,15 @@ constexpr bool is_last_chunk(stream_t &stream) {
     }
 }
 
+template<class stream_t>
+constexpr bool is_sync_flush(stream_t &stream) {
+    if constexpr(std::is_same_v<deflate_state<execution_path_t::software>, stream_t>) {
+        return stream.is_sync_flush();
+    } else {
+        return false;
+    }
+}
+
 template <typename stream_t>
 auto flush_bit_buffer(stream_t &stream, compression_state_t &state) noexcept -> qpl_ml_status {
     auto isal_state = &stream.isal_stream_ptr_->internal_state;
@@ -214,7 +223,7 @@ auto flush_bit_buffer(stream_t &stream, compression_state_t &state) noexcept ->
     uint32_t bits_length   = 0;
     int      flush_size    = 0;
 
-    if (is_last_chunk(stream)) {
+    if (is_last_chunk(stream) || is_sync_flush(stream)) {
         if (stream.isal_stream_ptr_->avail_out < bit_buffer_slope_bytes && bit_buffer->m_bit_count) {
             return status_list::more_output_needed;
         }
@@ -301,7 +310,7 @@ auto finish_compression_process(deflate_state<execution_path_t::software> &strea
 }
 
 void update_hash(deflate_state<execution_path_t::software> &stream, uint8_t *dictionary_ptr, uint32_t dictionary_size) noexcept {
-    if (stream.compression_level() == high_level) {
+    if (stream.compression_level() != default_level) {
         qplc_setup_dictionary()(dictionary_ptr, dictionary_size, stream.hash_table());
     } else {
         isal_deflate_hash(stream.isal_stream_ptr_, dictionary_ptr, dictionary_size);
@@ -340,6 +349,7 @@ auto deflate_body_with_dictionary(deflate_state<execution_path_t::software> &str
     uint32_t      avail_in       = stream.isal_stream_ptr_->avail_in;
     int32_t       buf_hist_start = 0;
     uint32_t      size           = 0;
+    const auto    flush          = stream.isal_stream_ptr_->flush;
 
     update_hash(stream, isal_state->buffer, isal_state->b_bytes_processed);
     uint32_t history_size = get_history_size(stream, start_in, buf_hist_start);
@@ -439,6 +449,7 @@ auto deflate_body_with_dictionary(deflate_state<execution_path_t::software> &str
             buffered_size                 -= processed;
 
             stream.isal_stream_ptr_->end_of_stream = stream.is_last_chunk();
+            stream.isal_stream_ptr_->flush         = flush;
             stream.isal_stream_ptr_->total_in     += buffered_size;
 
             stream.isal_stream_ptr_->next_in  = next_in;
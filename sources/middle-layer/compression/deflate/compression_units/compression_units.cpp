@@ -168,6 +168,15 @@ auto slow_deflate_body(deflate_state<execution_path_t::software> &stream, compre
         }
 
     } else {
+        // Sync flush requires the current block to be closed before the empty stored block
+        if (stream.is_sync_flush()) {
+            auto status = write_end_of_block(stream, state);
+
+            if (status) {
+                return status;
+            }
+        }
+
         state = compression_state_t::flush_bit_buffer;
     }
 
@@ -225,6 +234,11 @@ auto deflate_finish(deflate_state<execution_path_t::software> &stream, compressi
             state = compression_state_t::finish_deflate_block;
         }
     } else {
+        // Sync flush requires the current block to be closed before the empty stored block
+        if (stream.is_sync_flush() && status_list::ok == status) {
+            status = write_end_of_block(stream, state);
+        }
+
         state = compression_state_t::flush_bit_buffer;
     }
 
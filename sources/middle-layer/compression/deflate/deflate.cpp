@@ -15,7 +15,24 @@
 
 namespace qpl::ml::compression {
 
-auto deflate_pass(deflate_state<execution_path_t::software> &stream, uint8_t *begin, uint32_t size) noexcept -> compression_operation_result_t {
+/**
+ * Verifies the output written since the previous call, the CRC is checked by the call made after the pass only
+ */
+static inline auto verify_written_output(verify_state<execution_path_t::software> &verify_state,
+                                         uint8_t *output_end_ptr) noexcept -> bool {
+    verify_state.input(verify_state.get_input_data(), output_end_ptr);
+
+    auto verification_result = perform_verification<execution_path_t::software,
+                                                    verification_mode_t::verify_deflate_default>(verify_state);
+
+    return verification_result.status != parser_status_t::error;
+}
+
+auto deflate_pass(deflate_state<execution_path_t::software> &stream,
+                  uint8_t *begin,
+                  uint32_t size,
+                  verify_state<execution_path_t::software> *lockstep_verify_state_ptr) noexcept
+                  -> compression_operation_result_t {
     compression_operation_result_t result;
 
     result.status_code_ = status_list::ok;
@@ -32,6 +49,15 @@ auto deflate_pass(deflate_state<execution_path_t::software> &stream, uint8_t *be
     // Main pipeline
     do {
         result.status_code_ = implementation.execute(stream, state);
+
+        // The blocks written before a new one starts are final, so they are verified while still in cache
+        if (lockstep_verify_state_ptr && !result.status_code_ && state == compression_state_t::start_new_block) {
+            if (!verify_written_output(*lockstep_verify_state_ptr, stream.next_out())) {
+                result.status_code_ = qpl::ml::status_list::verify_error;
+
+                return result;
+            }
+        }
     } while (!result.status_code_ && state != compression_state_t::finish_compression_process);
 
     if (!result.status_code_ && stream.mini_blocks_support() == mini_blocks_support_t::disabled) {
@@ -271,7 +297,7 @@ auto deflate<execution_path_t::software, deflate_mode_t::deflate_no_headers>(def
     state.compression_mode_ = canned_mode;
     auto output_begin_ptr   = state.next_out();
 
-    auto result = deflate_pass(state, begin, size);
+    auto result = deflate_pass(state, begin, size, nullptr);
 
     if (state.is_verification_enabled_ && !result.status_code_) {
         auto builder = (state.is_first_chunk()) ?
@@ -316,29 +342,46 @@ auto deflate<execution_path_t::software, deflate_mode_t::deflate_default>(deflat
                                                                           const uint32_t size) noexcept -> compression_operation_result_t {
     auto output_begin_ptr = state.next_out();
 
-    compression_operation_result_t result = deflate_pass(state, begin, size);
-
-    if (!(state.is_first_chunk() && state.is_last_chunk())) {
-        state.save_bit_buffer();
-    }
+    compression_operation_result_t result;
 
-    if (state.is_verification_enabled_ && !result.status_code_) {
+    if (state.is_verification_enabled_) {
         auto builder = (state.is_first_chunk()) ?
                 compression::verification_state_builder<execution_path_t::software>::create(state.allocator_) :
                 compression::verification_state_builder<execution_path_t::software>::restore(state.allocator_);
 
         auto verify_state = builder.build();
 
-        verify_state.input(output_begin_ptr, state.next_out())
-                    .required_crc(state.checksum_.crc32);
+        // A dynamic block is final once the next one starts, while a static or fixed block
+        // can still be rewritten as stored ones, so the latter are verified after the pass
+        const bool is_lockstep = state.is_lockstep_verification_ &&
+                                 state.compression_mode() == dynamic_mode &&
+                                 state.mini_blocks_support() == mini_blocks_support_t::disabled &&
+                                 state.dictionary_support() == dictionary_support_t::disabled;
 
-        auto verification_result = perform_verification<execution_path_t::software,
-                                                        verification_mode_t::verify_deflate_default>(verify_state);
+        verify_state.input(output_begin_ptr, output_begin_ptr)
+                    .defer_crc_check(true);
 
-        if (verification_result.status == parser_status_t::error) {
-            result.status_code_ = qpl::ml::status_list::verify_error;
+        result = deflate_pass(state, begin, size, is_lockstep ? &verify_state : nullptr);
 
-            return result;
+        if (!(state.is_first_chunk() && state.is_last_chunk())) {
+            state.save_bit_buffer();
+        }
+
+        if (!result.status_code_) {
+            verify_state.defer_crc_check(false)
+                        .required_crc(state.checksum_.crc32);
+
+            if (!verify_written_output(verify_state, state.next_out())) {
+                result.status_code_ = qpl::ml::status_list::verify_error;
+
+                return result;
+            }
+        }
+    } else {
+        result = deflate_pass(state, begin, size, nullptr);
+
+        if (!(state.is_first_chunk() && state.is_last_chunk())) {
+            state.save_bit_buffer();
         }
     }
 
@@ -36,8 +36,13 @@ constexpr auto build_deflate_implementation(compression_level_t level,
     }
     
     if (mode == dynamic_mode) {
-        return level == default_level
-               ? deflate_implementation<default_level, dynamic_mode, block_type>::instance
+        if (level == default_level) {
+            return deflate_implementation<default_level, dynamic_mode, block_type>::instance;
+        }
+
+        // Optimal parsing is applied only to the dynamic blocks, where the block statistics are known
+        return level == level_9
+               ? deflate_implementation<level_9, dynamic_mode, block_type>::instance
                : deflate_implementation<high_level, dynamic_mode, block_type>::instance;
     }
 
@@ -79,6 +79,16 @@ public:
         return *reinterpret_cast<common_type *>(this);
     }
 
+    /**
+     * Closes the current block of a non-last chunk and byte-aligns the output with an empty stored block,
+     * so the next chunk can be compressed independently and appended to the stream
+     */
+    auto sync_flush(bool value) noexcept -> common_type & {
+        stream_.sync_flush_ = value;
+
+        return *reinterpret_cast<common_type *>(this);
+    }
+
     auto crc_seed(util::checksum_accumulator value) noexcept -> common_type & {
         stream_.checksum_ = value;
 
@@ -116,6 +126,16 @@ public:
         return *reinterpret_cast<common_type *>(this);
     }
 
+    /**
+     * Verifies every dynamic block right after it is written instead of the whole output after the pass,
+     * the other blocks are verified after the pass as usual
+     */
+    auto verify_in_lockstep(bool value) noexcept -> common_type & {
+        stream_.is_lockstep_verification_ = value;
+
+        return *reinterpret_cast<common_type *>(this);
+    }
+
 protected:
     auto set_isal_internal_buffers(uint8_t *const level_buffer_ptr,
                                    const uint32_t level_buffer_size,
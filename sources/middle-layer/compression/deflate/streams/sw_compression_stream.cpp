@@ -11,6 +11,44 @@
 #include "deflate_hash_table.h"
 
 namespace qpl::ml::compression {
+
+namespace {
+
+/**
+ * @brief Match search parameters of the own matcher, see deflate_hash_table_t
+ */
+struct match_parameters_t {
+    compression_level_t level;
+    uint32_t            attempts;
+    uint32_t            good_match;
+    uint32_t            nice_match;
+    uint32_t            lazy_match;
+};
+
+/**
+ * Lazy match of the minimal match length makes the search greedy.
+ * Chains are limited by the 4K window anyway, so the longest ones are used by the highest levels.
+ */
+constexpr match_parameters_t match_parameters[] = {
+        {level_0,    1u,    8u,  16u,  4u},
+        {level_2,    32u,   16u, 128u, 4u},
+        {high_level, 4096u, 32u, 258u, 258u},
+        {level_9,    4096u, 32u, 258u, 258u}
+};
+
+auto get_match_parameters(compression_level_t level) noexcept -> const match_parameters_t & {
+    for (const auto &parameters : match_parameters) {
+        if (parameters.level == level) {
+            return parameters;
+        }
+    }
+
+    // Levels without own parameters are processed as the high level
+    return match_parameters[2];
+}
+
+} // anonymous namespace
+
 void deflate_state<execution_path_t::software>::set_source(uint8_t *begin, uint32_t size) noexcept {
     isal_stream_ptr_->next_in  = begin;
     isal_stream_ptr_->avail_in = size;
@@ -44,18 +82,20 @@ void deflate_state<execution_path_t::software>::reset_match_history() noexcept {
 
     auto level_buffer = reinterpret_cast<level_buf *>(isal_stream_ptr_->level_buf);
     
-    if (compression_level() == high_level) {
+    if (compression_level() != default_level) {
         hash_table_.hash_table_ptr = reinterpret_cast<uint32_t *>(level_buffer->hash_map.hash_table);
         hash_table_.hash_story_ptr = hash_table_.hash_table_ptr + high_hash_table_size;
 
         if (isal_stream_ptr_->total_in == 0) {
+            const auto &parameters = get_match_parameters(compression_level());
+
             deflate_hash_table_reset(&hash_table_);
 
             hash_table_.hash_mask  = util::build_mask<uint32_t, 12u>();
-            hash_table_.attempts   = 4096u;
-            hash_table_.good_match = 32u;
-            hash_table_.nice_match = 258u;
-            hash_table_.lazy_match = 258u;
+            hash_table_.attempts   = parameters.attempts;
+            hash_table_.good_match = parameters.good_match;
+            hash_table_.nice_match = parameters.nice_match;
+            hash_table_.lazy_match = parameters.lazy_match;
         }
     } else {
         auto isal_state   = &isal_stream_ptr_->internal_state;
@@ -154,6 +194,10 @@ auto deflate_state<execution_path_t::software>::init_level_buffer() noexcept ->
     return dictionary_support_;
 }
 
+[[nodiscard]] auto deflate_state<execution_path_t::software>::is_sync_flush() const noexcept -> bool {
+    return sync_flush_;
+}
+
 [[nodiscard]] auto deflate_state<execution_path_t::software>::hash_table() noexcept -> deflate_hash_table_t * {
     return &hash_table_;
 }
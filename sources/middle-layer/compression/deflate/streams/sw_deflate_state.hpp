@@ -26,6 +26,9 @@
 
 namespace qpl::ml::compression {
 
+template <execution_path_t path>
+class verify_state;
+
 /**
  * Size of internal buffer for the isal level buffer
  */
@@ -46,6 +49,12 @@ class deflate_state<execution_path_t::software> final : public compression_strea
                         uint8_t *begin,
                         const uint32_t size) noexcept -> compression_operation_result_t;
 
+    friend auto deflate_pass(deflate_state<execution_path_t::software> &stream,
+                             uint8_t *begin,
+                             uint32_t size,
+                             verify_state<execution_path_t::software> *lockstep_verify_state_ptr) noexcept
+                             -> compression_operation_result_t;
+
 public:
     [[nodiscard]] static inline auto required_buffer_size() noexcept -> uint32_t {
         auto size = sizeof(isal_zstream);
@@ -68,6 +77,8 @@ public:
 
     [[nodiscard]] auto dictionary_support() const noexcept -> dictionary_support_t;
 
+    [[nodiscard]] auto is_sync_flush() const noexcept -> bool;
+
     [[nodiscard]] auto crc() const noexcept -> uint32_t;
 
     static constexpr auto execution_path = execution_path_t::software;
@@ -120,6 +131,7 @@ protected:
     dictionary_support_t   dictionary_support_      = dictionary_support_t::disabled;
     BitBuf2                *bit_buffer_ptr          = nullptr;
     bool                   start_new_block_         = false;
+    bool                   sync_flush_              = false;
     uint8_t                *source_begin_ptr_       = nullptr;
     uint32_t               source_size_             = 0;
     uint32_t               ignore_start_bits_       = 0;
@@ -127,6 +139,7 @@ protected:
 
     // Verification
     bool                   is_verification_enabled_   = false;
+    bool                   is_lockstep_verification_  = false;
     qpl_compression_huffman_table* compression_table_ = nullptr;
 
     // Other
@@ -165,6 +178,9 @@ private:
     friend auto slow_deflate_icf_body(deflate_state<execution_path_t::software> &stream,
                                       compression_state_t &state) noexcept -> qpl_ml_status;
 
+    friend auto optimal_deflate_icf_body(deflate_state<execution_path_t::software> &stream,
+                                         compression_state_t &state) noexcept -> qpl_ml_status;
+
     friend auto write_header(deflate_state<execution_path_t::software> &stream,
                              compression_state_t &state) noexcept -> qpl_ml_status;
 
@@ -26,6 +26,7 @@ enum compression_mode_t : uint32_t {
 };
 
 enum compression_level_t : uint32_t {
+    level_0 = 10, // Matches qpl_level_0, 0 is not a level
     level_1 = 1,
     level_2 = 2,
     level_3 = 3,
@@ -10,6 +10,7 @@
 #include <cstdint>
 #include "common/defs.hpp"
 #include "common/linear_allocator.hpp"
+#include "util/util.hpp"
 #include "compression/deflate/utils/compression_defs.hpp"
 #include "hw_aecs_api.h"
 #include "hw_descriptors_api.h"
@@ -76,6 +77,14 @@ public:
 
     [[nodiscard]] inline auto get_buffer() noexcept -> uint8_t *;
 
+    [[nodiscard]] static constexpr inline auto get_buffer_size() noexcept -> uint32_t {
+        auto size = sizeof(internal_state_fields_t);
+        size += huffman_only_lookup_table_size;
+        size += huffman_only_be_buffer_size;
+
+        return static_cast<uint32_t>(util::align_size(size, 1_kb));
+    }
+
     static constexpr auto execution_path = execution_path_t::software;
 
 private:
@@ -115,6 +124,13 @@ public:
 
     [[nodiscard]] inline auto get_input_size() const noexcept -> uint32_t;
 
+    [[nodiscard]] static constexpr inline auto get_buffer_size() noexcept -> uint32_t {
+        auto size = sizeof(hw_descriptor);
+        size += sizeof(HW_PATH_VOLATILE hw_completion_record);
+
+        return static_cast<uint32_t>(util::align_size(size, 1_kb));
+    }
+
     static constexpr auto execution_path = execution_path_t::hardware;
 
 private:
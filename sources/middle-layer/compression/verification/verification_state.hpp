@@ -7,6 +7,8 @@
 #ifndef QPL_SOURCES_MIDDLE_LAYER_VERIFICATION_VERIFY_STATE_HPP
 #define QPL_SOURCES_MIDDLE_LAYER_VERIFICATION_VERIFY_STATE_HPP
 
+#include <algorithm>
+
 #include "compression/inflate/deflate_header_decompression.hpp"
 #include "common/defs.hpp"
 #include "util/memory.hpp"
@@ -41,6 +43,8 @@ public:
 
     inline auto crc_seed(uint32_t seed) noexcept -> verify_state &;
 
+    inline auto defer_crc_check(bool value) noexcept -> verify_state &;
+
     inline auto set_parser_position(parser_position_t value) noexcept -> verify_state &;
 
     inline auto get_parser_position() noexcept -> parser_position_t;
@@ -49,8 +53,19 @@ public:
 
     inline auto reset_state() noexcept -> verify_state &;
 
+    inline auto cache_header(uint64_t read_in,
+                             uint32_t read_in_length,
+                             const uint8_t *next_in_ptr,
+                             uint32_t header_bits) noexcept -> verify_state &;
+
+    inline auto reset_header_cache() noexcept -> verify_state &;
+
+    inline auto skip_cached_header() noexcept -> uint32_t;
+
     [[nodiscard]] inline auto is_first() const noexcept -> bool;
 
+    [[nodiscard]] inline auto is_crc_check_deferred() const noexcept -> bool;
+
     [[nodiscard]] inline auto get_input_data() const noexcept -> uint8_t *;
 
     [[nodiscard]] inline auto get_input_size() const noexcept -> uint32_t;
@@ -85,10 +100,13 @@ private:
         uint32_t           decompression_buffer_size;
         isal_inflate_state state_ptr;
         uint32_t           crc;
+        uint8_t            header_bits[ISAL_DEF_MAX_HDR_SIZE];
+        uint32_t           header_bits_count;
     } *verify_state_ptr;
 
     bool     is_first_;
-    uint32_t required_crc_value;
+    bool     is_crc_check_deferred_ = false;
+    uint32_t required_crc_value    = 0u;
 };
 
 template <>
@@ -97,6 +115,26 @@ class verify_state<execution_path_t::hardware> {
 };
 
 // ------ SOFTWARE PATH ------ //
+/**
+ * Copies bit_count bits of the deflate stream that starts with the read_in_length bits buffered in read_in
+ * and continues with the next_in_ptr bytes
+ */
+static inline void copy_stream_bits(uint64_t read_in,
+                                    uint32_t read_in_length,
+                                    const uint8_t *next_in_ptr,
+                                    uint32_t bit_count,
+                                    uint8_t *destination_ptr) noexcept {
+    util::set_zeros(destination_ptr, util::bit_to_byte(bit_count));
+
+    for (uint32_t i = 0u; i < bit_count; i++) {
+        const uint32_t bit = (i < read_in_length)
+                             ? static_cast<uint32_t>(read_in >> i) & 1u
+                             : (next_in_ptr[(i - read_in_length) >> 3u] >> ((i - read_in_length) & 7u)) & 1u;
+
+        destination_ptr[i >> 3u] |= static_cast<uint8_t>(bit << (i & 7u));
+    }
+}
+
 template <class iterator_t>
 inline auto verify_state<execution_path_t::software>::input(iterator_t begin,
                                                             iterator_t end) noexcept -> verify_state & {
@@ -126,7 +164,7 @@ inline auto verify_state<execution_path_t::software>::decompress_table(uint8_t *
 
     verify_state_ptr->state_ptr.block_state = ISAL_BLOCK_CODED;
 
-    return *this;
+    return reset_header_cache();
 }
 
 inline auto verify_state<execution_path_t::software>::required_crc(uint32_t crc) noexcept -> verify_state & {
@@ -154,6 +192,12 @@ inline auto verify_state<execution_path_t::software>::crc_seed(uint32_t seed) no
     return *this;
 }
 
+inline auto verify_state<execution_path_t::software>::defer_crc_check(bool value) noexcept -> verify_state & {
+    is_crc_check_deferred_ = value;
+
+    return *this;
+}
+
 inline auto verify_state<execution_path_t::software>::reset_miniblock_state() noexcept -> verify_state & {
     verify_state_ptr->state_ptr.next_out  = verify_state_ptr->decompression_buffer_ptr;
     verify_state_ptr->state_ptr.avail_out = verify_state_ptr->decompression_buffer_size;
@@ -165,13 +209,94 @@ inline auto verify_state<execution_path_t::software>::reset_miniblock_state() no
 inline auto verify_state<execution_path_t::software>::reset_state() noexcept -> verify_state & {
     reset_inflate_state(&verify_state_ptr->state_ptr);
 
+    return reset_header_cache();
+}
+
+inline auto verify_state<execution_path_t::software>::cache_header(uint64_t read_in,
+                                                                   uint32_t read_in_length,
+                                                                   const uint8_t *next_in_ptr,
+                                                                   uint32_t header_bits) noexcept -> verify_state & {
+    if (header_bits > sizeof(verify_state_ptr->header_bits) * byte_bits_size) {
+        return reset_header_cache();
+    }
+
+    copy_stream_bits(read_in, read_in_length, next_in_ptr, header_bits, verify_state_ptr->header_bits);
+    verify_state_ptr->header_bits_count = header_bits;
+
+    return *this;
+}
+
+inline auto verify_state<execution_path_t::software>::reset_header_cache() noexcept -> verify_state & {
+    verify_state_ptr->header_bits_count = 0u;
+
     return *this;
 }
 
+/**
+ * Consumes the next block header if its bits match the cached header of the last Huffman coded block,
+ * so the decoding tables built for that header are used as is. BFINAL is the only bit allowed to differ.
+ *
+ * @return number of the header bits consumed, 0 if the header should be parsed
+ */
+inline auto verify_state<execution_path_t::software>::skip_cached_header() noexcept -> uint32_t {
+    auto &inflate_state      = verify_state_ptr->state_ptr;
+    const auto *cached_ptr   = verify_state_ptr->header_bits;
+    const uint32_t header_bits = verify_state_ptr->header_bits_count;
+
+    if (0u == header_bits || ISAL_BLOCK_HDR == inflate_state.block_state || inflate_state.read_in_length < 0) {
+        return 0u;
+    }
+
+    const auto read_in_length = static_cast<uint32_t>(inflate_state.read_in_length);
+
+    if (read_in_length + static_cast<uint64_t>(inflate_state.avail_in) * byte_bits_size < header_bits) {
+        return 0u;
+    }
+
+    uint8_t header[ISAL_DEF_MAX_HDR_SIZE];
+    const uint32_t header_bytes = util::bit_to_byte(header_bits);
+
+    copy_stream_bits(inflate_state.read_in, read_in_length, inflate_state.next_in, header_bits, header);
+
+    if (((header[0] ^ cached_ptr[0]) & 0xFEu) || !std::equal(header + 1u, header + header_bytes, cached_ptr + 1u)) {
+        return 0u;
+    }
+
+    if (header_bits <= read_in_length) {
+        inflate_state.read_in        = (header_bits < 64u) ? inflate_state.read_in >> header_bits : 0u;
+        inflate_state.read_in_length = static_cast<int32_t>(read_in_length - header_bits);
+    } else {
+        const uint32_t stream_bits = header_bits - read_in_length;
+        const uint32_t rest_bits   = stream_bits & 7u;
+
+        inflate_state.next_in  += stream_bits >> 3u;
+        inflate_state.avail_in -= stream_bits >> 3u;
+
+        inflate_state.read_in        = 0u;
+        inflate_state.read_in_length = 0;
+
+        if (rest_bits) {
+            inflate_state.read_in        = *inflate_state.next_in >> rest_bits;
+            inflate_state.read_in_length = static_cast<int32_t>(byte_bits_size - rest_bits);
+            inflate_state.next_in++;
+            inflate_state.avail_in--;
+        }
+    }
+
+    inflate_state.bfinal      = header[0] & 1u;
+    inflate_state.block_state = ISAL_BLOCK_CODED;
+
+    return header_bits;
+}
+
 [[nodiscard]] inline auto verify_state<execution_path_t::software>::is_first() const noexcept -> bool {
     return is_first_;
 }
 
+[[nodiscard]] inline auto verify_state<execution_path_t::software>::is_crc_check_deferred() const noexcept -> bool {
+    return is_crc_check_deferred_;
+}
+
 [[nodiscard]] inline auto verify_state<execution_path_t::software>::get_input_data() const noexcept -> uint8_t * {
     return verify_state_ptr->state_ptr.next_in;
 }
@@ -19,9 +19,17 @@ auto verify_deflate_header(verify_state<execution_path_t::software> &state) noex
         return result;
     }
 
+    const uint32_t cached_header_bits = state.skip_cached_header();
+
+    if (cached_header_bits) {
+        result.bits_read = cached_header_bits;
+        return result;
+    }
+
     const uint32_t initial_bits_in_buffer = inflate_state.read_in_length;
     uint8_t *initial_next_in_ptr = inflate_state.next_in;
     uint64_t initial_read_in_buffer = inflate_state.read_in;
+    const bool is_header_split = (ISAL_BLOCK_HDR == inflate_state.block_state);
 
     parser_status_t parser_status = parser_status_t::ok;
 
@@ -49,6 +57,15 @@ auto verify_deflate_header(verify_state<execution_path_t::software> &state) noex
         } else {
             parser_status = parser_status_t::ok;
         }
+
+        if (ISAL_BLOCK_CODED == inflate_state.block_state) {
+            // The decoding tables are rebuilt, remember the header they are built for
+            if (is_header_split) {
+                state.reset_header_cache();
+            } else {
+                state.cache_header(initial_read_in_buffer, initial_bits_in_buffer, initial_next_in_ptr, actual_bits_read);
+            }
+        }
     } else {
         parser_status = parser_status_t::error;
     }
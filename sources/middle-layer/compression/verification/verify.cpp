@@ -93,9 +93,10 @@ auto perform_verification<execution_path_t::software, verification_mode_t::verif
         }
     }
 
-    if (verification_result.status == parser_status_t::final_end_of_block ||
-        verification_result.status == parser_status_t::end_of_block ||
-        verification_result.status == parser_status_t::end_of_mini_block) {
+    if (!state.is_crc_check_deferred() &&
+        (verification_result.status == parser_status_t::final_end_of_block ||
+         verification_result.status == parser_status_t::end_of_block ||
+         verification_result.status == parser_status_t::end_of_mini_block)) {
         if (state.get_state()->crc != state.get_required_crc()) {
             verification_result.status = parser_status_t::error;
         }
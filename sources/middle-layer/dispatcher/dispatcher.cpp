@@ -32,15 +32,34 @@ unsigned long long _xgetbv(unsigned int index) {
 
 #endif
 
-#define CPUID_AVX512F       0x00100000
-#define CPUID_AVX512CD      0x00200000
-#define CPUID_AVX512VL      0x04000000
-#define CPUID_AVX512BW      0x01000000
-#define CPUID_AVX512DQ      0x02000000
-#define EXC_OSXSAVE         0x08000000 // 27th  bit
+#define CPUID_BMI1          0x00000008 // 3rd bit of EBX, leaf 7
+#define CPUID_AVX2          0x00000020 // 5th bit of EBX, leaf 7
+#define CPUID_BMI2          0x00000100 // 8th bit of EBX, leaf 7
+#define CPUID_AVX512F       0x00010000 // 16th bit of EBX, leaf 7
+#define CPUID_AVX512DQ      0x00020000 // 17th bit of EBX, leaf 7
+#define CPUID_AVX512CD      0x10000000 // 28th bit of EBX, leaf 7
+#define CPUID_AVX512BW      0x40000000 // 30th bit of EBX, leaf 7
+#define CPUID_AVX512VL      0x80000000 // 31st bit of EBX, leaf 7
+#define EXC_FMA             0x00001000 // 12th bit of ECX, leaf 1
+#define EXC_MOVBE           0x00400000 // 22nd bit of ECX, leaf 1
+#define EXC_POPCNT          0x00800000 // 23rd bit of ECX, leaf 1
+#define EXC_OSXSAVE         0x08000000 // 27th bit of ECX, leaf 1
+#define EXC_AVX             0x10000000 // 28th bit of ECX, leaf 1
+#define EXC_F16C            0x20000000 // 29th bit of ECX, leaf 1
+#define EXC_LZCNT           0x00000020 // 5th bit of ECX, leaf 0x80000001
+
+#define CPUID_EXTENDED_INFO 0x80000001 // Extended features leaf, holds LZCNT
+
+// qplcore_avx2 is built for Haswell, so its kernels (and the code the compiler generates for them)
+// may use every extension of this generation, not only AVX2
+#define EXC_HASWELL_MASK    (EXC_FMA | EXC_MOVBE | EXC_POPCNT | EXC_AVX | EXC_F16C)
+#define CPUID_HASWELL_MASK  (CPUID_AVX2 | CPUID_BMI1 | CPUID_BMI2)
 
 #define CPUID_AVX512_MASK (CPUID_AVX512F | CPUID_AVX512CD | CPUID_AVX512VL | CPUID_AVX512BW | CPUID_AVX512DQ)
 
+#define XCR_YMM_STATE_MASK  0x06 // XMM and YMM state are enabled by OS
+#define XCR_ZMM_STATE_MASK  0xe0 // Opmask, ZMM_Hi256 and Hi16_ZMM states are enabled by OS
+
 namespace qpl::ml::dispatcher {
 class kernel_dispatcher_singleton
 {
@@ -53,66 +72,111 @@ public:
 static kernel_dispatcher_singleton g_kernel_dispatcher_singleton;
 
 extern unpack_table_t px_unpack_table;
+extern unpack_table_t avx2_unpack_table;
 extern unpack_table_t avx512_unpack_table;
 
 extern pack_index_table_t px_pack_index_table;
+extern pack_index_table_t avx2_pack_index_table;
 extern pack_index_table_t avx512_pack_index_table;
 
 extern unpack_prle_table_t px_unpack_prle_table;
+extern unpack_prle_table_t avx2_unpack_prle_table;
 extern unpack_prle_table_t avx512_unpack_prle_table;
 
 extern scan_i_table_t px_scan_i_table;
+extern scan_i_table_t avx2_scan_i_table;
 extern scan_i_table_t avx512_scan_i_table;
 
 extern scan_table_t px_scan_table;
+extern scan_table_t avx2_scan_table;
 extern scan_table_t avx512_scan_table;
 
+extern scan_packed_table_t px_scan_packed_table;
+extern scan_packed_table_t avx2_scan_packed_table;
+extern scan_packed_table_t avx512_scan_packed_table;
+
 extern pack_table_t px_pack_table;
+extern pack_table_t avx2_pack_table;
 extern pack_table_t avx512_pack_table;
 
 extern extract_table_t px_extract_table;
+extern extract_table_t avx2_extract_table;
 extern extract_table_t avx512_extract_table;
 
 extern extract_i_table_t px_extract_i_table;
+extern extract_i_table_t avx2_extract_i_table;
 extern extract_i_table_t avx512_extract_i_table;
 
 extern aggregates_table_t px_aggregates_table;
+extern aggregates_table_t avx2_aggregates_table;
 extern aggregates_table_t avx512_aggregates_table;
 
 extern find_unique_table_t px_find_unique_table;
+extern find_unique_table_t avx2_find_unique_table;
 extern find_unique_table_t avx512_find_unique_table;
 
 extern set_membership_i_table_t px_set_membership_i_table;
+extern set_membership_i_table_t avx2_set_membership_i_table;
 extern set_membership_i_table_t avx512_set_membership_i_table;
 
+extern set_membership_hash_table_t px_set_membership_hash_table;
+extern set_membership_hash_table_t avx2_set_membership_hash_table;
+extern set_membership_hash_table_t avx512_set_membership_hash_table;
+
 extern select_table_t px_select_table;
+extern select_table_t avx2_select_table;
 extern select_table_t avx512_select_table;
 
 extern select_i_table_t px_select_i_table;
+extern select_i_table_t avx2_select_i_table;
 extern select_i_table_t avx512_select_i_table;
 
 extern expand_table_t px_expand_table;
+extern expand_table_t avx2_expand_table;
 extern expand_table_t avx512_expand_table;
 
 extern expand_rle_table_t px_expand_rle_table;
+extern expand_rle_table_t avx2_expand_rle_table;
 extern expand_rle_table_t avx512_expand_rle_table;
 
+extern bitmap_logic_table_t px_bitmap_logic_table;
+extern bitmap_logic_table_t avx2_bitmap_logic_table;
+extern bitmap_logic_table_t avx512_bitmap_logic_table;
+
+extern bitmap_not_table_t px_bitmap_not_table;
+extern bitmap_not_table_t avx2_bitmap_not_table;
+extern bitmap_not_table_t avx512_bitmap_not_table;
+
+extern bitmap_popcount_table_t px_bitmap_popcount_table;
+extern bitmap_popcount_table_t avx2_bitmap_popcount_table;
+extern bitmap_popcount_table_t avx512_bitmap_popcount_table;
+
+extern bitmap_find_table_t px_bitmap_find_table;
+extern bitmap_find_table_t avx2_bitmap_find_table;
+extern bitmap_find_table_t avx512_bitmap_find_table;
+
 extern memory_copy_table_t px_memory_copy_table;
+extern memory_copy_table_t avx2_memory_copy_table;
 extern memory_copy_table_t avx512_memory_copy_table;
 
 extern zero_table_t px_zero_table;
+extern zero_table_t avx2_zero_table;
 extern zero_table_t avx512_zero_table;
 
 extern move_table_t px_move_table;
+extern move_table_t avx2_move_table;
 extern move_table_t avx512_move_table;
 
 extern crc64_table_t px_crc64_table;
+extern crc64_table_t avx2_crc64_table;
 extern crc64_table_t avx512_crc64_table;
 
 extern xor_checksum_table_t px_xor_checksum_table;
+extern xor_checksum_table_t avx2_xor_checksum_table;
 extern xor_checksum_table_t avx512_xor_checksum_table;
 
 extern zero_compress_table_t px_zero_compress_table;
+extern zero_compress_table_t avx2_zero_compress_table;
 extern zero_compress_table_t avx512_zero_compress_table;
 
 extern deflate_table_t px_deflate_table;
@@ -128,18 +192,41 @@ extern setup_dictionary_table_t avx512_setup_dictionary_table;
 auto detect_platform() -> arch_t {
     arch_t detected_platform = arch_t::px_arch;
     int    cpu_info[4];
+    cpuid(cpu_info, 0);
+
+    if (cpu_info[0] < 7) { // Leaf 7 with AVX2 and BMI flags is not available
+        return detected_platform;
+    }
+
     cpuid(cpu_info, 1);
 
-    bool avx512_support_cpu   = cpu_info[1] & CPUID_AVX512_MASK;
     bool os_uses_XSAVE_XSTORE = cpu_info[2] & EXC_OSXSAVE;
+    bool haswell_support_cpu  = (cpu_info[2] & EXC_HASWELL_MASK) == EXC_HASWELL_MASK;
+
+    cpuid(cpu_info, 7);
+
+    bool avx2_support_cpu   = haswell_support_cpu && (cpu_info[1] & CPUID_HASWELL_MASK) == CPUID_HASWELL_MASK;
+    bool avx512_support_cpu = (cpu_info[1] & CPUID_AVX512_MASK) == CPUID_AVX512_MASK;
+
+    cpuid(cpu_info, static_cast<int>(0x80000000u));
 
-    if (avx512_support_cpu && os_uses_XSAVE_XSTORE) {
+    if (static_cast<unsigned int>(cpu_info[0]) >= CPUID_EXTENDED_INFO) {
+        cpuid(cpu_info, static_cast<int>(CPUID_EXTENDED_INFO));
+
+        avx2_support_cpu = avx2_support_cpu && (cpu_info[2] & EXC_LZCNT);
+    } else {
+        avx2_support_cpu = false;
+    }
+
+    if (avx2_support_cpu && os_uses_XSAVE_XSTORE) {
         // Check if XMM state and YMM state are saved
         unsigned long long xcr_feature_mask = _xgetbv(0);
 
-        if ((xcr_feature_mask & 0x6) == 0x6) // AVX2 is supported now
+        if ((xcr_feature_mask & XCR_YMM_STATE_MASK) == XCR_YMM_STATE_MASK) // AVX2 is supported now
         {
-            if ((xcr_feature_mask & 0xe0) == 0xe0) // AVX512 is supported now
+            detected_platform = arch_t::avx2_arch;
+
+            if (avx512_support_cpu && (xcr_feature_mask & XCR_ZMM_STATE_MASK) == XCR_ZMM_STATE_MASK) // AVX512 is supported now
             {
                 detected_platform = arch_t::avx512_arch;
             }
@@ -320,6 +407,10 @@ auto kernels_dispatcher::get_scan_table() const noexcept -> const scan_table_t &
     return *scan_table_ptr_;
 }
 
+auto kernels_dispatcher::get_scan_packed_table() const noexcept -> const scan_packed_table_t & {
+    return *scan_packed_table_ptr_;
+}
+
 auto kernels_dispatcher::get_aggregates_table() const noexcept -> const aggregates_table_t & {
     return *aggregates_table_ptr_;
 }
@@ -340,6 +431,10 @@ auto kernels_dispatcher::get_set_membership_i_table() const noexcept -> const se
     return *set_membership_i_table_ptr_;
 }
 
+auto kernels_dispatcher::get_set_membership_hash_table() const noexcept -> const set_membership_hash_table_t & {
+    return *set_membership_hash_table_ptr_;
+}
+
 auto kernels_dispatcher::get_select_table() const noexcept -> const select_table_t & {
     return *select_table_ptr_;
 }
@@ -348,6 +443,22 @@ auto kernels_dispatcher::get_select_i_table() const noexcept -> const select_i_t
     return *select_i_table_ptr_;
 }
 
+auto kernels_dispatcher::get_bitmap_logic_table() const noexcept -> const bitmap_logic_table_t & {
+    return *bitmap_logic_table_ptr_;
+}
+
+auto kernels_dispatcher::get_bitmap_not_table() const noexcept -> const bitmap_not_table_t & {
+    return *bitmap_not_table_ptr_;
+}
+
+auto kernels_dispatcher::get_bitmap_popcount_table() const noexcept -> const bitmap_popcount_table_t & {
+    return *bitmap_popcount_table_ptr_;
+}
+
+auto kernels_dispatcher::get_bitmap_find_table() const noexcept -> const bitmap_find_table_t & {
+    return *bitmap_find_table_ptr_;
+}
+
 auto kernels_dispatcher::get_memory_copy_table() const noexcept -> const memory_copy_table_t & {
     return *memory_copy_table_ptr_;
 }
@@ -405,15 +516,21 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             pack_table_ptr_                  = &avx512_pack_table;
             scan_i_table_ptr_                = &avx512_scan_i_table;
             scan_table_ptr_                  = &avx512_scan_table;
+            scan_packed_table_ptr_           = &avx512_scan_packed_table;
             extract_table_ptr_               = &avx512_extract_table;
             extract_i_table_ptr_             = &avx512_extract_i_table;
             aggregates_table_ptr_            = &avx512_aggregates_table;
             find_unique_table_ptr_           = &avx512_find_unique_table;
             set_membership_i_table_ptr_      = &avx512_set_membership_i_table;
+            set_membership_hash_table_ptr_   = &avx512_set_membership_hash_table;
             select_table_ptr_                = &avx512_select_table;
             select_i_table_ptr_              = &avx512_select_i_table;
             expand_table_ptr_                = &avx512_expand_table;
             expand_rle_table_ptr_            = &avx512_expand_rle_table;
+            bitmap_logic_table_ptr_          = &avx512_bitmap_logic_table;
+            bitmap_not_table_ptr_            = &avx512_bitmap_not_table;
+            bitmap_popcount_table_ptr_       = &avx512_bitmap_popcount_table;
+            bitmap_find_table_ptr_           = &avx512_bitmap_find_table;
             memory_copy_table_ptr_           = &avx512_memory_copy_table;
             zero_table_ptr_                  = &avx512_zero_table;
             move_table_ptr_                  = &avx512_move_table;
@@ -425,6 +542,40 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             setup_dictionary_table_ptr_      = &avx512_setup_dictionary_table;
             break;
         }
+        case arch_t::avx2_arch: {
+            unpack_table_ptr_                = &avx2_unpack_table;
+            unpack_prle_table_ptr_           = &avx2_unpack_prle_table;
+            pack_index_table_ptr_            = &avx2_pack_index_table;
+            pack_table_ptr_                  = &avx2_pack_table;
+            scan_i_table_ptr_                = &avx2_scan_i_table;
+            scan_table_ptr_                  = &avx2_scan_table;
+            scan_packed_table_ptr_           = &avx2_scan_packed_table;
+            extract_table_ptr_               = &avx2_extract_table;
+            extract_i_table_ptr_             = &avx2_extract_i_table;
+            aggregates_table_ptr_            = &avx2_aggregates_table;
+            find_unique_table_ptr_           = &avx2_find_unique_table;
+            set_membership_i_table_ptr_      = &avx2_set_membership_i_table;
+            set_membership_hash_table_ptr_   = &avx2_set_membership_hash_table;
+            select_table_ptr_                = &avx2_select_table;
+            select_i_table_ptr_              = &avx2_select_i_table;
+            expand_table_ptr_                = &avx2_expand_table;
+            expand_rle_table_ptr_            = &avx2_expand_rle_table;
+            bitmap_logic_table_ptr_          = &avx2_bitmap_logic_table;
+            bitmap_not_table_ptr_            = &avx2_bitmap_not_table;
+            bitmap_popcount_table_ptr_       = &avx2_bitmap_popcount_table;
+            bitmap_find_table_ptr_           = &avx2_bitmap_find_table;
+            memory_copy_table_ptr_           = &avx2_memory_copy_table;
+            zero_table_ptr_                  = &avx2_zero_table;
+            move_table_ptr_                  = &avx2_move_table;
+            crc64_table_ptr_                 = &avx2_crc64_table;
+            xor_checksum_table_ptr_          = &avx2_xor_checksum_table;
+            zero_compress_table_ptr_         = &avx2_zero_compress_table;
+            // Compression kernels have no AVX2 flavor
+            deflate_table_ptr_               = &px_deflate_table;
+            deflate_fix_table_ptr_           = &px_deflate_fix_table;
+            setup_dictionary_table_ptr_      = &px_setup_dictionary_table;
+            break;
+        }
         default: {
             unpack_table_ptr_                = &px_unpack_table;
             unpack_prle_table_ptr_           = &px_unpack_prle_table;
@@ -432,15 +583,21 @@ kernels_dispatcher::kernels_dispatcher() noexcept {
             pack_table_ptr_                  = &px_pack_table;
             scan_i_table_ptr_                = &px_scan_i_table;
             scan_table_ptr_                  = &px_scan_table;
+            scan_packed_table_ptr_           = &px_scan_packed_table;
             extract_table_ptr_               = &px_extract_table;
             extract_i_table_ptr_             = &px_extract_i_table;
             aggregates_table_ptr_            = &px_aggregates_table;
             find_unique_table_ptr_           = &px_find_unique_table;
             set_membership_i_table_ptr_      = &px_set_membership_i_table;
+            set_membership_hash_table_ptr_   = &px_set_membership_hash_table;
             select_table_ptr_                = &px_select_table;
             select_i_table_ptr_              = &px_select_i_table;
             expand_table_ptr_                = &px_expand_table;
             expand_rle_table_ptr_            = &px_expand_rle_table;
+            bitmap_logic_table_ptr_          = &px_bitmap_logic_table;
+            bitmap_not_table_ptr_            = &px_bitmap_not_table;
+            bitmap_popcount_table_ptr_       = &px_bitmap_popcount_table;
+            bitmap_find_table_ptr_           = &px_bitmap_find_table;
             memory_copy_table_ptr_           = &px_memory_copy_table;
             zero_table_ptr_                  = &px_zero_table;
             move_table_ptr_                  = &px_move_table;
@@ -24,6 +24,7 @@
 #include "qplc_rle_burst.h"
 #include "qplc_checksum.h"
 #include "qplc_zero_compression.h"
+#include "qplc_bitmap.h"
 
 #define OWN_MIN_(a, b) (a < b) ? a : b
 
@@ -74,6 +75,7 @@ using unpack_prle_table_t = std::array<qplc_unpack_prle_t_ptr, 3>;
 
 using scan_i_table_t = std::array<qplc_scan_i_t_ptr, 24>;
 using scan_table_t = std::array<qplc_scan_t_ptr, 24>;
+using scan_packed_table_t = std::array<qplc_scan_packed_t_ptr, 2>;
 
 using pack_table_t = std::array<qplc_pack_bits_t_ptr, 70>;
 
@@ -85,6 +87,7 @@ using aggregates_table_t = std::array<qplc_aggregates_t_ptr, 4>;
 using find_unique_table_t = std::array<qplc_find_unique_t_ptr, 3>;
 
 using set_membership_i_table_t = std::array<qplc_set_membership_i_t_ptr, 3>;
+using set_membership_hash_table_t = std::array<qplc_set_membership_hash_t_ptr, 2>;
 
 using select_table_t = std::array<qplc_select_t_ptr, 3>;
 using select_i_table_t = std::array<qplc_select_i_t_ptr, 3>;
@@ -92,6 +95,11 @@ using select_i_table_t = std::array<qplc_select_i_t_ptr, 3>;
 using expand_table_t = std::array<qplc_expand_t_ptr, 3>;
 using expand_rle_table_t = std::array<qplc_rle_burst_t_ptr, 9>;
 
+using bitmap_logic_table_t = std::array<qplc_bitmap_logic_t_ptr, 4>;
+using bitmap_not_table_t = std::array<qplc_bitmap_not_t_ptr, 1>;
+using bitmap_popcount_table_t = std::array<qplc_bitmap_popcount_t_ptr, 1>;
+using bitmap_find_table_t = std::array<qplc_bitmap_find_t_ptr, 2>;
+
 using memory_copy_table_t = std::array<qplc_copy_t_ptr, 3>;
 using zero_table_t = std::array<qplc_zero_t_ptr, 1>;
 using move_table_t = std::array<qplc_move_t_ptr, 1>;
@@ -101,7 +109,7 @@ using xor_checksum_table_t = std::array<qplc_xor_checksum_t_ptr, 1>;
 
 using zero_compress_table_t = std::array<qplc_zero_compress_t_ptr, 4u>;
 
-using deflate_table_t = std::array<void*, 3u>;
+using deflate_table_t = std::array<void*, 4u>;
 
 using deflate_fix_table_t = std::array<void*, 1u>;
 
@@ -110,6 +118,7 @@ using setup_dictionary_table_t = std::array<void*, 1u>;
 using aggregates_function_ptr_t = aggregates_table_t::value_type;
 using extract_function_ptr_t    = extract_table_t::value_type;
 using scan_function_ptr         = scan_table_t::value_type;
+using scan_packed_function_ptr  = scan_packed_table_t::value_type;
 
 class kernels_dispatcher final {
 public:
@@ -133,6 +142,8 @@ public:
 
     [[nodiscard]] auto get_scan_table() const noexcept -> const scan_table_t &;
 
+    [[nodiscard]] auto get_scan_packed_table() const noexcept -> const scan_packed_table_t &;
+
     [[nodiscard]] auto get_extract_table() const noexcept -> const extract_table_t &;
 
     [[nodiscard]] auto get_extract_i_table() const noexcept -> const extract_i_table_t &;
@@ -141,6 +152,8 @@ public:
 
     [[nodiscard]] auto get_set_membership_i_table() const noexcept -> const set_membership_i_table_t &;
 
+    [[nodiscard]] auto get_set_membership_hash_table() const noexcept -> const set_membership_hash_table_t &;
+
     [[nodiscard]] auto get_select_table() const noexcept -> const select_table_t &;
 
     [[nodiscard]] auto get_select_i_table() const noexcept -> const select_i_table_t &;
@@ -149,6 +162,14 @@ public:
 
     [[nodiscard]] auto get_expand_rle_table() const noexcept -> const expand_rle_table_t &;
 
+    [[nodiscard]] auto get_bitmap_logic_table() const noexcept -> const bitmap_logic_table_t &;
+
+    [[nodiscard]] auto get_bitmap_not_table() const noexcept -> const bitmap_not_table_t &;
+
+    [[nodiscard]] auto get_bitmap_popcount_table() const noexcept -> const bitmap_popcount_table_t &;
+
+    [[nodiscard]] auto get_bitmap_find_table() const noexcept -> const bitmap_find_table_t &;
+
     [[nodiscard]] auto get_memory_copy_table() const noexcept -> const memory_copy_table_t &;
 
     [[nodiscard]] auto get_zero_table() const noexcept -> const zero_table_t &;
@@ -177,15 +198,21 @@ private:
     pack_table_t                    *pack_table_ptr_                    = nullptr;
     scan_i_table_t                  *scan_i_table_ptr_                  = nullptr;
     scan_table_t                    *scan_table_ptr_                    = nullptr;
+    scan_packed_table_t             *scan_packed_table_ptr_             = nullptr;
     extract_table_t                 *extract_table_ptr_                 = nullptr;
     extract_i_table_t               *extract_i_table_ptr_               = nullptr;
     aggregates_table_t              *aggregates_table_ptr_              = nullptr;
     find_unique_table_t             *find_unique_table_ptr_             = nullptr;
     set_membership_i_table_t        *set_membership_i_table_ptr_        = nullptr;
+    set_membership_hash_table_t     *set_membership_hash_table_ptr_     = nullptr;
     select_table_t                  *select_table_ptr_                  = nullptr;
     select_i_table_t                *select_i_table_ptr_                = nullptr;
     expand_table_t                  *expand_table_ptr_                  = nullptr;
     expand_rle_table_t              *expand_rle_table_ptr_              = nullptr;
+    bitmap_logic_table_t            *bitmap_logic_table_ptr_            = nullptr;
+    bitmap_not_table_t              *bitmap_not_table_ptr_              = nullptr;
+    bitmap_popcount_table_t         *bitmap_popcount_table_ptr_         = nullptr;
+    bitmap_find_table_t             *bitmap_find_table_ptr_             = nullptr;
     memory_copy_table_t             *memory_copy_table_ptr_             = nullptr;
     zero_table_t                    *zero_table_ptr_                    = nullptr;
     move_table_t                    *move_table_ptr_                    = nullptr;
@@ -47,23 +47,31 @@ void hw_device::fill_hw_context(hw_accelerator_context *const hw_context_ptr) co
     hw_context_ptr->device_properties.block_on_fault_enabled        = hw_device::get_block_on_fault_available();
 }
 
-auto hw_device::enqueue_descriptor(void *desc_ptr) const noexcept -> bool {
-    uint8_t retry = 0u;
-    static thread_local std::uint32_t wq_idx = 0;
-
-    // For small low-latency cases WQ with small transfer size may be preferable
-    // TODO: order WQs by priority and engines capacity, check transfer sizes and other possible features
-    for (uint64_t try_count = 0u; try_count < queue_count_; ++try_count) {
-        hw_iaa_descriptor_set_block_on_fault((hw_descriptor *) desc_ptr, working_queues_[wq_idx].get_block_on_fault());
-
-        retry = working_queues_[wq_idx].enqueue_descriptor(desc_ptr);
-        wq_idx = (wq_idx+1) % queue_count_;
-        if (!retry) {
-            break;
-        }
-    }
+auto hw_device::enqueue_descriptor(void *desc_ptr, size_t queue_idx) const noexcept -> bool {
+    const auto &queue = working_queues_[queue_idx];
+
+    hw_iaa_descriptor_hint_cpu_cache_as_destination((hw_descriptor *) desc_ptr, get_cache_write_available());
+    hw_iaa_descriptor_set_block_on_fault((hw_descriptor *) desc_ptr, queue.get_block_on_fault());
+
+    return static_cast<bool>(queue.enqueue_descriptor(desc_ptr));
+}
+
+void hw_device::retire_descriptor(size_t queue_idx) const noexcept {
+    working_queues_[queue_idx].retire_descriptor();
+}
+
+auto hw_device::get_queue_state(size_t queue_idx) const noexcept -> hw_queue_state_t {
+    const auto &queue = working_queues_[queue_idx];
+
+    hw_queue_state_t state{};
+
+    state.numa_id           = numa_node_id_;
+    state.outstanding_count = queue.get_outstanding_count();
+    state.size              = queue.get_size();
+    state.max_transfer_size = queue.get_max_transfer_size();
+    state.priority          = queue.priority();
 
-    return static_cast<bool>(retry);
+    return state;
 }
 
 auto hw_device::get_max_set_size() const noexcept -> uint32_t {
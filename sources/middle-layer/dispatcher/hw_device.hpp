@@ -13,6 +13,7 @@
 
 #include "qpl/c_api/defs.h"
 #include "hw_queue.hpp"
+#include "hw_selection_policy.hpp"
 #include "hw_devices.h"
 #include "hw_status.h"
 
@@ -33,7 +34,11 @@ public:
 
     void fill_hw_context(hw_accelerator_context *hw_context_ptr) const noexcept;
 
-    [[nodiscard]] auto enqueue_descriptor(void *desc_ptr) const noexcept -> bool;
+    [[nodiscard]] auto enqueue_descriptor(void *desc_ptr, size_t queue_idx) const noexcept -> bool;
+
+    void retire_descriptor(size_t queue_idx) const noexcept;
+
+    [[nodiscard]] auto get_queue_state(size_t queue_idx) const noexcept -> hw_queue_state_t;
 
     [[nodiscard]] auto initialize_new_device(descriptor_t *device_descriptor_ptr) noexcept -> hw_accelerator_status;
 
@@ -13,28 +13,57 @@
 
 #if defined( linux )
 
+#include <algorithm>
+#include <bitset>
+
+#include "hw_definitions.h"
+#include "dispatcher/numa.hpp"
+
 #endif
 
 #define QPL_HWSTS_RET(expr, err_code) { if( expr ) { return( err_code ); }}
 
 namespace qpl::ml::dispatcher {
+
+#if defined( linux )
+
+/**
+ * @brief Checks whether the device passes the restrictions of the options
+ */
+static auto is_device_requested(accfg_dev *device_ptr, const hw_dispatcher_options_t &options) noexcept -> bool {
+    if (-1 != options.numa_id && static_cast<uint64_t>(options.numa_id) != hw_device_get_numa_node(device_ptr)) {
+        return false;
+    }
+
+    if (nullptr == options.device_ids_ptr) {
+        return true;
+    }
+
+    const auto device_id   = static_cast<uint32_t>(hw_device_get_id(device_ptr));
+    const auto *ids_end_ptr = options.device_ids_ptr + options.device_ids_count;
+
+    return ids_end_ptr != std::find(options.device_ids_ptr, ids_end_ptr, device_id);
+}
+
+#endif
+
+/**
+ * @brief Constructs the dispatcher while the library is loaded, as the library is built without thread-safe statics,
+ *        the hardware itself is discovered on the first use
+ */
 class hw_dispatcher_singleton
 {
 public:
     hw_dispatcher_singleton()
     {
-        (void)hw_dispatcher::get_instance();
+        (void)hw_dispatcher::get_uninitialized_instance();
     }
 };
 static hw_dispatcher_singleton g_hw_dispatcher_singleton;
 
+hw_dispatcher::hw_dispatcher() noexcept = default;
 
-hw_dispatcher::hw_dispatcher() noexcept {
-    hw_init_status_ = hw_dispatcher::initialize_hw();
-    hw_support_     = hw_init_status_ == HW_ACCELERATOR_STATUS_OK;
-}
-
-auto hw_dispatcher::initialize_hw() noexcept -> hw_accelerator_status {
+auto hw_dispatcher::initialize_hw(const hw_dispatcher_options_t &options) noexcept -> hw_accelerator_status {
 #if defined( linux )
     accfg_ctx *ctx_ptr = nullptr;
 
@@ -47,13 +76,16 @@ auto hw_dispatcher::initialize_hw() noexcept -> hw_accelerator_status {
     int32_t context_creation_status = hw_driver_new_context(&ctx_ptr);
     QPL_HWSTS_RET(0u != context_creation_status, HW_ACCELERATOR_LIBACCEL_ERROR);
 
+    hw_context_.set_driver_context_ptr(ctx_ptr);
+
     // Retrieve first device in the system given the passed in context
     DIAG("enumerating devices\n");
     auto *dev_tmp_ptr = hw_context_get_first_device(ctx_ptr);
     auto device_it    = devices_.begin();
 
     while (nullptr != dev_tmp_ptr) {
-        if (HW_ACCELERATOR_STATUS_OK == device_it->initialize_new_device(dev_tmp_ptr)) {
+        if (is_device_requested(dev_tmp_ptr, options) &&
+            HW_ACCELERATOR_STATUS_OK == device_it->initialize_new_device(dev_tmp_ptr)) {
             device_it++;
         }
 
@@ -67,8 +99,6 @@ auto hw_dispatcher::initialize_hw() noexcept -> hw_accelerator_status {
         return HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE; // No devices -> No WQ
     }
 
-    hw_context_.set_driver_context_ptr(ctx_ptr);
-
     return HW_ACCELERATOR_STATUS_OK;
 #else
     // Windows is not supported
@@ -76,8 +106,15 @@ auto hw_dispatcher::initialize_hw() noexcept -> hw_accelerator_status {
 #endif
 }
 
-hw_dispatcher::~hw_dispatcher() noexcept {
+void hw_dispatcher::release_hw() noexcept {
 #if defined( linux )
+    // Unmap portals and stop emulated work queues before the driver is unloaded
+    for (size_t i = 0u; i < device_count_; i++) {
+        devices_[i] = hw_device{};
+    }
+
+    device_count_ = 0u;
+
     // Variables
     auto *context_ptr = hw_context_.get_driver_context_ptr();
 
@@ -90,14 +127,64 @@ hw_dispatcher::~hw_dispatcher() noexcept {
     // Zeroing values
     hw_context_.set_driver_context_ptr(nullptr);
 #endif
+
+    hw_support_     = false;
+    hw_init_status_ = HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
 }
 
-auto hw_dispatcher::get_instance() noexcept -> hw_dispatcher & {
+void hw_dispatcher::reinitialize(const hw_dispatcher_options_t &options) noexcept {
+    release_hw();
+
+    hw_init_status_ = initialize_hw(options);
+    hw_support_     = hw_init_status_ == HW_ACCELERATOR_STATUS_OK;
+
+    is_initialized_.store(true, std::memory_order_release);
+}
+
+hw_dispatcher::~hw_dispatcher() noexcept {
+    release_hw();
+}
+
+auto hw_dispatcher::get_uninitialized_instance() noexcept -> hw_dispatcher & {
     static hw_dispatcher instance{};
 
     return instance;
 }
 
+auto hw_dispatcher::get_instance() noexcept -> hw_dispatcher & {
+    auto &instance = get_uninitialized_instance();
+
+    // Hardware is discovered on the first use, so processes that use the software path only don't pay for it
+    if (!instance.is_initialized_.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(instance.init_mutex_);
+
+        if (!instance.is_initialized_.load(std::memory_order_relaxed)) {
+            instance.reinitialize(hw_dispatcher_options_t{});
+        }
+    }
+
+    return instance;
+}
+
+auto hw_dispatcher::initialize(const hw_dispatcher_options_t &options) noexcept -> hw_accelerator_status {
+    auto &instance = get_uninitialized_instance();
+
+    std::lock_guard<std::mutex> lock(instance.init_mutex_);
+
+    instance.reinitialize(options);
+
+    return instance.hw_init_status_;
+}
+
+void hw_dispatcher::finalize() noexcept {
+    auto &instance = get_uninitialized_instance();
+
+    std::lock_guard<std::mutex> lock(instance.init_mutex_);
+
+    instance.is_initialized_.store(false, std::memory_order_release);
+    instance.release_hw();
+}
+
 void hw_dispatcher::fill_hw_context(hw_accelerator_context *const hw_context_ptr) noexcept {
 #if defined( linux )
     // Restore context
@@ -135,6 +222,107 @@ auto hw_dispatcher::device(size_t idx) const noexcept -> const hw_device & {
     return devices_[idx % device_count_];
 }
 
+namespace {
+
+const hw_load_aware_policy default_selection_policy{};
+
+} // anonymous namespace
+
+auto hw_dispatcher::enqueue_descriptor(void *desc_ptr,
+                                       int32_t numa_id,
+                                       uint32_t *queue_tag_ptr) const noexcept -> hw_accelerator_status {
+    static thread_local uint32_t rotation = 0u;
+
+    *queue_tag_ptr = 0u;
+
+    if (0u == device_count_) {
+        return HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
+    }
+
+    const auto *policy_ptr = selection_policy_ptr_.load(std::memory_order_acquire);
+
+    if (nullptr == policy_ptr) {
+        policy_ptr = &default_selection_policy;
+    }
+
+    hw_submission_t submission{};
+
+    submission.numa_id        = (-1 == numa_id) ? static_cast<uint64_t>(util::get_numa_id())
+                                                : static_cast<uint64_t>(numa_id);
+    submission.is_numa_strict = (-1 != numa_id);
+    submission.transfer_size  = reinterpret_cast<hw_iaa_analytics_descriptor *>(desc_ptr)->src1_size;
+
+    // Equally ranked work queues are used in turns
+    const uint32_t start = rotation++;
+
+    std::bitset<MAX_NUM_DEV * MAX_NUM_WQ> is_rejected;
+
+    auto result = HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
+
+    while (true) {
+        uint64_t best_rank       = hw_selection_policy::not_eligible;
+        size_t   best_device_idx = 0u;
+        size_t   best_queue_idx  = 0u;
+
+        for (size_t i = 0u; i < device_count_; i++) {
+            const size_t device_idx = (start + i) % device_count_;
+            const auto   &device    = devices_[device_idx];
+
+            for (size_t j = 0u; j < device.size(); j++) {
+                const size_t queue_idx = (start + j) % device.size();
+
+                if (is_rejected[device_idx * MAX_NUM_WQ + queue_idx]) {
+                    continue;
+                }
+
+                const auto rank = policy_ptr->rank(device.get_queue_state(queue_idx), submission);
+
+                if (rank < best_rank) {
+                    best_rank       = rank;
+                    best_device_idx = device_idx;
+                    best_queue_idx  = queue_idx;
+                }
+            }
+        }
+
+        if (hw_selection_policy::not_eligible == best_rank) {
+            return result;
+        }
+
+        const auto queue_id = static_cast<uint32_t>(best_device_idx * MAX_NUM_WQ + best_queue_idx);
+
+        if (!devices_[best_device_idx].enqueue_descriptor(desc_ptr, best_queue_idx)) {
+            *queue_tag_ptr = queue_id + 1u;
+
+            return HW_ACCELERATOR_STATUS_OK;
+        }
+
+        is_rejected[queue_id] = true;
+        result = HW_ACCELERATOR_WQ_IS_BUSY;
+    }
+}
+
+void hw_dispatcher::retire_descriptor(uint32_t *queue_tag_ptr) const noexcept {
+    const auto tag = *queue_tag_ptr;
+
+    if (0u == tag) {
+        return;
+    }
+
+    const size_t device_idx = (tag - 1u) / MAX_NUM_WQ;
+    const size_t queue_idx  = (tag - 1u) % MAX_NUM_WQ;
+
+    *queue_tag_ptr = 0u;
+
+    if (device_idx < device_count_ && queue_idx < devices_[device_idx].size()) {
+        devices_[device_idx].retire_descriptor(queue_idx);
+    }
+}
+
+void hw_dispatcher::set_selection_policy(const hw_selection_policy *policy_ptr) noexcept {
+    selection_policy_ptr_.store(policy_ptr, std::memory_order_release);
+}
+
 void hw_dispatcher::hw_context::set_driver_context_ptr(accfg_ctx *driver_context_ptr) noexcept {
     driver_context_ptr_ = driver_context_ptr;
 }
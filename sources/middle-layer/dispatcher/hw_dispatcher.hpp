@@ -10,10 +10,12 @@
 #include <array>
 #include <cstdint>
 #include <atomic>
+#include <mutex>
 
 #include "hw_devices.h"
 #include "hw_status.h"
 #include "hw_device.hpp"
+#include "hw_selection_policy.hpp"
 #include "qpl/c_api/defs.h"
 
 #if defined(linux )
@@ -24,7 +26,17 @@
 
 namespace qpl::ml::dispatcher {
 
+/**
+ * @brief Restricts the set of devices discovered by @ref hw_dispatcher
+ */
+struct hw_dispatcher_options_t {
+    int32_t        numa_id          = -1;         /**< NUMA node of the devices, -1 for devices of all nodes */
+    const uint32_t *device_ids_ptr  = nullptr;    /**< IDs of the devices (1 for iax1), nullptr for all devices */
+    uint32_t       device_ids_count = 0u;         /**< Number of the device IDs */
+};
+
 class hw_dispatcher final {
+    friend class hw_dispatcher_singleton;
 
     static constexpr uint32_t max_devices = MAX_NUM_DEV;
 
@@ -46,8 +58,26 @@ class hw_dispatcher final {
 
 public:
 
+    /**
+     * @brief Returns the dispatcher, the hardware is discovered with the default options on the first call
+     *        or the first call after @ref finalize
+     */
     static auto get_instance() noexcept -> hw_dispatcher &;
 
+    /**
+     * @brief Discovers the hardware with the given options, releasing the previously discovered one
+     *
+     * @note Must not be called while hardware jobs are in flight
+     */
+    static auto initialize(const hw_dispatcher_options_t &options) noexcept -> hw_accelerator_status;
+
+    /**
+     * @brief Releases the discovered hardware, the next @ref get_instance discovers it again
+     *
+     * @note Must not be called while hardware jobs are in flight
+     */
+    static void finalize() noexcept;
+
     [[nodiscard]] auto is_hw_support() const noexcept -> bool;
 
     [[nodiscard]] auto get_hw_init_status() const noexcept -> hw_accelerator_status;
@@ -64,6 +94,38 @@ public:
 
     [[nodiscard]] auto device(size_t idx) const noexcept -> const hw_device &;
 
+    /**
+     * @brief Enqueues the descriptor to the work queue chosen by the selection policy
+     *
+     * @details If the chosen work queue rejects the descriptor, the next one is tried until every eligible
+     *          work queue has rejected it. The work queue is returned as the tag kept by the caller,
+     *          so the descriptor can be retired with @ref retire_descriptor once its completion record is written.
+     *          The descriptor itself is not modified.
+     *
+     * @param desc_ptr       pointer to the descriptor
+     * @param numa_id        NUMA node of the devices to use, -1 prefers the current node and allows the others
+     * @param queue_tag_ptr  receives the tag of the work queue, 0 if the descriptor was not enqueued
+     */
+    [[nodiscard]] auto enqueue_descriptor(void *desc_ptr,
+                                          int32_t numa_id,
+                                          uint32_t *queue_tag_ptr) const noexcept -> hw_accelerator_status;
+
+    /**
+     * @brief Removes the completed descriptor from the outstanding descriptors of its work queue
+     *
+     * @param queue_tag_ptr  tag returned by @ref enqueue_descriptor, reset to 0
+     *
+     * @note Retiring the tag again or retiring the tag of a descriptor that was not enqueued has no effect
+     */
+    void retire_descriptor(uint32_t *queue_tag_ptr) const noexcept;
+
+    /**
+     * @brief Replaces the work queue selection policy, nullptr restores the default @ref hw_load_aware_policy
+     *
+     * @note The policy must outlive its use by the dispatcher
+     */
+    void set_selection_policy(const hw_selection_policy *policy_ptr) noexcept;
+
 #endif
 
     virtual ~hw_dispatcher() noexcept;
@@ -71,7 +133,13 @@ public:
 protected:
     hw_dispatcher() noexcept;
 
-    auto initialize_hw() noexcept -> hw_accelerator_status;
+    static auto get_uninitialized_instance() noexcept -> hw_dispatcher &;
+
+    auto initialize_hw(const hw_dispatcher_options_t &options) noexcept -> hw_accelerator_status;
+
+    void release_hw() noexcept;
+
+    void reinitialize(const hw_dispatcher_options_t &options) noexcept;
 
 private:
 #if defined( linux )
@@ -79,10 +147,15 @@ private:
     hw_driver_t        hw_driver_{};
     device_container_t devices_{};
     size_t             device_count_      = 0;
+
+    std::atomic<const hw_selection_policy *> selection_policy_ptr_{nullptr}; /**< nullptr for the default policy */
 #endif
 
-    bool                  hw_support_;
-    hw_accelerator_status hw_init_status_;
+    bool                  hw_support_     = false;
+    hw_accelerator_status hw_init_status_ = HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
+
+    std::mutex        init_mutex_;                  /**< Serializes the hardware discovery and release */
+    std::atomic<bool> is_initialized_ = false;      /**< Hardware is discovered */
 };
 
 }
@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#if defined( linux ) && defined( QPL_HW_EMULATOR )
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+#include "hw_emulated_portal.hpp"
+#include "hw_completion_record_api.h"
+#include "hw_iaa_flags.h"
+#include "hw_status.h"
+#include "dispatcher/dispatcher.hpp"
+#include "util/checksum.hpp"
+
+namespace qpl::ml::dispatcher {
+
+namespace {
+
+// Operation codes and flags of the descriptors, see Intel® In-Memory Analytics Accelerator specification
+constexpr uint32_t opcode_shift       = 24u;
+constexpr uint32_t opcode_memory_copy = 0x03u;
+constexpr uint32_t opcode_crc64       = 0x44u;
+constexpr uint32_t flag_request_int   = 1u << 4u;
+constexpr uint32_t flag_crc32c        = 1u << 21u;
+constexpr uint16_t crc64_flag_inverse = 1u << 14u;
+constexpr uint16_t crc64_flag_be      = 1u << 15u;
+
+void complete(hw_iaa_completion_record *record_ptr,
+              hw_operation_status status,
+              hw_operation_error error_code = AD_ERROR_CODE_OK) noexcept {
+    record_ptr->error_code = error_code;
+
+    // Status is written last as the waiting thread considers the record ready once the status is set
+    std::atomic_thread_fence(std::memory_order_release);
+    *reinterpret_cast<volatile hw_operation_status *>(&record_ptr->status) = status;
+}
+
+void execute_memory_copy(const hw_iaa_analytics_descriptor &descriptor, hw_iaa_completion_record *record_ptr) noexcept {
+    std::memmove(descriptor.dst_ptr, descriptor.src1_ptr, descriptor.src1_size);
+
+    record_ptr->bytes_completed = descriptor.src1_size;
+    complete(record_ptr, AD_STATUS_SUCCESS);
+}
+
+void execute_crc64(const hw_iaa_analytics_descriptor &descriptor, hw_iaa_completion_record *record_ptr) noexcept {
+    uint64_t polynomial = 0u;
+
+    // Polynomial occupies the last 8 bytes of the descriptor
+    std::memcpy(&polynomial, &descriptor.filter_flags, sizeof(polynomial));
+
+    const bool is_be_bit_order = (descriptor.decomp_flags & crc64_flag_be) != 0u;
+    const bool is_inverse      = (descriptor.decomp_flags & crc64_flag_inverse) != 0u;
+
+    const auto crc = kernels_dispatcher::get_instance().get_crc64_table()[0](descriptor.src1_ptr,
+                                                                            descriptor.src1_size,
+                                                                            polynomial,
+                                                                            is_be_bit_order,
+                                                                            is_inverse);
+
+    record_ptr->max_last_agg = static_cast<uint32_t>(crc);
+    record_ptr->sum_agg      = static_cast<uint32_t>(crc >> 32u);
+    complete(record_ptr, AD_STATUS_SUCCESS);
+}
+
+void execute_zero_operation(const hw_iaa_analytics_descriptor &descriptor,
+                            hw_iaa_completion_record *record_ptr,
+                            uint32_t opcode) noexcept {
+    const bool     is_compress = (QPL_OPCODE_Z_COMP32 == opcode || QPL_OPCODE_Z_COMP16 == opcode);
+    const bool     is_16u      = (QPL_OPCODE_Z_COMP16 == opcode || QPL_OPCODE_Z_DECOMP16 == opcode);
+    const uint32_t input_width = is_16u ? sizeof(uint16_t) : sizeof(uint32_t);
+
+    // Uncompressed data is the source for compression and the destination for decompression
+    if (is_compress && 0u != descriptor.src1_size % input_width) {
+        complete(record_ptr, AD_STATUS_INVALID_INPUT_SIZE);
+
+        return;
+    }
+
+    // Kernels are ordered as compress 16u, decompress 16u, compress 32u, decompress 32u
+    const uint32_t index       = (is_16u ? 0u : 2u) + (is_compress ? 0u : 1u);
+    uint32_t       output_size = 0u;
+
+    const auto status = kernels_dispatcher::get_instance().get_zero_compress_table()[index](descriptor.src1_ptr,
+                                                                                           descriptor.src1_size,
+                                                                                           descriptor.dst_ptr,
+                                                                                           descriptor.max_dst_size,
+                                                                                           &output_size);
+
+    if (QPLC_STS_DST_IS_SHORT_ERR == status) {
+        complete(record_ptr, AD_STATUS_ANALYTICS_ERROR, AD_ERROR_CODE_UNRECOVERABLE_OUTPUT_OVERFLOW);
+
+        return;
+    }
+
+    if (QPLC_STS_OK != status) {
+        complete(record_ptr, AD_STATUS_ANALYTICS_ERROR, AD_ERROR_CODE_INVALID_ZDECOMP_HDR);
+
+        return;
+    }
+
+    const uint8_t  *data_ptr = is_compress ? descriptor.src1_ptr : descriptor.dst_ptr;
+    const uint32_t data_size = is_compress ? descriptor.src1_size : output_size;
+
+    record_ptr->crc = (descriptor.op_code_op_flags & flag_crc32c)
+                      ? util::crc32_iscsi_inv(data_ptr, data_ptr + data_size, 0u)
+                      : util::crc32_gzip(data_ptr, data_ptr + data_size, 0u);
+
+    record_ptr->xor_checksum    = static_cast<uint16_t>(util::xor_checksum(data_ptr, data_ptr + data_size, 0u));
+    record_ptr->bytes_completed = descriptor.src1_size;
+    record_ptr->output_size     = output_size;
+    record_ptr->min_first_agg   = std::numeric_limits<uint32_t>::max();
+    record_ptr->max_last_agg    = 0u;
+    record_ptr->sum_agg         = 0u;
+    complete(record_ptr, AD_STATUS_SUCCESS);
+}
+
+void execute(const hw_descriptor &task_descriptor) noexcept {
+    const auto &descriptor = reinterpret_cast<const hw_iaa_analytics_descriptor &>(task_descriptor);
+    auto       *record_ptr = reinterpret_cast<hw_iaa_completion_record *>(descriptor.completion_record_ptr);
+    const auto opcode      = descriptor.op_code_op_flags >> opcode_shift;
+
+    // The completion interrupt handle is reserved unless the completion interrupt is requested
+    if (0u != descriptor.comp_int_handle && 0u == (descriptor.op_code_op_flags & flag_request_int)) {
+        complete(record_ptr, AD_STATUS_NONZERO_RESERVED_FIELD);
+
+        return;
+    }
+
+    switch (opcode) {
+        case opcode_memory_copy:
+            execute_memory_copy(descriptor, record_ptr);
+            break;
+        case opcode_crc64:
+            execute_crc64(descriptor, record_ptr);
+            break;
+        case QPL_OPCODE_Z_COMP32:
+        case QPL_OPCODE_Z_COMP16:
+        case QPL_OPCODE_Z_DECOMP32:
+        case QPL_OPCODE_Z_DECOMP16:
+            execute_zero_operation(descriptor, record_ptr, opcode);
+            break;
+        default:
+            complete(record_ptr, AD_STATUS_UNSUPPORTED_OPCODE);
+    }
+}
+
+} // anonymous namespace
+
+hw_emulated_portal::hw_emulated_portal(uint32_t size, uint32_t busy_period, uint64_t latency_ns) noexcept
+        : size_(size),
+          busy_period_(busy_period),
+          latency_(latency_ns),
+          worker_(&hw_emulated_portal::process_tasks, this) {
+}
+
+hw_emulated_portal::~hw_emulated_portal() noexcept {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        is_stopped_ = true;
+    }
+
+    condition_.notify_one();
+    worker_.join();
+
+    // Descriptors that haven't started are completed with an error, so their waiters don't wait forever
+    for (const auto &task : tasks_) {
+        const auto &descriptor = reinterpret_cast<const hw_iaa_analytics_descriptor &>(task.descriptor);
+
+        complete(reinterpret_cast<hw_iaa_completion_record *>(descriptor.completion_record_ptr),
+                 AD_STATUS_ANALYTICS_ERROR,
+                 AD_ERROR_CODE_TIMEOUT);
+    }
+}
+
+auto hw_emulated_portal::enqueue_descriptor(const void *desc_ptr) noexcept -> bool {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        enqueue_count_++;
+
+        if ((busy_period_ && 0u == enqueue_count_ % busy_period_) || tasks_.size() >= size_) {
+            return true;
+        }
+
+        task_t task{};
+
+        std::memcpy(&task.descriptor, desc_ptr, sizeof(task.descriptor));
+        task.start_time = std::chrono::steady_clock::now() + latency_;
+
+        tasks_.push_back(task);
+    }
+
+    condition_.notify_one();
+
+    return false;
+}
+
+void hw_emulated_portal::process_tasks() noexcept {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        condition_.wait(lock, [this]() { return is_stopped_ || !tasks_.empty(); });
+
+        if (is_stopped_) {
+            return;
+        }
+
+        const auto start_time = tasks_.front().start_time;
+
+        if (std::chrono::steady_clock::now() < start_time) {
+            condition_.wait_until(lock, start_time);
+
+            continue;
+        }
+
+        // The descriptor occupies the queue until it is executed
+        const auto descriptor = tasks_.front().descriptor;
+
+        lock.unlock();
+        execute(descriptor);
+        lock.lock();
+
+        tasks_.pop_front();
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_PORTAL_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_PORTAL_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "hw_definitions.h"
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief Software portal of the emulated work queue
+ *
+ * @details Accepts descriptors the same way the work queue portal does: the descriptor is copied on enqueue and
+ *          the enqueue is rejected if the queue is full. Descriptors are executed in order by a worker thread with
+ *          the software kernels, the completion record is written when the execution is finished.
+ *
+ *          Supported operations are memory copy, CRC64, zero compress and zero decompress,
+ *          others are completed with AD_STATUS_UNSUPPORTED_OPCODE.
+ */
+class hw_emulated_portal final {
+public:
+    /**
+     * @param size         number of descriptors the queue holds
+     * @param busy_period  every busy_period-th enqueue is rejected, 0 disables the rejection
+     * @param latency_ns   time between the enqueue of a descriptor and the start of its execution
+     */
+    hw_emulated_portal(uint32_t size, uint32_t busy_period, uint64_t latency_ns) noexcept;
+
+    hw_emulated_portal(const hw_emulated_portal &) = delete;
+
+    auto operator=(const hw_emulated_portal &) -> hw_emulated_portal & = delete;
+
+    /**
+     * @brief Enqueues a copy of the descriptor
+     *
+     * @return true if the descriptor is rejected and the enqueue should be retried, false otherwise
+     */
+    [[nodiscard]] auto enqueue_descriptor(const void *desc_ptr) noexcept -> bool;
+
+    /**
+     * @brief Stops the worker, descriptors that haven't started are completed with AD_ERROR_CODE_TIMEOUT
+     */
+    ~hw_emulated_portal() noexcept;
+
+private:
+    struct task_t {
+        hw_descriptor                         descriptor;
+        std::chrono::steady_clock::time_point start_time;
+    };
+
+    void process_tasks() noexcept;
+
+    const uint32_t                 size_;
+    const uint32_t                 busy_period_;
+    const std::chrono::nanoseconds latency_;
+
+    std::mutex              mutex_;
+    std::condition_variable condition_;
+    std::deque<task_t>      tasks_;
+    uint64_t                enqueue_count_ = 0u;
+    bool                    is_stopped_    = false;
+    std::thread             worker_;
+};
+
+}
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_EMULATED_PORTAL_HPP_
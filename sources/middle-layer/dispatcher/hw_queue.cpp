@@ -9,6 +9,10 @@
 #include <fcntl.h>
 #include <sys/mman.h>
 
+#if defined( QPL_HW_EMULATOR )
+#include <new>
+#endif
+
 #include "hw_queue.hpp"
 #include "hw_configuration_driver.h"
 
@@ -20,22 +24,47 @@
 namespace qpl::ml::dispatcher {
 
 hw_queue::hw_queue(hw_queue &&other) noexcept {
-    priority_      = other.priority_;
-    portal_mask_   = other.portal_mask_;
-    portal_ptr_    = other.portal_ptr_;
-    portal_offset_ = 0;
+    block_on_fault_    = other.block_on_fault_;
+    priority_          = other.priority_;
+    size_              = other.size_;
+    max_transfer_size_ = other.max_transfer_size_;
+    portal_mask_       = other.portal_mask_;
+    portal_ptr_        = other.portal_ptr_;
+    portal_offset_     = 0;
+    outstanding_count_ = other.outstanding_count_.load();
 
     other.portal_ptr_ = nullptr;
+
+#if defined( QPL_HW_EMULATOR )
+    emulated_portal_ = std::move(other.emulated_portal_);
+#endif
 }
 
 auto hw_queue::operator=(hw_queue &&other) noexcept -> hw_queue & {
-    priority_      = other.priority_;
-    portal_mask_   = other.portal_mask_;
-    portal_ptr_    = other.portal_ptr_;
-    portal_offset_ = 0;
+    if (this == &other) {
+        return *this;
+    }
+
+    // The portal of the queue is released before it is replaced
+    if (portal_ptr_ != nullptr) {
+        munmap(portal_ptr_, 0x1000u);
+    }
+
+    block_on_fault_    = other.block_on_fault_;
+    priority_          = other.priority_;
+    size_              = other.size_;
+    max_transfer_size_ = other.max_transfer_size_;
+    portal_mask_       = other.portal_mask_;
+    portal_ptr_        = other.portal_ptr_;
+    portal_offset_     = 0;
+    outstanding_count_ = other.outstanding_count_.load();
 
     other.portal_ptr_ = nullptr;
 
+#if defined( QPL_HW_EMULATOR )
+    emulated_portal_ = std::move(other.emulated_portal_);
+#endif
+
     return *this;
 }
 
@@ -63,13 +92,34 @@ auto hw_queue::get_portal_ptr() const noexcept -> void * {
 auto hw_queue::enqueue_descriptor(void *desc_ptr) const noexcept -> qpl_status {
     uint8_t retry = 0u;
 
+#if defined( QPL_HW_EMULATOR )
+    if (emulated_portal_) {
+        retry = emulated_portal_->enqueue_descriptor(desc_ptr);
+    } else {
+        retry = enqcmd(desc_ptr);
+    }
+#else
+    retry = enqcmd(desc_ptr);
+#endif
+
+    if (!retry) {
+        // Accepted descriptor stays outstanding until it is retired on completion
+        outstanding_count_.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    return static_cast<qpl_status>(retry);
+}
+
+auto hw_queue::enqcmd(void *desc_ptr) const noexcept -> uint8_t {
+    uint8_t retry = 0u;
+
     void *current_place_ptr = get_portal_ptr();
     asm volatile("sfence\t\n"
                  ".byte 0xf2, 0x0f, 0x38, 0xf8, 0x02\t\n"
                  "setz %0\t\n"
     : "=r"(retry) : "a" (current_place_ptr), "d" (desc_ptr));
 
-    return static_cast<qpl_status>(retry);
+    return retry;
 }
 
 auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> hw_accelerator_status {
@@ -90,6 +140,27 @@ auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> hw_acce
         return HW_ACCELERATOR_WORK_QUEUES_NOT_AVAILABLE;
     }
 
+    size_              = static_cast<uint32_t>(hw_work_queue_get_size(work_queue_ptr));
+    max_transfer_size_ = hw_work_queue_get_max_transfer_size(work_queue_ptr);
+
+#if defined( QPL_HW_EMULATOR )
+    const auto *emulated_properties_ptr = hw_work_queue_get_emulated_properties(work_queue_ptr);
+
+    if (emulated_properties_ptr) {
+        emulated_portal_.reset(new (std::nothrow) hw_emulated_portal(emulated_properties_ptr->size,
+                                                                     emulated_properties_ptr->busy_period,
+                                                                     emulated_properties_ptr->latency_ns));
+        QPL_HWSTS_RET((nullptr == emulated_portal_), HW_ACCELERATOR_LIBACCEL_ERROR);
+
+        priority_       = hw_work_queue_get_priority(work_queue_ptr);
+        block_on_fault_ = hw_work_queue_get_block_on_fault(work_queue_ptr);
+
+        DIAG("     %7s: emulated, priority: %d\n", work_queue_dev_name, priority_);
+
+        return HW_ACCELERATOR_STATUS_OK;
+    }
+#endif
+
     DIAG("     %7s:\n", work_queue_dev_name);
     auto status = hw_work_queue_get_device_path(work_queue_ptr, path, 64 - 1);
     QPL_HWSTS_RET((0 > status), HW_ACCELERATOR_LIBACCEL_ERROR);
@@ -129,6 +200,8 @@ auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> hw_acce
 #else
     DIAG("     %7s: priority:    %d\n", work_queue_dev_name, priority_);
     DIAG("     %7s: bof:         %d\n", work_queue_dev_name, block_on_fault_);
+    DIAG("     %7s: size:        %u\n", work_queue_dev_name, size_);
+    DIAG("     %7s: max xfer:    %lu\n", work_queue_dev_name, max_transfer_size_);
 #endif
 
     hw_queue::set_portal_ptr(region_ptr);
@@ -144,5 +217,25 @@ auto hw_queue::get_block_on_fault() const noexcept -> bool {
     return block_on_fault_;
 }
 
+auto hw_queue::get_size() const noexcept -> uint32_t {
+    return size_;
+}
+
+auto hw_queue::get_max_transfer_size() const noexcept -> uint64_t {
+    return max_transfer_size_;
+}
+
+auto hw_queue::get_outstanding_count() const noexcept -> uint32_t {
+    return outstanding_count_.load(std::memory_order_relaxed);
+}
+
+void hw_queue::retire_descriptor() const noexcept {
+    auto count = outstanding_count_.load(std::memory_order_relaxed);
+
+    // Saturate at zero, the counter is a load estimation and must not wrap around
+    while (0u != count && !outstanding_count_.compare_exchange_weak(count, count - 1u, std::memory_order_relaxed)) {
+    }
+}
+
 }
 #endif
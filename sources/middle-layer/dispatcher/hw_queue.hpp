@@ -9,6 +9,12 @@
 
 #include <atomic>
 
+#if defined( QPL_HW_EMULATOR )
+#include <memory>
+
+#include "hw_emulated_portal.hpp"
+#endif
+
 #include "qpl/c_api/status.h"
 #include "hw_status.h"
 
@@ -38,16 +44,32 @@ public:
 
     [[nodiscard]] auto get_block_on_fault() const noexcept -> bool;
 
+    [[nodiscard]] auto get_size() const noexcept -> uint32_t;
+
+    [[nodiscard]] auto get_max_transfer_size() const noexcept -> uint64_t;
+
+    [[nodiscard]] auto get_outstanding_count() const noexcept -> uint32_t;
+
+    void retire_descriptor() const noexcept;
+
     void set_portal_ptr(void *portal_ptr) noexcept;
 
     virtual ~hw_queue() noexcept;
 
 private:
-    bool                          block_on_fault_ = false;
-    int32_t                       priority_       = 0u;
-    uint64_t                      portal_mask_    = 0u;      /**< Mask for incrementing portals */
-    mutable void                  *portal_ptr_    = nullptr;
-    mutable std::atomic<uint64_t> portal_offset_  = 0u;      /**< Portal for enqcmd (mod page size)*/
+    [[nodiscard]] auto enqcmd(void *desc_ptr) const noexcept -> uint8_t;
+
+    bool                          block_on_fault_    = false;
+    int32_t                       priority_          = 0u;
+    uint32_t                      size_              = 0u;      /**< Number of descriptors the queue holds */
+    uint64_t                      max_transfer_size_ = 0u;      /**< Maximum transfer size of a descriptor */
+    uint64_t                      portal_mask_       = 0u;      /**< Mask for incrementing portals */
+    mutable void                  *portal_ptr_       = nullptr;
+    mutable std::atomic<uint64_t> portal_offset_     = 0u;      /**< Portal for enqcmd (mod page size)*/
+    mutable std::atomic<uint32_t> outstanding_count_ = 0u;      /**< Descriptors enqueued and not retired yet */
+#if defined( QPL_HW_EMULATOR )
+    std::unique_ptr<hw_emulated_portal> emulated_portal_;    /**< Replaces the portal if the queue is emulated */
+#endif
 };
 
 }
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+
+#include "hw_selection_policy.hpp"
+
+namespace qpl::ml::dispatcher {
+
+namespace {
+
+// Rank fields from the most significant one
+constexpr uint32_t group_shift          = 56u;
+constexpr uint32_t transfer_class_shift = 48u;
+constexpr uint32_t load_shift           = 16u;
+
+constexpr uint64_t load_scale   = 1024u;         /**< Load of the queue filled up to its size */
+constexpr uint64_t max_load     = UINT32_MAX;
+constexpr int32_t  max_priority = UINT16_MAX;
+
+/**
+ * @brief Number of significant bits of the maximum transfer size, unknown size is the largest one
+ */
+auto get_transfer_class(uint64_t max_transfer_size) noexcept -> uint64_t {
+    uint64_t transfer_class = 0u;
+
+    if (0u == max_transfer_size) {
+        return std::numeric_limits<uint64_t>::digits;
+    }
+
+    while (max_transfer_size) {
+        transfer_class++;
+        max_transfer_size >>= 1u;
+    }
+
+    return transfer_class;
+}
+
+} // anonymous namespace
+
+auto hw_load_aware_policy::rank(const hw_queue_state_t &queue,
+                                const hw_submission_t &submission) const noexcept -> uint64_t {
+    const bool is_local = queue.numa_id == submission.numa_id;
+
+    if (!is_local && submission.is_numa_strict) {
+        return not_eligible;
+    }
+
+    if (0u != queue.max_transfer_size && submission.transfer_size > queue.max_transfer_size) {
+        return not_eligible;
+    }
+
+    const bool is_saturated = 0u != queue.size && queue.outstanding_count >= queue.size;
+
+    const uint64_t group    = (is_saturated ? 2u : 0u) + (is_local ? 0u : 1u);
+    const uint64_t load     = std::min(queue.outstanding_count * load_scale / std::max(queue.size, 1u), max_load);
+    const uint64_t priority = std::clamp(queue.priority, 0, max_priority);
+
+    return (group << group_shift) |
+           (get_transfer_class(queue.max_transfer_size) << transfer_class_shift) |
+           (load << load_shift) |
+           (max_priority - priority);
+}
+
+}
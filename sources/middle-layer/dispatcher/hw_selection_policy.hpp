@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_SELECTION_POLICY_HPP_
+#define QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_SELECTION_POLICY_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace qpl::ml::dispatcher {
+
+/**
+ * @brief State of a work queue used for the work queue selection
+ */
+struct hw_queue_state_t {
+    uint64_t numa_id           = 0u;    /**< NUMA node of the device */
+    uint32_t outstanding_count = 0u;    /**< Number of descriptors submitted to the queue and not retired yet */
+    uint32_t size              = 0u;    /**< Number of descriptors the queue holds, 0 if unknown */
+    uint64_t max_transfer_size = 0u;    /**< Maximum transfer size of the queue, 0 if unknown */
+    int32_t  priority          = 0;     /**< Priority of the queue */
+};
+
+/**
+ * @brief Properties of the descriptor submission used for the work queue selection
+ */
+struct hw_submission_t {
+    uint64_t numa_id        = 0u;       /**< NUMA node requested by the user or the current one */
+    bool     is_numa_strict = false;    /**< Devices of other NUMA nodes must not be used */
+    uint32_t transfer_size  = 0u;       /**< Number of source bytes of the descriptor */
+};
+
+/**
+ * @brief Interface of the work queue selection policy
+ *
+ * @details The descriptor is enqueued to the work queue with the lowest rank,
+ *          if the work queue rejects the descriptor the next one is used.
+ */
+class hw_selection_policy {
+public:
+    static constexpr uint64_t not_eligible = std::numeric_limits<uint64_t>::max();    /**< Queue must not be used */
+
+    [[nodiscard]] virtual auto rank(const hw_queue_state_t &queue,
+                                    const hw_submission_t &submission) const noexcept -> uint64_t = 0;
+
+    virtual ~hw_selection_policy() noexcept = default;
+};
+
+/**
+ * @brief Default work queue selection policy
+ *
+ * @details Queues are preferred in the following order:
+ *          - not saturated queues of the local devices;
+ *          - not saturated queues of the remote devices, if the NUMA node isn't requested by the user;
+ *          - saturated queues of the local and then remote devices, the enqueue may still succeed.
+ *
+ *          The queue is saturated if the number of the outstanding descriptors reaches its size.
+ *          Within the group the queue with the smallest maximum transfer size that fits the descriptor is preferred,
+ *          so small jobs go to low-latency queues and large jobs don't wait behind them.
+ *          Then the least loaded and the highest priority queue is preferred.
+ */
+class hw_load_aware_policy final : public hw_selection_policy {
+public:
+    [[nodiscard]] auto rank(const hw_queue_state_t &queue,
+                            const hw_submission_t &submission) const noexcept -> uint64_t override;
+};
+
+}
+#endif //QPL_SOURCES_MIDDLE_LAYER_DISPATCHER_HW_SELECTION_POLICY_HPP_
@@ -4,10 +4,14 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <atomic>
+#include <thread>
+
 #include "awaiter.hpp"
 
 #if defined(linux)
 
+#include <cpuid.h>
 #include <x86intrin.h>
 
 #else
@@ -17,16 +21,53 @@
 
 namespace qpl::ml {
 
-#ifdef QPL_EFFICIENT_WAIT
-static inline uint64_t current_time() {
-    return __rdtsc();
+namespace {
+
+constexpr uint32_t waitpkg_cpuid_leaf    = 7u;
+constexpr uint32_t waitpkg_cpuid_ecx_bit = 5u;
+constexpr uint32_t umwait_c02_state      = 0u;       /**< Deeper optimized state, bit 0 of the UMWAIT control */
+constexpr uint32_t umwait_period         = 100000u;  /**< Default OS limit of a single UMWAIT in clocks */
+
+auto detect_waitpkg() noexcept -> bool {
+#if defined(linux)
+    uint32_t eax = 0u;
+    uint32_t ebx = 0u;
+    uint32_t ecx = 0u;
+    uint32_t edx = 0u;
+
+    if (!__get_cpuid_count(waitpkg_cpuid_leaf, 0u, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+
+    return ecx & (1u << waitpkg_cpuid_ecx_bit);
+#else
+    return false;
+#endif
 }
 
-static inline void monitor_address(volatile void *address) {
+#ifdef QPL_EFFICIENT_WAIT
+constexpr auto default_wait_mode = wait_mode_t::umwait;
+#else
+constexpr auto default_wait_mode = wait_mode_t::spin;
+#endif
+
+const bool            waitpkg_supported = detect_waitpkg();
+
+/*
+ * The global policy is published as a whole with a sequence lock: the version is odd while the fields are
+ * being written, and readers retry until they see the same even version before and after reading them
+ */
+std::atomic<uint32_t> global_policy_version{0u};
+std::atomic<uint32_t> global_wait_mode{static_cast<uint32_t>(default_wait_mode)};
+std::atomic<uint32_t> global_spin_count{0u};
+std::atomic<uint64_t> global_timeout_ns{0u};
+
+#if defined(linux)
+inline void monitor_address(volatile void *address) {
     asm volatile(".byte 0xf3, 0x48, 0x0f, 0xae, 0xf0" : : "a"(address));
 }
 
-static inline int wait_until(uint64_t timeout, uint32_t state) {
+inline int wait_until(uint64_t timeout, uint32_t state) {
     uint8_t r            = 0u;
     auto    timeout_low  = static_cast<uint32_t>(timeout);
     auto    timeout_high = static_cast<uint32_t>(timeout >> 32);
@@ -40,6 +81,122 @@ static inline int wait_until(uint64_t timeout, uint32_t state) {
 }
 #endif
 
+/**
+ * @brief Sleeps till the address is written or the period is over, returns false if WAITPKG is not available
+ */
+inline auto umwait(volatile uint8_t *address_ptr, uint8_t initial_value, uint32_t period) noexcept -> bool {
+#if defined(linux)
+    if (waitpkg_supported) {
+        monitor_address(address_ptr);
+
+        // The address may be changed before the monitor is armed
+        if (initial_value == *address_ptr) {
+            wait_until(__rdtsc() + period, umwait_c02_state);
+        }
+
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+auto wait_loop(volatile uint8_t *address_ptr,
+               uint8_t initial_value,
+               const wait_policy_t &policy,
+               wait_deadline_t deadline,
+               uint32_t period) noexcept -> bool {
+    const bool is_bounded = wait_deadline_t::max() != deadline;
+    uint32_t   checks     = 0u;
+
+    while (initial_value == *address_ptr) {
+        if (is_bounded && std::chrono::steady_clock::now() >= deadline) {
+            return initial_value != *address_ptr;
+        }
+
+        if (wait_mode_t::spin == policy.mode || checks < policy.spin_count) {
+            checks++;
+            _mm_pause();
+            continue;
+        }
+
+        if (wait_mode_t::umwait == policy.mode && umwait(address_ptr, initial_value, period)) {
+            continue;
+        }
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+auto is_waitpkg_supported() noexcept -> bool {
+    return waitpkg_supported;
+}
+
+auto get_default_wait_policy() noexcept -> wait_policy_t {
+    wait_policy_t policy;
+
+    policy.mode = default_wait_mode;
+
+    return policy;
+}
+
+void set_wait_policy(const wait_policy_t &policy) noexcept {
+    auto version = global_policy_version.load(std::memory_order_relaxed);
+
+    // Concurrent writers are serialized by moving the version from an even value to the odd one
+    do {
+        version &= ~1u;
+    } while (!global_policy_version.compare_exchange_weak(version, version + 1u,
+                                                          std::memory_order_relaxed,
+                                                          std::memory_order_relaxed));
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    global_wait_mode.store(static_cast<uint32_t>(policy.mode), std::memory_order_relaxed);
+    global_spin_count.store(policy.spin_count, std::memory_order_relaxed);
+    global_timeout_ns.store(policy.timeout_ns, std::memory_order_relaxed);
+
+    global_policy_version.store(version + 2u, std::memory_order_release);
+}
+
+auto get_wait_policy() noexcept -> wait_policy_t {
+    wait_policy_t policy;
+
+    while (true) {
+        const auto version = global_policy_version.load(std::memory_order_acquire);
+
+        if (version & 1u) {
+            _mm_pause();
+            continue;
+        }
+
+        policy.mode       = static_cast<wait_mode_t>(global_wait_mode.load(std::memory_order_relaxed));
+        policy.spin_count = global_spin_count.load(std::memory_order_relaxed);
+        policy.timeout_ns = global_timeout_ns.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (version == global_policy_version.load(std::memory_order_relaxed)) {
+            return policy;
+        }
+    }
+}
+
+auto make_wait_deadline(const wait_policy_t &policy) noexcept -> wait_deadline_t {
+    const auto now       = std::chrono::steady_clock::now();
+    const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(wait_deadline_t::max() - now);
+
+    if (0u == policy.timeout_ns || policy.timeout_ns >= static_cast<uint64_t>(remaining.count())) {
+        return wait_deadline_t::max();
+    }
+
+    return now + std::chrono::nanoseconds(policy.timeout_ns);
+}
+
 awaiter::awaiter(volatile void *address,
                  uint8_t initial_value,
                  uint32_t period) noexcept
@@ -50,21 +207,17 @@ awaiter::awaiter(volatile void *address,
 }
 
 awaiter::~awaiter() noexcept {
-#ifdef QPL_EFFICIENT_WAIT
-    while (initial_value_ == *address_ptr_) {
-        monitor_address(address_ptr_);
-
-        auto start = current_time();
-        wait_until(start + period_, idle_state_);
-    }
-#else
-    while (initial_value_ == *address_ptr_) {
-        _mm_pause();
-    }
-#endif
+    wait_loop(address_ptr_, initial_value_, get_wait_policy(), wait_deadline_t::max(), period_);
 }
 
 void awaiter::wait_for(volatile void *address, uint8_t initial_value) noexcept {
     awaiter wait_for(address, initial_value);
 }
+
+auto awaiter::wait_for(volatile void *address,
+                       uint8_t initial_value,
+                       const wait_policy_t &policy,
+                       wait_deadline_t deadline) noexcept -> bool {
+    return wait_loop(reinterpret_cast<volatile uint8_t *>(address), initial_value, policy, deadline, umwait_period);
+}
 }
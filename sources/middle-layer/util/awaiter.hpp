@@ -12,11 +12,58 @@
 #ifndef QPL_AWAITER_HPP
 #define QPL_AWAITER_HPP
 
-
+#include <chrono>
 #include <cstdint>
 
 namespace qpl::ml {
 
+/**
+ * @brief The way the waiting thread spends time between checks of the awaited address
+ */
+enum class wait_mode_t : uint32_t {
+    spin,   /**< PAUSE between checks */
+    umwait, /**< PAUSE for the spin count, then UMONITOR/UMWAIT, yield if WAITPKG is not available */
+    yield,  /**< PAUSE for the spin count, then yield the CPU between checks */
+};
+
+/**
+ * @brief Waiting parameters, zero timeout means that the wait is not bounded
+ */
+struct wait_policy_t {
+    wait_mode_t mode       = wait_mode_t::spin;
+    uint32_t    spin_count = 0u;
+    uint64_t    timeout_ns = 0u;
+};
+
+using wait_deadline_t = std::chrono::steady_clock::time_point;
+
+/**
+ * @brief Returns true if the CPU supports UMONITOR/UMWAIT instructions
+ */
+auto is_waitpkg_supported() noexcept -> bool;
+
+/**
+ * @brief Returns the policy the library starts with, umwait if built with efficient wait, spin otherwise
+ */
+auto get_default_wait_policy() noexcept -> wait_policy_t;
+
+/**
+ * @brief Sets the policy that is used by waits without an explicit one
+ *
+ * @note Waits that start concurrently see either the previous policy or this one, never a mix of their fields
+ */
+void set_wait_policy(const wait_policy_t &policy) noexcept;
+
+/**
+ * @brief Returns the policy that is used by waits without an explicit one
+ */
+auto get_wait_policy() noexcept -> wait_policy_t;
+
+/**
+ * @brief Returns the moment the wait with the given policy gives up, wait_deadline_t::max() if it is not bounded
+ */
+auto make_wait_deadline(const wait_policy_t &policy) noexcept -> wait_deadline_t;
+
 /**
  * @brief Class that allows to defer scope exit to the moment when a certain address is changed
  */
@@ -35,17 +82,26 @@ public:
                      uint32_t period = 200) noexcept;
 
     /**
-     * @brief Destructor that performs actual wait
+     * @brief Destructor that performs actual wait with the global policy, the timeout is ignored
      */
     ~awaiter() noexcept;
 
     static void wait_for(volatile void *address, uint8_t initial_value) noexcept;
 
+    /**
+     * @brief Waits until the address is changed or the deadline is reached
+     *
+     * @return false if the deadline is reached first
+     */
+    static auto wait_for(volatile void *address,
+                         uint8_t initial_value,
+                         const wait_policy_t &policy,
+                         wait_deadline_t deadline) noexcept -> bool;
+
 private:
     volatile uint8_t *address_ptr_  = nullptr;  /**< Pointer to memory that should be asynchronously changed */
     uint32_t         period_        = 0u;       /**< Number of clocks between checks */
     uint8_t          initial_value_ = 0u;       /**< Value to compare with */
-    uint32_t         idle_state_    = 0u;       /**< State for CPU wait control */
 };
 
 }
@@ -10,6 +10,37 @@
 
 namespace qpl::ml::util {
 
+namespace {
+
+constexpr uint32_t crc32_gzip_polynomial = 0xedb88320u;    /**< Reflected CRC32 polynomial */
+constexpr uint32_t crc32_bits            = 32u;
+
+/**
+ * @brief Multiplies 32x32 GF(2) matrix by the vector
+ */
+auto gf2_matrix_times(const uint32_t *matrix, uint32_t vector) noexcept -> uint32_t {
+    uint32_t sum = 0u;
+
+    while (vector) {
+        if (vector & 1u) {
+            sum ^= *matrix;
+        }
+
+        vector >>= 1u;
+        matrix++;
+    }
+
+    return sum;
+}
+
+void gf2_matrix_square(uint32_t *square, const uint32_t *matrix) noexcept {
+    for (uint32_t n = 0u; n < crc32_bits; n++) {
+        square[n] = gf2_matrix_times(matrix, matrix[n]);
+    }
+}
+
+} // anonymous namespace
+
 auto adler32(uint8_t *const begin, uint32_t size, uint32_t seed) noexcept -> uint32_t {
     auto old_adler32 = seed;
     auto new_adler32 = seed & least_significant_16_bits;
@@ -22,4 +53,48 @@ auto adler32(uint8_t *const begin, uint32_t size, uint32_t seed) noexcept -> uin
     return (old_adler32 & most_significant_16_bits) | new_adler32;
 }
 
+auto crc32_combine(uint32_t first_crc, uint32_t second_crc, size_t second_size) noexcept -> uint32_t {
+    if (second_size == 0u) {
+        return first_crc;
+    }
+
+    uint32_t even[crc32_bits];    // Operator for the even powers of two zero bits
+    uint32_t odd[crc32_bits];     // Operator for the odd powers of two zero bits
+
+    // Operator for one zero bit
+    odd[0] = crc32_gzip_polynomial;
+
+    for (uint32_t n = 1u, row = 1u; n < crc32_bits; n++, row <<= 1u) {
+        odd[n] = row;
+    }
+
+    gf2_matrix_square(even, odd);    // Two zero bits
+    gf2_matrix_square(odd, even);    // Four zero bits
+
+    // Apply second_size zero bytes to the first CRC, the first squaring gives the operator for one zero byte
+    do {
+        gf2_matrix_square(even, odd);
+
+        if (second_size & 1u) {
+            first_crc = gf2_matrix_times(even, first_crc);
+        }
+
+        second_size >>= 1u;
+
+        if (second_size == 0u) {
+            break;
+        }
+
+        gf2_matrix_square(odd, even);
+
+        if (second_size & 1u) {
+            first_crc = gf2_matrix_times(odd, first_crc);
+        }
+
+        second_size >>= 1u;
+    } while (second_size != 0u);
+
+    return first_crc ^ second_crc;
+}
+
 } // namespace qpl::ml
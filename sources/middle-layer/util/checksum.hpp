@@ -12,6 +12,8 @@
 #ifndef QPL_SOURCES_MIDDLE_LAYER_UTIL_CHECKSUM_HPP_
 #define QPL_SOURCES_MIDDLE_LAYER_UTIL_CHECKSUM_HPP_
 
+#include <cstddef>
+
 #include "crc.h"
 #include "dispatcher/dispatcher.hpp"
 
@@ -37,6 +39,15 @@ enum class crc_type_t {
 
 auto adler32(uint8_t *begin, uint32_t size, uint32_t seed) noexcept -> uint32_t;
 
+/**
+ * @brief Calculates CRC32 (gzip) of two concatenated buffers from CRCs of the buffers
+ *
+ * @param  first_crc    CRC32 of the first buffer
+ * @param  second_crc   CRC32 of the second buffer
+ * @param  second_size  number of bytes in the second buffer
+ */
+auto crc32_combine(uint32_t first_crc, uint32_t second_crc, size_t second_size) noexcept -> uint32_t;
+
 template <class input_iterator_t>
 inline uint32_t crc32_gzip(const input_iterator_t source_begin,
                            const input_iterator_t source_end,
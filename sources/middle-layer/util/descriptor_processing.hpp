@@ -53,13 +53,20 @@ inline auto wait_descriptor_result(HW_PATH_VOLATILE hw_completion_record *const
 template <typename return_t, execution_mode_t mode>
 inline auto process_descriptor(hw_descriptor *const descriptor_ptr,
                                HW_PATH_VOLATILE hw_completion_record *const completion_record_ptr,
-                               int32_t numa_id = -1) noexcept -> return_t {
+                               int32_t numa_id = -1,
+                               uint32_t *queue_tag_ptr = nullptr) noexcept -> return_t {
     return_t operation_result;
+    uint32_t queue_tag = 0u;
+
+    // Synchronous execution retires the descriptor itself, so the tag doesn't need to outlive the call
+    if (nullptr == queue_tag_ptr) {
+        queue_tag_ptr = &queue_tag;
+    }
 
     hw_iaa_descriptor_set_completion_record(descriptor_ptr, completion_record_ptr);
     completion_record_ptr->status = AD_STATUS_INPROG; // Mark completion record as not completed
 
-    auto accel_status = hw_enqueue_descriptor(descriptor_ptr, numa_id);
+    auto accel_status = hw_enqueue_descriptor(descriptor_ptr, numa_id, queue_tag_ptr);
 
     if constexpr (mode == execution_mode_t::sync) {
         uint32_t status = accelerator_status_to_qpl(accel_status);
@@ -73,6 +80,7 @@ inline auto process_descriptor(hw_descriptor *const descriptor_ptr,
         }
 
         operation_result = wait_descriptor_result<return_t>(completion_record_ptr);
+        hw_retire_descriptor(queue_tag_ptr);
 
         if constexpr (std::is_same<other::copy_operation_result_t, return_t>::value) {
             operation_result.copied_bytes_ = reinterpret_cast<hw_iaa_analytics_descriptor *>(descriptor_ptr)->src1_size;
@@ -92,11 +100,29 @@ inline auto process_descriptor(hw_descriptor *const descriptor_ptr,
     return operation_result;
 }
 
+/**
+ * @brief Waits for the enqueued descriptors and retires them, the tags of not enqueued ones are 0
+ *
+ * @note The descriptors can't be retired before their completion records are written, as they still occupy
+ *       the work queues and write into the completion records owned by the caller
+ */
+template <size_t number_of_descriptors>
+inline void retire_descriptors(std::array<hw_completion_record, number_of_descriptors> &completion_records,
+                               std::array<uint32_t, number_of_descriptors> &queue_tags) noexcept {
+    for (size_t i = 0u; i < number_of_descriptors; i++) {
+        if (0u != queue_tags[i]) {
+            awaiter::wait_for(&completion_records[i].status, AD_STATUS_INPROG);
+            hw_retire_descriptor(&queue_tags[i]);
+        }
+    }
+}
+
 template <typename return_t, uint32_t number_of_descriptors>
 inline auto process_descriptor(std::array<hw_descriptor, number_of_descriptors> &descriptors,
                                std::array<hw_completion_record, number_of_descriptors> &completion_records,
                                int32_t numa_id) noexcept -> return_t {
     return_t operation_result{};
+    std::array<uint32_t, number_of_descriptors> queue_tags{};
 
     for (uint32_t i = 0; i < descriptors.size(); i++) {
         hw_iaa_descriptor_set_completion_record(&descriptors[i], &completion_records[i]);
@@ -105,15 +131,19 @@ inline auto process_descriptor(std::array<hw_descriptor, number_of_descriptors>
         if constexpr (std::is_same_v<return_t, uint32_t>) {
             operation_result = process_descriptor<uint32_t, execution_mode_t::async>(&descriptors[i],
                                                                                      &completion_records[i],
-                                                                                     numa_id);
+                                                                                     numa_id,
+                                                                                     &queue_tags[i]);
             if (operation_result != status_list::ok) {
+                retire_descriptors(completion_records, queue_tags);
                 return operation_result;
             }
         } else {
             operation_result.status_code_ = process_descriptor<uint32_t, execution_mode_t::async>(&descriptors[i],
                                                                                                   &completion_records[i],
-                                                                                                  numa_id);
+                                                                                                  numa_id,
+                                                                                                  &queue_tags[i]);
             if (operation_result.status_code_ != status_list::ok) {
+                retire_descriptors(completion_records, queue_tags);
                 return operation_result;
             }
         }
@@ -121,8 +151,10 @@ inline auto process_descriptor(std::array<hw_descriptor, number_of_descriptors>
 
     for (uint32_t i = 0; i < descriptors.size(); i++) {
         auto execution_status = ml::util::wait_descriptor_result<return_t>(&completion_records[i]);
+        hw_retire_descriptor(&queue_tags[i]);
 
         if (execution_status.status_code_ != status_list::ok) {
+            retire_descriptors(completion_records, queue_tags);
             operation_result.status_code_ = execution_status.status_code_;
             return operation_result;
         } else {
@@ -0,0 +1,430 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <thread>
+
+#if defined(linux)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "executor.hpp"
+
+namespace qpl::ml::util {
+
+namespace {
+
+#if defined(linux)
+using native_thread_t = pthread_t;
+#else
+using native_thread_t = std::thread;
+#endif
+
+/**
+ * @brief Fixed set of workers, each of them has its own queue and steals from others when it is empty
+ *
+ * @note The library is built without exceptions, so workers are started with @ref initialize(),
+ *       which reports the failure with the status instead of terminating
+ */
+class work_stealing_pool final {
+    /**
+     * @brief Worker thread and its queue, tasks are linked from the oldest one to the newest one
+     */
+    struct worker_t {
+        work_stealing_pool *pool_ptr  = nullptr;
+        uint32_t           index      = 0u;
+        native_thread_t    thread{};
+        std::mutex         mutex;                   /**< Protects the queue */
+        executor_task_t    *oldest_ptr = nullptr;
+        executor_task_t    *newest_ptr = nullptr;
+
+        void push(executor_task_t *task_ptr) noexcept {
+            task_ptr->previous_ptr = newest_ptr;
+            task_ptr->next_ptr     = nullptr;
+
+            if (newest_ptr) {
+                newest_ptr->next_ptr = task_ptr;
+            } else {
+                oldest_ptr = task_ptr;
+            }
+
+            newest_ptr = task_ptr;
+        }
+
+        auto pop_newest() noexcept -> executor_task_t * {
+            auto *task_ptr = newest_ptr;
+
+            if (task_ptr) {
+                newest_ptr = task_ptr->previous_ptr;
+                (newest_ptr ? newest_ptr->next_ptr : oldest_ptr) = nullptr;
+            }
+
+            return task_ptr;
+        }
+
+        auto pop_oldest() noexcept -> executor_task_t * {
+            auto *task_ptr = oldest_ptr;
+
+            if (task_ptr) {
+                oldest_ptr = task_ptr->next_ptr;
+                (oldest_ptr ? oldest_ptr->previous_ptr : newest_ptr) = nullptr;
+            }
+
+            return task_ptr;
+        }
+    };
+
+public:
+    work_stealing_pool() noexcept = default;
+
+    work_stealing_pool(const work_stealing_pool &other) = delete;
+
+    auto operator=(const work_stealing_pool &other) -> work_stealing_pool & = delete;
+
+    ~work_stealing_pool() noexcept {
+        stop();
+    }
+
+    [[nodiscard]] auto initialize(uint32_t threads_count,
+                                  const uint32_t *cpu_ids_ptr,
+                                  uint32_t cpu_ids_count) noexcept -> qpl_ml_status {
+        workers_.reset(new (std::nothrow) worker_t[threads_count]);
+
+        if (!workers_) {
+            return status_list::memory_allocation_error;
+        }
+
+        workers_count_ = threads_count;
+
+        for (uint32_t i = 0u; i < threads_count; i++) {
+            auto &worker = workers_[i];
+
+            worker.pool_ptr = this;
+            worker.index    = i;
+
+#if defined(linux)
+            if (0 != pthread_create(&worker.thread, nullptr, &work_stealing_pool::run, &worker)) {
+                stop();
+
+                return status_list::memory_allocation_error;
+            }
+
+            if (0u != cpu_ids_count) {
+                cpu_set_t cpu_set;
+                CPU_ZERO(&cpu_set);
+                CPU_SET(cpu_ids_ptr[i % cpu_ids_count], &cpu_set);
+
+                // Pinning is a hint, workers keep running if the CPU is not available
+                pthread_setaffinity_np(worker.thread, sizeof(cpu_set), &cpu_set);
+            }
+#else
+            worker.thread = std::thread(&work_stealing_pool::run, &worker);
+#endif
+
+            started_count_++;
+        }
+
+        return status_list::ok;
+    }
+
+    void submit(executor_task_t *task_ptr) noexcept {
+        auto &worker = workers_[(current_pool_ == this)
+                                ? current_worker_
+                                : next_worker_.fetch_add(1u, std::memory_order_relaxed) % workers_count_];
+
+        // The task is counted before it is published, so a worker never takes a task that is not counted yet
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_tasks_++;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.push(task_ptr);
+        }
+
+        condition_.notify_one();
+    }
+
+    void submit(executor_task_t *const *tasks_ptr, uint32_t tasks_count) noexcept {
+        const auto first_worker = (current_pool_ == this)
+                                  ? current_worker_
+                                  : next_worker_.fetch_add(1u, std::memory_order_relaxed) % workers_count_;
+        const auto used_workers = std::min(workers_count_, tasks_count);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_tasks_ += tasks_count;
+        }
+
+        for (uint32_t i = 0u; i < used_workers; i++) {
+            const uint32_t begin  = static_cast<uint32_t>(uint64_t(tasks_count) * i / used_workers);
+            const uint32_t end    = static_cast<uint32_t>(uint64_t(tasks_count) * (i + 1u) / used_workers);
+            auto           &worker = workers_[(first_worker + i) % workers_count_];
+
+            std::lock_guard<std::mutex> lock(worker.mutex);
+
+            for (uint32_t j = begin; j < end; j++) {
+                worker.push(tasks_ptr[j]);
+            }
+        }
+
+        condition_.notify_all();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> uint32_t {
+        return workers_count_;
+    }
+
+    [[nodiscard]] static auto is_worker_thread() noexcept -> bool {
+        return nullptr != current_pool_;
+    }
+
+private:
+    /**
+     * @brief Completes the queued tasks and joins the started workers
+     */
+    void stop() noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            is_stopped_ = true;
+        }
+
+        condition_.notify_all();
+
+        for (uint32_t i = 0u; i < started_count_; i++) {
+#if defined(linux)
+            pthread_join(workers_[i].thread, nullptr);
+#else
+            workers_[i].thread.join();
+#endif
+        }
+
+        started_count_ = 0u;
+    }
+
+    static auto run(void *worker_ptr) noexcept -> void * {
+        auto &worker = *reinterpret_cast<worker_t *>(worker_ptr);
+        auto &pool   = *worker.pool_ptr;
+
+        current_pool_   = &pool;
+        current_worker_ = worker.index;
+
+        while (true) {
+            auto *task_ptr = pool.pop(worker.index);
+
+            if (task_ptr) {
+                task_ptr->routine(task_ptr->context);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(pool.mutex_);
+            pool.condition_.wait(lock, [&pool]() -> bool {
+                return pool.is_stopped_ || pool.pending_tasks_ != 0u;
+            });
+
+            // Queued tasks are completed before the pool is stopped
+            if (pool.pending_tasks_ == 0u) {
+                break;
+            }
+        }
+
+        current_pool_ = nullptr;
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Takes the newest task of the own queue or the oldest task of another queue
+     */
+    auto pop(uint32_t index) noexcept -> executor_task_t * {
+        for (uint32_t i = 0u; i < workers_count_; i++) {
+            auto            &worker  = workers_[(index + i) % workers_count_];
+            executor_task_t *task_ptr = nullptr;
+
+            {
+                std::lock_guard<std::mutex> lock(worker.mutex);
+
+                task_ptr = (i == 0u) ? worker.pop_newest() : worker.pop_oldest();
+            }
+
+            if (task_ptr) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                pending_tasks_--;
+
+                return task_ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static thread_local work_stealing_pool *current_pool_;     /**< Pool the current thread works for */
+    static thread_local uint32_t           current_worker_;    /**< Index of the current worker */
+
+    std::unique_ptr<worker_t[]> workers_;                    /**< Workers and their queues */
+    uint32_t                    workers_count_ = 0u;         /**< Number of allocated workers */
+    uint32_t                    started_count_ = 0u;         /**< Number of started workers */
+    std::atomic<uint32_t>       next_worker_{0u};            /**< Queue for the next external task */
+    std::mutex                  mutex_;                      /**< Protects the counter and the stop flag */
+    std::condition_variable     condition_;                  /**< Wakes idle workers up */
+    uint32_t                    pending_tasks_ = 0u;         /**< Number of tasks in all queues */
+    bool                        is_stopped_    = false;      /**< Set once the pool is stopped */
+};
+
+thread_local work_stealing_pool *work_stealing_pool::current_pool_   = nullptr;
+thread_local uint32_t           work_stealing_pool::current_worker_ = 0u;
+
+// The pool is never destroyed implicitly, as joining workers during the static destruction is not safe
+std::shared_mutex           executor_mutex;            /**< Shared by submissions, exclusive for the pool replacement */
+work_stealing_pool          *executor_pool = nullptr;  /**< Pool that is started with the first task */
+uint32_t                    executor_threads_count = 0u;
+std::unique_ptr<uint32_t[]> executor_cpu_ids;
+uint32_t                    executor_cpu_ids_count = 0u;
+
+auto get_default_threads_count() noexcept -> uint32_t {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Calls the submission with the pool, the pool is started if there is no one
+ */
+template <class submission_t>
+auto submit_to_pool(submission_t submission) noexcept -> qpl_ml_status {
+    {
+        std::shared_lock<std::shared_mutex> lock(executor_mutex);
+
+        if (executor_pool) {
+            submission(*executor_pool);
+
+            return status_list::ok;
+        }
+    }
+
+    std::lock_guard<std::shared_mutex> lock(executor_mutex);
+
+    if (!executor_pool) {
+        const auto threads_count = (executor_threads_count == 0u) ? get_default_threads_count()
+                                                                  : executor_threads_count;
+
+        std::unique_ptr<work_stealing_pool> pool(new (std::nothrow) work_stealing_pool());
+
+        if (!pool) {
+            return status_list::memory_allocation_error;
+        }
+
+        const auto status = pool->initialize(threads_count, executor_cpu_ids.get(), executor_cpu_ids_count);
+
+        if (status_list::ok != status) {
+            return status;
+        }
+
+        executor_pool = pool.release();
+    }
+
+    submission(*executor_pool);
+
+    return status_list::ok;
+}
+
+/**
+ * @brief Detaches the current pool, it is stopped by the caller outside of the lock
+ */
+auto detach_pool() noexcept -> std::unique_ptr<work_stealing_pool> {
+    std::unique_ptr<work_stealing_pool> pool(executor_pool);
+
+    executor_pool = nullptr;
+
+    return pool;
+}
+
+} // anonymous namespace
+
+auto execute_async(executor_task_t *task_ptr) noexcept -> qpl_ml_status {
+    return submit_to_pool([task_ptr](work_stealing_pool &pool) -> void {
+        pool.submit(task_ptr);
+    });
+}
+
+auto execute_async(executor_task_t *const *tasks_ptr, uint32_t tasks_count) noexcept -> qpl_ml_status {
+    if (0u == tasks_count) {
+        return status_list::ok;
+    }
+
+    return submit_to_pool([tasks_ptr, tasks_count](work_stealing_pool &pool) -> void {
+        pool.submit(tasks_ptr, tasks_count);
+    });
+}
+
+auto configure_executor(uint32_t threads_count,
+                        const uint32_t *cpu_ids_ptr,
+                        uint32_t cpu_ids_count) noexcept -> qpl_ml_status {
+    if (work_stealing_pool::is_worker_thread()) {
+        return status_list::not_supported_err;
+    }
+
+    std::unique_ptr<uint32_t[]> cpu_ids;
+
+    if (0u != cpu_ids_count) {
+        cpu_ids.reset(new (std::nothrow) uint32_t[cpu_ids_count]);
+
+        if (!cpu_ids) {
+            return status_list::memory_allocation_error;
+        }
+
+        std::copy(cpu_ids_ptr, cpu_ids_ptr + cpu_ids_count, cpu_ids.get());
+    }
+
+    std::unique_ptr<work_stealing_pool> previous_pool;
+
+    {
+        std::lock_guard<std::shared_mutex> lock(executor_mutex);
+
+        executor_threads_count = threads_count;
+        executor_cpu_ids_count = cpu_ids_count;
+        executor_cpu_ids.swap(cpu_ids);
+
+        previous_pool = detach_pool();
+    }
+
+    // The previous pool is drained outside of the lock, so new tasks go to the new pool meanwhile
+    return status_list::ok;
+}
+
+auto shutdown_executor() noexcept -> qpl_ml_status {
+    if (work_stealing_pool::is_worker_thread()) {
+        return status_list::not_supported_err;
+    }
+
+    std::unique_ptr<work_stealing_pool> pool;
+
+    {
+        std::lock_guard<std::shared_mutex> lock(executor_mutex);
+
+        pool = detach_pool();
+    }
+
+    return status_list::ok;
+}
+
+auto get_executor_threads_count() noexcept -> uint32_t {
+    std::shared_lock<std::shared_mutex> lock(executor_mutex);
+
+    if (executor_pool) {
+        return executor_pool->size();
+    }
+
+    return (executor_threads_count == 0u) ? get_default_threads_count() : executor_threads_count;
+}
+
+} // namespace qpl::ml::util
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Middle Layer API (private C++ API)
+ */
+
+#ifndef QPL_EXECUTOR_HPP
+#define QPL_EXECUTOR_HPP
+
+#include <cstdint>
+
+#include "common/defs.hpp"
+
+namespace qpl::ml::util {
+
+/**
+ * @brief Routine that is run by the executor with the context given at submission
+ */
+using task_routine_t = void (*)(void *context);
+
+/**
+ * @brief Task of the executor, the memory is owned by the submitter and is not touched after the routine is called
+ *
+ * @note Links are used by the executor while the task is queued, so the submission never allocates
+ */
+struct executor_task_t {
+    task_routine_t  routine      = nullptr;
+    void            *context     = nullptr;
+    executor_task_t *previous_ptr = nullptr;    /**< Previous task of the worker queue */
+    executor_task_t *next_ptr     = nullptr;    /**< Next task of the worker queue */
+};
+
+/**
+ * @brief Enqueues the task to the internal work-stealing pool of worker threads
+ *
+ * @note Workers are started with the first submitted task. A task submitted from a worker
+ *       is put to the queue of this worker, other tasks are distributed between queues round-robin.
+ *       Idle workers steal tasks from queues of busy ones, so tasks are not started in the submission order.
+ *
+ * @param  task_ptr  task whose routine is called by one of the workers
+ *
+ * @return status_list::memory_allocation_error if the workers can't be started
+ */
+[[nodiscard]] auto execute_async(executor_task_t *task_ptr) noexcept -> qpl_ml_status;
+
+/**
+ * @brief Enqueues the group of tasks, queues are locked once per group
+ *
+ * @note Tasks are spread between queues in contiguous ranges, so idle workers steal them in bulk.
+ *
+ * @param  tasks_ptr    tasks whose routines are called by the workers
+ * @param  tasks_count  number of tasks
+ *
+ * @return status_list::memory_allocation_error if the workers can't be started, none of the tasks is queued then
+ */
+[[nodiscard]] auto execute_async(executor_task_t *const *tasks_ptr, uint32_t tasks_count) noexcept -> qpl_ml_status;
+
+/**
+ * @brief Sets the configuration of the pool and stops the current pool, the next task starts the new one
+ *
+ * @note Tasks queued to the previous pool are completed before its workers are stopped
+ *
+ * @param  threads_count  number of workers, 0 means the number of hardware threads
+ * @param  cpu_ids_ptr    CPUs that workers are pinned to round-robin, may be null if cpu_ids_count is 0
+ * @param  cpu_ids_count  number of CPUs, 0 means workers are not pinned
+ *
+ * @return status_list::not_supported_err if it is called from a worker, as the worker would wait for itself
+ */
+[[nodiscard]] auto configure_executor(uint32_t threads_count,
+                                      const uint32_t *cpu_ids_ptr,
+                                      uint32_t cpu_ids_count) noexcept -> qpl_ml_status;
+
+/**
+ * @brief Completes the queued tasks and stops the workers, the next task starts the pool again
+ *
+ * @note The pool is never stopped implicitly, workers that are not stopped live until the process exits
+ *
+ * @return status_list::not_supported_err if it is called from a worker, as the worker would wait for itself
+ */
+[[nodiscard]] auto shutdown_executor() noexcept -> qpl_ml_status;
+
+/**
+ * @brief Returns the number of workers the pool has or would have once started
+ */
+auto get_executor_threads_count() noexcept -> uint32_t;
+
+} // namespace qpl::ml::util
+
+#endif // QPL_EXECUTOR_HPP
@@ -9,6 +9,10 @@
 
 #include "common/defs.hpp"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 extern "C" const uint8_t own_reversed_bits_table[];
 
 namespace qpl::ml {
@@ -84,6 +88,21 @@ inline size_t bit_to_byte(const size_t value) noexcept {
     return bytes;
 }
 
+/**
+ * @brief Returns index of the lowest set bit of the non-zero value
+ */
+inline uint32_t trailing_zeros(const uint64_t value) noexcept {
+#if defined(_MSC_VER)
+    unsigned long index = 0u;
+
+    _BitScanForward64(&index, value);
+
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
 template <class T>
 inline T revert_bits(T value) noexcept;
 
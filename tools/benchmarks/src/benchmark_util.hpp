@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef QPL_BENCHMARK_UTIL_HPP
+#define QPL_BENCHMARK_UTIL_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.h"
+#include "algorithmic_dataset.hpp"
+
+namespace qpl::bench {
+
+/**
+ * @brief Environment variable that overrides the dataset path compiled into the benchmarks
+ */
+constexpr const char *dataset_variable = "QPL_BENCHMARK_DATASET";
+
+struct path_description_t {
+    const char *name;
+    qpl_path_t path;
+};
+
+/**
+ * @brief Execution paths that are benchmarked, hardware benchmarks are skipped if there is no accelerator
+ */
+constexpr path_description_t execution_paths[] = {
+        {"software", qpl_path_software},
+        {"hardware", qpl_path_hardware}
+};
+
+/**
+ * @brief Returns the path to the dataset that is used by benchmarks working with real data
+ */
+inline auto get_dataset_path() -> std::string {
+    const char *path = std::getenv(dataset_variable);
+
+    return (path != nullptr) ? std::string(path) : std::string(QPL_BENCHMARK_DATASET_PATH);
+}
+
+/**
+ * @brief Returns files of the algorithmic dataset, the dataset is empty if the path doesn't exist
+ */
+inline auto get_dataset() -> const std::vector<std::pair<std::string, std::vector<uint8_t>>> & {
+    static const auto dataset = []() {
+        std::vector<std::pair<std::string, std::vector<uint8_t>>> result;
+
+        if (std::filesystem::is_directory(get_dataset_path())) {
+            const qpl::tools::algorithmic_dataset_t files(get_dataset_path());
+
+            result.assign(files.get_data().begin(), files.get_data().end());
+        }
+
+        // Stable order of files keeps benchmark names in the same order between runs
+        std::sort(result.begin(), result.end(), [](const auto &left, const auto &right) {
+            return left.first < right.first;
+        });
+
+        return result;
+    }();
+
+    return dataset;
+}
+
+/**
+ * @brief Allocates and initializes the job for the given path
+ *
+ * @return empty pointer if the path is not available
+ */
+inline auto make_job(qpl_path_t path) -> std::unique_ptr<uint8_t[]> {
+    uint32_t size = 0u;
+
+    if (QPL_STS_OK != qpl_get_job_size(path, &size)) {
+        return nullptr;
+    }
+
+    auto buffer = std::make_unique<uint8_t[]>(size);
+
+    if (QPL_STS_OK != qpl_init_job(path, reinterpret_cast<qpl_job *>(buffer.get()))) {
+        return nullptr;
+    }
+
+    return buffer;
+}
+
+/**
+ * @brief Collects latencies of separate iterations and reports their percentiles as counters
+ *
+ * @note The number of kept samples is bounded: once the storage is full, every second sample is dropped
+ *       and only every second of the following iterations is recorded, so samples stay uniformly distributed
+ */
+class latency_recorder {
+    using clock_t = std::chrono::steady_clock;
+
+    static constexpr size_t max_samples = 64u * 1024u;
+
+public:
+    latency_recorder() {
+        samples_.reserve(max_samples);
+    }
+
+    void start() noexcept {
+        start_ = clock_t::now();
+    }
+
+    void stop() {
+        const auto latency = std::chrono::duration<double, std::micro>(clock_t::now() - start_).count();
+
+        if (iteration_++ % stride_ != 0u) {
+            return;
+        }
+
+        if (samples_.size() == max_samples) {
+            for (size_t i = 0u; i < max_samples / 2u; i++) {
+                samples_[i] = samples_[2u * i];
+            }
+
+            samples_.resize(max_samples / 2u);
+            stride_ *= 2u;
+        }
+
+        samples_.push_back(latency);
+    }
+
+    /**
+     * @brief Adds p50_us, p90_us and p99_us counters to the benchmark report
+     */
+    void report(benchmark::State &state) {
+        if (samples_.empty()) {
+            return;
+        }
+
+        std::sort(samples_.begin(), samples_.end());
+
+        for (auto [name, percentile] : {std::pair{"p50_us", 50u}, std::pair{"p90_us", 90u}, std::pair{"p99_us", 99u}}) {
+            const auto position = std::min(samples_.size() - 1u, samples_.size() * percentile / 100u);
+
+            state.counters[name] = benchmark::Counter(samples_[position]);
+        }
+    }
+
+private:
+    std::vector<double>   samples_;
+    clock_t::time_point   start_;
+    uint64_t              iteration_ = 0u;
+    uint64_t              stride_    = 1u;
+};
+
+/**
+ * @brief Executes the job in the benchmark loop, the job is configured by the given callable before each run
+ *
+ * @param  state              benchmark state
+ * @param  job_ptr            initialized job
+ * @param  prepare            callable that sets operation parameters and buffers of the job
+ * @param  bytes_per_iteration number of source bytes processed by one execution
+ */
+template <class prepare_t>
+void run_job(benchmark::State &state, qpl_job *job_ptr, prepare_t &&prepare, size_t bytes_per_iteration) {
+    latency_recorder latency;
+
+    for (auto _ : state) {
+        prepare(job_ptr);
+
+        latency.start();
+        const auto status = qpl_execute_job(job_ptr);
+        latency.stop();
+
+        if (status != QPL_STS_OK) {
+            state.SkipWithError(("Operation failed with status " + std::to_string(status)).c_str());
+            break;
+        }
+    }
+
+    latency.report(state);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes_per_iteration));
+}
+
+} // namespace qpl::bench
+
+#endif // QPL_BENCHMARK_UTIL_HPP
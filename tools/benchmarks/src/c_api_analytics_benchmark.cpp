@@ -0,0 +1,423 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Measures throughput and latency percentiles of analytics operations of the low-level API
+ *
+ * @details Benchmarks are named <operation>/<path>/<parser>/width:<bits>/elements:<count>. Sources are
+ *          produced by the test generators, the mask for select and expand has every second bit set.
+ *          Set membership with QPL_FLAG_SET_LIST is named set_membership_list/<path>/domain:<bits>/keys:<count>,
+ *          domains of 15 bits are compared with the bit vector set, wider ones use the hash set.
+ *          Index output of scan is named scan_indices/<path>/<output>/selectivity:<permille>, matches are
+ *          grouped in clusters, so 32-bit indices may be compared with range encoded output. Checksums and
+ *          aggregates are omitted there.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "benchmark_util.hpp"
+#include "source_provider.hpp"
+
+namespace {
+
+constexpr uint32_t seed                = 12345u;
+constexpr uint32_t max_set_bit_width   = 15u;
+constexpr uint8_t  every_second_bit    = 0x55u;
+constexpr uint32_t destination_padding = 64u;
+
+struct operation_description_t {
+    const char    *name;
+    qpl_operation operation;
+};
+
+constexpr operation_description_t operations[] = {
+        {"scan_eq",        qpl_op_scan_eq},
+        {"scan_ne",        qpl_op_scan_ne},
+        {"scan_lt",        qpl_op_scan_lt},
+        {"scan_le",        qpl_op_scan_le},
+        {"scan_gt",        qpl_op_scan_gt},
+        {"scan_ge",        qpl_op_scan_ge},
+        {"scan_range",     qpl_op_scan_range},
+        {"scan_not_range", qpl_op_scan_not_range},
+        {"extract",        qpl_op_extract},
+        {"select",         qpl_op_select},
+        {"expand",         qpl_op_expand},
+        {"find_unique",    qpl_op_find_unique},
+        {"set_membership", qpl_op_set_membership},
+        {"rle_burst",      qpl_op_rle_burst}
+};
+
+struct parser_description_t {
+    const char *name;
+    qpl_parser parser;
+};
+
+constexpr parser_description_t parsers[] = {
+        {"le", qpl_p_le_packed_array},
+        {"be", qpl_p_be_packed_array},
+        {"prle", qpl_p_parquet_rle}
+};
+
+constexpr uint32_t bit_widths[]     = {1u, 5u, 8u, 16u, 32u};
+constexpr uint32_t element_counts[] = {4u * 1024u, 64u * 1024u, 1024u * 1024u};
+
+/**
+ * @brief Buffers of one benchmark case that are prepared before the measurement
+ */
+struct analytics_case_t {
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> source2;
+    std::vector<uint8_t> destination;
+    uint32_t             elements_count = 0u;
+    uint32_t             src1_bit_width = 0u;
+    uint32_t             src2_bit_width = 0u;
+    uint32_t             param_low      = 0u;
+    uint32_t             param_high     = 0u;
+};
+
+auto make_case(qpl_operation operation,
+               qpl_parser parser,
+               uint32_t bit_width,
+               uint32_t elements_count) -> analytics_case_t {
+    analytics_case_t test_case;
+
+    const uint64_t max_value    = (bit_width == 32u) ? UINT32_MAX : (1ull << bit_width) - 1u;
+    const uint32_t dropped_bits = (bit_width > max_set_bit_width) ? bit_width - max_set_bit_width : 0u;
+
+    test_case.elements_count = elements_count;
+    test_case.src1_bit_width = bit_width;
+    test_case.source         = qpl::test::source_provider(elements_count, bit_width, seed, parser).get_source();
+    test_case.destination.resize(elements_count * sizeof(uint32_t) + destination_padding);
+
+    switch (operation) {
+        case qpl_op_scan_range:
+        case qpl_op_scan_not_range:
+            test_case.param_low  = static_cast<uint32_t>(max_value / 4u);
+            test_case.param_high = static_cast<uint32_t>(max_value / 4u * 3u);
+            break;
+        case qpl_op_extract:
+            test_case.param_low  = elements_count / 4u;
+            test_case.param_high = elements_count / 4u * 3u;
+            break;
+        case qpl_op_select:
+            test_case.source2.assign((elements_count + 7u) / 8u, every_second_bit);
+            test_case.src2_bit_width = 1u;
+            break;
+        case qpl_op_expand:
+            // Every second bit is set, so only a half of source elements is used. The source still has
+            // as many elements as the mask, as PRLE stream is required to hold all input elements
+            test_case.source = qpl::test::source_provider(2u * elements_count, bit_width, seed, parser).get_source();
+            test_case.source2.assign((2u * elements_count + 7u) / 8u, every_second_bit);
+            test_case.src2_bit_width = 1u;
+            test_case.elements_count = 2u * elements_count;
+            test_case.destination.resize(2u * elements_count * sizeof(uint32_t) + destination_padding);
+            break;
+        case qpl_op_find_unique:
+            test_case.param_low = dropped_bits;
+            test_case.destination.resize((1u << (bit_width - dropped_bits)) / 8u + destination_padding);
+            break;
+        case qpl_op_set_membership:
+            test_case.param_low = dropped_bits;
+            test_case.source2.assign(((1u << (bit_width - dropped_bits)) + 7u) / 8u, every_second_bit);
+            test_case.src2_bit_width = 1u;
+            break;
+        case qpl_op_rle_burst: {
+            // 8-bit counters keep run lengths 1..4, source elements become symbols
+            test_case.source2 = test_case.source;
+            test_case.source.resize(elements_count);
+
+            uint32_t output_elements = 0u;
+
+            for (uint32_t i = 0u; i < elements_count; i++) {
+                test_case.source[i] = static_cast<uint8_t>(i % 4u + 1u);
+                output_elements += test_case.source[i];
+            }
+
+            test_case.src1_bit_width = 8u;
+            test_case.src2_bit_width = bit_width;
+            test_case.destination.resize(output_elements * sizeof(uint32_t) + destination_padding);
+            break;
+        }
+        default:
+            test_case.param_low = static_cast<uint32_t>(max_value / 2u);
+            break;
+    }
+
+    return test_case;
+}
+
+void analytics_execute(benchmark::State &state,
+                       qpl_path_t path,
+                       qpl_operation operation,
+                       qpl_parser parser,
+                       uint32_t bit_width,
+                       uint32_t elements_count) {
+    auto job_buffer = qpl::bench::make_job(path);
+
+    if (!job_buffer) {
+        state.SkipWithError("Execution path is not available");
+        return;
+    }
+
+    auto test_case = make_case(operation, parser, bit_width, elements_count);
+
+    qpl::bench::run_job(state, reinterpret_cast<qpl_job *>(job_buffer.get()), [&](qpl_job *job_ptr) {
+        job_ptr->op                 = operation;
+        job_ptr->parser             = (operation == qpl_op_rle_burst) ? qpl_p_le_packed_array : parser;
+        job_ptr->next_in_ptr        = test_case.source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(test_case.source.size());
+        job_ptr->next_out_ptr       = test_case.destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(test_case.destination.size());
+        job_ptr->src1_bit_width     = test_case.src1_bit_width;
+        job_ptr->num_input_elements = test_case.elements_count;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->param_low          = test_case.param_low;
+        job_ptr->param_high         = test_case.param_high;
+        job_ptr->flags              = 0u;
+
+        if (!test_case.source2.empty()) {
+            job_ptr->next_src2_ptr  = test_case.source2.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(test_case.source2.size());
+            job_ptr->src2_bit_width = test_case.src2_bit_width;
+        }
+    }, test_case.source.size());
+}
+
+constexpr uint32_t set_list_elements_count = 1024u * 1024u;
+
+/**
+ * @brief Set membership of 32-bit elements with the set given as a list of keys, a half of elements is in the set
+ *
+ * @note Domain of 15 bits and less is looked up in the byte per key set, so the list mode is compared
+ *       with the bit vector set of the same keys when bit_vector_set is true
+ */
+void set_membership_list_execute(benchmark::State &state,
+                                 qpl_path_t path,
+                                 uint32_t domain_bit_width,
+                                 uint32_t keys_count,
+                                 bool bit_vector_set) {
+    auto job_buffer = qpl::bench::make_job(path);
+
+    if (!job_buffer) {
+        state.SkipWithError("Execution path is not available");
+        return;
+    }
+
+    constexpr uint32_t source_bit_width = 32u;
+
+    const uint32_t key_mask = (domain_bit_width == source_bit_width) ? UINT32_MAX : (1u << domain_bit_width) - 1u;
+
+    std::mt19937                            engine(seed);
+    std::uniform_int_distribution<uint32_t> distribution;
+
+    std::vector<uint32_t> keys(keys_count);
+    std::vector<uint32_t> source(set_list_elements_count);
+    std::vector<uint8_t>  bit_vector(((1ull << domain_bit_width) + 7u) / 8u);
+    std::vector<uint8_t>  destination(set_list_elements_count / 8u + destination_padding);
+
+    for (auto &key : keys) {
+        key = distribution(engine) & key_mask;
+
+        if (bit_vector_set) {
+            bit_vector[key / 8u] |= static_cast<uint8_t>(1u << (key % 8u));
+        }
+    }
+
+    for (uint32_t i = 0u; i < set_list_elements_count; i++) {
+        source[i] = (i % 2u) ? keys[distribution(engine) % keys_count] : distribution(engine) & key_mask;
+    }
+
+    qpl::bench::run_job(state, reinterpret_cast<qpl_job *>(job_buffer.get()), [&](qpl_job *job_ptr) {
+        job_ptr->op                 = qpl_op_set_membership;
+        job_ptr->parser             = qpl_p_le_packed_array;
+        job_ptr->next_in_ptr        = reinterpret_cast<uint8_t *>(source.data());
+        job_ptr->available_in       = static_cast<uint32_t>(source.size() * sizeof(uint32_t));
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+        job_ptr->src1_bit_width     = source_bit_width;
+        job_ptr->num_input_elements = set_list_elements_count;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->param_low          = 0u;
+        job_ptr->param_high         = source_bit_width - domain_bit_width;
+
+        if (bit_vector_set) {
+            job_ptr->next_src2_ptr  = bit_vector.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(bit_vector.size());
+            job_ptr->src2_bit_width = 1u;
+            job_ptr->flags          = 0u;
+        } else {
+            job_ptr->next_src2_ptr  = reinterpret_cast<uint8_t *>(keys.data());
+            job_ptr->available_src2 = static_cast<uint32_t>(keys.size() * sizeof(uint32_t));
+            job_ptr->src2_bit_width = 32u;
+            job_ptr->flags          = QPL_FLAG_SET_LIST;
+        }
+    }, source.size() * sizeof(uint32_t));
+}
+
+void register_set_membership_list_benchmarks() {
+    for (const auto &path : qpl::bench::execution_paths) {
+        // Set list is processed on the software path only
+        if (path.path == qpl_path_hardware) {
+            continue;
+        }
+
+        for (uint32_t domain_bit_width : {max_set_bit_width, 20u, 32u}) {
+            for (uint32_t keys_count : {1024u, 100u * 1024u}) {
+                const std::string suffix = std::string("/") + path.name +
+                                           "/domain:" + std::to_string(domain_bit_width) +
+                                           "/keys:" + std::to_string(keys_count);
+
+                benchmark::RegisterBenchmark(("c_api_set_membership_list" + suffix).c_str(),
+                                             set_membership_list_execute,
+                                             path.path,
+                                             domain_bit_width,
+                                             keys_count,
+                                             false);
+
+                if (domain_bit_width <= max_set_bit_width) {
+                    benchmark::RegisterBenchmark(("c_api_set_membership_bit_vector" + suffix).c_str(),
+                                                 set_membership_list_execute,
+                                                 path.path,
+                                                 domain_bit_width,
+                                                 keys_count,
+                                                 true);
+                }
+            }
+        }
+    }
+}
+
+constexpr uint32_t selectivity_elements_count = 1024u * 1024u;
+constexpr uint32_t cluster_size               = 16u;
+constexpr uint32_t permille                   = 1000u;
+
+/**
+ * @brief Scan of 32-bit elements with index output, every cluster of elements either matches or not
+ */
+void scan_indices_execute(benchmark::State &state,
+                          qpl_path_t path,
+                          qpl_out_format out_bit_width,
+                          uint32_t flags,
+                          uint32_t selectivity_permille) {
+    auto job_buffer = qpl::bench::make_job(path);
+
+    if (!job_buffer) {
+        state.SkipWithError("Execution path is not available");
+        return;
+    }
+
+    std::mt19937                            engine(seed);
+    std::uniform_int_distribution<uint32_t> distribution(0u, permille - 1u);
+
+    std::vector<uint32_t> source(selectivity_elements_count);
+    std::vector<uint8_t>  destination(selectivity_elements_count * sizeof(uint32_t) + destination_padding);
+
+    for (uint32_t i = 0u; i < selectivity_elements_count; i += cluster_size) {
+        const uint32_t value = distribution(engine);
+
+        for (uint32_t j = i; j < i + cluster_size; j++) {
+            source[j] = value;
+        }
+    }
+
+    qpl::bench::run_job(state, reinterpret_cast<qpl_job *>(job_buffer.get()), [&](qpl_job *job_ptr) {
+        job_ptr->op                 = qpl_op_scan_lt;
+        job_ptr->parser             = qpl_p_le_packed_array;
+        job_ptr->next_in_ptr        = reinterpret_cast<uint8_t *>(source.data());
+        job_ptr->available_in       = static_cast<uint32_t>(source.size() * sizeof(uint32_t));
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+        job_ptr->src1_bit_width     = 32u;
+        job_ptr->num_input_elements = selectivity_elements_count;
+        job_ptr->out_bit_width      = out_bit_width;
+        job_ptr->param_low          = selectivity_permille;
+        // Checksums of the source would take most of the time
+        job_ptr->flags              = flags | QPL_FLAG_OMIT_CHECKSUMS | QPL_FLAG_OMIT_AGGREGATES;
+    }, source.size() * sizeof(uint32_t));
+}
+
+void register_scan_indices_benchmarks() {
+    struct output_description_t {
+        const char     *name;
+        qpl_out_format out_bit_width;
+        uint32_t       flags;
+    };
+
+    constexpr output_description_t outputs[] = {
+            {"nominal", qpl_ow_nom, 0u},
+            {"ow_32",   qpl_ow_32,  0u},
+            {"ranges",  qpl_ow_32,  QPL_FLAG_OUT_RANGES}
+    };
+
+    for (const auto &path : qpl::bench::execution_paths) {
+        for (const auto &output : outputs) {
+            // Range encoded output is written on the software path only
+            if (path.path == qpl_path_hardware && 0u != output.flags) {
+                continue;
+            }
+
+            for (uint32_t selectivity_permille : {1u, 10u, 100u, 500u}) {
+                const std::string name = std::string("c_api_scan_indices/") + path.name +
+                                         "/" + output.name +
+                                         "/selectivity:" + std::to_string(selectivity_permille);
+
+                benchmark::RegisterBenchmark(name.c_str(),
+                                             scan_indices_execute,
+                                             path.path,
+                                             output.out_bit_width,
+                                             output.flags,
+                                             selectivity_permille);
+            }
+        }
+    }
+}
+
+int register_benchmarks() {
+    for (const auto &operation : operations) {
+        for (const auto &path : qpl::bench::execution_paths) {
+            for (const auto &parser : parsers) {
+                // Run-lengths are always stored in a packed array of 8-bit counters
+                if (operation.operation == qpl_op_rle_burst && parser.parser != qpl_p_le_packed_array) {
+                    continue;
+                }
+
+                for (uint32_t bit_width : bit_widths) {
+                    for (uint32_t elements_count : element_counts) {
+                        const std::string name = std::string("c_api_") + operation.name +
+                                                 "/" + path.name +
+                                                 "/" + parser.name +
+                                                 "/width:" + std::to_string(bit_width) +
+                                                 "/elements:" + std::to_string(elements_count);
+
+                        benchmark::RegisterBenchmark(name.c_str(),
+                                                     analytics_execute,
+                                                     path.path,
+                                                     operation.operation,
+                                                     parser.parser,
+                                                     bit_width,
+                                                     elements_count);
+                    }
+                }
+            }
+        }
+    }
+
+    register_set_membership_list_benchmarks();
+    register_scan_indices_benchmarks();
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Measures per-job overhead of asynchronous submission of many small jobs of the low-level API
+ *
+ * @details Benchmarks are named scan_<mode>/<path>/size:<bytes>/jobs:<count>. The jobs mode submits every
+ *          job with qpl_submit_job and waits for them with qpl_wait_job, the batch mode uses qpl_submit_batch
+ *          and qpl_wait_batch. Each job scans its own 8-bit source, the job_time counter is the time per job.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "benchmark_util.hpp"
+
+namespace {
+
+constexpr uint32_t scan_boundary = 100u;
+constexpr uint32_t jobs_counts[]  = {16u, 64u, 512u};
+constexpr uint32_t source_sizes[] = {1024u, 4u * 1024u, 16u * 1024u, 64u * 1024u};
+
+void scan_jobs_execute(benchmark::State &state, qpl_path_t path, uint32_t size, uint32_t jobs_count, bool use_batch) {
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffers;
+    std::vector<qpl_job *>                  jobs;
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        job_buffers.push_back(qpl::bench::make_job(path));
+
+        if (!job_buffers.back()) {
+            state.SkipWithError("Execution path is not available");
+            return;
+        }
+
+        jobs.push_back(reinterpret_cast<qpl_job *>(job_buffers.back().get()));
+    }
+
+    std::vector<uint8_t> source(size);
+    std::iota(source.begin(), source.end(), 0u);
+
+    std::vector<std::vector<uint8_t>> destinations(jobs_count, std::vector<uint8_t>(size / 8u));
+    std::vector<qpl_status>           statuses(jobs_count);
+
+    const auto prepare = [&]() -> void {
+        for (uint32_t i = 0u; i < jobs_count; i++) {
+            auto *job_ptr = jobs[i];
+
+            job_ptr->op                 = qpl_op_scan_lt;
+            job_ptr->param_low          = scan_boundary;
+            job_ptr->src1_bit_width     = 8u;
+            job_ptr->out_bit_width      = qpl_ow_nom;
+            job_ptr->num_input_elements = size;
+            job_ptr->flags              = QPL_FLAG_OMIT_AGGREGATES | QPL_FLAG_OMIT_CHECKSUMS;
+            job_ptr->next_in_ptr        = source.data();
+            job_ptr->available_in       = size;
+            job_ptr->next_out_ptr       = destinations[i].data();
+            job_ptr->available_out      = static_cast<uint32_t>(destinations[i].size());
+
+            statuses[i] = QPL_STS_BEING_PROCESSED;
+        }
+    };
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        prepare();
+        state.ResumeTiming();
+
+        qpl_status status = QPL_STS_OK;
+
+        if (use_batch) {
+            status = qpl_submit_batch(jobs.data(), jobs_count);
+
+            if (QPL_STS_OK == status) {
+                status = qpl_wait_batch(jobs.data(), jobs_count, statuses.data());
+            }
+        } else {
+            for (uint32_t i = 0u; i < jobs_count && QPL_STS_OK == status; i++) {
+                status = qpl_submit_job(jobs[i]);
+            }
+
+            for (uint32_t i = 0u; i < jobs_count && QPL_STS_OK == status; i++) {
+                status = qpl_wait_job(jobs[i]);
+            }
+        }
+
+        if (QPL_STS_OK != status) {
+            state.SkipWithError(("Operation failed with status " + std::to_string(status)).c_str());
+            break;
+        }
+    }
+
+    state.counters["job_time"] = benchmark::Counter(static_cast<double>(jobs_count),
+                                                    benchmark::Counter::kIsIterationInvariantRate |
+                                                    benchmark::Counter::kInvert);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * size * jobs_count);
+}
+
+int register_benchmarks() {
+    for (const auto &path : qpl::bench::execution_paths) {
+        for (uint32_t size : source_sizes) {
+            for (uint32_t jobs_count : jobs_counts) {
+                const std::string suffix = std::string("/") + path.name +
+                                           "/size:" + std::to_string(size) +
+                                           "/jobs:" + std::to_string(jobs_count);
+
+                // Jobs are processed by worker threads, so the time of the submitting thread is not representative
+                benchmark::RegisterBenchmark(("c_api_scan_jobs" + suffix).c_str(),
+                                             scan_jobs_execute,
+                                             path.path,
+                                             size,
+                                             jobs_count,
+                                             false)->UseRealTime();
+                benchmark::RegisterBenchmark(("c_api_scan_batch" + suffix).c_str(),
+                                             scan_jobs_execute,
+                                             path.path,
+                                             size,
+                                             jobs_count,
+                                             true)->UseRealTime();
+            }
+        }
+    }
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
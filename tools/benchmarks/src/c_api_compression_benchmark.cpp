@@ -0,0 +1,290 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Measures throughput and latency percentiles of deflate and inflate of the low-level API
+ *        on files of the test dataset
+ *
+ * @details Benchmarks are named <operation>/<path>/<mode>/<level>/<file>/size:<bytes>, where the size
+ *          is the length of the file prefix that is processed (the whole file for "full"). The dataset
+ *          location is compiled in and may be overridden with the QPL_BENCHMARK_DATASET variable.
+ *          Compression is measured without verification, the cost of the verification is measured
+ *          by the benchmarks of the default level with the /verify:<mode> suffix.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "benchmark_util.hpp"
+
+namespace {
+
+constexpr uint32_t destination_padding = 1024u;
+
+enum class compression_mode_t {
+    fixed,
+    static_table,
+    dynamic,
+    canned
+};
+
+struct mode_description_t {
+    const char         *name;
+    compression_mode_t mode;
+};
+
+constexpr mode_description_t compression_modes[] = {
+        {"fixed",   compression_mode_t::fixed},
+        {"static",  compression_mode_t::static_table},
+        {"dynamic", compression_mode_t::dynamic},
+        {"canned",  compression_mode_t::canned}
+};
+
+struct level_description_t {
+    const char                  *name;
+    qpl_compression_levels      level;
+};
+
+/**
+ * @brief Levels other than the default one are supported by the software path only
+ */
+constexpr level_description_t compression_levels[] = {
+        {"level_0", qpl_level_0},
+        {"default", qpl_default_level},
+        {"level_2", qpl_level_2},
+        {"high",    qpl_high_level},
+        {"level_9", qpl_level_9}
+};
+
+/**
+ * @brief Verification of the compressed stream, sampled one verifies every sample_period-th stream,
+ * streaming one verifies the dynamic blocks as they are written
+ */
+struct verification_description_t {
+    const char *name;
+    uint32_t   flags;
+    uint32_t   sample_period;
+};
+
+constexpr verification_description_t verification_off = {"off", QPL_FLAG_OMIT_VERIFY, 0u};
+
+constexpr verification_description_t verification_modes[] = {
+        {"full",      0u,                        0u},
+        {"streaming", QPL_FLAG_VERIFY_STREAMING, 0u},
+        {"sampled_8", QPL_FLAG_VERIFY_SAMPLED,   8u}
+};
+
+constexpr uint32_t prefix_sizes[] = {4u * 1024u, 64u * 1024u, 0u};    /**< 0 means the whole file */
+
+/**
+ * @brief Huffman table that is destroyed automatically
+ */
+using huffman_table_ptr = std::unique_ptr<qpl_huffman_table, decltype(&qpl_huffman_table_destroy)>;
+
+auto make_huffman_table(qpl_path_t path,
+                        const std::vector<uint8_t> &source,
+                        qpl_compression_levels level) -> huffman_table_ptr {
+    qpl_huffman_table_t table = nullptr;
+
+    if (QPL_STS_OK != qpl_deflate_huffman_table_create(combined_table_type, path, DEFAULT_ALLOCATOR_C, &table)) {
+        return {nullptr, qpl_huffman_table_destroy};
+    }
+
+    huffman_table_ptr result(table, qpl_huffman_table_destroy);
+
+    qpl_histogram histogram{};
+
+    if (QPL_STS_OK != qpl_gather_deflate_statistics(const_cast<uint8_t *>(source.data()),
+                                                    static_cast<uint32_t>(source.size()),
+                                                    &histogram,
+                                                    level,
+                                                    path) ||
+        QPL_STS_OK != qpl_huffman_table_init(table, &histogram)) {
+        return {nullptr, qpl_huffman_table_destroy};
+    }
+
+    return result;
+}
+
+/**
+ * @brief Sets compression flags and the table of the given mode
+ */
+void set_compression_mode(qpl_job *job_ptr,
+                          compression_mode_t mode,
+                          qpl_huffman_table_t table,
+                          const verification_description_t &verification) {
+    job_ptr->flags                = QPL_FLAG_FIRST | QPL_FLAG_LAST | verification.flags;
+    job_ptr->verify_sample_period = verification.sample_period;
+    job_ptr->huffman_table        = nullptr;
+
+    switch (mode) {
+        case compression_mode_t::dynamic:
+            job_ptr->flags |= QPL_FLAG_DYNAMIC_HUFFMAN;
+            break;
+        case compression_mode_t::static_table:
+            job_ptr->huffman_table = table;
+            break;
+        case compression_mode_t::canned:
+            job_ptr->flags |= QPL_FLAG_CANNED_MODE;
+            job_ptr->huffman_table = table;
+            break;
+        default:
+            break;
+    }
+}
+
+void compression_execute(benchmark::State &state,
+                         qpl_path_t path,
+                         compression_mode_t mode,
+                         qpl_compression_levels level,
+                         const std::vector<uint8_t> *file_ptr,
+                         uint32_t prefix_size,
+                         bool is_decompression,
+                         verification_description_t verification) {
+    auto job_buffer = qpl::bench::make_job(path);
+
+    if (!job_buffer) {
+        state.SkipWithError("Execution path is not available");
+        return;
+    }
+
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    const auto source_size = (prefix_size == 0u || prefix_size > file_ptr->size())
+                             ? file_ptr->size()
+                             : static_cast<size_t>(prefix_size);
+
+    const std::vector<uint8_t> source(file_ptr->begin(), file_ptr->begin() + source_size);
+
+    std::vector<uint8_t> compressed(2u * source.size() + destination_padding);
+    std::vector<uint8_t> decompressed(source.size());
+
+    huffman_table_ptr table(nullptr, qpl_huffman_table_destroy);
+
+    if (mode == compression_mode_t::static_table || mode == compression_mode_t::canned) {
+        table = make_huffman_table(path, source, level);
+
+        if (!table) {
+            state.SkipWithError("Couldn't build Huffman table");
+            return;
+        }
+    }
+
+    auto prepare_compression = [&](qpl_job *job) {
+        job->op            = qpl_op_compress;
+        job->level         = level;
+        job->next_in_ptr   = const_cast<uint8_t *>(source.data());
+        job->available_in  = static_cast<uint32_t>(source.size());
+        job->next_out_ptr  = compressed.data();
+        job->available_out = static_cast<uint32_t>(compressed.size());
+
+        set_compression_mode(job, mode, table.get(), verification);
+    };
+
+    if (!is_decompression) {
+        qpl::bench::run_job(state, job_ptr, prepare_compression, source.size());
+        state.counters["ratio"] = static_cast<double>(source.size()) / job_ptr->total_out;
+
+        return;
+    }
+
+    prepare_compression(job_ptr);
+
+    if (QPL_STS_OK != qpl_execute_job(job_ptr)) {
+        state.SkipWithError("Couldn't compress the source");
+        return;
+    }
+
+    const uint32_t compressed_size = job_ptr->total_out;
+
+    qpl::bench::run_job(state, job_ptr, [&](qpl_job *job) {
+        job->op            = qpl_op_decompress;
+        job->next_in_ptr   = compressed.data();
+        job->available_in  = compressed_size;
+        job->next_out_ptr  = decompressed.data();
+        job->available_out = static_cast<uint32_t>(decompressed.size());
+        job->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job->huffman_table = nullptr;
+
+        if (mode == compression_mode_t::canned) {
+            job->flags         = QPL_FLAG_NO_BUFFERING | QPL_FLAG_RND_ACCESS | QPL_FLAG_CANNED_MODE;
+            job->huffman_table = table.get();
+        }
+    }, source.size());
+}
+
+int register_benchmarks() {
+    for (const bool is_decompression : {false, true}) {
+        for (const auto &path : qpl::bench::execution_paths) {
+            for (const auto &mode : compression_modes) {
+                for (const auto &level : compression_levels) {
+                    for (const auto &file : qpl::bench::get_dataset()) {
+                        for (uint32_t prefix_size : prefix_sizes) {
+                            const std::string size = (prefix_size == 0u) ? "full" : std::to_string(prefix_size);
+                            const std::string name = std::string(is_decompression ? "c_api_decompress" : "c_api_compress") +
+                                                     "/" + path.name +
+                                                     "/" + mode.name +
+                                                     "/" + level.name +
+                                                     "/" + file.first +
+                                                     "/size:" + size;
+
+                            benchmark::RegisterBenchmark(name.c_str(),
+                                                         compression_execute,
+                                                         path.path,
+                                                         mode.mode,
+                                                         level.level,
+                                                         &file.second,
+                                                         prefix_size,
+                                                         is_decompression,
+                                                         verification_off);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (const auto &verification : verification_modes) {
+        for (const auto &path : qpl::bench::execution_paths) {
+            for (const auto &mode : compression_modes) {
+                for (const auto &file : qpl::bench::get_dataset()) {
+                    for (uint32_t prefix_size : prefix_sizes) {
+                        const std::string size = (prefix_size == 0u) ? "full" : std::to_string(prefix_size);
+                        const std::string name = std::string("c_api_compress") +
+                                                 "/" + path.name +
+                                                 "/" + mode.name +
+                                                 "/default" +
+                                                 "/" + file.first +
+                                                 "/size:" + size +
+                                                 "/verify:" + verification.name;
+
+                        benchmark::RegisterBenchmark(name.c_str(),
+                                                     compression_execute,
+                                                     path.path,
+                                                     mode.mode,
+                                                     qpl_default_level,
+                                                     &file.second,
+                                                     prefix_size,
+                                                     false,
+                                                     verification);
+                    }
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
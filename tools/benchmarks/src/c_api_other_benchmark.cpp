@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Measures throughput and latency percentiles of copy, CRC64 and zero-compress operations
+ *        of the low-level API
+ *
+ * @details Benchmarks are named <operation>/<path>/size:<bytes>. Sources of zero-compress operations
+ *          have every second element equal to zero, zero-decompress benchmarks inflate their output.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "benchmark_util.hpp"
+
+namespace {
+
+constexpr uint64_t crc64_ecma_polynomial = 0x42F0E1EBA9EA3693ull;
+constexpr uint32_t destination_padding   = 1024u;
+
+struct operation_description_t {
+    const char    *name;
+    qpl_operation operation;
+    uint32_t      flags;
+};
+
+constexpr operation_description_t operations[] = {
+        {"memcpy",          qpl_op_memcpy,         0u},
+        {"crc64",           qpl_op_crc64,          0u},
+        {"crc64_be",        qpl_op_crc64,          QPL_FLAG_CRC64_BE},
+        {"crc64_inv",       qpl_op_crc64,          QPL_FLAG_CRC64_INV},
+        {"z_compress16",    qpl_op_z_compress16,   0u},
+        {"z_compress32",    qpl_op_z_compress32,   0u},
+        {"z_decompress16",  qpl_op_z_decompress16, 0u},
+        {"z_decompress32",  qpl_op_z_decompress32, 0u}
+};
+
+constexpr uint32_t source_sizes[] = {4u * 1024u, 64u * 1024u, 1024u * 1024u};
+
+auto is_zero_decompression(qpl_operation operation) -> bool {
+    return operation == qpl_op_z_decompress16 || operation == qpl_op_z_decompress32;
+}
+
+auto get_zero_compression(qpl_operation operation) -> qpl_operation {
+    return (operation == qpl_op_z_decompress16) ? qpl_op_z_compress16 : qpl_op_z_compress32;
+}
+
+auto generate_source(uint32_t size) -> std::vector<uint8_t> {
+    std::vector<uint8_t> source(size, 0u);
+
+    std::mt19937                            engine(size);
+    std::uniform_int_distribution<uint32_t> values(1u, UINT8_MAX);
+
+    // Every second 32-bit word is zero, so both zero-compress flavors find something to drop
+    for (uint32_t i = 0u; i < size; i++) {
+        if ((i / sizeof(uint32_t)) % 2u == 0u) {
+            source[i] = static_cast<uint8_t>(values(engine));
+        }
+    }
+
+    return source;
+}
+
+void other_execute(benchmark::State &state, qpl_path_t path, operation_description_t operation, uint32_t size) {
+    auto job_buffer = qpl::bench::make_job(path);
+
+    if (!job_buffer) {
+        state.SkipWithError("Execution path is not available");
+        return;
+    }
+
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    auto source = generate_source(size);
+
+    std::vector<uint8_t> destination(2u * size + destination_padding);
+
+    if (is_zero_decompression(operation.operation)) {
+        job_ptr->op            = get_zero_compression(operation.operation);
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = size;
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+        job_ptr->flags         = 0u;
+
+        if (QPL_STS_OK != qpl_execute_job(job_ptr)) {
+            state.SkipWithError("Couldn't zero-compress the source");
+            return;
+        }
+
+        destination.resize(job_ptr->total_out);
+        source.swap(destination);
+        destination.resize(2u * size + destination_padding);
+    }
+
+    qpl::bench::run_job(state, job_ptr, [&](qpl_job *job) {
+        job->op            = operation.operation;
+        job->next_in_ptr   = source.data();
+        job->available_in  = static_cast<uint32_t>(source.size());
+        job->next_out_ptr  = destination.data();
+        job->available_out = static_cast<uint32_t>(destination.size());
+        job->crc64_poly    = crc64_ecma_polynomial;
+        job->flags         = operation.flags;
+    }, source.size());
+}
+
+int register_benchmarks() {
+    for (const auto &operation : operations) {
+        for (const auto &path : qpl::bench::execution_paths) {
+            for (uint32_t size : source_sizes) {
+                const std::string name = std::string("c_api_") + operation.name +
+                                         "/" + path.name +
+                                         "/size:" + std::to_string(size);
+
+                benchmark::RegisterBenchmark(name.c_str(), other_execute, path.path, operation, size);
+            }
+        }
+    }
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Measures throughput of small-input operations of the high-level API
+ *
+ * @details The execute variant allocates internal buffers per call, the execute_with_context variant
+ *          reuses buffers of the thread-local @ref qpl::execution_context.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.hpp"
+
+namespace {
+
+constexpr uint32_t boundary = 48u;
+
+void scan_execute(benchmark::State &state, uint32_t elements_count, bool use_context) {
+    std::vector<uint8_t> source(elements_count);
+    std::vector<uint8_t> destination((elements_count + 7u) / 8u);
+
+    std::iota(source.begin(), source.end(), 0u);
+
+    auto operation = qpl::scan_operation::builder(qpl::less, boundary)
+            .input_vector_width(8u)
+            .output_vector_width(1u)
+            .build();
+
+    auto &context = qpl::execution_context<>::get_thread_local();
+
+    for (auto _ : state) {
+        if (use_context) {
+            auto result = qpl::execute<qpl::software>(operation, context, source, destination);
+            benchmark::DoNotOptimize(result);
+        } else {
+            auto result = qpl::execute<qpl::software>(operation, source, destination);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+}
+
+int register_benchmarks() {
+    for (uint32_t elements_count : {64u, 256u, 1024u, 4096u}) {
+        const std::string suffix = "/elements:" + std::to_string(elements_count);
+
+        benchmark::RegisterBenchmark(("cpp_api_scan/execute" + suffix).c_str(), scan_execute, elements_count, false);
+        benchmark::RegisterBenchmark(("cpp_api_scan/execute_with_context" + suffix).c_str(),
+                                     scan_execute,
+                                     elements_count,
+                                     true);
+    }
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
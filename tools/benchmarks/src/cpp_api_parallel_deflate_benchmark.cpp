@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Measures software deflate throughput of a large buffer depending on the number of threads
+ *
+ * @details The threads:1 variant is the regular single-stream compression, other variants split
+ *          the source into segments that are compressed in parallel.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.hpp"
+
+namespace {
+
+constexpr uint32_t source_size = 32u * 1024u * 1024u;
+
+auto generate_source() -> std::vector<uint8_t> {
+    std::vector<uint8_t> source(source_size);
+
+    // Column-like data: short runs of repeated small values
+    std::mt19937                            engine(source_size);
+    std::uniform_int_distribution<uint32_t> values(0u, 63u);
+    std::uniform_int_distribution<uint32_t> lengths(1u, 16u);
+
+    for (size_t i = 0u; i < source.size();) {
+        const auto value  = static_cast<uint8_t>(values(engine));
+        const auto length = lengths(engine);
+
+        for (uint32_t j = 0u; j < length && i < source.size(); j++, i++) {
+            source[i] = value;
+        }
+    }
+
+    return source;
+}
+
+void deflate_execute(benchmark::State &state, uint32_t thread_count) {
+    static const auto source = generate_source();
+
+    std::vector<uint8_t> destination(2u * source.size());
+
+    // One thread means the regular compression path
+    auto operation = qpl::deflate_operation::builder()
+            .compression_mode<qpl::dynamic_mode>()
+            .parallel(thread_count)
+            .build();
+
+    for (auto _ : state) {
+        auto result = qpl::execute<qpl::software>(operation, source, destination);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * source.size());
+}
+
+int register_benchmarks() {
+    for (uint32_t thread_count : {1u, 2u, 4u, 8u}) {
+        const std::string name = "cpp_api_deflate/software/threads:" + std::to_string(thread_count);
+
+        benchmark::RegisterBenchmark(name.c_str(), deflate_execute, thread_count)
+                ->Unit(benchmark::kMillisecond)
+                ->UseRealTime();
+    }
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
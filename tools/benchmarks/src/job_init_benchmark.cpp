@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Reports qpl_job footprint and initialization latency for every operation class
+ *
+ * @details The job_size counter holds the size returned by @ref qpl_get_job_size_for_class,
+ *          the iteration time is the latency of @ref qpl_init_job_for_class.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "qpl/qpl.h"
+
+namespace {
+
+struct operation_class_t {
+    const char *name;
+    uint32_t   op_classes;
+};
+
+const operation_class_t operation_classes[] = {
+        {"all",        qpl_op_class_all},
+        {"analytics",  qpl_op_class_analytics},
+        {"compress",   qpl_op_class_compress},
+        {"decompress", qpl_op_class_decompress},
+        {"other",      qpl_op_class_other}
+};
+
+void job_init(benchmark::State &state, qpl_path_t path, uint32_t op_classes) {
+    uint32_t job_size = 0u;
+
+    if (QPL_STS_OK != qpl_get_job_size_for_class(path, op_classes, &job_size)) {
+        state.SkipWithError("Couldn't get job size");
+        return;
+    }
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto *job_ptr   = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(qpl_init_job_for_class(path, op_classes, job_ptr));
+        benchmark::ClobberMemory();
+
+        qpl_fini_job(job_ptr);
+    }
+
+    state.counters["job_size"] = benchmark::Counter(static_cast<double>(job_size),
+                                                    benchmark::Counter::kDefaults,
+                                                    benchmark::Counter::kIs1024);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * job_size);
+}
+
+int register_benchmarks() {
+    for (const auto &operation_class : operation_classes) {
+        const std::string name = std::string("job_init/software/") + operation_class.name;
+
+        benchmark::RegisterBenchmark(name.c_str(), job_init, qpl_path_software, operation_class.op_classes);
+    }
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
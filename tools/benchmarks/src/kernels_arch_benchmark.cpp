@@ -0,0 +1,415 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Compares px, avx2 and avx512 analytics kernels for every input bit width, hash set lookups and CRC64 kernels
+ *
+ * @details Benchmarks call kernel tables of the particular architecture directly, so all flavors
+ *          supported by the current CPU can be compared in one run. Architectures that are not supported
+ *          by the CPU are reported as skipped.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dispatcher/dispatcher.hpp"
+#include "analytics/hash_set.hpp"
+
+namespace qpl::ml::dispatcher {
+extern unpack_table_t     px_unpack_table;
+extern unpack_table_t     avx2_unpack_table;
+extern unpack_table_t     avx512_unpack_table;
+extern scan_table_t       px_scan_table;
+extern scan_table_t       avx2_scan_table;
+extern scan_table_t       avx512_scan_table;
+extern pack_table_t       px_pack_table;
+extern pack_table_t       avx2_pack_table;
+extern pack_table_t       avx512_pack_table;
+extern select_table_t     px_select_table;
+extern select_table_t     avx2_select_table;
+extern select_table_t     avx512_select_table;
+extern aggregates_table_t px_aggregates_table;
+extern aggregates_table_t avx2_aggregates_table;
+extern aggregates_table_t avx512_aggregates_table;
+extern crc64_table_t      px_crc64_table;
+extern crc64_table_t      avx2_crc64_table;
+extern crc64_table_t      avx512_crc64_table;
+extern scan_packed_table_t px_scan_packed_table;
+extern scan_packed_table_t avx2_scan_packed_table;
+extern scan_packed_table_t avx512_scan_packed_table;
+extern set_membership_hash_table_t px_set_membership_hash_table;
+extern set_membership_hash_table_t avx2_set_membership_hash_table;
+extern set_membership_hash_table_t avx512_set_membership_hash_table;
+extern bitmap_logic_table_t px_bitmap_logic_table;
+extern bitmap_logic_table_t avx2_bitmap_logic_table;
+extern bitmap_logic_table_t avx512_bitmap_logic_table;
+extern bitmap_popcount_table_t px_bitmap_popcount_table;
+extern bitmap_popcount_table_t avx2_bitmap_popcount_table;
+extern bitmap_popcount_table_t avx512_bitmap_popcount_table;
+}
+
+namespace {
+
+namespace dispatcher = qpl::ml::dispatcher;
+
+constexpr uint32_t elements_count  = 64u * 1024u;
+constexpr uint32_t max_bit_width   = 32u;
+constexpr uint32_t equals_flavor   = 0u;
+constexpr uint32_t in_range_flavor = 6u;
+
+struct arch_tables_t {
+    const char                           *name;
+    dispatcher::arch_t                   arch;
+    const dispatcher::unpack_table_t     &unpack;
+    const dispatcher::scan_table_t       &scan;
+    const dispatcher::pack_table_t       &pack;
+    const dispatcher::select_table_t     &select;
+    const dispatcher::aggregates_table_t &aggregates;
+    const dispatcher::crc64_table_t      &crc64;
+    const dispatcher::scan_packed_table_t &scan_packed;
+    const dispatcher::set_membership_hash_table_t &set_membership_hash;
+    const dispatcher::bitmap_logic_table_t &bitmap_logic;
+    const dispatcher::bitmap_popcount_table_t &bitmap_popcount;
+};
+
+const arch_tables_t arch_tables[] = {
+        {"px",     dispatcher::px_arch,     dispatcher::px_unpack_table,     dispatcher::px_scan_table,
+                   dispatcher::px_pack_table,     dispatcher::px_select_table,     dispatcher::px_aggregates_table,
+                   dispatcher::px_crc64_table,     dispatcher::px_scan_packed_table,
+                   dispatcher::px_set_membership_hash_table, dispatcher::px_bitmap_logic_table,
+                   dispatcher::px_bitmap_popcount_table},
+        {"avx2",   dispatcher::avx2_arch,   dispatcher::avx2_unpack_table,   dispatcher::avx2_scan_table,
+                   dispatcher::avx2_pack_table,   dispatcher::avx2_select_table,   dispatcher::avx2_aggregates_table,
+                   dispatcher::avx2_crc64_table,     dispatcher::avx2_scan_packed_table,
+                   dispatcher::avx2_set_membership_hash_table, dispatcher::avx2_bitmap_logic_table,
+                   dispatcher::avx2_bitmap_popcount_table},
+        {"avx512", dispatcher::avx512_arch, dispatcher::avx512_unpack_table, dispatcher::avx512_scan_table,
+                   dispatcher::avx512_pack_table, dispatcher::avx512_select_table, dispatcher::avx512_aggregates_table,
+                   dispatcher::avx512_crc64_table, dispatcher::avx512_scan_packed_table,
+                   dispatcher::avx512_set_membership_hash_table, dispatcher::avx512_bitmap_logic_table,
+                   dispatcher::avx512_bitmap_popcount_table}
+};
+
+auto random_buffer(size_t size, uint32_t seed) -> std::vector<uint8_t> {
+    std::vector<uint8_t>               buffer(size);
+    std::mt19937                       engine(seed);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    for (auto &byte : buffer) {
+        byte = static_cast<uint8_t>(distribution(engine));
+    }
+
+    return buffer;
+}
+
+/**
+ * @brief Produces unpacked elements of the given bit width
+ */
+auto unpacked_buffer(uint32_t bit_width) -> std::vector<uint8_t> {
+    auto packed   = random_buffer(elements_count * sizeof(uint32_t) + 64u, bit_width);
+    auto unpacked = std::vector<uint8_t>(elements_count * sizeof(uint32_t));
+
+    dispatcher::px_unpack_table[dispatcher::get_unpack_index(0u, bit_width)](packed.data(),
+                                                                             elements_count,
+                                                                             0u,
+                                                                             unpacked.data());
+    return unpacked;
+}
+
+auto is_supported(dispatcher::arch_t arch) -> bool {
+    return arch <= dispatcher::detect_platform();
+}
+
+void unpack(benchmark::State &state, const arch_tables_t &tables, uint32_t bit_width) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    auto source      = random_buffer(elements_count * sizeof(uint32_t) + 64u, bit_width);
+    auto destination = std::vector<uint8_t>(elements_count * sizeof(uint32_t));
+    auto kernel      = tables.unpack[dispatcher::get_unpack_index(0u, bit_width)];
+
+    for (auto _ : state) {
+        kernel(source.data(), elements_count, 0u, destination.data());
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * elements_count * bit_width / 8u);
+}
+
+void scan(benchmark::State &state, const arch_tables_t &tables, uint32_t bit_width, uint32_t flavor) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    const uint32_t high_value = static_cast<uint32_t>((1ULL << bit_width) - 1u);
+
+    auto source      = unpacked_buffer(bit_width);
+    auto destination = std::vector<uint8_t>(elements_count);
+    auto kernel      = tables.scan[dispatcher::get_scan_index(bit_width, flavor)];
+
+    for (auto _ : state) {
+        kernel(source.data(), destination.data(), elements_count, high_value / 4u, high_value / 2u);
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+}
+
+/**
+ * @brief Fused scan of packed elements with the bit vector output, compare with unpack + scan + pack_bit_vector
+ */
+void scan_packed(benchmark::State &state, const arch_tables_t &tables, uint32_t bit_width) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    const uint32_t high_value = static_cast<uint32_t>((1ULL << bit_width) - 1u);
+
+    auto source      = random_buffer(elements_count * sizeof(uint32_t), bit_width);
+    auto destination = std::vector<uint8_t>(elements_count / 8u);
+    auto kernel      = tables.scan_packed[0];
+
+    for (auto _ : state) {
+        kernel(source.data(), elements_count, bit_width, destination.data(), high_value / 4u, high_value / 2u);
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * elements_count * bit_width / 8u);
+}
+
+void pack_bit_vector(benchmark::State &state, const arch_tables_t &tables) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    auto source      = random_buffer(elements_count, 1u);
+    auto destination = std::vector<uint8_t>(elements_count / 8u + 1u);
+    auto kernel      = tables.pack[dispatcher::get_pack_bits_index(0u, 1u, 0u)];
+
+    for (auto &byte : source) {
+        byte &= 1u;
+    }
+
+    for (auto _ : state) {
+        kernel(source.data(), elements_count, destination.data(), 0u);
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+}
+
+void select(benchmark::State &state, const arch_tables_t &tables, uint32_t bit_width) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    auto source      = unpacked_buffer(bit_width);
+    auto mask        = random_buffer(elements_count, max_bit_width + bit_width);
+    auto destination = std::vector<uint8_t>(elements_count * sizeof(uint32_t));
+    auto kernel      = tables.select[dispatcher::get_select_index(bit_width)];
+
+    for (auto &byte : mask) {
+        byte &= 1u;
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kernel(source.data(), mask.data(), destination.data(), elements_count));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+}
+
+void aggregates(benchmark::State &state, const arch_tables_t &tables, uint32_t bit_width) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    auto source = unpacked_buffer(bit_width);
+    auto kernel = tables.aggregates[dispatcher::get_aggregates_index(bit_width)];
+
+    for (auto _ : state) {
+        uint32_t min_value = UINT32_MAX;
+        uint32_t max_value = 0u;
+        uint32_t sum       = 0u;
+        uint32_t index     = 0u;
+
+        kernel(source.data(), elements_count, &min_value, &max_value, &sum, &index);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+}
+
+/**
+ * @brief Looks 32-bit elements up in the hash set, a half of the elements belongs to the set
+ */
+void set_membership_hash(benchmark::State &state, const arch_tables_t &tables, uint32_t keys_count) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    std::mt19937                            engine(keys_count);
+    std::uniform_int_distribution<uint32_t> distribution;
+
+    std::vector<uint32_t>                    keys(keys_count);
+    std::vector<uint32_t>                    source(elements_count);
+    qpl::ml::analytics::hash_set_t           hash_set;
+
+    if (!hash_set.reserve(keys_count)) {
+        state.SkipWithError("Memory allocation failed");
+        return;
+    }
+
+    for (auto &key : keys) {
+        key = distribution(engine);
+        hash_set.insert(key);
+    }
+
+    for (uint32_t i = 0u; i < elements_count; i++) {
+        source[i] = (i % 2u) ? keys[distribution(engine) % keys_count] : distribution(engine);
+    }
+
+    const auto set_view    = hash_set.view();
+    auto       destination = std::vector<uint8_t>(elements_count * sizeof(uint32_t));
+    auto       kernel      = tables.set_membership_hash[1];
+
+    for (auto _ : state) {
+        // The kernel works in-place, so the source is restored each iteration
+        std::memcpy(destination.data(), source.data(), destination.size());
+
+        kernel(destination.data(), elements_count, 0u, UINT32_MAX, &set_view);
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * elements_count);
+}
+
+void crc64(benchmark::State &state, const arch_tables_t &tables, uint32_t length) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    constexpr uint64_t polynomial = 0x42F0E1EBA9EA3693ULL;
+
+    auto source = random_buffer(length, length);
+    auto kernel = tables.crc64[0];
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kernel(source.data(), length, polynomial, 0u, 1u));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * length);
+}
+
+/**
+ * @brief AND of two bit vectors, e.g. combination of results of two scans
+ */
+void bitmap_and(benchmark::State &state, const arch_tables_t &tables, uint32_t length) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    auto source1     = random_buffer(length, 1u);
+    auto source2     = random_buffer(length, 2u);
+    auto destination = std::vector<uint8_t>(length);
+    auto kernel      = tables.bitmap_logic[0];
+
+    for (auto _ : state) {
+        kernel(source1.data(), source2.data(), destination.data(), length);
+        benchmark::DoNotOptimize(destination.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * length);
+}
+
+void bitmap_popcount(benchmark::State &state, const arch_tables_t &tables, uint32_t length) {
+    if (!is_supported(tables.arch)) {
+        state.SkipWithError("Architecture is not supported by the CPU");
+        return;
+    }
+
+    auto source = random_buffer(length, length);
+    auto kernel = tables.bitmap_popcount[0];
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(kernel(source.data(), length));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * length);
+}
+
+int register_benchmarks() {
+    for (const auto &tables : arch_tables) {
+        const std::string arch_name = tables.name;
+
+        for (uint32_t bit_width = 1u; bit_width <= max_bit_width; bit_width++) {
+            const std::string suffix = "/" + arch_name + "/bit_width:" + std::to_string(bit_width);
+
+            benchmark::RegisterBenchmark(("unpack" + suffix).c_str(), unpack, tables, bit_width);
+            benchmark::RegisterBenchmark(("scan_eq" + suffix).c_str(), scan, tables, bit_width, equals_flavor);
+            benchmark::RegisterBenchmark(("scan_range" + suffix).c_str(), scan, tables, bit_width, in_range_flavor);
+            benchmark::RegisterBenchmark(("scan_packed" + suffix).c_str(), scan_packed, tables, bit_width);
+        }
+
+        for (uint32_t bit_width : {8u, 16u, 32u}) {
+            const std::string suffix = "/" + arch_name + "/bit_width:" + std::to_string(bit_width);
+
+            benchmark::RegisterBenchmark(("select" + suffix).c_str(), select, tables, bit_width);
+            benchmark::RegisterBenchmark(("aggregates" + suffix).c_str(), aggregates, tables, bit_width);
+        }
+
+        benchmark::RegisterBenchmark(("pack_bit_vector/" + arch_name).c_str(), pack_bit_vector, tables);
+
+        for (uint32_t keys_count : {1024u, 100u * 1024u, 1024u * 1024u}) {
+            const std::string suffix = "/" + arch_name + "/keys:" + std::to_string(keys_count);
+
+            benchmark::RegisterBenchmark(("set_membership_hash" + suffix).c_str(), set_membership_hash, tables, keys_count);
+        }
+
+        for (uint32_t length : {64u, 4096u, 65536u}) {
+            const std::string suffix = "/" + arch_name + "/length:" + std::to_string(length);
+
+            benchmark::RegisterBenchmark(("crc64" + suffix).c_str(), crc64, tables, length);
+        }
+
+        for (uint32_t length : {64u, 4096u, 65536u}) {
+            const std::string suffix = "/" + arch_name + "/length:" + std::to_string(length);
+
+            benchmark::RegisterBenchmark(("bitmap_and" + suffix).c_str(), bitmap_and, tables, length);
+            benchmark::RegisterBenchmark(("bitmap_popcount" + suffix).c_str(), bitmap_popcount, tables, length);
+        }
+    }
+
+    return 0;
+}
+
+[[maybe_unused]] const int registered = register_benchmarks();
+
+}
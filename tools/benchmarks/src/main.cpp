@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Entry point of the benchmarks
+ *
+ * @details Besides the console output, results are written in JSON format to qpl_benchmarks.json
+ *          (unless --benchmark_out is given), so reports of different releases can be compared
+ *          with tools/compare.py of Google Benchmark.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "qpl/qpl.h"
+
+#include "benchmark_util.hpp"
+
+namespace {
+
+constexpr const char *output_argument        = "--benchmark_out=";
+constexpr const char *default_output         = "--benchmark_out=qpl_benchmarks.json";
+constexpr const char *default_output_format  = "--benchmark_out_format=json";
+
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> default_arguments;
+    std::vector<char *>      arguments(argv, argv + argc);
+
+    bool is_output_set = false;
+
+    for (int i = 1; i < argc; i++) {
+        is_output_set |= (std::string(argv[i]).rfind(output_argument, 0u) == 0u);
+    }
+
+    if (!is_output_set) {
+        default_arguments = {default_output, default_output_format};
+
+        for (auto &argument : default_arguments) {
+            arguments.push_back(argument.data());
+        }
+    }
+
+    auto arguments_count = static_cast<int>(arguments.size());
+
+    benchmark::Initialize(&arguments_count, arguments.data());
+
+    if (benchmark::ReportUnrecognizedArguments(arguments_count, arguments.data())) {
+        return 1;
+    }
+
+    benchmark::AddCustomContext("qpl_version", qpl_get_library_version());
+    benchmark::AddCustomContext("dataset", qpl::bench::get_dataset_path());
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "qpl/qpl.hpp"
+
+#include "ta_hl_common.hpp"
+#include "high_level_api_util.hpp"
+
+namespace qpl::test {
+
+static auto generate_bitmap(std::mt19937 &generator, uint32_t bit_count) -> std::vector<uint8_t> {
+    std::vector<uint8_t> bitmap((bit_count + 7u) / 8u);
+
+    for (auto &byte : bitmap) {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    return bitmap;
+}
+
+static auto get_bit(const std::vector<uint8_t> &bitmap, uint32_t index) -> bool {
+    return (bitmap[index / 8u] >> (index % 8u)) & 1u;
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(bitmap_operation, logic_and_count) {
+    // Bit vector operations are performed by the software path only
+    if (qpl_path_hardware == util::TestEnvironment::GetInstance().GetExecutionPath()) {
+        return;
+    }
+
+    const auto seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    std::mt19937 generator(seed);
+
+    for (uint32_t bit_count : {1u, 100u, 40001u}) {
+        auto source1 = generate_bitmap(generator, bit_count);
+        auto source2 = generate_bitmap(generator, bit_count);
+
+        const std::string test_case_info = "\nSeed: " + std::to_string(seed) +
+                                           "\nNumber of bits: " + std::to_string(bit_count) + "\n";
+
+        for (auto operation : {bitmap_and, bitmap_or, bitmap_xor, bitmap_and_not, bitmap_not}) {
+            auto bitmap = bitmap_operation::builder(operation, source2.data(), source2.size())
+                    .number_of_input_elements(bit_count)
+                    .build();
+
+            std::vector<uint8_t> destination(source1.size(), 0u);
+            std::vector<uint8_t> reference(source1.size(), 0u);
+
+            for (uint32_t i = 0u; i < bit_count; i++) {
+                const bool a = get_bit(source1, i);
+                const bool b = get_bit(source2, i);
+                bool       result;
+
+                switch (operation) {
+                    case bitmap_and:
+                        result = a && b;
+                        break;
+                    case bitmap_or:
+                        result = a || b;
+                        break;
+                    case bitmap_xor:
+                        result = a != b;
+                        break;
+                    case bitmap_and_not:
+                        result = a && !b;
+                        break;
+                    default:
+                        result = !a;
+                        break;
+                }
+
+                if (result) {
+                    reference[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+                }
+            }
+
+            uint32_t result_value = 0u;
+
+            ASSERT_NO_THROW(result_value = handle_result(test::execute(bitmap, source1, destination)))
+                                        << test_case_info << "Operation: " << operation;
+            EXPECT_EQ(bit_count, result_value) << test_case_info << "Operation: " << operation;
+            EXPECT_EQ(reference, destination) << test_case_info << "Operation: " << operation;
+        }
+
+        std::vector<uint32_t> indices;
+
+        for (uint32_t i = 0u; i < bit_count; i++) {
+            if (get_bit(source1, i)) {
+                indices.push_back(i);
+            }
+        }
+
+        std::vector<uint8_t> destination(1u, 0u);
+
+        const std::pair<bitmap_operations, uint32_t> expectations[] = {
+                {bitmap_popcount, static_cast<uint32_t>(indices.size())},
+                {bitmap_first_set, (indices.empty()) ? bit_count : indices.front()},
+                {bitmap_last_set, (indices.empty()) ? bit_count : indices.back()}
+        };
+
+        for (const auto &expectation : expectations) {
+            auto bitmap = bitmap_operation::builder(expectation.first)
+                    .number_of_input_elements(bit_count)
+                    .build();
+
+            uint32_t result_value = 0u;
+
+            ASSERT_NO_THROW(result_value = handle_result(test::execute(bitmap, source1, destination)))
+                                        << test_case_info << "Operation: " << expectation.first;
+            EXPECT_EQ(expectation.second, result_value) << test_case_info << "Operation: " << expectation.first;
+        }
+    }
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(bitmap_operation, chain_after_scan) {
+    if (qpl_path_hardware == util::TestEnvironment::GetInstance().GetExecutionPath()) {
+        return;
+    }
+
+    const auto seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    std::mt19937 generator(seed);
+
+    constexpr uint32_t number_of_elements = 10001u;
+    constexpr uint32_t boundary           = 100u;
+
+    std::vector<uint8_t> source(number_of_elements);
+
+    for (auto &value : source) {
+        value = static_cast<uint8_t>(generator());
+    }
+
+    auto mask = generate_bitmap(generator, number_of_elements);
+
+    std::vector<uint8_t> reference((number_of_elements + 7u) / 8u, 0u);
+    uint32_t             reference_count = 0u;
+
+    for (uint32_t i = 0u; i < number_of_elements; i++) {
+        if (source[i] < boundary && get_bit(mask, i)) {
+            reference[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+            reference_count++;
+        }
+    }
+
+    const std::string test_case_info = "\nSeed: " + std::to_string(seed) + "\n";
+
+    // (x < boundary) & mask
+    auto chain = scan_operation::builder(qpl::less, boundary)
+                         .input_vector_width(8u)
+                         .output_vector_width(1u)
+                         .build() |
+                 bitmap_operation(bitmap_and, mask.data(), mask.size());
+
+    std::vector<uint8_t> destination(source.size(), 0u);
+    uint32_t             result_value = 0u;
+
+    ASSERT_NO_THROW(result_value = handle_result(test::execute(chain, source, destination))) << test_case_info;
+    EXPECT_EQ(number_of_elements, result_value) << test_case_info;
+    EXPECT_TRUE(std::equal(reference.begin(), reference.end(), destination.begin())) << test_case_info;
+
+    // popcount((x < boundary) & mask)
+    auto count_chain = scan_operation::builder(qpl::less, boundary)
+                               .input_vector_width(8u)
+                               .output_vector_width(1u)
+                               .build() |
+                       bitmap_operation(bitmap_and, mask.data(), mask.size()) |
+                       bitmap_operation(bitmap_popcount);
+
+    ASSERT_NO_THROW(result_value = handle_result(test::execute(count_chain, source, destination))) << test_case_info;
+    EXPECT_EQ(reference_count, result_value) << test_case_info;
+}
+
+}
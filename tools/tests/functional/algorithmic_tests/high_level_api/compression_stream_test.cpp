@@ -12,10 +12,12 @@
 #include "high_level_api_util.hpp"
 #include "source_provider.hpp"
 #include "check_result.hpp"
+#include "random_generator.h"
 
 #include "qpl/cpp_api/operations/compression/inflate_operation.hpp"
 #include "qpl/cpp_api/results/deflate_stream.hpp"
 #include "qpl/cpp_api/results/inflate_stream.hpp"
+#include "qpl/cpp_api/results/segment_sink.hpp"
 
 namespace qpl::test {
 
@@ -361,6 +363,146 @@ QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(compression_stream_test, high_fixed, Comp
     EXPECT_TRUE(CompareVectors(source, destination));
 }
 
+// Segmented output
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(compression_stream_test, segmented_dynamic, CompressionStreamTest) {
+    constexpr size_t compression_segment_size   = 8192u;
+    constexpr size_t decompression_segment_size = 1000u;
+
+    // Perform compression into the segments allocated by the sink
+    auto deflate_operation = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .build();
+
+    auto deflate_stream    = qpl::deflate_stream(std::move(deflate_operation), 0u);
+    auto deflate_sink      = segment_sink(compression_segment_size);
+    auto current_chunk     = source.begin();
+    auto current_chunk_end = (current_test_case.chunk_size < source.size())
+                             ? current_chunk + current_test_case.chunk_size
+                             : source.end();
+
+    while (std::distance(current_chunk_end, source.end()) > current_test_case.chunk_size) {
+        deflate_stream.push(current_chunk, current_chunk_end, deflate_sink);
+
+        current_chunk += current_test_case.chunk_size;
+        current_chunk_end += current_test_case.chunk_size;
+    }
+
+    deflate_stream.flush(current_chunk, source.end(), deflate_sink);
+
+    std::vector<uint8_t> compressed;
+
+    for (const auto &segment: deflate_sink.segments()) {
+        ASSERT_LE(segment.size, compression_segment_size);
+
+        compressed.insert(compressed.end(), segment.data, segment.data + segment.size);
+    }
+
+    ASSERT_EQ(deflate_sink.size(), compressed.size());
+
+    // Perform decompression into the segments given by the provider
+    std::vector<std::vector<uint8_t>> provided_segments;
+
+    auto inflate_sink = segment_sink([&provided_segments, decompression_segment_size](size_t min_size) -> output_segment {
+        auto &segment = provided_segments.emplace_back(std::max(min_size, decompression_segment_size));
+
+        return {segment.data(), segment.size()};
+    });
+
+    auto inflate_stream = qpl::inflate_stream(qpl::inflate_operation(), compressed.begin(), compressed.end());
+
+    inflate_stream.extract(inflate_sink);
+
+    destination.clear();
+
+    for (const auto &segment: inflate_sink.segments()) {
+        destination.insert(destination.end(), segment.data, segment.data + segment.size);
+    }
+
+    EXPECT_EQ(inflate_sink.size(), source.size());
+    EXPECT_TRUE(CompareVectors(source, destination));
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(compression_stream, short_segment) {
+    std::array<uint8_t, 16u> segment{};
+
+    auto sink = segment_sink([&segment](size_t) -> output_segment {
+        return {segment.data(), segment.size()};
+    });
+
+    std::array<uint8_t, 100u> source{};
+
+    auto deflate_stream = qpl::deflate_stream(qpl::deflate_operation(), 0u);
+
+    // Provider returns less bytes than the stream requires
+    EXPECT_THROW(deflate_stream.flush(source.begin(), source.end(), sink), short_destination_exception);
+    EXPECT_EQ(0u, sink.size());
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(compression_stream, short_segment_size) {
+    EXPECT_THROW(static_cast<void>(segment_sink(segment_sink::min_segment_size - 1u)), invalid_argument_exception);
+    EXPECT_NO_THROW(static_cast<void>(segment_sink(segment_sink::min_segment_size)));
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(compression_stream, segmented_fixed_incompressible) {
+    constexpr std::array<size_t, 3u> source_sizes  = {5000u, 70000u, 300000u};
+    constexpr std::array<size_t, 3u> chunk_sizes   = {4096u, 65536u, 100000u};
+    constexpr std::array<size_t, 3u> segment_sizes = {segment_sink::min_segment_size, 10000u, 70000u};
+
+    qpl::test::random random_byte(0u, UINT8_MAX, util::TestEnvironment::GetInstance().GetSeed());
+
+    for (auto source_size: source_sizes) {
+        std::vector<uint8_t> source(source_size);
+
+        // Fixed Huffman codes expand the random data
+        for (auto &byte: source) {
+            byte = static_cast<uint8_t>(random_byte);
+        }
+
+        for (auto chunk_size: chunk_sizes) {
+            for (auto segment_size: segment_sizes) {
+                auto deflate_operation = deflate_operation::builder()
+                        .compression_mode<fixed_mode>()
+                        .build();
+
+                auto deflate_stream = qpl::deflate_stream(std::move(deflate_operation), 0u);
+                auto deflate_sink   = segment_sink(segment_size);
+                auto current_chunk  = source.begin();
+
+                while (static_cast<size_t>(std::distance(current_chunk, source.end())) > chunk_size) {
+                    deflate_stream.push(current_chunk, current_chunk + chunk_size, deflate_sink);
+
+                    current_chunk += chunk_size;
+                }
+
+                deflate_stream.flush(current_chunk, source.end(), deflate_sink);
+
+                std::vector<uint8_t> compressed;
+
+                for (const auto &segment: deflate_sink.segments()) {
+                    compressed.insert(compressed.end(), segment.data, segment.data + segment.size);
+                }
+
+                auto inflate_sink   = segment_sink(segment_size);
+                auto inflate_stream = qpl::inflate_stream(qpl::inflate_operation(), compressed.begin(), compressed.end());
+
+                inflate_stream.extract(inflate_sink);
+
+                std::vector<uint8_t> destination;
+
+                for (const auto &segment: inflate_sink.segments()) {
+                    destination.insert(destination.end(), segment.data, segment.data + segment.size);
+                }
+
+                EXPECT_TRUE(CompareVectors(source, destination))
+                        << "source size: " << source_size
+                        << ", chunk size: " << chunk_size
+                        << ", segment size: " << segment_size;
+            }
+        }
+    }
+}
+
 QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(decompression_stream, incorrect_input) {
     constexpr uint32_t source_size = 100;
     constexpr uint32_t destination_size = 100;
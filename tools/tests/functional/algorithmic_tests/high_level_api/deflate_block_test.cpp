@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <atomic>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include "ta_hl_common.hpp"
@@ -15,6 +17,46 @@
 
 namespace qpl::test {
 
+/**
+ * @brief Number of bytes allocated with @ref counting_allocator
+ */
+static std::atomic<size_t> counted_allocations_size{0u};
+
+/**
+ * @brief Allocator that counts allocated bytes to check that internal buffers are allocated with it
+ */
+template <class T>
+class counting_allocator {
+public:
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U> &) noexcept {
+    }
+
+    auto allocate(size_t count) -> T * {
+        counted_allocations_size += count * sizeof(T);
+
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T *pointer, size_t count) noexcept {
+        std::allocator<T>().deallocate(pointer, count);
+    }
+};
+
+template <class T, class U>
+bool operator==(const counting_allocator<T> &, const counting_allocator<U> &) noexcept {
+    return true;
+}
+
+template <class T, class U>
+bool operator!=(const counting_allocator<T> &, const counting_allocator<U> &) noexcept {
+    return false;
+}
+
 class DeflateBlockTest : public CompressionFixture {
 public:
     void InitializeTestCases() {
@@ -171,4 +213,142 @@ QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_block, high_static, DeflateBlockT
     EXPECT_TRUE(check_deflate_block(source.begin(), source.end(), deflate_block));
 }
 
+// Parallel decompression
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_block, decompress_dynamic, DeflateBlockTest) {
+    // Variables
+    const compression_levels compression_level = default_level;
+    const compression_modes  compression_mode  = dynamic_mode;
+
+    // Act
+    auto deflate_operation = deflate_operation::builder()
+            .compression_mode<compression_mode>()
+            .compression_level(compression_level)
+            .build();
+
+    auto deflate_block = test::build_deflate_block(deflate_operation, source, current_test_case.mini_block_size);
+
+    // Assert
+    for (uint32_t thread_count : {1u, 4u}) {
+        std::vector<uint8_t> destination(source.size());
+
+        size_t decompressed_size = 0u;
+
+        ASSERT_NO_THROW(decompressed_size = deflate_block.decompress(destination.begin(),
+                                                                     destination.end(),
+                                                                     thread_count));
+
+        ASSERT_EQ(source.size(), decompressed_size);
+        EXPECT_EQ(source, destination);
+    }
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_block, decompress_short_destination, DeflateBlockTest) {
+    auto deflate_operation = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .build();
+
+    auto deflate_block = test::build_deflate_block(deflate_operation, source, current_test_case.mini_block_size);
+
+    std::vector<uint8_t> destination(source.size() - 1u);
+
+    EXPECT_THROW(deflate_block.decompress(destination.begin(), destination.end()), short_destination_exception);
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_block, decompress_with_block_allocator, DeflateBlockTest) {
+    if (qpl_path_software != util::TestEnvironment::GetInstance().GetExecutionPath()) {
+        GTEST_SKIP() << "The allocator is checked on the software path only";
+    }
+
+    auto deflate_operation = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .build();
+
+    auto deflate_block = qpl::build_deflate_block<qpl::software, counting_allocator>(deflate_operation,
+                                                                                     source.begin(),
+                                                                                     source.end(),
+                                                                                     current_test_case.mini_block_size);
+
+    const uint32_t thread_count     = 4u;
+    const uint32_t threads_count    = qpl::util::get_mini_blocks_threads_count(static_cast<uint32_t>(source.size()),
+                                                                               current_test_case.mini_block_size,
+                                                                               thread_count);
+    const size_t   allocations_size = counted_allocations_size;
+
+    std::vector<uint8_t> destination(source.size());
+
+    ASSERT_EQ(source.size(), deflate_block.decompress(destination.begin(), destination.end(), thread_count));
+    EXPECT_EQ(source, destination);
+
+    // Job buffers of the threads are taken from the allocator of the block
+    EXPECT_GE(counted_allocations_size - allocations_size, threads_count * qpl::util::get_job_size());
+}
+
+// Range and gather reads
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_block, read_range, DeflateBlockTest) {
+    auto deflate_operation = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .build();
+
+    auto deflate_block = test::build_deflate_block(deflate_operation, source, current_test_case.mini_block_size);
+
+    const size_t mini_block_bytes = qpl::util::convert_mini_block_size(current_test_case.mini_block_size);
+    const size_t middle_offset    = std::min(mini_block_bytes / 2u, source.size() - 1u);
+
+    // Ranges that start and end inside mini-blocks, cross several of them and cover the whole block
+    const std::vector<std::pair<size_t, size_t>> ranges = {
+            {0u, source.size()},
+            {middle_offset, std::min(source.size() - middle_offset, 3u * mini_block_bytes)},
+            {source.size() - 1u, 1u},
+            {source.size() / 3u, source.size() / 3u}
+    };
+
+    for (auto cache_size : {1u, 3u}) {
+        deflate_block.set_cache_size(cache_size);
+
+        for (const auto &range : ranges) {
+            std::vector<uint8_t> destination(range.second);
+
+            ASSERT_NO_THROW(deflate_block.read(range.first, range.second, destination.begin()));
+            EXPECT_TRUE(std::equal(destination.begin(), destination.end(), source.begin() + range.first))
+                                << "offset: " << range.first << ", length: " << range.second;
+        }
+    }
+
+    std::vector<uint8_t> destination(2u);
+    EXPECT_THROW(deflate_block.read(source.size() - 1u, 2u, destination.begin()), invalid_argument_exception);
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_block, gather, DeflateBlockTest) {
+    auto deflate_operation = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .build();
+
+    auto deflate_block = test::build_deflate_block(deflate_operation, source, current_test_case.mini_block_size);
+
+    // Positions jump between the beginning and the end of the block
+    std::vector<uint32_t> indices;
+
+    for (size_t i = 0u; i < source.size() / 2u; i += 97u) {
+        indices.push_back(static_cast<uint32_t>(i));
+        indices.push_back(static_cast<uint32_t>(source.size() - 1u - i));
+    }
+
+    std::vector<uint8_t> destination(indices.size());
+
+    ASSERT_NO_THROW(deflate_block.gather(indices.begin(), indices.end(), destination.begin()));
+
+    for (size_t i = 0u; i < indices.size(); i++) {
+        ASSERT_EQ(source[indices[i]], destination[i]) << "position: " << indices[i];
+    }
+
+    // Alternating point accesses are served by the cache
+    deflate_block.set_cache_size(2u);
+
+    for (size_t i = 0u; i < indices.size(); i++) {
+        ASSERT_EQ(source[indices[i]], deflate_block[indices[i]]) << "position: " << indices[i];
+    }
+}
+
 } // namespace qpl::test
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <vector>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "qpl/qpl.hpp"
+
+#include "ta_hl_common.hpp"
+#include "high_level_api_util.hpp"
+#include "source_provider.hpp"
+#include "format_generator.hpp"
+
+namespace qpl::test {
+
+static inline auto get_test_case_info(const uint32_t seed,
+                                      const uint32_t number_of_elements,
+                                      const uint32_t input_bit_width) -> std::string {
+    std::string result = std::string("\nTest parameters:") +
+                         "\n" + "Seed: " + std::to_string(seed) +
+                         "\n" + "Number of elements: " + std::to_string(number_of_elements) +
+                         "\n" + "Input bit width: " + std::to_string(input_bit_width) +
+                         "\n";
+
+    return result;
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(execution_context, scan_and_find_unique) {
+    const auto seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    // One context for all iterations to check that buffers are reused correctly
+    execution_context<std::allocator> context;
+
+    for (auto number_of_elements : format_generator::generate_length_sequence()) {
+        for (uint32_t input_bit_width = 1u; input_bit_width <= 15u; input_bit_width++) {
+            source_provider source_generator(number_of_elements, input_bit_width, seed);
+
+            auto source         = source_generator.get_source();
+            auto test_case_info = get_test_case_info(seed, number_of_elements, input_bit_width);
+
+            // Scan
+            std::vector<uint8_t> scan_destination((number_of_elements + 7u) / 8u, 0u);
+            std::vector<uint8_t> scan_reference(scan_destination.size(), 0u);
+
+            auto scan_operation = scan_operation::builder(less, (1u << input_bit_width) / 2u)
+                    .input_vector_width(input_bit_width)
+                    .output_vector_width(1u)
+                    .number_of_input_elements(number_of_elements)
+                    .build();
+
+            uint32_t scan_result_count    = 0u;
+            uint32_t scan_reference_count = 0u;
+
+            ASSERT_NO_THROW(scan_result_count = handle_result(test::execute(scan_operation,
+                                                                            context,
+                                                                            source,
+                                                                            scan_destination))) << test_case_info;
+            ASSERT_NO_THROW(scan_reference_count = handle_result(test::execute(scan_operation,
+                                                                               source,
+                                                                               scan_reference))) << test_case_info;
+
+            ASSERT_EQ(scan_reference_count, scan_result_count) << test_case_info;
+            ASSERT_EQ(scan_reference, scan_destination) << test_case_info;
+
+            // Find unique
+            const uint32_t low_bits_to_ignore  = input_bit_width / 3u;
+            const uint32_t high_bits_to_ignore = input_bit_width / 3u;
+            const uint32_t set_size            = 1u << (input_bit_width - low_bits_to_ignore - high_bits_to_ignore);
+
+            std::vector<uint8_t> unique_destination((set_size + 7u) / 8u, 0u);
+            std::vector<uint8_t> unique_reference(unique_destination.size(), 0u);
+
+            auto find_unique_operation = find_unique_operation::builder(low_bits_to_ignore, high_bits_to_ignore)
+                    .input_vector_width(input_bit_width)
+                    .number_of_input_elements(number_of_elements)
+                    .build();
+
+            uint32_t unique_result_count    = 0u;
+            uint32_t unique_reference_count = 0u;
+
+            ASSERT_NO_THROW(unique_result_count = handle_result(test::execute(find_unique_operation,
+                                                                              context,
+                                                                              source,
+                                                                              unique_destination))) << test_case_info;
+            ASSERT_NO_THROW(unique_reference_count = handle_result(test::execute(find_unique_operation,
+                                                                                 source,
+                                                                                 unique_reference))) << test_case_info;
+
+            ASSERT_EQ(unique_reference_count, unique_result_count) << test_case_info;
+            ASSERT_EQ(unique_reference, unique_destination) << test_case_info;
+        }
+    }
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(execution_context, compression) {
+    const auto     seed               = util::TestEnvironment::GetInstance().GetSeed();
+    const uint32_t number_of_elements = 64u * 1024u;
+
+    source_provider source_generator(number_of_elements, 8u, seed);
+
+    auto source = source_generator.get_source();
+
+    std::vector<uint8_t> compressed_source(2u * source.size() + 1024u);
+    std::vector<uint8_t> destination(source.size());
+
+    auto &context = execution_context<std::allocator>::get_thread_local();
+
+    auto deflate_operation = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .build();
+
+    auto inflate_operation = inflate_operation::builder().build();
+
+    // The second pass works with buffers cached by the first one
+    for (uint32_t pass = 0u; pass < 2u; pass++) {
+        std::fill(destination.begin(), destination.end(), 0u);
+
+        uint32_t compressed_size = 0u;
+
+        ASSERT_NO_THROW(compressed_size = handle_result(test::execute(deflate_operation,
+                                                                      context,
+                                                                      source,
+                                                                      compressed_source)));
+
+        std::vector<uint8_t> compressed(compressed_source.begin(), compressed_source.begin() + compressed_size);
+
+        uint32_t decompressed_size = 0u;
+
+        ASSERT_NO_THROW(decompressed_size = handle_result(test::execute(inflate_operation,
+                                                                        context,
+                                                                        compressed,
+                                                                        destination)));
+
+        ASSERT_EQ(source.size(), decompressed_size);
+        ASSERT_EQ(source, destination);
+    }
+}
+
+} // namespace qpl::test
@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstring>
+#include <vector>
+
+#include "ta_hl_common.hpp"
+#include "compression_fixture.hpp"
+#include "high_level_api_util.hpp"
+#include "check_result.hpp"
+
+namespace qpl::test {
+
+static constexpr uint32_t test_thread_count = 4u;
+static constexpr uint32_t test_segment_size = 16u * 1024u;
+static constexpr uint32_t gzip_trailer_size = 8u;
+
+class ParallelCompressionTest : public CompressionFixture {
+public:
+    void InitializeTestCases() {
+        CompressionTestCase test_case;
+
+        for (bool gzip : {false, true}) {
+            for (auto &dataset: util::TestEnvironment::GetInstance().GetAlgorithmicDataset().get_data()) {
+                test_case.file_name = dataset.first;
+                test_case.gzip_mode = gzip;
+
+                this->AddNewTestCase(test_case);
+            }
+        }
+    }
+
+    void SetUp() override {
+        CompressionFixture::SetUp();
+        InitializeTestCases();
+    }
+
+    void RunRoundTrip(deflate_operation::builder &builder) {
+        std::vector<uint8_t> compressed_source(2 * source.size() + additional_bytes_for_compression);
+        std::vector<uint8_t> reference_source(compressed_source.size());
+
+        uint32_t deflate_result_value   = 0;
+        uint32_t reference_result_value = 0;
+
+        auto reference_operation = builder.gzip_mode(current_test_case.gzip_mode).build();
+        auto deflate_operation   = builder.parallel(test_thread_count, test_segment_size).build();
+
+        ASSERT_NO_THROW(deflate_result_value = handle_result(test::execute(deflate_operation,
+                                                                           source,
+                                                                           compressed_source)));
+        ASSERT_NO_THROW(reference_result_value = handle_result(test::execute(reference_operation,
+                                                                             source,
+                                                                             reference_source)));
+
+        // Decompression
+        auto inflate_operation = inflate_operation::builder()
+                .gzip_mode(current_test_case.gzip_mode)
+                .build();
+
+        auto inflate_result = test::execute(inflate_operation,
+                                            compressed_source.begin(),
+                                            compressed_source.begin() + deflate_result_value,
+                                            destination.begin(),
+                                            destination.end());
+
+        ASSERT_NO_THROW(handle_result(inflate_result));
+
+        // Assert
+        EXPECT_TRUE(CompareVectors(destination, source));
+
+        if (current_test_case.gzip_mode) {
+            uint32_t crc           = 0u;
+            uint32_t reference_crc = 0u;
+            uint32_t input_size    = 0u;
+
+            std::memcpy(&crc, &compressed_source[deflate_result_value - gzip_trailer_size], sizeof(crc));
+            std::memcpy(&input_size, &compressed_source[deflate_result_value - sizeof(input_size)], sizeof(input_size));
+            std::memcpy(&reference_crc, &reference_source[reference_result_value - gzip_trailer_size], sizeof(crc));
+
+            EXPECT_EQ(reference_crc, crc);
+
+            // Sources that fit into one segment are compressed by the regular path
+            if (source.size() > test_segment_size) {
+                EXPECT_EQ(source.size(), input_size);
+            }
+        }
+    }
+};
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(parallel_compression, default_dynamic, ParallelCompressionTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "Parallel compression is supported by the software path only.";
+    }
+
+    auto builder = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .compression_level(default_level);
+
+    RunRoundTrip(builder);
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(parallel_compression, default_fixed, ParallelCompressionTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "Parallel compression is supported by the software path only.";
+    }
+
+    auto builder = deflate_operation::builder()
+            .compression_mode<fixed_mode>()
+            .compression_level(default_level);
+
+    RunRoundTrip(builder);
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(parallel_compression, default_static, ParallelCompressionTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "Parallel compression is supported by the software path only.";
+    }
+
+    deflate_histogram deflate_histogram;
+    test::update_deflate_statistics(source.begin(), source.end(), deflate_histogram, default_level);
+
+    auto builder = deflate_operation::builder()
+            .compression_mode<static_mode>(test::make_deflate_table(deflate_histogram))
+            .compression_level(default_level);
+
+    RunRoundTrip(builder);
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(parallel_compression, high_dynamic, ParallelCompressionTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "Parallel compression is supported by the software path only.";
+    }
+
+    auto builder = deflate_operation::builder()
+            .compression_mode<dynamic_mode>()
+            .compression_level(high_level);
+
+    RunRoundTrip(builder);
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST_TC(parallel_compression, high_fixed, ParallelCompressionTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        GTEST_SKIP() << "Parallel compression is supported by the software path only.";
+    }
+
+    auto builder = deflate_operation::builder()
+            .compression_mode<fixed_mode>()
+            .compression_level(high_level);
+
+    RunRoundTrip(builder);
+}
+
+} // namespace qpl::test
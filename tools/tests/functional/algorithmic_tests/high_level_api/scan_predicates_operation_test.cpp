@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <random>
+#include <vector>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "qpl/cpp_api/operations/analytics/scan_predicates_operation.hpp"
+
+#include "ta_hl_common.hpp"
+#include "high_level_api_util.hpp"
+
+namespace qpl::test {
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(scan_predicates, little_endian) {
+    // Programs of predicates are evaluated by the software path only
+    if (qpl_path_hardware == util::TestEnvironment::GetInstance().GetExecutionPath()) {
+        return;
+    }
+
+    const auto seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    std::mt19937 generator(seed);
+
+    for (uint32_t number_of_elements : {1u, 100u, 40001u}) {
+        for (uint32_t input_bit_width : {3u, 8u, 16u, 21u}) {
+            const uint32_t max_value = (1u << input_bit_width) - 1u;
+
+            std::vector<uint32_t> values(number_of_elements);
+
+            for (auto &value : values) {
+                value = generator() & max_value;
+            }
+
+            std::vector<uint8_t> source((number_of_elements * input_bit_width + 7u) / 8u, 0u);
+
+            for (uint32_t i = 0u; i < number_of_elements; i++) {
+                for (uint32_t bit = 0u; bit < input_bit_width; bit++) {
+                    const uint64_t position = static_cast<uint64_t>(i) * input_bit_width + bit;
+
+                    source[position / 8u] |= static_cast<uint8_t>(((values[i] >> bit) & 1u) << (position % 8u));
+                }
+            }
+
+            const uint32_t low_boundary  = max_value / 4u;
+            const uint32_t high_boundary = 3u * (max_value / 4u);
+            const uint32_t point         = max_value / 2u;
+
+            // (x >= low && x < high && !(x == point)) || x == 0
+            auto operation = scan_predicates_operation::builder(qpl::greater, low_boundary)
+                    .is_inclusive(true)
+                    .predicate(predicate_and, qpl::less, high_boundary)
+                    .predicate(predicate_and_not, qpl::equals, point)
+                    .predicate(predicate_or, qpl::equals, 0u)
+                    .parser<little_endian_packed_array>(number_of_elements)
+                    .input_vector_width(input_bit_width)
+                    .output_vector_width(1u)
+                    .build();
+
+            std::vector<uint8_t> destination((number_of_elements + 7u) / 8u, 0u);
+            std::vector<uint8_t> reference(destination.size(), 0u);
+
+            for (uint32_t i = 0u; i < number_of_elements; i++) {
+                const uint32_t value = values[i];
+
+                if ((value >= low_boundary && value < high_boundary && value != point) || 0u == value) {
+                    reference[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+                }
+            }
+
+            const std::string test_case_info = "\nSeed: " + std::to_string(seed) +
+                                               "\nNumber of elements: " + std::to_string(number_of_elements) +
+                                               "\nInput bit width: " + std::to_string(input_bit_width) + "\n";
+
+            ASSERT_NO_THROW(handle_result(test::execute(operation, source, destination))) << test_case_info;
+            EXPECT_EQ(reference, destination) << test_case_info;
+        }
+    }
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(scan_predicates, too_many_predicates) {
+    if (qpl_path_hardware == util::TestEnvironment::GetInstance().GetExecutionPath()) {
+        return;
+    }
+
+    std::vector<uint8_t> source(64u, 1u);
+    std::vector<uint8_t> destination(source.size(), 0u);
+
+    auto builder = scan_predicates_operation::builder(qpl::equals, 1u);
+
+    for (uint32_t i = 0u; i < scan_predicates_operation::max_predicates; i++) {
+        (void) builder.predicate(predicate_or, qpl::equals, i);
+    }
+
+    auto operation = builder.input_vector_width(8u)
+            .output_vector_width(1u)
+            .build();
+
+    EXPECT_ANY_THROW(handle_result(test::execute(operation, source, destination)));
+}
+
+}
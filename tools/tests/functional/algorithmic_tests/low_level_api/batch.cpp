@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl/qpl.h"
+#include "../../../common/operation_test.hpp"
+#include "source_provider.hpp"
+#include "ta_ll_common.hpp"
+
+namespace qpl::test {
+
+constexpr uint32_t batch_size      = 64u;
+constexpr uint32_t scan_bit_width  = 8u;
+constexpr uint32_t scan_boundary   = 100u;
+
+/**
+ * @brief Jobs of the batch with their buffers, the n-th job scans (n + 1) KB
+ */
+class batch_of_scans {
+public:
+    explicit batch_of_scans(qpl_path_t path) {
+        const auto seed = util::TestEnvironment::GetInstance().GetSeed();
+        uint32_t job_size = 0u;
+
+        EXPECT_EQ(QPL_STS_OK, qpl_get_job_size(path, &job_size));
+
+        for (uint32_t i = 0u; i < batch_size; i++) {
+            const uint32_t elements_count = (i + 1u) * 1024u;
+
+            job_buffers_.push_back(std::make_unique<uint8_t[]>(job_size));
+            jobs_.push_back(reinterpret_cast<qpl_job *>(job_buffers_.back().get()));
+            sources_.push_back(source_provider(elements_count, scan_bit_width, seed + i).get_source());
+            destinations_.emplace_back(elements_count / 8u, 0u);
+            references_.emplace_back(elements_count / 8u, 0u);
+
+            EXPECT_EQ(QPL_STS_OK, qpl_init_job(path, jobs_.back()));
+        }
+    }
+
+    ~batch_of_scans() {
+        for (auto *job_ptr : jobs_) {
+            qpl_fini_job(job_ptr);
+        }
+    }
+
+    /**
+     * @brief Fills references by executing jobs one by one and prepares them for the batch
+     */
+    void execute_references() {
+        for (uint32_t i = 0u; i < batch_size; i++) {
+            prepare(i, references_[i]);
+            ASSERT_EQ(QPL_STS_OK, qpl_execute_job(jobs_[i]));
+        }
+
+        prepare_jobs();
+    }
+
+    /**
+     * @brief Prepares jobs for the batch without the references
+     */
+    void prepare_jobs() {
+        for (uint32_t i = 0u; i < batch_size; i++) {
+            prepare(i, destinations_[i]);
+        }
+    }
+
+    void compare() {
+        for (uint32_t i = 0u; i < batch_size; i++) {
+            ASSERT_EQ(references_[i], destinations_[i]) << "job: " << i;
+            ASSERT_EQ(references_[i].size(), jobs_[i]->total_out) << "job: " << i;
+        }
+    }
+
+    auto jobs() -> qpl_job ** {
+        return jobs_.data();
+    }
+
+private:
+    void prepare(uint32_t index, std::vector<uint8_t> &destination) {
+        auto *job_ptr = jobs_[index];
+
+        job_ptr->op                 = qpl_op_scan_lt;
+        job_ptr->parser             = qpl_p_le_packed_array;
+        job_ptr->param_low          = scan_boundary;
+        job_ptr->src1_bit_width     = scan_bit_width;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->num_input_elements = static_cast<uint32_t>(sources_[index].size());
+        job_ptr->flags              = QPL_FLAG_OMIT_AGGREGATES | QPL_FLAG_OMIT_CHECKSUMS;
+        job_ptr->next_in_ptr        = sources_[index].data();
+        job_ptr->available_in       = static_cast<uint32_t>(sources_[index].size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    }
+
+    std::vector<std::unique_ptr<uint8_t[]>> job_buffers_;
+    std::vector<qpl_job *>                  jobs_;
+    std::vector<std::vector<uint8_t>>       sources_;
+    std::vector<std::vector<uint8_t>>       destinations_;
+    std::vector<std::vector<uint8_t>>       references_;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(batch, wait) {
+    batch_of_scans batch(util::TestEnvironment::GetInstance().GetExecutionPath());
+    batch.execute_references();
+
+    std::vector<qpl_status> statuses(batch_size, QPL_STS_BEING_PROCESSED);
+
+    ASSERT_EQ(QPL_STS_OK, qpl_submit_batch(batch.jobs(), batch_size));
+    ASSERT_EQ(QPL_STS_OK, qpl_wait_batch(batch.jobs(), batch_size, statuses.data()));
+
+    for (auto status : statuses) {
+        ASSERT_EQ(QPL_STS_OK, status);
+    }
+
+    batch.compare();
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(batch, check) {
+    batch_of_scans batch(util::TestEnvironment::GetInstance().GetExecutionPath());
+    batch.execute_references();
+
+    std::vector<qpl_status> statuses(batch_size, QPL_STS_BEING_PROCESSED);
+
+    ASSERT_EQ(QPL_STS_OK, qpl_submit_batch(batch.jobs(), batch_size));
+
+    qpl_status status = QPL_STS_BEING_PROCESSED;
+
+    while (QPL_STS_BEING_PROCESSED == status) {
+        status = qpl_check_batch(batch.jobs(), batch_size, statuses.data());
+    }
+
+    ASSERT_EQ(QPL_STS_OK, status);
+
+    // Completed jobs are not checked again
+    ASSERT_EQ(QPL_STS_OK, qpl_wait_batch(batch.jobs(), batch_size, statuses.data()));
+
+    batch.compare();
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(batch, rejected_batch_is_not_submitted) {
+    batch_of_scans batch(util::TestEnvironment::GetInstance().GetExecutionPath());
+    batch.execute_references();
+
+    batch.jobs()[batch_size - 1u]->op = static_cast<qpl_operation>(0xFFu);
+
+    ASSERT_EQ(QPL_STS_OPERATION_ERR, qpl_submit_batch(batch.jobs(), batch_size));
+
+    for (uint32_t i = 0u; i < batch_size; i++) {
+        ASSERT_EQ(QPL_STS_OK, qpl_check_job(batch.jobs()[i])) << "job: " << i;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(batch, job_over_accelerator_limits_rejects_batch) {
+    if (qpl_path_hardware != util::TestEnvironment::GetInstance().GetExecutionPath()) {
+        GTEST_SKIP() << "Accelerator limits are checked on the hardware path only";
+    }
+
+    batch_of_scans batch(qpl_path_hardware);
+    batch.prepare_jobs();
+
+    // The accelerator doesn't scan raw streams, the job is rejected before any other job is enqueued
+    batch.jobs()[batch_size - 1u]->flags |= QPL_FLAG_NO_HDRS;
+
+    ASSERT_EQ(QPL_STS_OPERATION_ERR, qpl_submit_batch(batch.jobs(), batch_size));
+}
+
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "../../../common/operation_test.hpp"
+#include "ta_ll_common.hpp"
+
+namespace qpl::test {
+
+class BitmapTest : public JobFixture {
+protected:
+    static auto apply(qpl_operation operation, uint8_t a, uint8_t b) -> uint8_t {
+        switch (operation) {
+            case qpl_op_bitmap_and:
+                return a & b;
+            case qpl_op_bitmap_or:
+                return a | b;
+            case qpl_op_bitmap_xor:
+                return a ^ b;
+            case qpl_op_bitmap_and_not:
+                return a & static_cast<uint8_t>(~b);
+            default:
+                return static_cast<uint8_t>(~a);
+        }
+    }
+
+    auto GenerateBitmap(uint32_t bit_count, uint32_t salt) -> std::vector<uint8_t> {
+        std::mt19937 generator(GetSeed() + salt);
+
+        std::vector<uint8_t> bitmap((bit_count + 7u) / 8u);
+
+        for (auto &byte : bitmap) {
+            byte = static_cast<uint8_t>(generator());
+        }
+
+        return bitmap;
+    }
+
+    void SetBitmapJob(qpl_operation operation, uint32_t bit_count,
+                      std::vector<uint8_t> &source1, std::vector<uint8_t> &source2, std::vector<uint8_t> &destination) {
+        job_ptr->op                 = operation;
+        job_ptr->flags              = 0u;
+        job_ptr->num_input_elements = bit_count;
+        job_ptr->next_in_ptr        = source1.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source1.size());
+        job_ptr->next_src2_ptr      = source2.data();
+        job_ptr->available_src2     = static_cast<uint32_t>(source2.size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    }
+
+    static constexpr std::array<uint32_t, 6> bit_counts = {1u, 7u, 64u, 333u, 4096u, 100003u};
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(bitmap, logic, BitmapTest) {
+    // Bit vector operations are performed by the software path only
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto operation : {qpl_op_bitmap_and, qpl_op_bitmap_or, qpl_op_bitmap_xor,
+                           qpl_op_bitmap_and_not, qpl_op_bitmap_not}) {
+        for (auto bit_count : bit_counts) {
+            auto source1 = GenerateBitmap(bit_count, 1u);
+            auto source2 = GenerateBitmap(bit_count, 2u);
+
+            std::vector<uint8_t> destination(source1.size() + 1u, 0xAAu);
+
+            SetBitmapJob(operation, bit_count, source1, source2, destination);
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "operation " << operation << ", bits " << bit_count;
+
+            std::vector<uint8_t> reference(source1.size());
+            std::vector<uint32_t> indices;
+
+            for (uint32_t i = 0u; i < bit_count; i++) {
+                const uint8_t byte = apply(operation, source1[i / 8u], source2[i / 8u]);
+
+                if ((byte >> (i % 8u)) & 1u) {
+                    reference[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+                    indices.push_back(i);
+                }
+            }
+
+            ASSERT_EQ(reference.size(), job_ptr->total_out);
+            EXPECT_TRUE(std::equal(reference.begin(), reference.end(), destination.begin()))
+                                << "operation " << operation << ", bits " << bit_count;
+            EXPECT_EQ(0xAAu, destination.back());
+            EXPECT_EQ(bit_count % 8u, job_ptr->last_bit_offset);
+            EXPECT_EQ(indices.size(), job_ptr->sum_value);
+
+            if (!indices.empty()) {
+                EXPECT_EQ(indices.front(), job_ptr->first_index_min_value);
+                EXPECT_EQ(indices.back(), job_ptr->last_index_max_value);
+            }
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(bitmap, count, BitmapTest) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto bit_count : bit_counts) {
+        for (uint32_t set_bits : {0u, 1u, 2u}) {
+            // Bits beyond the vector are set to check they are ignored
+            std::vector<uint8_t> source((bit_count + 7u) / 8u, 0u);
+            std::vector<uint8_t> unused;
+
+            if (bit_count % 8u) {
+                source.back() = static_cast<uint8_t>(0xFFu << (bit_count % 8u));
+            }
+
+            std::mt19937 generator(GetSeed() + bit_count);
+
+            std::vector<uint32_t> indices;
+
+            for (uint32_t i = 0u; i < set_bits; i++) {
+                const uint32_t index = generator() % bit_count;
+
+                source[index / 8u] |= static_cast<uint8_t>(1u << (index % 8u));
+                indices.push_back(index);
+            }
+
+            std::sort(indices.begin(), indices.end());
+            indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+            SetBitmapJob(qpl_op_bitmap_count, bit_count, source, unused, unused);
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "bits " << bit_count;
+
+            EXPECT_EQ(0u, job_ptr->total_out);
+            EXPECT_EQ(indices.size(), job_ptr->sum_value);
+
+            if (indices.empty()) {
+                EXPECT_EQ(UINT32_MAX, job_ptr->first_index_min_value);
+                EXPECT_EQ(0u, job_ptr->last_index_max_value);
+            } else {
+                EXPECT_EQ(indices.front(), job_ptr->first_index_min_value);
+                EXPECT_EQ(indices.back(), job_ptr->last_index_max_value);
+            }
+        }
+    }
+}
+
+}
@@ -287,6 +287,96 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_default_level, Defla
     CompressFixedMode(qpl_default_level);
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_blocks_level_0, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 0 on the hardware path";
+        }
+        return;
+    }
+    CompressDynamicMode(qpl_level_0);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, static_blocks_level_0, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 0 on the hardware path";
+        }
+        return;
+    }
+    CompressStaticMode(qpl_level_0);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_level_0, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 0 on the hardware path";
+        }
+        return;
+    }
+    CompressFixedMode(qpl_level_0);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_blocks_level_2, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 2 on the hardware path";
+        }
+        return;
+    }
+    CompressDynamicMode(qpl_level_2);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, static_blocks_level_2, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 2 on the hardware path";
+        }
+        return;
+    }
+    CompressStaticMode(qpl_level_2);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_level_2, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 2 on the hardware path";
+        }
+        return;
+    }
+    CompressFixedMode(qpl_level_2);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, dynamic_blocks_level_9, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 9 on the hardware path";
+        }
+        return;
+    }
+    CompressDynamicMode(qpl_level_9);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, static_blocks_level_9, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 9 on the hardware path";
+        }
+        return;
+    }
+    CompressStaticMode(qpl_level_9);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate, fixed_blocks_level_9, DeflateTest) {
+    if (GetExecutionPath() == qpl_path_hardware) {
+        if (0 == DeflateTest::num_test++) {
+            GTEST_SKIP() << "Deflate operation doesn't support compression level 9 on the hardware path";
+        }
+        return;
+    }
+    CompressFixedMode(qpl_level_9);
+}
+
 QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(deflate_index, dynamic_blocks_high_level, DeflateTest) {
     if (GetExecutionPath() == qpl_path_hardware) {
         GTEST_SKIP() << "Resource management mistake when HW test (replaced by test deflate_high.dynamic_verify";
@@ -4,6 +4,10 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <set>
 #include <vector>
 #include <string>
 #include "gtest/gtest.h"
@@ -14,6 +18,7 @@
 #include "qpl_api_ref.h"
 #include "ta_ll_common.hpp"
 #include "check_result.hpp"
+#include "random_generator.h"
 
 namespace qpl::test
 {
@@ -141,3 +146,112 @@ namespace qpl::test
         EXPECT_TRUE(CompareVectors(destination, reference_destination, job_ptr->total_out));
     }
 }
+
+namespace qpl::test
+{
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(find_unique_list, wide_and_narrow_domains)
+    {
+        struct set_list_case_t
+        {
+            uint32_t bit_width;
+            uint32_t low_bits_to_ignore;
+            uint32_t high_bits_to_ignore;
+        };
+
+        // Domains of 15 bits and narrower are marked in the byte per value set, wider ones in the hash set
+        constexpr set_list_case_t set_list_cases[] = {{16u, 0u, 0u},
+                                                      {16u, 1u, 0u},
+                                                      {32u, 0u, 0u},
+                                                      {32u, 4u, 8u},
+                                                      {32u, 0u, 20u}};
+
+        constexpr uint32_t elements_count = 50000u;
+
+        auto     execution_path = util::TestEnvironment::GetInstance().GetExecutionPath();
+        auto     seed           = util::TestEnvironment::GetInstance().GetSeed();
+        uint32_t job_size       = 0u;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(execution_path, &job_size));
+
+        auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+        auto job_ptr    = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(execution_path, job_ptr));
+
+        random random_value(0u, UINT32_MAX, seed);
+
+        for (const auto &test_case : set_list_cases)
+        {
+            const uint32_t set_bit_width = test_case.bit_width - test_case.low_bits_to_ignore - test_case.high_bits_to_ignore;
+            const uint32_t value_mask    = (set_bit_width == 32u) ? UINT32_MAX : (1u << set_bit_width) - 1u;
+
+            // Low and high cardinalities
+            for (uint32_t distinct_count : {7u, elements_count})
+            {
+                std::vector<uint32_t> distinct_values(distinct_count);
+                std::generate(distinct_values.begin(), distinct_values.end(), [&random_value]() {
+                    return static_cast<uint32_t>(random_value);
+                });
+
+                std::vector<uint8_t> source(elements_count * test_case.bit_width / 8u);
+                std::set<uint32_t>   reference_set;
+
+                for (uint32_t i = 0u; i < elements_count; i++)
+                {
+                    const uint32_t value = distinct_values[static_cast<uint32_t>(random_value) % distinct_count];
+
+                    std::memcpy(source.data() + i * (test_case.bit_width / 8u), &value, test_case.bit_width / 8u);
+                    reference_set.insert((value >> test_case.low_bits_to_ignore) & value_mask);
+                }
+
+                const std::vector<uint32_t> reference(reference_set.begin(), reference_set.end());
+
+                for (bool is_short_destination : {false, true})
+                {
+                    const uint32_t destination_size = static_cast<uint32_t>(reference.size() * sizeof(uint32_t))
+                                                      - (is_short_destination ? 1u : 0u);
+
+                    std::vector<uint8_t> destination(destination_size + 1u);
+
+                    job_ptr->op                 = qpl_op_find_unique;
+                    job_ptr->parser             = qpl_p_le_packed_array;
+                    job_ptr->next_in_ptr        = source.data();
+                    job_ptr->available_in       = static_cast<uint32_t>(source.size());
+                    job_ptr->next_out_ptr       = destination.data();
+                    job_ptr->available_out      = destination_size;
+                    job_ptr->src1_bit_width     = test_case.bit_width;
+                    job_ptr->num_input_elements = elements_count;
+                    job_ptr->out_bit_width      = qpl_ow_nom;
+                    job_ptr->param_low          = test_case.low_bits_to_ignore;
+                    job_ptr->param_high         = test_case.high_bits_to_ignore;
+                    job_ptr->flags              = QPL_FLAG_SET_LIST;
+
+                    auto status = run_job_api(job_ptr);
+
+                    if (execution_path == qpl_path_hardware)
+                    {
+                        ASSERT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, status);
+                        continue;
+                    }
+
+                    if (is_short_destination)
+                    {
+                        ASSERT_EQ(QPL_STS_DST_IS_SHORT_ERR, status);
+                        continue;
+                    }
+
+                    ASSERT_EQ(QPL_STS_OK, status);
+                    ASSERT_EQ(reference.size() * sizeof(uint32_t), job_ptr->total_out);
+                    ASSERT_EQ(0, std::memcmp(reference.data(), destination.data(), job_ptr->total_out))
+                        << "bit width: " << test_case.bit_width << ", distinct values: " << distinct_count;
+
+                    EXPECT_EQ(reference.size(), job_ptr->sum_value);
+                    EXPECT_EQ(reference.front(), job_ptr->first_index_min_value);
+                    EXPECT_EQ(reference.back(), job_ptr->last_index_max_value);
+                }
+            }
+        }
+
+        ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+    }
+}
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "../../../common/operation_test.hpp"
+#include "ta_ll_common.hpp"
+#include "source_provider.hpp"
+
+namespace qpl::test {
+
+class JobClassesTest : public JobFixture {
+protected:
+    void SetUp() override {
+        JobFixture::SetUp();
+
+        source_provider source_generator(element_count, bit_width, GetSeed());
+        ASSERT_NO_THROW(source = source_generator.get_source());
+
+        compressed_source.resize(source.size() * 2u + 100u);
+
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST | QPL_FLAG_DYNAMIC_HUFFMAN | QPL_FLAG_OMIT_VERIFY;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr  = compressed_source.data();
+        job_ptr->available_out = static_cast<uint32_t>(compressed_source.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+        compressed_source.resize(job_ptr->total_out);
+    }
+
+    auto InitJob(uint32_t op_classes, std::unique_ptr<uint8_t[]> &job_buffer) -> qpl_job * {
+        uint32_t full_size = 0u;
+        uint32_t job_size  = 0u;
+
+        EXPECT_EQ(QPL_STS_OK, qpl_get_job_size(GetExecutionPath(), &full_size));
+        EXPECT_EQ(QPL_STS_OK, qpl_get_job_size_for_class(GetExecutionPath(), op_classes, &job_size));
+
+        if (qpl_op_class_all != op_classes) {
+            EXPECT_LT(job_size, full_size);
+        }
+
+        job_buffer = std::make_unique<uint8_t[]>(job_size);
+        auto *new_job_ptr = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+        EXPECT_EQ(QPL_STS_OK, qpl_init_job_for_class(GetExecutionPath(), op_classes, new_job_ptr));
+
+        return new_job_ptr;
+    }
+
+    void RunScan(qpl_job *scan_job_ptr, std::vector<uint8_t> &destination) {
+        destination.assign(element_count / 8u + 1u, 0u);
+
+        scan_job_ptr->op                 = qpl_op_scan_range;
+        scan_job_ptr->flags              = QPL_FLAG_DECOMPRESS_ENABLE | QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        scan_job_ptr->param_low          = 10u;
+        scan_job_ptr->param_high         = 200u;
+        scan_job_ptr->src1_bit_width     = bit_width;
+        scan_job_ptr->num_input_elements = element_count;
+        scan_job_ptr->out_bit_width      = qpl_ow_nom;
+        scan_job_ptr->next_in_ptr        = compressed_source.data();
+        scan_job_ptr->available_in       = static_cast<uint32_t>(compressed_source.size());
+        scan_job_ptr->next_out_ptr       = destination.data();
+        scan_job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(scan_job_ptr));
+    }
+
+    static constexpr uint32_t element_count = 64u * 1024u;
+    static constexpr uint32_t bit_width     = 8u;
+
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> compressed_source;
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_classes, analytics, JobClassesTest) {
+    std::vector<uint8_t> reference;
+    std::vector<uint8_t> destination;
+
+    std::unique_ptr<uint8_t[]> reference_job_buffer;
+    std::unique_ptr<uint8_t[]> slim_job_buffer;
+
+    auto *reference_job_ptr = InitJob(qpl_op_class_all, reference_job_buffer);
+    RunScan(reference_job_ptr, reference);
+
+    auto *slim_job_ptr = InitJob(qpl_op_class_analytics, slim_job_buffer);
+    RunScan(slim_job_ptr, destination);
+
+    EXPECT_EQ(reference, destination);
+    EXPECT_EQ(reference_job_ptr->sum_value, slim_job_ptr->sum_value);
+
+    qpl_fini_job(slim_job_ptr);
+    qpl_fini_job(reference_job_ptr);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_classes, decompress, JobClassesTest) {
+    std::vector<uint8_t> destination(source.size());
+
+    std::unique_ptr<uint8_t[]> slim_job_buffer;
+
+    auto *slim_job_ptr = InitJob(qpl_op_class_decompress, slim_job_buffer);
+
+    slim_job_ptr->op            = qpl_op_decompress;
+    slim_job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+    slim_job_ptr->next_in_ptr   = compressed_source.data();
+    slim_job_ptr->available_in  = static_cast<uint32_t>(compressed_source.size());
+    slim_job_ptr->next_out_ptr  = destination.data();
+    slim_job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(slim_job_ptr));
+    EXPECT_EQ(source, destination);
+
+    qpl_fini_job(slim_job_ptr);
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(job_classes, other, JobClassesTest) {
+    std::vector<uint8_t> destination(source.size());
+
+    std::unique_ptr<uint8_t[]> slim_job_buffer;
+
+    auto *slim_job_ptr = InitJob(qpl_op_class_other, slim_job_buffer);
+
+    slim_job_ptr->op            = qpl_op_memcpy;
+    slim_job_ptr->next_in_ptr   = source.data();
+    slim_job_ptr->available_in  = static_cast<uint32_t>(source.size());
+    slim_job_ptr->next_out_ptr  = destination.data();
+    slim_job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(slim_job_ptr));
+    EXPECT_EQ(source, destination);
+
+    qpl_fini_job(slim_job_ptr);
+}
+
+}
@@ -154,4 +154,199 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(job_reusage, compression_by_chunks_high_le
     CompressWithJobReusage(true, qpl_high_level);
 }
 
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(sampled_verification, reused_job, JobFixture) {
+    constexpr uint32_t source_size   = 10000u;
+    constexpr uint32_t sample_period = 3u;
+    constexpr uint32_t streams_count = 7u;
+
+    qpl::test::random random_symbol(0u, 15u, GetSeed());
+
+    std::vector<uint8_t> source(source_size);
+    std::vector<uint8_t> compressed(source_size * 2u);
+    std::vector<uint8_t> decompressed(source_size);
+
+    std::generate(source.begin(), source.end(), [&random_symbol]() {
+        return static_cast<uint8_t>(random_symbol);
+    });
+
+    // Streams are compressed with one job or with two ones, all jobs of a stream share the decision
+    for (uint32_t stream = 0u; stream < streams_count; stream++) {
+        const bool     is_single_job = (stream % 2u) == 0u;
+        const uint32_t first_size    = is_single_job ? source_size : source_size / 2u;
+
+        job_ptr->op                   = qpl_op_compress;
+        job_ptr->level                = qpl_default_level;
+        job_ptr->flags                = QPL_FLAG_FIRST | QPL_FLAG_VERIFY_SAMPLED | QPL_FLAG_DYNAMIC_HUFFMAN;
+        job_ptr->flags               |= is_single_job ? QPL_FLAG_LAST : 0u;
+        job_ptr->verify_sample_period = sample_period;
+        job_ptr->next_in_ptr          = source.data();
+        job_ptr->available_in         = first_size;
+        job_ptr->next_out_ptr         = compressed.data();
+        job_ptr->available_out        = static_cast<uint32_t>(compressed.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr)) << "stream " << stream;
+
+        if (!is_single_job) {
+            job_ptr->flags        = QPL_FLAG_LAST | QPL_FLAG_VERIFY_SAMPLED | QPL_FLAG_DYNAMIC_HUFFMAN;
+            job_ptr->available_in = source_size - first_size;
+
+            ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr)) << "stream " << stream;
+        }
+
+        EXPECT_EQ(stream + 1u, job_ptr->data_ptr.verify_stream_count) << "stream " << stream;
+        EXPECT_EQ((stream % sample_period) == 0u, job_ptr->data_ptr.is_stream_verified != 0u) << "stream " << stream;
+
+        const uint32_t compressed_size = job_ptr->total_out;
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->next_in_ptr   = compressed.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr)) << "stream " << stream;
+        ASSERT_EQ(source_size, job_ptr->total_out) << "stream " << stream;
+        ASSERT_TRUE(CompareVectors(decompressed, source)) << "stream " << stream;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(sampled_verification, only_sampled_streams_are_verified, JobFixture) {
+    // The running CRC of the hardware path is kept in the accelerator state, not in qpl_job.crc
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "The test corrupts the running CRC of the software path";
+    }
+
+    constexpr uint32_t source_size   = 10000u;
+    constexpr uint32_t sample_period = 3u;
+    constexpr uint32_t streams_count = 7u;
+
+    qpl::test::random random_symbol(0u, 15u, GetSeed());
+
+    std::vector<uint8_t> source(source_size);
+    std::vector<uint8_t> compressed(source_size * 2u);
+
+    std::generate(source.begin(), source.end(), [&random_symbol]() {
+        return static_cast<uint8_t>(random_symbol);
+    });
+
+    // A rejected stream start is retried with the same decision
+    job_ptr->op                   = qpl_op_compress;
+    job_ptr->flags                = QPL_FLAG_FIRST | QPL_FLAG_VERIFY_SAMPLED;
+    job_ptr->verify_sample_period = sample_period;
+    job_ptr->next_in_ptr          = source.data();
+    job_ptr->available_in         = source_size;
+    job_ptr->next_out_ptr         = nullptr;
+
+    ASSERT_NE(QPL_STS_OK, qpl_execute_job(job_ptr));
+    EXPECT_EQ(0u, job_ptr->data_ptr.verify_stream_count);
+
+    // The running CRC is corrupted between the jobs of each stream, only the verifier can notice it
+    for (uint32_t stream = 0u; stream < streams_count; stream++) {
+        job_ptr->op                   = qpl_op_compress;
+        job_ptr->level                = qpl_default_level;
+        job_ptr->flags                = QPL_FLAG_FIRST | QPL_FLAG_VERIFY_SAMPLED | QPL_FLAG_DYNAMIC_HUFFMAN;
+        job_ptr->verify_sample_period = sample_period;
+        job_ptr->next_in_ptr          = source.data();
+        job_ptr->available_in         = source_size / 2u;
+        job_ptr->next_out_ptr         = compressed.data();
+        job_ptr->available_out        = static_cast<uint32_t>(compressed.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr)) << "stream " << stream;
+
+        job_ptr->flags        = QPL_FLAG_LAST | QPL_FLAG_VERIFY_SAMPLED | QPL_FLAG_DYNAMIC_HUFFMAN;
+        job_ptr->available_in = source_size - source_size / 2u;
+        job_ptr->crc         ^= 1u;
+
+        const auto expected_status = (stream % sample_period == 0u) ? QPL_STS_VERIFY_ERR : QPL_STS_OK;
+
+        EXPECT_EQ(expected_status, qpl_execute_job(job_ptr)) << "stream " << stream;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(streaming_verification, multi_block_streams, JobFixture) {
+    constexpr uint32_t source_size = 1024u * 1024u;
+    constexpr uint32_t jobs_count  = 4u;
+    constexpr uint32_t job_size    = source_size / jobs_count;
+
+    qpl::test::random random_symbol(0u, 15u, GetSeed());
+
+    std::vector<uint8_t> source(source_size);
+    std::vector<uint8_t> compressed(source_size * 2u);
+    std::vector<uint8_t> decompressed(source_size);
+
+    std::generate(source.begin(), source.end(), [&random_symbol]() {
+        return static_cast<uint8_t>(random_symbol);
+    });
+
+    // Dynamic jobs write several blocks each, fixed jobs start a block with the same header each
+    const std::array<uint32_t, 2u> mode_flags = {QPL_FLAG_DYNAMIC_HUFFMAN, QPL_FLAG_START_NEW_BLOCK};
+
+    for (const auto flags : mode_flags) {
+        job_ptr->op            = qpl_op_compress;
+        job_ptr->level         = qpl_default_level;
+        job_ptr->huffman_table = nullptr;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->next_out_ptr  = compressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+        for (uint32_t job = 0u; job < jobs_count; job++) {
+            job_ptr->flags        = flags | QPL_FLAG_VERIFY_STREAMING;
+            job_ptr->flags       |= (0u == job) ? QPL_FLAG_FIRST : 0u;
+            job_ptr->flags       |= (jobs_count - 1u == job) ? QPL_FLAG_LAST : 0u;
+            job_ptr->available_in = job_size;
+
+            ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr)) << "flags " << flags << ", job " << job;
+        }
+
+        const uint32_t compressed_size = job_ptr->total_out;
+
+        job_ptr->op            = qpl_op_decompress;
+        job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_LAST;
+        job_ptr->next_in_ptr   = compressed.data();
+        job_ptr->available_in  = compressed_size;
+        job_ptr->next_out_ptr  = decompressed.data();
+        job_ptr->available_out = static_cast<uint32_t>(decompressed.size());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr)) << "flags " << flags;
+        ASSERT_EQ(source_size, job_ptr->total_out) << "flags " << flags;
+        ASSERT_TRUE(CompareVectors(decompressed, source)) << "flags " << flags;
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(streaming_verification, corrupted_stream, JobFixture) {
+    // The running CRC of the hardware path is kept in the accelerator state, not in qpl_job.crc
+    if (qpl_path_hardware == GetExecutionPath()) {
+        GTEST_SKIP() << "The test corrupts the running CRC of the software path";
+    }
+
+    constexpr uint32_t source_size = 512u * 1024u;
+
+    qpl::test::random random_symbol(0u, 15u, GetSeed());
+
+    std::vector<uint8_t> source(source_size);
+    std::vector<uint8_t> compressed(source_size * 2u);
+
+    std::generate(source.begin(), source.end(), [&random_symbol]() {
+        return static_cast<uint8_t>(random_symbol);
+    });
+
+    job_ptr->op            = qpl_op_compress;
+    job_ptr->level         = qpl_default_level;
+    job_ptr->flags         = QPL_FLAG_FIRST | QPL_FLAG_VERIFY_STREAMING | QPL_FLAG_DYNAMIC_HUFFMAN;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = source_size / 2u;
+    job_ptr->next_out_ptr  = compressed.data();
+    job_ptr->available_out = static_cast<uint32_t>(compressed.size());
+
+    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+
+    // The blocks are verified as they are written, the CRC is still checked once the job is done
+    job_ptr->flags        = QPL_FLAG_LAST | QPL_FLAG_VERIFY_STREAMING | QPL_FLAG_DYNAMIC_HUFFMAN;
+    job_ptr->available_in = source_size - source_size / 2u;
+    job_ptr->crc         ^= 1u;
+
+    EXPECT_EQ(QPL_STS_VERIFY_ERR, qpl_execute_job(job_ptr));
+}
+
 }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include "gtest/gtest.h"
@@ -402,4 +403,147 @@ namespace qpl::test
         EXPECT_TRUE(compare_checksum_fields(job_ptr, reference_job_ptr));
         EXPECT_TRUE(CompareVectors(destination, reference_destination, job_ptr->total_out));
     }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(scan, scan_range_streaming_with_decompress, ScanTest)
+    {
+        // Streaming scan is supported by the software path for packed arrays only
+        if (GetExecutionPath() != qpl_path_software || current_test_case.parser == qpl_p_parquet_rle) {
+            return;
+        }
+
+        // Pieces are small enough to split every chunk of the stream
+        constexpr uint32_t source_piece_size      = 61u;
+        constexpr uint32_t destination_piece_size = 40u;
+        constexpr uint32_t max_jobs_count         = 100000u;
+
+        job_ptr->op = qpl_op_scan_range;
+        reference_job_ptr->op = qpl_op_scan_range;
+        std::vector<uint8_t> compressed_source;
+        ASSERT_NO_THROW(compressed_source = GetCompressedSource());
+
+        auto reference_status = ref_compare(reference_job_ptr);
+        ASSERT_EQ(QPL_STS_OK, reference_status);
+
+        // Single job over the whole stream gives the expected aggregates
+        const uint32_t flags  = job_ptr->flags | QPL_FLAG_DECOMPRESS_ENABLE;
+        job_ptr->available_in = static_cast<uint32_t>(compressed_source.size());
+        job_ptr->next_in_ptr  = compressed_source.data();
+        job_ptr->flags        = flags;
+
+        ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+
+        const uint32_t expected_total_out   = job_ptr->total_out;
+        const uint32_t expected_first_index = job_ptr->first_index_min_value;
+        const uint32_t expected_last_index  = job_ptr->last_index_max_value;
+        const uint32_t expected_sum         = job_ptr->sum_value;
+
+        std::vector<uint8_t> streamed_destination(destination.size(), 0u);
+
+        uint8_t *const source_end      = compressed_source.data() + compressed_source.size();
+        uint8_t *const destination_end = streamed_destination.data() + streamed_destination.size();
+
+        job_ptr->next_in_ptr  = compressed_source.data();
+        job_ptr->available_in = 0u;
+        job_ptr->next_out_ptr = streamed_destination.data();
+
+        qpl_status status   = QPL_STS_OK;
+        bool       is_first = true;
+        bool       is_last  = false;
+
+        for (uint32_t jobs_count = 0u; !(is_last && QPL_STS_OK == status); jobs_count++) {
+            ASSERT_LT(jobs_count, max_jobs_count);
+
+            // Next source piece is given when the previous one is consumed
+            if (0u == job_ptr->available_in) {
+                job_ptr->available_in = std::min(source_piece_size,
+                                                 static_cast<uint32_t>(source_end - job_ptr->next_in_ptr));
+            }
+
+            is_last = (job_ptr->next_in_ptr + job_ptr->available_in == source_end);
+
+            job_ptr->available_out = std::min(destination_piece_size,
+                                              static_cast<uint32_t>(destination_end - job_ptr->next_out_ptr));
+            job_ptr->flags         = flags | QPL_FLAG_STREAMING_SCAN
+                                     | (is_first ? QPL_FLAG_FIRST : 0u)
+                                     | (is_last ? QPL_FLAG_LAST : 0u);
+            is_first = false;
+
+            status = run_job_api(job_ptr);
+            ASSERT_TRUE(QPL_STS_OK == status || QPL_STS_MORE_OUTPUT_NEEDED == status) << "status: " << status;
+        }
+
+        EXPECT_EQ(expected_total_out, job_ptr->total_out);
+        EXPECT_EQ(expected_first_index, job_ptr->first_index_min_value);
+        EXPECT_EQ(expected_last_index, job_ptr->last_index_max_value);
+        EXPECT_EQ(expected_sum, job_ptr->sum_value);
+        EXPECT_TRUE(CompareVectors(streamed_destination, reference_destination, expected_total_out));
+    }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_TC(scan, scan_range_ranges_output, ScanTest)
+    {
+        // Range encoded output is supported by the software path for little-endian indices only
+        if (GetExecutionPath() != qpl_path_software || 1u == current_test_case.destination_bit_width
+            || (current_test_case.flags & QPL_FLAG_OUT_BE)) {
+            return;
+        }
+
+        job_ptr->op = qpl_op_scan_range;
+        job_ptr->flags |= QPL_FLAG_OUT_RANGES;
+        reference_job_ptr->op = qpl_op_scan_range;
+
+        // Every match may start a run, so there may be twice as many values as in the list of indices
+        destination.resize(destination.size() * 2u);
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+        auto status = run_job_api(job_ptr);
+        auto reference_status = ref_compare(reference_job_ptr);
+
+        ASSERT_EQ(QPL_STS_OK, status);
+        ASSERT_EQ(QPL_STS_OK, reference_status);
+
+        // Reference list of indices is encoded to pairs of the first index and the length of every run
+        const uint32_t index_size   = current_test_case.destination_bit_width / 8u;
+        const uint64_t max_length   = (1ULL << current_test_case.destination_bit_width) - 1u;
+        const auto     read_index   = [&](const uint8_t *index_ptr) -> uint64_t {
+            uint64_t value = 0u;
+            std::copy(index_ptr, index_ptr + index_size, reinterpret_cast<uint8_t *>(&value));
+            return value;
+        };
+        const auto     write_index  = [&](std::vector<uint8_t> &ranges, uint64_t value) {
+            const auto *value_ptr = reinterpret_cast<const uint8_t *>(&value);
+            ranges.insert(ranges.end(), value_ptr, value_ptr + index_size);
+        };
+
+        std::vector<uint64_t> run_starts;
+        std::vector<uint64_t> run_lengths;
+
+        for (uint32_t offset = 0u; offset < reference_job_ptr->total_out; offset += index_size) {
+            const uint64_t index = read_index(reference_destination.data() + offset);
+
+            if (!run_starts.empty() && run_starts.back() + run_lengths.back() == index) {
+                run_lengths.back()++;
+            } else {
+                run_starts.push_back(index);
+                run_lengths.push_back(1u);
+            }
+        }
+
+        std::vector<uint8_t> expected_ranges;
+
+        for (size_t i = 0u; i < run_starts.size(); i++) {
+            for (uint64_t start = run_starts[i], length = run_lengths[i]; 0u != length;) {
+                const uint64_t pair_length = std::min(max_length, length);
+
+                write_index(expected_ranges, start);
+                write_index(expected_ranges, pair_length);
+                start += pair_length;
+                length -= pair_length;
+            }
+        }
+
+        ASSERT_EQ(expected_ranges.size(), job_ptr->total_out);
+        EXPECT_TRUE(std::equal(expected_ranges.begin(), expected_ranges.end(), destination.begin()));
+        EXPECT_TRUE(compare_checksum_fields(job_ptr, reference_job_ptr));
+    }
 }
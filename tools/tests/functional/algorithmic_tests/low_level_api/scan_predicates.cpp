@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "../../../common/operation_test.hpp"
+#include "ta_ll_common.hpp"
+
+namespace qpl::test {
+
+class ScanPredicatesTest : public JobFixture {
+protected:
+    static auto pack(const std::vector<uint32_t> &values, uint32_t bit_width, bool is_be) -> std::vector<uint8_t> {
+        std::vector<uint8_t> packed((values.size() * bit_width + 7u) / 8u, 0u);
+
+        for (size_t i = 0u; i < values.size(); i++) {
+            for (uint32_t bit = 0u; bit < bit_width; bit++) {
+                const uint64_t position  = i * bit_width + bit;
+                const uint32_t value_bit = (is_be) ? bit_width - 1u - bit : bit;
+                const uint32_t byte_bit  = (is_be) ? 7u - position % 8u : position % 8u;
+
+                packed[position / 8u] |= static_cast<uint8_t>(((values[i] >> value_bit) & 1u) << byte_bit);
+            }
+        }
+
+        return packed;
+    }
+
+    static auto compare(const qpl_scan_predicate &predicate, uint32_t value) -> bool {
+        switch (predicate.op) {
+            case qpl_op_scan_eq:
+                return value == predicate.param_low;
+            case qpl_op_scan_ne:
+                return value != predicate.param_low;
+            case qpl_op_scan_lt:
+                return value < predicate.param_low;
+            case qpl_op_scan_le:
+                return value <= predicate.param_low;
+            case qpl_op_scan_gt:
+                return value > predicate.param_low;
+            case qpl_op_scan_ge:
+                return value >= predicate.param_low;
+            case qpl_op_scan_range:
+                return predicate.param_low <= value && value <= predicate.param_high;
+            default:
+                return value < predicate.param_low || predicate.param_high < value;
+        }
+    }
+
+    static auto evaluate(const std::vector<qpl_scan_predicate> &program, uint32_t value) -> bool {
+        bool result = compare(program[0], value);
+
+        for (size_t i = 1u; i < program.size(); i++) {
+            const bool match = compare(program[i], value);
+
+            switch (program[i].combination) {
+                case qpl_predicate_and:
+                    result = result && match;
+                    break;
+                case qpl_predicate_or:
+                    result = result || match;
+                    break;
+                case qpl_predicate_and_not:
+                    result = result && !match;
+                    break;
+                default:
+                    result = result || !match;
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    auto GenerateValues(uint32_t bit_width, uint32_t count) -> std::vector<uint32_t> {
+        std::mt19937 generator(GetSeed() + bit_width);
+
+        const uint32_t mask = (32u == bit_width) ? UINT32_MAX : (1u << bit_width) - 1u;
+
+        std::vector<uint32_t> values(count);
+
+        for (auto &value : values) {
+            value = generator() & mask;
+        }
+
+        return values;
+    }
+
+    /**
+     * @brief Programs over the quarters of the elements domain
+     */
+    static auto GetPrograms(uint32_t bit_width) -> std::vector<std::vector<qpl_scan_predicate>> {
+        const uint32_t max_value = (32u == bit_width) ? UINT32_MAX : (1u << bit_width) - 1u;
+        const uint32_t quarter   = max_value / 4u;
+
+        return {
+                {{qpl_op_scan_gt, quarter, 0u, qpl_predicate_and}},
+                {{qpl_op_scan_range, quarter, 3u * quarter, qpl_predicate_and},
+                 {qpl_op_scan_eq, 2u * quarter, 0u, qpl_predicate_and_not},
+                 {qpl_op_scan_lt, quarter / 2u, 0u, qpl_predicate_or}},
+                {{qpl_op_scan_not_range, quarter, 2u * quarter, qpl_predicate_or_not},
+                 {qpl_op_scan_ne, 0u, 0u, qpl_predicate_and},
+                 {qpl_op_scan_ge, 3u * quarter, 0u, qpl_predicate_or_not},
+                 {qpl_op_scan_le, max_value, 0u, qpl_predicate_and}},
+        };
+    }
+
+    void SetScanJob(const std::vector<qpl_scan_predicate> &program, uint32_t bit_width, bool is_be,
+                    std::vector<uint8_t> &source, std::vector<uint8_t> &destination, qpl_out_format out_format) {
+        job_ptr->op                 = qpl_op_scan_eq;
+        job_ptr->flags              = QPL_FLAG_SCAN_PREDICATES;
+        job_ptr->parser             = (is_be) ? qpl_p_be_packed_array : qpl_p_le_packed_array;
+        job_ptr->src1_bit_width     = bit_width;
+        job_ptr->num_input_elements = element_count;
+        job_ptr->out_bit_width      = out_format;
+        job_ptr->next_in_ptr        = source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+        job_ptr->next_src2_ptr      = reinterpret_cast<uint8_t *>(const_cast<qpl_scan_predicate *>(program.data()));
+        job_ptr->available_src2     = static_cast<uint32_t>(program.size() * sizeof(qpl_scan_predicate));
+    }
+
+    // Several chunks of the internal buffers
+    static constexpr uint32_t element_count = 40001u;
+    static constexpr std::array<uint32_t, 7> bit_widths = {1u, 5u, 8u, 13u, 16u, 27u, 32u};
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_predicates, bit_vector, ScanPredicatesTest) {
+    // Programs of predicates are evaluated by the software path only
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto bit_width : bit_widths) {
+        for (bool is_be : {false, true}) {
+            const auto values = GenerateValues(bit_width, element_count);
+            auto       source = pack(values, bit_width, is_be);
+
+            for (const auto &program : GetPrograms(bit_width)) {
+                std::vector<uint8_t> destination((element_count + 7u) / 8u);
+
+                SetScanJob(program, bit_width, is_be, source, destination, qpl_ow_nom);
+
+                ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "bit width " << bit_width;
+
+                std::vector<uint8_t> reference((element_count + 7u) / 8u, 0u);
+                std::vector<uint32_t> indices;
+
+                for (uint32_t i = 0u; i < element_count; i++) {
+                    if (evaluate(program, values[i])) {
+                        reference[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+                        indices.push_back(i);
+                    }
+                }
+
+                ASSERT_EQ(reference.size(), job_ptr->total_out);
+                EXPECT_EQ(reference, destination) << "bit width " << bit_width << ", predicates " << program.size();
+                EXPECT_EQ(indices.size(), job_ptr->sum_value);
+                EXPECT_EQ(element_count % 8u, job_ptr->last_bit_offset);
+
+                if (!indices.empty()) {
+                    EXPECT_EQ(indices.front(), job_ptr->first_index_min_value);
+                    EXPECT_EQ(indices.back(), job_ptr->last_index_max_value);
+                }
+            }
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(scan_predicates, indices, ScanPredicatesTest) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto bit_width : bit_widths) {
+        const auto values = GenerateValues(bit_width, element_count);
+        auto       source = pack(values, bit_width, false);
+
+        for (const auto &program : GetPrograms(bit_width)) {
+            std::vector<uint8_t> destination(element_count * sizeof(uint32_t));
+
+            SetScanJob(program, bit_width, false, source, destination, qpl_ow_32);
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "bit width " << bit_width;
+
+            std::vector<uint32_t> indices;
+
+            for (uint32_t i = 0u; i < element_count; i++) {
+                if (evaluate(program, values[i])) {
+                    indices.push_back(i);
+                }
+            }
+
+            ASSERT_EQ(indices.size() * sizeof(uint32_t), job_ptr->total_out);
+
+            auto *index_ptr = reinterpret_cast<uint32_t *>(destination.data());
+            EXPECT_TRUE(std::equal(indices.begin(), indices.end(), index_ptr)) << "bit width " << bit_width;
+        }
+    }
+}
+
+}
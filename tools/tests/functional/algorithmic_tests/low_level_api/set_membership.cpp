@@ -5,6 +5,10 @@
  ******************************************************************************/
 
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_set>
 #include <vector>
 #include <string>
 #include "gtest/gtest.h"
@@ -15,6 +19,7 @@
 #include "qpl_api_ref.h"
 #include "ta_ll_common.hpp"
 #include "check_result.hpp"
+#include "random_generator.h"
 
 namespace qpl::test
 {
@@ -149,3 +154,196 @@ namespace qpl::test
         test_case_counter++;
     }
 }
+
+namespace qpl::test
+{
+    struct set_list_case_t
+    {
+        uint32_t bit_width;
+        uint32_t low_bits_to_ignore;
+        uint32_t high_bits_to_ignore;
+    };
+
+    // Domains of 15 bits and narrower are processed with the byte per key set, wider ones with the hash set
+    constexpr set_list_case_t set_list_cases[] = {{16u, 0u, 0u},
+                                                  {16u, 1u, 0u},
+                                                  {32u, 0u, 0u},
+                                                  {32u, 4u, 8u},
+                                                  {32u, 0u, 20u}};
+
+    static inline auto get_element(const std::vector<uint8_t> &source, uint32_t index, uint32_t bit_width) -> uint32_t
+    {
+        uint32_t value = 0u;
+        std::memcpy(&value, source.data() + index * (bit_width / 8u), bit_width / 8u);
+
+        return value;
+    }
+
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(set_membership_list, wide_and_narrow_domains)
+    {
+        constexpr uint32_t elements_count = 10000u;
+
+        auto     execution_path = util::TestEnvironment::GetInstance().GetExecutionPath();
+        auto     seed           = util::TestEnvironment::GetInstance().GetSeed();
+        uint32_t job_size       = 0u;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(execution_path, &job_size));
+
+        auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+        auto job_ptr    = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(execution_path, job_ptr));
+
+        random random_value(0u, UINT32_MAX, seed);
+        random random_choice(0u, 1u, seed);
+
+        for (const auto &test_case : set_list_cases)
+        {
+            const uint32_t set_bit_width = test_case.bit_width - test_case.low_bits_to_ignore - test_case.high_bits_to_ignore;
+            const uint32_t key_mask      = (set_bit_width == 32u) ? UINT32_MAX : (1u << set_bit_width) - 1u;
+
+            for (uint32_t keys_count : {1u, 1000u, 100000u})
+            {
+                std::vector<uint32_t> keys(keys_count);
+                std::unordered_set<uint32_t> reference_set;
+
+                // Every fourth key is out of the domain and never matches
+                for (uint32_t i = 0u; i < keys_count; i++)
+                {
+                    keys[i] = static_cast<uint32_t>(random_value);
+                    keys[i] = (i % 4u == 3u) ? keys[i] : keys[i] & key_mask;
+
+                    if (keys[i] <= key_mask)
+                    {
+                        reference_set.insert(keys[i]);
+                    }
+                }
+
+                std::vector<uint8_t> source(elements_count * test_case.bit_width / 8u);
+
+                for (uint32_t i = 0u; i < elements_count; i++)
+                {
+                    uint32_t value = static_cast<uint32_t>(random_value);
+
+                    if (static_cast<uint32_t>(random_choice))
+                    {
+                        const uint32_t key = keys[static_cast<uint32_t>(random_value) % keys_count] & key_mask;
+                        value = (value & ~(key_mask << test_case.low_bits_to_ignore)) | (key << test_case.low_bits_to_ignore);
+                    }
+
+                    std::memcpy(source.data() + i * (test_case.bit_width / 8u), &value, test_case.bit_width / 8u);
+                }
+
+                std::vector<uint8_t> destination(elements_count / 8u);
+
+                job_ptr->op                 = qpl_op_set_membership;
+                job_ptr->parser             = qpl_p_le_packed_array;
+                job_ptr->next_in_ptr        = source.data();
+                job_ptr->available_in       = static_cast<uint32_t>(source.size());
+                job_ptr->next_out_ptr       = destination.data();
+                job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+                job_ptr->next_src2_ptr      = reinterpret_cast<uint8_t *>(keys.data());
+                job_ptr->available_src2     = static_cast<uint32_t>(keys.size() * sizeof(uint32_t));
+                job_ptr->src1_bit_width     = test_case.bit_width;
+                job_ptr->src2_bit_width     = 32u;
+                job_ptr->num_input_elements = elements_count;
+                job_ptr->out_bit_width      = qpl_ow_nom;
+                job_ptr->param_low          = test_case.low_bits_to_ignore;
+                job_ptr->param_high         = test_case.high_bits_to_ignore;
+                job_ptr->flags              = QPL_FLAG_SET_LIST;
+
+                auto status = run_job_api(job_ptr);
+
+                if (execution_path == qpl_path_hardware)
+                {
+                    ASSERT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, status);
+                    continue;
+                }
+
+                ASSERT_EQ(QPL_STS_OK, status);
+                ASSERT_EQ(destination.size(), job_ptr->total_out);
+
+                for (uint32_t i = 0u; i < elements_count; i++)
+                {
+                    const uint32_t key      = (get_element(source, i, test_case.bit_width) >> test_case.low_bits_to_ignore) & key_mask;
+                    const uint32_t expected = reference_set.count(key) ? 1u : 0u;
+
+                    ASSERT_EQ(expected, (destination[i / 8u] >> (i % 8u)) & 1u)
+                        << "bit width: " << test_case.bit_width << ", keys: " << keys_count << ", index: " << i;
+                }
+
+                std::vector<uint32_t> sorted_keys(reference_set.begin(), reference_set.end());
+                std::sort(sorted_keys.begin(), sorted_keys.end());
+
+                EXPECT_EQ(sorted_keys.size(), job_ptr->sum_value);
+                EXPECT_EQ(sorted_keys.front(), job_ptr->first_index_min_value);
+                EXPECT_EQ(sorted_keys.back(), job_ptr->last_index_max_value);
+            }
+        }
+
+        ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+    }
+}
+
+namespace qpl::test
+{
+    // The list mode is software only, the job is routed by the path set at its initialization
+    QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(set_membership_list, submit_on_hardware_and_auto_paths)
+    {
+        const std::vector<uint32_t> keys   = {7u, 100000u, 0x80000000u};
+        const std::vector<uint32_t> source = {7u, 8u, 100000u, 0x80000000u, 0u, 100001u, 7u, 0xFFFFFFFFu};
+
+        constexpr uint8_t expected_mask = 0b01001101u;
+
+        for (auto execution_path : {qpl_path_hardware, qpl_path_auto})
+        {
+            uint32_t job_size = 0u;
+            ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(execution_path, &job_size));
+
+            auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+            auto job_ptr    = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+            // The hardware path job can't be initialized without accelerators
+            if (QPL_STS_OK != qpl_init_job(execution_path, job_ptr))
+            {
+                qpl_fini_job(job_ptr);
+                continue;
+            }
+
+            uint8_t destination = 0u;
+
+            job_ptr->op                 = qpl_op_set_membership;
+            job_ptr->parser             = qpl_p_le_packed_array;
+            job_ptr->next_in_ptr        = reinterpret_cast<uint8_t *>(const_cast<uint32_t *>(source.data()));
+            job_ptr->available_in       = static_cast<uint32_t>(source.size() * sizeof(uint32_t));
+            job_ptr->next_out_ptr       = &destination;
+            job_ptr->available_out      = 1u;
+            job_ptr->next_src2_ptr      = reinterpret_cast<uint8_t *>(const_cast<uint32_t *>(keys.data()));
+            job_ptr->available_src2     = static_cast<uint32_t>(keys.size() * sizeof(uint32_t));
+            job_ptr->src1_bit_width     = 32u;
+            job_ptr->src2_bit_width     = 32u;
+            job_ptr->num_input_elements = static_cast<uint32_t>(source.size());
+            job_ptr->out_bit_width      = qpl_ow_nom;
+            job_ptr->param_low          = 0u;
+            job_ptr->param_high         = 0u;
+            job_ptr->flags              = QPL_FLAG_SET_LIST;
+
+            auto status = qpl_submit_job(job_ptr);
+
+            if (qpl_path_hardware == execution_path)
+            {
+                EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, status);
+            }
+            else
+            {
+                ASSERT_EQ(QPL_STS_OK, status);
+                ASSERT_EQ(QPL_STS_OK, qpl_wait_job(job_ptr));
+
+                EXPECT_EQ(1u, job_ptr->total_out);
+                EXPECT_EQ(expected_mask, destination);
+            }
+
+            ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+        }
+    }
+}
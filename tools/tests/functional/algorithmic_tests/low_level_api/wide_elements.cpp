@@ -0,0 +1,272 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "../../../common/operation_test.hpp"
+#include "ta_ll_common.hpp"
+
+namespace qpl::test {
+
+class WideElementsTest : public JobFixture {
+protected:
+    static auto pack(const std::vector<uint64_t> &values, uint32_t bit_width, bool is_be) -> std::vector<uint8_t> {
+        std::vector<uint8_t> packed((values.size() * bit_width + 7u) / 8u, 0u);
+
+        for (size_t i = 0u; i < values.size(); i++) {
+            for (uint32_t bit = 0u; bit < bit_width; bit++) {
+                const uint64_t position  = i * bit_width + bit;
+                const uint32_t value_bit = (is_be) ? bit_width - 1u - bit : bit;
+                const uint32_t byte_bit  = (is_be) ? 7u - position % 8u : position % 8u;
+
+                packed[position / 8u] |= static_cast<uint8_t>(((values[i] >> value_bit) & 1u) << byte_bit);
+            }
+        }
+
+        return packed;
+    }
+
+    static auto unpack(const uint8_t *packed_ptr, size_t count, uint32_t bit_width, bool is_be) -> std::vector<uint64_t> {
+        std::vector<uint64_t> values(count, 0u);
+
+        for (size_t i = 0u; i < count; i++) {
+            for (uint32_t bit = 0u; bit < bit_width; bit++) {
+                const uint64_t position  = i * bit_width + bit;
+                const uint32_t value_bit = (is_be) ? bit_width - 1u - bit : bit;
+                const uint32_t byte_bit  = (is_be) ? 7u - position % 8u : position % 8u;
+
+                values[i] |= static_cast<uint64_t>((packed_ptr[position / 8u] >> byte_bit) & 1u) << value_bit;
+            }
+        }
+
+        return values;
+    }
+
+    auto GenerateValues(uint32_t bit_width, uint32_t count) -> std::vector<uint64_t> {
+        std::mt19937_64 generator(GetSeed() + bit_width);
+
+        const uint64_t mask = (64u == bit_width) ? UINT64_MAX : (1ULL << bit_width) - 1u;
+
+        std::vector<uint64_t> values(count);
+
+        for (auto &value : values) {
+            value = generator() & mask;
+        }
+
+        return values;
+    }
+
+    auto GenerateMask(uint32_t count) -> std::vector<uint8_t> {
+        std::mt19937 generator(GetSeed());
+
+        std::vector<uint8_t> mask((count + 7u) / 8u);
+
+        for (auto &byte : mask) {
+            byte = static_cast<uint8_t>(generator());
+        }
+
+        return mask;
+    }
+
+    static auto is_bit_set(const std::vector<uint8_t> &mask, uint32_t index, bool is_be) -> bool {
+        return (mask[index / 8u] >> ((is_be) ? 7u - index % 8u : index % 8u)) & 1u;
+    }
+
+    void SetAnalyticsJob(qpl_operation operation, uint32_t bit_width, bool is_be,
+                         std::vector<uint8_t> &source, std::vector<uint8_t> &destination, uint32_t count) {
+        job_ptr->op                 = operation;
+        job_ptr->flags              = (is_be) ? QPL_FLAG_OUT_BE : 0u;
+        job_ptr->parser             = (is_be) ? qpl_p_be_packed_array : qpl_p_le_packed_array;
+        job_ptr->src1_bit_width     = bit_width;
+        job_ptr->num_input_elements = count;
+        job_ptr->out_bit_width      = qpl_ow_nom;
+        job_ptr->next_in_ptr        = source.data();
+        job_ptr->available_in       = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr       = destination.data();
+        job_ptr->available_out      = static_cast<uint32_t>(destination.size());
+    }
+
+    void CheckAggregates(const std::vector<uint64_t> &values) {
+        uint64_t sum = 0u;
+
+        for (auto value : values) {
+            sum += value;
+        }
+
+        const uint64_t min_value = *std::min_element(values.begin(), values.end());
+        const uint64_t max_value = *std::max_element(values.begin(), values.end());
+
+        EXPECT_EQ(min_value, job_ptr->first_index_min_value_64);
+        EXPECT_EQ(max_value, job_ptr->last_index_max_value_64);
+        EXPECT_EQ(sum, job_ptr->sum_value_64);
+        EXPECT_EQ(static_cast<uint32_t>(sum), job_ptr->sum_value);
+    }
+
+    static constexpr uint32_t element_count = 1001u;
+    static constexpr std::array<uint32_t, 5> bit_widths = {33u, 40u, 57u, 63u, 64u};
+};
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, scan, WideElementsTest) {
+    // Elements wider than 32 bits are supported by the software path only
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto bit_width : bit_widths) {
+        for (bool is_be : {false, true}) {
+            const auto values = GenerateValues(bit_width, element_count);
+
+            auto sorted_values = values;
+            std::sort(sorted_values.begin(), sorted_values.end());
+
+            auto source = pack(values, bit_width, is_be);
+            std::vector<uint8_t> destination((element_count + 7u) / 8u);
+
+            SetAnalyticsJob(qpl_op_scan_range, bit_width, false, source, destination, element_count);
+            job_ptr->parser        = (is_be) ? qpl_p_be_packed_array : qpl_p_le_packed_array;
+            job_ptr->param_low_64  = sorted_values[element_count / 4u];
+            job_ptr->param_high_64 = sorted_values[element_count / 2u];
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "bit width " << bit_width;
+
+            std::vector<uint8_t> reference((element_count + 7u) / 8u, 0u);
+            std::vector<uint32_t> indices;
+
+            for (uint32_t i = 0u; i < element_count; i++) {
+                if (job_ptr->param_low_64 <= values[i] && values[i] <= job_ptr->param_high_64) {
+                    reference[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+                    indices.push_back(i);
+                }
+            }
+
+            ASSERT_EQ(reference.size(), job_ptr->total_out);
+            EXPECT_EQ(reference, destination) << "bit width " << bit_width;
+            EXPECT_EQ(indices.size(), job_ptr->sum_value_64);
+            EXPECT_EQ(indices.front(), job_ptr->first_index_min_value_64);
+            EXPECT_EQ(indices.back(), job_ptr->last_index_max_value_64);
+            EXPECT_EQ(element_count % 8u, job_ptr->last_bit_offset);
+
+            // Indices of matches are written with any output bit width of scan
+            std::vector<uint8_t> index_destination(element_count * sizeof(uint32_t));
+
+            SetAnalyticsJob(qpl_op_scan_range, bit_width, false, source, index_destination, element_count);
+            job_ptr->parser        = (is_be) ? qpl_p_be_packed_array : qpl_p_le_packed_array;
+            job_ptr->out_bit_width = qpl_ow_32;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr));
+            ASSERT_EQ(indices.size() * sizeof(uint32_t), job_ptr->total_out);
+
+            auto *index_ptr = reinterpret_cast<uint32_t *>(index_destination.data());
+            EXPECT_TRUE(std::equal(indices.begin(), indices.end(), index_ptr)) << "bit width " << bit_width;
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, extract, WideElementsTest) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto bit_width : bit_widths) {
+        for (bool is_be : {false, true}) {
+            const auto values = GenerateValues(bit_width, element_count);
+
+            auto source = pack(values, bit_width, is_be);
+            std::vector<uint8_t> destination(source.size());
+
+            SetAnalyticsJob(qpl_op_extract, bit_width, is_be, source, destination, element_count);
+            job_ptr->param_low  = 7u;
+            job_ptr->param_high = element_count + 100u;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "bit width " << bit_width;
+
+            const std::vector<uint64_t> reference(values.begin() + 7u, values.end());
+
+            ASSERT_EQ((reference.size() * bit_width + 7u) / 8u, job_ptr->total_out);
+            EXPECT_EQ(reference, unpack(destination.data(), reference.size(), bit_width, is_be))
+                                << "bit width " << bit_width << (is_be ? ", big-endian" : "");
+            CheckAggregates(reference);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, select, WideElementsTest) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto bit_width : bit_widths) {
+        for (bool is_be : {false, true}) {
+            const auto values = GenerateValues(bit_width, element_count);
+            auto       mask   = GenerateMask(element_count);
+
+            auto source = pack(values, bit_width, is_be);
+            std::vector<uint8_t> destination(source.size());
+
+            SetAnalyticsJob(qpl_op_select, bit_width, is_be, source, destination, element_count);
+            job_ptr->flags |= (is_be) ? QPL_FLAG_SRC2_BE : 0u;
+            job_ptr->next_src2_ptr  = mask.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(mask.size());
+            job_ptr->src2_bit_width = 1u;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "bit width " << bit_width;
+
+            std::vector<uint64_t> reference;
+
+            for (uint32_t i = 0u; i < element_count; i++) {
+                if (is_bit_set(mask, i, is_be)) {
+                    reference.push_back(values[i]);
+                }
+            }
+
+            ASSERT_EQ((reference.size() * bit_width + 7u) / 8u, job_ptr->total_out);
+            EXPECT_EQ(reference, unpack(destination.data(), reference.size(), bit_width, is_be))
+                                << "bit width " << bit_width << (is_be ? ", big-endian" : "");
+            CheckAggregates(reference);
+        }
+    }
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST_F(wide_elements, expand, WideElementsTest) {
+    if (qpl_path_hardware == GetExecutionPath()) {
+        return;
+    }
+
+    for (auto bit_width : bit_widths) {
+        for (bool is_be : {false, true}) {
+            const auto values = GenerateValues(bit_width, element_count);
+            auto       mask   = GenerateMask(element_count);
+
+            auto source = pack(values, bit_width, is_be);
+            std::vector<uint8_t> destination(source.size());
+
+            SetAnalyticsJob(qpl_op_expand, bit_width, is_be, source, destination, element_count);
+            job_ptr->flags |= (is_be) ? QPL_FLAG_SRC2_BE : 0u;
+            job_ptr->next_src2_ptr  = mask.data();
+            job_ptr->available_src2 = static_cast<uint32_t>(mask.size());
+            job_ptr->src2_bit_width = 1u;
+
+            ASSERT_EQ(QPL_STS_OK, run_job_api(job_ptr)) << "bit width " << bit_width;
+
+            std::vector<uint64_t> reference;
+            uint32_t              source_index = 0u;
+
+            for (uint32_t i = 0u; i < element_count; i++) {
+                reference.push_back(is_bit_set(mask, i, is_be) ? values[source_index++] : 0u);
+            }
+
+            ASSERT_EQ((reference.size() * bit_width + 7u) / 8u, job_ptr->total_out);
+            EXPECT_EQ(reference, unpack(destination.data(), reference.size(), bit_width, is_be))
+                                << "bit width " << bit_width << (is_be ? ", big-endian" : "");
+            CheckAggregates(reference);
+        }
+    }
+}
+
+}
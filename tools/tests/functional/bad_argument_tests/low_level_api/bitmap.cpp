@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Bad Args tests for bit vector operations
+ */
+
+#include "gtest/gtest.h"
+#include "qpl/qpl.h"
+#include "../../../common/operation_test.hpp"
+#include "tb_ll_common.hpp"
+
+#include <array>
+
+namespace qpl::test {
+
+constexpr uint32_t BITMAP_BYTE_SIZE = 16u;
+constexpr uint32_t BITMAP_BIT_COUNT = BITMAP_BYTE_SIZE * 8u - 3u;
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(bitmap, errors) {
+    std::array<uint8_t, BITMAP_BYTE_SIZE> source1{};
+    std::array<uint8_t, BITMAP_BYTE_SIZE> source2{};
+    std::array<uint8_t, BITMAP_BYTE_SIZE> destination{};
+
+    job_ptr->op                 = qpl_op_bitmap_and;
+    job_ptr->flags              = 0u;
+    job_ptr->num_input_elements = BITMAP_BIT_COUNT;
+    job_ptr->next_in_ptr        = source1.data();
+    job_ptr->available_in       = BITMAP_BYTE_SIZE;
+    job_ptr->next_src2_ptr      = source2.data();
+    job_ptr->available_src2     = BITMAP_BYTE_SIZE;
+    job_ptr->next_out_ptr       = destination.data();
+    job_ptr->available_out      = BITMAP_BYTE_SIZE;
+
+    if (qpl::test::util::TestEnvironment::GetInstance().GetExecutionPath() == qpl_path_hardware) {
+        EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: hardware path";
+
+        return;
+    }
+
+    job_ptr->num_input_elements = 0u;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_SIZE_ERR) << "Fail on: no bits";
+
+    job_ptr->num_input_elements = BITMAP_BIT_COUNT + 8u;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_SRC_IS_SHORT_ERR) << "Fail on: short source";
+
+    job_ptr->num_input_elements = BITMAP_BIT_COUNT;
+    job_ptr->available_src2     = BITMAP_BYTE_SIZE - 1u;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_SRC_IS_SHORT_ERR) << "Fail on: short second source";
+
+    job_ptr->available_src2 = BITMAP_BYTE_SIZE;
+    job_ptr->next_src2_ptr  = nullptr;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NULL_PTR_ERR) << "Fail on: null second source";
+
+    job_ptr->next_src2_ptr = source2.data();
+    job_ptr->available_out = BITMAP_BYTE_SIZE - 1u;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_DST_IS_SHORT_ERR) << "Fail on: short destination";
+
+    job_ptr->available_out = BITMAP_BYTE_SIZE;
+    job_ptr->next_out_ptr  = source2.data();
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_BUFFER_OVERLAP_ERR) << "Fail on: destination overlaps second source";
+
+    // The second source and the destination are not used by count
+    job_ptr->op            = qpl_op_bitmap_count;
+    job_ptr->next_src2_ptr = nullptr;
+    job_ptr->next_out_ptr  = nullptr;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_OK) << "Fail on: count without destination";
+}
+
+}
@@ -156,10 +156,23 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(deflate, incorrect_compression_level) {
 
     ASSERT_EQ(run_job_api(job_ptr), QPL_STD_UNSUPPORTED_COMPRESSION_LEVEL);
 
+    job_ptr->level = qpl_level_5;
+
+    ASSERT_EQ(run_job_api(job_ptr), QPL_STD_UNSUPPORTED_COMPRESSION_LEVEL);
+
+    // Zero-initialized level is not the level 0
+    job_ptr->level = (qpl_compression_levels) 0;
+
+    ASSERT_EQ(run_job_api(job_ptr), QPL_STD_UNSUPPORTED_COMPRESSION_LEVEL);
+
     if (qpl::test::util::TestEnvironment::GetInstance().GetExecutionPath() == qpl_path_hardware) {
         job_ptr->level = qpl_high_level;
 
         ASSERT_EQ(run_job_api(job_ptr), QPL_STD_UNSUPPORTED_COMPRESSION_LEVEL);
+
+        job_ptr->level = qpl_level_9;
+
+        ASSERT_EQ(run_job_api(job_ptr), QPL_STD_UNSUPPORTED_COMPRESSION_LEVEL);
     }
 }
 
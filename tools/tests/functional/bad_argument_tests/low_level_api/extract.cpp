@@ -92,4 +92,28 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(extract, drop_initial_bytes) {
                                                                                    | QPL_FLAG_DECOMPRESS_ENABLE);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(extract, wide_elements_errors) {
+    std::array<uint8_t, SOURCE_ARRAY_SIZE>      source{};
+    std::array<uint8_t, DESTINATION_ARRAY_SIZE> destination{};
+
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 40u, 16u, qpl_p_le_packed_array);
+    set_output_stream(job_ptr, destination.data(), DESTINATION_ARRAY_SIZE, qpl_ow_nom);
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, OPERATION_FLAGS, qpl_op_extract);
+
+    // Elements of 33-64 bits are processed on the software path only
+    if (qpl_path_hardware == TestEnviroment::GetInstance().GetExecutionPath()) {
+        EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: hardware path";
+        return;
+    }
+
+    // Compressed source is limited to 32-bit elements
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, OPERATION_FLAGS | QPL_FLAG_DECOMPRESS_ENABLE, qpl_op_extract);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: compressed source";
+
+    // Elements of 33-64 bits are written as is
+    set_output_stream(job_ptr, destination.data(), DESTINATION_ARRAY_SIZE, qpl_ow_32);
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, OPERATION_FLAGS, qpl_op_extract);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_OUT_FORMAT_ERR) << "Fail on: extended output";
+}
+
 }
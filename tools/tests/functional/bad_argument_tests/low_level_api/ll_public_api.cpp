@@ -41,6 +41,67 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_init, test) {
     EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_get_job_size_for_class, test) {
+    qpl_status status;
+    uint32_t   size;
+
+    status = qpl_get_job_size_for_class(PATH, qpl_op_class_analytics, nullptr);
+
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr";
+
+    status = qpl_get_job_size_for_class(INCORRECT_PATH, qpl_op_class_analytics, &size);
+
+    EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
+
+    status = qpl_get_job_size_for_class(PATH, 0u, &size);
+
+    EXPECT_EQ(status, QPL_STS_OPERATION_ERR) << "Failed on empty operation class";
+
+    status = qpl_get_job_size_for_class(PATH, qpl_op_class_all + 1u, &size);
+
+    EXPECT_EQ(status, QPL_STS_OPERATION_ERR) << "Failed on incorrect operation class";
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_init_job_for_class, test) {
+    qpl_status status;
+    uint32_t   size;
+
+    status = qpl_get_job_size_for_class(PATH, qpl_op_class_analytics, &size);
+    ASSERT_EQ(status, QPL_STS_OK);
+
+    std::unique_ptr<uint8_t[]> job_buffer(new uint8_t[size]);
+    auto *slim_job_ptr = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    status = qpl_init_job_for_class(PATH, qpl_op_class_analytics, nullptr);
+
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr";
+
+    status = qpl_init_job_for_class(INCORRECT_PATH, qpl_op_class_analytics, slim_job_ptr);
+
+    EXPECT_EQ(status, QPL_STS_PATH_ERR) << "Failed on incorrect path check";
+
+    status = qpl_init_job_for_class(PATH, 0u, slim_job_ptr);
+
+    EXPECT_EQ(status, QPL_STS_OPERATION_ERR) << "Failed on empty operation class";
+
+    status = qpl_init_job_for_class(PATH, qpl_op_class_analytics, slim_job_ptr);
+    ASSERT_EQ(status, QPL_STS_OK);
+
+    // Operations of other classes must be rejected by the job
+    for (auto operation : {qpl_op_compress, qpl_op_decompress, qpl_op_memcpy, qpl_op_crc64}) {
+        slim_job_ptr->op          = operation;
+        slim_job_ptr->next_in_ptr = job_buffer.get();
+
+        status = qpl_submit_job(slim_job_ptr);
+        EXPECT_EQ(status, QPL_STS_BAD_JOB_STRUCT_ERR) << "Failed on operation " << operation;
+
+        status = qpl_execute_job(slim_job_ptr);
+        EXPECT_EQ(status, QPL_STS_BAD_JOB_STRUCT_ERR) << "Failed on operation " << operation;
+    }
+
+    qpl_fini_job(slim_job_ptr);
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_submit, test) {
     qpl_status status;
     uint8_t    *stored_ptr;
@@ -128,6 +189,36 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_check, test) {
     EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr";
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_batch, test) {
+    qpl_status status;
+    qpl_job    *jobs[2]    = {job_ptr, nullptr};
+    qpl_status statuses[2] = {QPL_STS_BEING_PROCESSED, QPL_STS_BEING_PROCESSED};
+
+    job_ptr->op          = qpl_op_memcpy;
+    job_ptr->next_in_ptr = (uint8_t *) job_ptr;
+
+    status = qpl_submit_batch(nullptr, 1u);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on jobs_ptr == nullptr";
+
+    status = qpl_submit_batch(jobs, 0u);
+    EXPECT_EQ(status, QPL_STS_SIZE_ERR) << "Failed on empty batch";
+
+    status = qpl_submit_batch(jobs, 2u);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on job_ptr == nullptr in the batch";
+
+    status = qpl_check_batch(nullptr, 1u, statuses);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on jobs_ptr == nullptr";
+
+    status = qpl_check_batch(jobs, 1u, nullptr);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on statuses_ptr == nullptr";
+
+    status = qpl_wait_batch(nullptr, 1u, statuses);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on jobs_ptr == nullptr";
+
+    status = qpl_wait_batch(jobs, 1u, nullptr);
+    EXPECT_EQ(status, QPL_STS_NULL_PTR_ERR) << "Failed on statuses_ptr == nullptr";
+}
+
 QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(qpl_finalize, test) {
     qpl_status status;
     qpl_job    job;
@@ -101,4 +101,104 @@ QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(scan, drop_initial_bytes) {
                                                                                    | QPL_FLAG_DECOMPRESS_ENABLE);
 }
 
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(scan, streaming_unsupported_modes) {
+    std::array<uint8_t, SOURCE_ARRAY_SIZE>      source{};
+    std::array<uint8_t, DESTINATION_ARRAY_SIZE> destination{};
+
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, INPUT_BIT_WIDTH, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+    set_output_stream(job_ptr, destination.data(), DESTINATION_ARRAY_SIZE, OUTPUT_BIT_WIDTH);
+
+    // Source must be compressed
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, QPL_FLAG_STREAMING_SCAN | QPL_FLAG_FIRST, qpl_op_scan_eq);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: uncompressed source";
+
+    // Parquet RLE isn't supported
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, INPUT_BIT_WIDTH, ELEMENTS_TO_PROCESS, qpl_p_parquet_rle);
+    set_operation_properties(job_ptr,
+                             DROP_INITIAL_BYTES,
+                             QPL_FLAG_STREAMING_SCAN | QPL_FLAG_FIRST | QPL_FLAG_DECOMPRESS_ENABLE,
+                             qpl_op_scan_eq);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: parquet rle source";
+
+    // Only the next jobs of the stream may have no source, the hardware path doesn't support streaming at all
+    set_input_stream(job_ptr, source.data(), 0u, INPUT_BIT_WIDTH, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+
+    if (qpl::test::util::TestEnvironment::GetInstance().GetExecutionPath() == qpl_path_hardware) {
+        EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: hardware path";
+    } else {
+        EXPECT_EQ(run_job_api(job_ptr), QPL_STS_SIZE_ERR) << "Fail on: empty source of the first job";
+    }
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(scan, ranges_unsupported_modes) {
+    std::array<uint8_t, SOURCE_ARRAY_SIZE>      source{};
+    std::array<uint8_t, DESTINATION_ARRAY_SIZE> destination{};
+
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, INPUT_BIT_WIDTH, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+
+    // Ranges are written as indices
+    set_output_stream(job_ptr, destination.data(), DESTINATION_ARRAY_SIZE, qpl_ow_nom);
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, QPL_FLAG_OUT_RANGES, qpl_op_scan_eq);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: nominal output";
+
+    // Big-endian indices aren't supported
+    set_output_stream(job_ptr, destination.data(), DESTINATION_ARRAY_SIZE, qpl_ow_32);
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, QPL_FLAG_OUT_RANGES | QPL_FLAG_OUT_BE, qpl_op_scan_eq);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: big-endian output";
+}
+
+QPL_LOW_LEVEL_API_BAD_ARGUMENT_TEST(scan, predicates_errors) {
+    std::array<uint8_t, SOURCE_ARRAY_SIZE>      source{};
+    std::array<uint8_t, DESTINATION_ARRAY_SIZE> destination{};
+
+    std::array<qpl_scan_predicate, 17u> predicates{};
+
+    for (auto &predicate : predicates) {
+        predicate = {qpl_op_scan_ge, 1u, 0u, qpl_predicate_and};
+    }
+
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, INPUT_BIT_WIDTH, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+    set_output_stream(job_ptr, destination.data(), DESTINATION_ARRAY_SIZE, OUTPUT_BIT_WIDTH);
+    set_operation_properties(job_ptr, DROP_INITIAL_BYTES, QPL_FLAG_SCAN_PREDICATES, qpl_op_scan_eq);
+
+    job_ptr->next_src2_ptr  = reinterpret_cast<uint8_t *>(predicates.data());
+    job_ptr->available_src2 = 2u * sizeof(qpl_scan_predicate);
+
+    if (qpl::test::util::TestEnvironment::GetInstance().GetExecutionPath() == qpl_path_hardware) {
+        EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: hardware path";
+
+        return;
+    }
+
+    job_ptr->next_src2_ptr = nullptr;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NULL_PTR_ERR) << "Fail on: null program";
+
+    job_ptr->next_src2_ptr  = reinterpret_cast<uint8_t *>(predicates.data());
+    job_ptr->available_src2 = 0u;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_SIZE_ERR) << "Fail on: empty program";
+
+    job_ptr->available_src2 = sizeof(qpl_scan_predicate) + 1u;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_SIZE_ERR) << "Fail on: partial predicate";
+
+    job_ptr->available_src2 = static_cast<uint32_t>(predicates.size() * sizeof(qpl_scan_predicate));
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_SIZE_ERR) << "Fail on: too many predicates";
+
+    job_ptr->available_src2 = 2u * sizeof(qpl_scan_predicate);
+    predicates[1].op        = qpl_op_extract;
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_OPERATION_ERR) << "Fail on: predicate is not a scan";
+
+    predicates[1].op          = qpl_op_scan_lt;
+    predicates[1].combination = static_cast<qpl_predicate_combination>(qpl_predicate_or_not + 1u);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_INVALID_PARAM_ERR) << "Fail on: unknown combination";
+
+    predicates[1].combination = qpl_predicate_and;
+    job_ptr->next_src2_ptr    = destination.data();
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_BUFFER_OVERLAP_ERR) << "Fail on: program overlaps destination";
+
+    // Elements of 33-64 bits aren't supported
+    job_ptr->next_src2_ptr = reinterpret_cast<uint8_t *>(predicates.data());
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 40u, 8u, INPUT_FORMAT);
+    EXPECT_EQ(run_job_api(job_ptr), QPL_STS_NOT_SUPPORTED_MODE_ERR) << "Fail on: wide elements";
+}
+
 }
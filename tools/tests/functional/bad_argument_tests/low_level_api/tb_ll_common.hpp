@@ -105,8 +105,19 @@ static inline void check_input_stream_validation(qpl_job *const job_ptr, qpl_ope
     set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 0u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
     EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:32]";
 
-    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 33u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
-    EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:32]";
+    // Scan, extract, select and expand accept 33-64-bit elements of uncompressed packed arrays
+    const bool is_wide_supported = !(flags & QPL_FLAG_DECOMPRESS_ENABLE)
+                                   && ((qpl_op_scan_eq <= operation && operation <= qpl_op_scan_not_range)
+                                       || qpl_op_extract == operation
+                                       || qpl_op_select == operation || qpl_op_expand == operation);
+
+    if (!is_wide_supported) {
+        set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 33u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+        EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:32]";
+    }
+
+    set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, 65u, ELEMENTS_TO_PROCESS, INPUT_FORMAT);
+    EXPECT_EQ(qpl::test::run_job_api(job_ptr), QPL_STS_BIT_WIDTH_ERR) << "Fail on: bit width !€ [1:64]";
 
     // Input format check
     set_input_stream(job_ptr, source.data(), SOURCE_ARRAY_SIZE, INPUT_BIT_WIDTH, ELEMENTS_TO_PROCESS, (qpl_parser)(LAST_INPUT_PARSER + 1u));
@@ -0,0 +1,362 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_api.h"
+#include "dispatcher/dispatcher.hpp"
+
+/*
+ * The dispatcher selects the AVX2 tier only on hosts without AVX-512, so kernels of this tier
+ * are called directly from their tables here and compared with the px kernels
+ */
+namespace qpl::ml::dispatcher {
+extern unpack_table_t px_unpack_table;
+extern unpack_table_t avx2_unpack_table;
+
+extern pack_table_t px_pack_table;
+extern pack_table_t avx2_pack_table;
+
+extern pack_index_table_t px_pack_index_table;
+extern pack_index_table_t avx2_pack_index_table;
+
+extern scan_table_t px_scan_table;
+extern scan_table_t avx2_scan_table;
+
+extern aggregates_table_t px_aggregates_table;
+extern aggregates_table_t avx2_aggregates_table;
+
+extern select_table_t px_select_table;
+extern select_table_t avx2_select_table;
+
+extern expand_table_t px_expand_table;
+extern expand_table_t avx2_expand_table;
+
+extern extract_table_t px_extract_table;
+extern extract_table_t avx2_extract_table;
+
+extern extract_i_table_t px_extract_i_table;
+extern extract_i_table_t avx2_extract_i_table;
+} // namespace qpl::ml::dispatcher
+
+constexpr uint32_t TEST_MAX_LENGTH  = 300u;
+constexpr uint32_t TEST_BUFFER_SIZE = TEST_MAX_LENGTH * sizeof(uint32_t) + 64u;
+
+namespace qpl::test {
+using randomizer = qpl::test::random;
+
+namespace dispatcher = qpl::ml::dispatcher;
+
+static inline bool is_avx2_tier_supported() {
+    return dispatcher::arch_t::px_arch != dispatcher::detect_platform();
+}
+
+// Elements of power-of-two widths never cross the byte boundary, so the stream can't start in the middle of them
+static inline bool is_start_bit_valid(uint32_t bit_width, uint32_t start_bit) {
+    return (0u != (bit_width & (bit_width - 1u))) || (0u == start_bit % std::min(bit_width, 8u));
+}
+
+static std::vector<uint8_t> get_random_bytes(uint32_t size, uint32_t max_value, uint64_t seed) {
+    std::vector<uint8_t> result(size);
+    randomizer           random_value(0u, static_cast<double>(max_value), seed);
+
+    std::generate(result.begin(), result.end(), [&random_value]() { return static_cast<uint8_t>(random_value); });
+
+    return result;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, unpack) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t   seed   = util::TestEnvironment::GetInstance().GetSeed();
+    const auto source = get_random_bytes(TEST_BUFFER_SIZE, UINT8_MAX, seed);
+
+    // Little-endian unpack from 1 to 32 bits
+    for (uint32_t index = 0u; index < 32u; index++) {
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+            for (uint32_t start_bit = 0u; start_bit < 8u; start_bit++) {
+                if (!is_start_bit_valid(index + 1u, start_bit)) {
+                    continue;
+                }
+
+                std::vector<uint8_t> destination(TEST_BUFFER_SIZE, 0u);
+                std::vector<uint8_t> reference(TEST_BUFFER_SIZE, 0u);
+
+                dispatcher::avx2_unpack_table[index](source.data(), length, start_bit, destination.data());
+                dispatcher::px_unpack_table[index](source.data(), length, start_bit, reference.data());
+
+                ASSERT_TRUE(reference == destination) << "bit width: " << index + 1u << ", length: " << length
+                                                      << ", start bit: " << start_bit;
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, pack) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    // 8u to 1..7 bits
+    for (uint32_t bit_width = 1u; bit_width < 8u; bit_width++) {
+        const auto source = get_random_bytes(TEST_BUFFER_SIZE, (1u << bit_width) - 1u, seed);
+
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+            for (uint32_t start_bit = 0u; start_bit < 8u; start_bit++) {
+                if (!is_start_bit_valid(bit_width, start_bit)) {
+                    continue;
+                }
+
+                std::vector<uint8_t> destination(TEST_BUFFER_SIZE, 0u);
+                std::vector<uint8_t> reference(TEST_BUFFER_SIZE, 0u);
+
+                dispatcher::avx2_pack_table[bit_width - 1u](source.data(), length, destination.data(), start_bit);
+                dispatcher::px_pack_table[bit_width - 1u](source.data(), length, reference.data(), start_bit);
+
+                ASSERT_TRUE(reference == destination) << "bit width: " << bit_width << ", length: " << length
+                                                      << ", start bit: " << start_bit;
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, pack_index) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    // Sparse and dense results of the predicate
+    for (uint32_t density : {2u, 16u, 255u}) {
+        randomizer           random_value(0u, static_cast<double>(density), seed);
+        std::vector<uint8_t> source(TEST_MAX_LENGTH);
+
+        std::generate(source.begin(), source.end(), [&random_value]() {
+            return static_cast<uint8_t>(0u == static_cast<uint32_t>(random_value) ? 1u : 0u);
+        });
+
+        // Indexes with 8, 16 and 32-bit output
+        for (uint32_t index = 1u; index < 4u; index++) {
+            const uint32_t max_index = (1u == index) ? UINT8_MAX : (2u == index) ? UINT16_MAX : UINT32_MAX;
+
+            for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+                // Start indexes close to the maximum and short destinations stop the packing with an error
+                for (uint32_t start_index : {0u, 200u, max_index - 40u}) {
+                    for (uint32_t destination_length : {TEST_BUFFER_SIZE, 9u}) {
+                        std::vector<uint8_t> destination(TEST_BUFFER_SIZE, 0u);
+                        std::vector<uint8_t> reference(TEST_BUFFER_SIZE, 0u);
+                        uint8_t              *destination_ptr  = destination.data();
+                        uint8_t              *reference_ptr    = reference.data();
+                        uint32_t             destination_index = start_index;
+                        uint32_t             reference_index   = start_index;
+
+                        auto status = dispatcher::avx2_pack_index_table[index](source.data(), length,
+                                                                               &destination_ptr, destination_length,
+                                                                               &destination_index);
+                        auto reference_status = dispatcher::px_pack_index_table[index](source.data(), length,
+                                                                                       &reference_ptr,
+                                                                                       destination_length,
+                                                                                       &reference_index);
+
+                        ASSERT_EQ(reference_status, status) << "output index: " << index << ", length: " << length
+                                                            << ", start index: " << start_index;
+                        ASSERT_EQ(reference_index, destination_index);
+                        ASSERT_EQ(reference_ptr - reference.data(), destination_ptr - destination.data());
+                        ASSERT_TRUE(reference == destination) << "output index: " << index << ", length: " << length
+                                                              << ", density: " << density;
+                    }
+                }
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, scan) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t   seed   = util::TestEnvironment::GetInstance().GetSeed();
+    const auto source = get_random_bytes(TEST_BUFFER_SIZE, UINT8_MAX, seed);
+
+    // Eight comparisons for 8u, 16u and 32u elements
+    for (uint32_t index = 0u; index < dispatcher::px_scan_table.size(); index++) {
+        const uint32_t data_type = index % 3u;
+        const uint32_t max_value = (0u == data_type) ? UINT8_MAX : (1u == data_type) ? UINT16_MAX : UINT32_MAX;
+        randomizer     random_value(0u, static_cast<double>(max_value), seed);
+
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+            std::vector<uint8_t> destination(TEST_BUFFER_SIZE, 0u);
+            std::vector<uint8_t> reference(TEST_BUFFER_SIZE, 0u);
+
+            uint32_t low_value  = static_cast<uint32_t>(random_value);
+            uint32_t high_value = static_cast<uint32_t>(random_value);
+
+            if (low_value > high_value) {
+                std::swap(low_value, high_value);
+            }
+
+            dispatcher::avx2_scan_table[index](source.data(), destination.data(), length, low_value, high_value);
+            dispatcher::px_scan_table[index](source.data(), reference.data(), length, low_value, high_value);
+
+            ASSERT_TRUE(reference == destination) << "scan index: " << index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, aggregates) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t seed = util::TestEnvironment::GetInstance().GetSeed();
+
+    // 1-bit, 8u, 16u and 32u elements
+    for (uint32_t index = 0u; index < dispatcher::px_aggregates_table.size(); index++) {
+        const auto source = get_random_bytes(TEST_BUFFER_SIZE, (0u == index) ? 1u : UINT8_MAX, seed);
+
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+            uint32_t min_value           = UINT32_MAX;
+            uint32_t max_value           = 0u;
+            uint32_t sum                 = 0u;
+            uint32_t element_index       = 0u;
+            uint32_t reference_min_value = UINT32_MAX;
+            uint32_t reference_max_value = 0u;
+            uint32_t reference_sum       = 0u;
+            uint32_t reference_index     = 0u;
+
+            dispatcher::avx2_aggregates_table[index](source.data(), length,
+                                                     &min_value, &max_value, &sum, &element_index);
+            dispatcher::px_aggregates_table[index](source.data(), length,
+                                                   &reference_min_value, &reference_max_value,
+                                                   &reference_sum, &reference_index);
+
+            ASSERT_EQ(reference_min_value, min_value) << "aggregates index: " << index << ", length: " << length;
+            ASSERT_EQ(reference_max_value, max_value) << "aggregates index: " << index << ", length: " << length;
+            ASSERT_EQ(reference_sum, sum) << "aggregates index: " << index << ", length: " << length;
+            ASSERT_EQ(reference_index, element_index) << "aggregates index: " << index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, select) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t   seed   = util::TestEnvironment::GetInstance().GetSeed();
+    const auto source = get_random_bytes(TEST_BUFFER_SIZE, UINT8_MAX, seed);
+    const auto mask   = get_random_bytes(TEST_MAX_LENGTH, 1u, seed + 1u);
+
+    // 8u, 16u and 32u elements
+    for (uint32_t index = 0u; index < dispatcher::px_select_table.size(); index++) {
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+            std::vector<uint8_t> destination(TEST_BUFFER_SIZE, 0u);
+            std::vector<uint8_t> reference(TEST_BUFFER_SIZE, 0u);
+
+            auto selected = dispatcher::avx2_select_table[index](source.data(), mask.data(),
+                                                                 destination.data(), length);
+            auto reference_selected = dispatcher::px_select_table[index](source.data(), mask.data(),
+                                                                         reference.data(), length);
+
+            ASSERT_EQ(reference_selected, selected) << "select index: " << index << ", length: " << length;
+            ASSERT_TRUE(reference == destination) << "select index: " << index << ", length: " << length;
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, expand) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t   seed   = util::TestEnvironment::GetInstance().GetSeed();
+    const auto source = get_random_bytes(TEST_BUFFER_SIZE, UINT8_MAX, seed);
+    const auto mask   = get_random_bytes(TEST_MAX_LENGTH, 1u, seed + 1u);
+
+    // 8u, 16u and 32u elements, the source is shorter than the number of set mask elements sometimes
+    for (uint32_t index = 0u; index < dispatcher::px_expand_table.size(); index++) {
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+            for (uint32_t source_length : {length / 4u, length}) {
+                std::vector<uint8_t> destination(TEST_BUFFER_SIZE, 0u);
+                std::vector<uint8_t> reference(TEST_BUFFER_SIZE, 0u);
+                uint32_t             mask_length           = length;
+                uint32_t             reference_mask_length = length;
+
+                auto expanded = dispatcher::avx2_expand_table[index](source.data(), source_length, mask.data(),
+                                                                     &mask_length, destination.data());
+                auto reference_expanded = dispatcher::px_expand_table[index](source.data(), source_length,
+                                                                             mask.data(), &reference_mask_length,
+                                                                             reference.data());
+
+                ASSERT_EQ(reference_expanded, expanded) << "expand index: " << index << ", length: " << length;
+                ASSERT_EQ(reference_mask_length, mask_length) << "expand index: " << index << ", length: " << length;
+                ASSERT_TRUE(reference == destination) << "expand index: " << index << ", length: " << length;
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_avx2_tier, extract) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    uint64_t   seed   = util::TestEnvironment::GetInstance().GetSeed();
+    const auto source = get_random_bytes(TEST_BUFFER_SIZE, UINT8_MAX, seed);
+
+    // 8u, 16u and 32u elements, the range starts before, inside and after the current chunk of elements
+    for (uint32_t index = 0u; index < dispatcher::px_extract_table.size(); index++) {
+        for (uint32_t length = 1u; length <= TEST_MAX_LENGTH; length += 7u) {
+            for (uint32_t first_index : {0u, length / 3u, length + 1u}) {
+                const uint32_t low_value  = first_index + length / 4u;
+                const uint32_t high_value = low_value + length / 2u;
+
+                std::vector<uint8_t> destination(TEST_BUFFER_SIZE, 0u);
+                std::vector<uint8_t> reference(TEST_BUFFER_SIZE, 0u);
+                uint32_t             index_value           = first_index;
+                uint32_t             reference_index_value = first_index;
+
+                auto extracted = dispatcher::avx2_extract_table[index](source.data(), destination.data(), length,
+                                                                       &index_value, low_value, high_value);
+                auto reference_extracted = dispatcher::px_extract_table[index](source.data(), reference.data(),
+                                                                               length, &reference_index_value,
+                                                                               low_value, high_value);
+
+                ASSERT_EQ(reference_extracted, extracted) << "extract index: " << index << ", length: " << length;
+                ASSERT_EQ(reference_index_value, index_value) << "extract index: " << index << ", length: " << length;
+                ASSERT_TRUE(reference == destination) << "extract index: " << index << ", length: " << length;
+
+                // In-place variant
+                destination           = source;
+                reference             = source;
+                index_value           = first_index;
+                reference_index_value = first_index;
+
+                extracted           = dispatcher::avx2_extract_i_table[index](destination.data(), length,
+                                                                              &index_value, low_value, high_value);
+                reference_extracted = dispatcher::px_extract_i_table[index](reference.data(), length,
+                                                                            &reference_index_value,
+                                                                            low_value, high_value);
+
+                ASSERT_EQ(reference_extracted, extracted) << "extract_i index: " << index << ", length: " << length;
+                ASSERT_EQ(reference_index_value, index_value) << "extract_i index: " << index << ", length: " << length;
+                ASSERT_TRUE(reference == destination) << "extract_i index: " << index << ", length: " << length;
+            }
+        }
+    }
+}
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_bitmap.h"
+#include "dispatcher/dispatcher.hpp"
+
+namespace qpl::test {
+
+static inline qplc_bitmap_logic_t_ptr qplc_bitmap_logic(uint32_t index) {
+    static const auto &table = qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_bitmap_logic_table();
+
+    return (qplc_bitmap_logic_t_ptr) table[index];
+}
+
+static inline qplc_bitmap_find_t_ptr qplc_bitmap_find(uint32_t index) {
+    static const auto &table = qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_bitmap_find_table();
+
+    return (qplc_bitmap_find_t_ptr) table[index];
+}
+
+static uint8_t ref_bitmap_logic(uint32_t index, uint8_t a, uint8_t b) {
+    switch (index) {
+        case 0u:
+            return a & b;
+        case 1u:
+            return a | b;
+        case 2u:
+            return a ^ b;
+        default:
+            return a & static_cast<uint8_t>(~b);
+    }
+}
+
+static uint32_t ref_find_first(const uint8_t *src_ptr, uint32_t length) {
+    for (uint32_t i = 0u; i < length * 8u; i++) {
+        if ((src_ptr[i / 8u] >> (i % 8u)) & 1u) {
+            return i;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+static uint32_t ref_find_last(const uint8_t *src_ptr, uint32_t length) {
+    for (uint32_t i = length * 8u; i > 0u; i--) {
+        if ((src_ptr[(i - 1u) / 8u] >> ((i - 1u) % 8u)) & 1u) {
+            return i - 1u;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+constexpr uint32_t max_length = 600u;
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_bitmap, logic) {
+    auto   seed = util::TestEnvironment::GetInstance().GetSeed();
+    random random_8u(0u, UINT8_MAX, seed);
+
+    std::vector<uint8_t> source1(max_length);
+    std::vector<uint8_t> source2(max_length);
+    std::vector<uint8_t> destination(max_length + 1u);
+
+    std::generate(source1.begin(), source1.end(), [&random_8u]() { return static_cast<uint8_t>(random_8u); });
+    std::generate(source2.begin(), source2.end(), [&random_8u]() { return static_cast<uint8_t>(random_8u); });
+
+    for (uint32_t length = 0u; length <= max_length; length++) {
+        // Sources are placed to the end of the buffers to catch reads beyond the last byte
+        const uint8_t *src1_ptr = source1.data() + max_length - length;
+        const uint8_t *src2_ptr = source2.data() + max_length - length;
+
+        for (uint32_t index = 0u; index < 4u; index++) {
+            std::fill(destination.begin(), destination.end(), 0xAAu);
+
+            qplc_bitmap_logic(index)(src1_ptr, src2_ptr, destination.data(), length);
+
+            for (uint32_t i = 0u; i < length; i++) {
+                ASSERT_EQ(ref_bitmap_logic(index, src1_ptr[i], src2_ptr[i]), destination[i])
+                                            << "operation: " << index << ", length: " << length << ", byte: " << i;
+            }
+
+            ASSERT_EQ(0xAAu, destination[length]) << "operation: " << index << ", length: " << length;
+        }
+
+        std::fill(destination.begin(), destination.end(), 0xAAu);
+
+        qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_bitmap_not_table()[0](src1_ptr,
+                                                                                      destination.data(),
+                                                                                      length);
+
+        for (uint32_t i = 0u; i < length; i++) {
+            ASSERT_EQ(static_cast<uint8_t>(~src1_ptr[i]), destination[i]) << "length: " << length << ", byte: " << i;
+        }
+
+        ASSERT_EQ(0xAAu, destination[length]) << "length: " << length;
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_bitmap, popcount_and_find) {
+    auto   seed = util::TestEnvironment::GetInstance().GetSeed();
+    random random_8u(0u, UINT8_MAX, seed);
+    random random_index(0u, max_length * 8u - 1u, seed);
+
+    const auto popcount = qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_bitmap_popcount_table()[0];
+
+    std::vector<uint8_t> source(max_length);
+
+    for (uint32_t density : {0u, 1u, 2u, 255u}) {
+        // Sparse vectors have a couple of set bits, so the search goes through the whole vector
+        if (density == 255u) {
+            std::generate(source.begin(), source.end(), [&random_8u]() { return static_cast<uint8_t>(random_8u); });
+        } else {
+            std::fill(source.begin(), source.end(), 0u);
+
+            for (uint32_t i = 0u; i < density; i++) {
+                const auto index = static_cast<uint32_t>(random_index);
+
+                source[index / 8u] |= static_cast<uint8_t>(1u << (index % 8u));
+            }
+        }
+
+        for (uint32_t length = 0u; length <= max_length; length++) {
+            const uint8_t *src_ptr = source.data() + max_length - length;
+
+            uint32_t reference_count = 0u;
+
+            for (uint32_t i = 0u; i < length * 8u; i++) {
+                reference_count += (src_ptr[i / 8u] >> (i % 8u)) & 1u;
+            }
+
+            ASSERT_EQ(reference_count, popcount(src_ptr, length)) << "density: " << density << ", length: " << length;
+            ASSERT_EQ(ref_find_first(src_ptr, length), qplc_bitmap_find(0u)(src_ptr, length))
+                                        << "density: " << density << ", length: " << length;
+            ASSERT_EQ(ref_find_last(src_ptr, length), qplc_bitmap_find(1u)(src_ptr, length))
+                                        << "density: " << density << ", length: " << length;
+        }
+    }
+}
+
+}
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_checksum.h"
+#include "dispatcher/dispatcher.hpp"
+
+/*
+ * The dispatcher picks only one tier for the host, so kernels of the other tiers
+ * are called directly from their tables here and compared with the reference
+ */
+namespace qpl::ml::dispatcher {
+extern crc64_table_t px_crc64_table;
+extern crc64_table_t avx2_crc64_table;
+} // namespace qpl::ml::dispatcher
+
+namespace qpl::test {
+
+namespace dispatcher = qpl::ml::dispatcher;
+
+static inline qplc_crc64_t_ptr qplc_crc64() {
+    static const auto &table = dispatcher::kernels_dispatcher::get_instance().get_crc64_table();
+
+    return (qplc_crc64_t_ptr) table[0u];
+}
+
+static inline bool is_avx2_tier_supported() {
+    return dispatcher::arch_t::px_arch != dispatcher::detect_platform();
+}
+
+static uint64_t reflect_64u(uint64_t value) {
+    uint64_t result = 0u;
+
+    for (uint32_t i = 0u; i < 64u; i++) {
+        result |= ((value >> i) & 1u) << (63u - i);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Bit-by-bit CRC64 calculation
+ */
+static uint64_t ref_crc64(const uint8_t *src_ptr, uint32_t length, uint64_t polynomial, bool is_be, bool is_inverse) {
+    uint64_t inversion_mask = 0u;
+
+    if (is_inverse) {
+        // All bits starting from the lowest non-zero bit of the polynomial
+        inversion_mask = ~(polynomial & (~polynomial + 1u)) + 1u;
+        inversion_mask = (is_be) ? reflect_64u(inversion_mask) : inversion_mask;
+    }
+
+    uint64_t crc = inversion_mask;
+
+    if (is_be) {
+        polynomial = reflect_64u(polynomial);
+
+        for (uint32_t i = 0u; i < length; i++) {
+            crc ^= src_ptr[i];
+            for (uint32_t bit = 0u; bit < 8u; bit++) {
+                crc = (crc & 1u) ? (crc >> 1u) ^ polynomial : (crc >> 1u);
+            }
+        }
+    } else {
+        for (uint32_t i = 0u; i < length; i++) {
+            crc ^= static_cast<uint64_t>(src_ptr[i]) << 56u;
+            for (uint32_t bit = 0u; bit < 8u; bit++) {
+                crc = (crc >> 63u) ? (crc << 1u) ^ polynomial : (crc << 1u);
+            }
+        }
+    }
+
+    return crc ^ inversion_mask;
+}
+
+constexpr uint32_t max_length = 2048u;
+
+static void check_all_lengths(qplc_crc64_t_ptr crc64_kernel) {
+    auto   seed = util::TestEnvironment::GetInstance().GetSeed();
+    random random_8u(0u, UINT8_MAX, seed);
+    random random_32u(1u, UINT32_MAX, seed);
+
+    std::vector<uint8_t> source(max_length);
+    std::generate(source.begin(), source.end(), [&random_8u]() { return static_cast<uint8_t>(random_8u); });
+
+    // Polynomials are changed on every call to check that cached lookup tables are not reused for them
+    const uint64_t polynomials[] = {0x42F0E1EBA9EA3693ULL,
+                                    0x000000000000001BULL,
+                                    (static_cast<uint64_t>(static_cast<uint32_t>(random_32u)) << 32u)
+                                    | static_cast<uint32_t>(random_32u),
+                                    static_cast<uint64_t>(static_cast<uint32_t>(random_32u)) << 32u};
+
+    for (uint32_t length = 0u; length <= max_length; length = (length < 600u) ? length + 1u : length + 97u) {
+        for (uint64_t polynomial : polynomials) {
+            for (bool is_be : {false, true}) {
+                for (bool is_inverse : {false, true}) {
+                    auto crc = crc64_kernel(source.data(), length, polynomial, is_be, is_inverse);
+
+                    ASSERT_EQ(ref_crc64(source.data(), length, polynomial, is_be, is_inverse), crc)
+                                                << "length: " << length << ", polynomial: " << std::hex << polynomial
+                                                << ", be: " << is_be << ", inverse: " << is_inverse;
+                }
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64, all_lengths) {
+    check_all_lengths(qplc_crc64());
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64, px_kernel) {
+    check_all_lengths((qplc_crc64_t_ptr) dispatcher::px_crc64_table[0u]);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_crc64, avx2_kernel) {
+    if (!is_avx2_tier_supported()) {
+        GTEST_SKIP_("AVX2 tier is not supported by the CPU");
+    }
+
+    check_all_lengths((qplc_crc64_t_ptr) dispatcher::avx2_crc64_table[0u]);
+}
+
+}
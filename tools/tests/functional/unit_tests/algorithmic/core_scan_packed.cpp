@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_scan.h"
+#include "dispatcher/dispatcher.hpp"
+
+namespace qpl::test {
+
+static inline qplc_scan_packed_t_ptr qplc_scan_packed(uint32_t index) {
+    static const auto &table = qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_scan_packed_table();
+
+    return (qplc_scan_packed_t_ptr) table[index];
+}
+
+static uint32_t ref_get_element(const uint8_t *src_ptr, uint32_t index, uint32_t bit_width) {
+    uint32_t value = 0u;
+
+    for (uint32_t bit = 0u; bit < bit_width; bit++) {
+        uint32_t bit_offset = index * bit_width + bit;
+
+        value |= static_cast<uint32_t>((src_ptr[bit_offset / 8u] >> (bit_offset % 8u)) & 1u) << bit;
+    }
+
+    return value;
+}
+
+static void ref_scan_range_nu1u(const uint8_t *src_ptr,
+                                uint32_t length,
+                                uint32_t bit_width,
+                                uint8_t *dst_ptr,
+                                uint32_t low_value,
+                                uint32_t high_value,
+                                bool is_inverted) {
+    std::fill(dst_ptr, dst_ptr + (length + 7u) / 8u, 0u);
+
+    for (uint32_t i = 0u; i < length; i++) {
+        uint32_t value = ref_get_element(src_ptr, i, bit_width);
+        bool     match = (low_value <= value) && (value <= high_value);
+
+        if (match != is_inverted) {
+            dst_ptr[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+        }
+    }
+}
+
+constexpr uint32_t max_length = 1100u;
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_scan_packed, all_bit_widths) {
+    auto   seed = util::TestEnvironment::GetInstance().GetSeed();
+    random random_8u(0u, UINT8_MAX, seed);
+
+    std::vector<uint8_t> source(max_length * sizeof(uint32_t));
+    std::vector<uint8_t> destination(max_length / 8u + 1u);
+    std::vector<uint8_t> reference(max_length / 8u + 1u);
+
+    for (uint32_t bit_width = 1u; bit_width <= 32u; bit_width++) {
+        std::generate(source.begin(), source.end(), [&random_8u]() { return static_cast<uint8_t>(random_8u); });
+
+        const uint32_t max_value = static_cast<uint32_t>((1ULL << bit_width) - 1u);
+        random         random_value(0u, max_value, seed);
+
+        for (uint32_t length = 0u; length <= max_length; length = (length < 300u) ? length + 1u : length + 67u) {
+            // Sources are placed to the end of the buffer to catch reads beyond the last element
+            const uint8_t *src_ptr = source.data() + source.size() - (length * bit_width + 7u) / 8u;
+
+            uint32_t low_value  = static_cast<uint32_t>(random_value);
+            uint32_t high_value = static_cast<uint32_t>(random_value);
+
+            const std::pair<uint32_t, uint32_t> ranges[] = {{std::min(low_value, high_value),
+                                                             std::max(low_value, high_value)},
+                                                            {low_value, low_value},
+                                                            {0u, UINT32_MAX},
+                                                            {1u, 0u}};
+
+            for (const auto &range : ranges) {
+                for (uint32_t index : {0u, 1u}) {
+                    std::fill(destination.begin(), destination.end(), 0xAAu);
+
+                    qplc_scan_packed(index)(src_ptr, length, bit_width, destination.data(), range.first, range.second);
+                    ref_scan_range_nu1u(src_ptr, length, bit_width, reference.data(),
+                                        range.first, range.second, 1u == index);
+
+                    ASSERT_TRUE(std::equal(reference.begin(),
+                                           reference.begin() + (length + 7u) / 8u,
+                                           destination.begin()))
+                                                << "bit width: " << bit_width << ", length: " << length
+                                                << ", low: " << range.first << ", high: " << range.second
+                                                << ", inverted: " << index;
+                }
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "qplc_set_membership.h"
+#include "dispatcher/dispatcher.hpp"
+#include "analytics/hash_set.hpp"
+
+namespace qpl::test {
+
+static inline qplc_set_membership_hash_t_ptr qplc_set_membership_hash(uint32_t index) {
+    static const auto &table = qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_set_membership_hash_table();
+
+    return (qplc_set_membership_hash_t_ptr) table[index];
+}
+
+constexpr uint32_t max_length = 1100u;
+
+template <class input_t>
+static void check_set_membership_hash(uint32_t index, uint32_t seed) {
+    constexpr uint32_t input_bit_width = 8u * sizeof(input_t);
+
+    random random_value(0u, (input_bit_width == 32u) ? UINT32_MAX : UINT16_MAX, seed);
+    random random_choice(0u, 1u, seed);
+
+    for (uint32_t keys_count : {0u, 1u, 15u, 16u, 100u, 5000u}) {
+        for (uint32_t shift : {0u, 3u}) {
+            const uint32_t mask = (input_bit_width == 32u) ? UINT32_MAX >> shift : UINT16_MAX >> shift;
+
+            std::vector<uint32_t>        keys(keys_count);
+            std::unordered_set<uint32_t> reference_set;
+            qpl::ml::analytics::hash_set_t hash_set;
+
+            ASSERT_TRUE(hash_set.reserve(keys_count));
+
+            for (auto &key : keys) {
+                key = static_cast<uint32_t>(random_value) & mask;
+                reference_set.insert(key);
+                ASSERT_TRUE(hash_set.insert(key));
+            }
+
+            // Value of free slots must be a valid key too
+            if (input_bit_width == 32u && shift == 0u && keys_count != 0u) {
+                keys[0] = QPLC_HASH_SET_EMPTY_KEY;
+                reference_set.insert(keys[0]);
+                ASSERT_TRUE(hash_set.insert(keys[0]));
+            }
+
+            ASSERT_EQ(reference_set.size(), hash_set.size());
+
+            const auto set_view = hash_set.view();
+
+            std::vector<input_t> source(max_length);
+            std::vector<uint8_t> destination(max_length * sizeof(input_t));
+
+            for (uint32_t length = 0u; length <= max_length; length = (length < 40u) ? length + 1u : length + 97u) {
+                // A half of the values is taken from the set
+                for (auto &value : source) {
+                    if (keys_count != 0u && static_cast<uint32_t>(random_choice)) {
+                        value = static_cast<input_t>(keys[static_cast<uint32_t>(random_value) % keys_count] << shift);
+                    } else {
+                        value = static_cast<input_t>(static_cast<uint32_t>(random_value));
+                    }
+                }
+
+                std::memcpy(destination.data(), source.data(), length * sizeof(input_t));
+
+                qplc_set_membership_hash(index)(destination.data(), length, shift, mask, &set_view);
+
+                for (uint32_t i = 0u; i < length; i++) {
+                    const uint32_t key      = (static_cast<uint32_t>(source[i]) >> shift) & mask;
+                    const uint8_t  expected = reference_set.count(key) ? 1u : 0u;
+
+                    ASSERT_EQ(expected, destination[i]) << "keys: " << keys_count << ", shift: " << shift
+                                                        << ", length: " << length << ", index: " << i;
+                }
+            }
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_set_membership_hash, 16u8u) {
+    check_set_membership_hash<uint16_t>(0u, util::TestEnvironment::GetInstance().GetSeed());
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(qplc_set_membership_hash, 32u8u) {
+    check_set_membership_hash<uint32_t>(1u, util::TestEnvironment::GetInstance().GetSeed());
+}
+
+}
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#if defined( linux ) && defined( QPL_HW_EMULATOR )
+
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../t_common.hpp"
+
+#include "hw_completion_record_api.h"
+#include "hw_descriptors_api.h"
+#include "hw_status.h"
+#include "analytics/analytics_defs.hpp"
+#include "dispatcher/hw_dispatcher.hpp"
+#include "dispatcher/hw_selection_policy.hpp"
+#include "util/awaiter.hpp"
+#include "util/descriptor_processing.hpp"
+
+namespace qpl::test {
+
+using qpl::ml::dispatcher::hw_dispatcher;
+using qpl::ml::dispatcher::hw_queue_state_t;
+using qpl::ml::dispatcher::hw_selection_policy;
+using qpl::ml::dispatcher::hw_submission_t;
+
+/**
+ * @brief Policy that always tries the work queue with the smallest maximum transfer size first
+ */
+class smallest_queue_first_policy final : public hw_selection_policy {
+public:
+    [[nodiscard]] auto rank(const hw_queue_state_t &queue,
+                            const hw_submission_t &) const noexcept -> uint64_t override {
+        return queue.max_transfer_size;
+    }
+};
+
+static auto get_outstanding_count(const hw_dispatcher &dispatcher) -> uint32_t {
+    uint32_t count = 0u;
+
+    for (const auto &device : dispatcher) {
+        for (size_t i = 0u; i < device.size(); i++) {
+            count += device.get_queue_state(i).outstanding_count;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Enqueues descriptors to two work queues that reject every second enqueue,
+ *        returns 0 or the number of the failed check
+ */
+static auto run_enqueue_fallback() -> int {
+    static const smallest_queue_first_policy policy;
+
+    auto &dispatcher = hw_dispatcher::get_instance();
+
+    if (!dispatcher.is_hw_support() || 1u != dispatcher.device_count() || 2u != dispatcher.device(0u).size()) {
+        return 1;
+    }
+
+    dispatcher.set_selection_policy(&policy);
+
+    std::vector<uint8_t> source(64u, 0xAAu);
+    std::vector<uint8_t> destination(source.size());
+
+    std::array<hw_iaa_completion_record, 4u> records{};
+    std::array<uint32_t, 4u>                 queue_tags{};
+    hw_descriptor HW_PATH_ALIGN_STRUCTURE    descriptor{};
+
+    hw_iaa_descriptor_init_mem_copy(&descriptor, source.data(), destination.data(), static_cast<uint32_t>(source.size()));
+
+    std::array<hw_accelerator_status, 4u> statuses{};
+
+    for (size_t i = 0u; i < records.size(); i++) {
+        records[i].status = AD_STATUS_INPROG;
+        hw_iaa_descriptor_set_completion_record(&descriptor, reinterpret_cast<hw_completion_record *>(&records[i]));
+
+        statuses[i] = dispatcher.enqueue_descriptor(&descriptor, -1, &queue_tags[i]);
+    }
+
+    for (size_t i = 0u; i < records.size(); i++) {
+        if (0u != queue_tags[i]) {
+            qpl::ml::awaiter::wait_for(&records[i].status, AD_STATUS_INPROG);
+            dispatcher.retire_descriptor(&queue_tags[i]);
+        }
+    }
+
+    dispatcher.set_selection_policy(nullptr);
+
+    // The first queue takes the 1st and the 3rd descriptors, the 2nd one is moved to the second queue,
+    // both queues reject the 4th one
+    if (HW_ACCELERATOR_STATUS_OK != statuses[0] || HW_ACCELERATOR_STATUS_OK != statuses[1]
+        || HW_ACCELERATOR_STATUS_OK != statuses[2] || HW_ACCELERATOR_WQ_IS_BUSY != statuses[3]) {
+        return 2;
+    }
+
+    if (AD_STATUS_SUCCESS != records[0].status || AD_STATUS_SUCCESS != records[1].status
+        || AD_STATUS_SUCCESS != records[2].status || source != destination) {
+        return 3;
+    }
+
+    return (0u == get_outstanding_count(dispatcher)) ? 0 : 4;
+}
+
+/**
+ * @brief Processes descriptors at once when the work queue rejects the third one,
+ *        returns 0 or the number of the failed check
+ */
+static auto run_rejected_multi_descriptor() -> int {
+    constexpr uint32_t number_of_descriptors = 4u;
+
+    auto &dispatcher = hw_dispatcher::get_instance();
+
+    if (!dispatcher.is_hw_support()) {
+        return 1;
+    }
+
+    std::vector<uint8_t> source(64u * number_of_descriptors, 0xAAu);
+    std::vector<uint8_t> destination(source.size());
+
+    std::array<hw_descriptor, number_of_descriptors>        descriptors{};
+    std::array<hw_completion_record, number_of_descriptors> records{};
+
+    for (uint32_t i = 0u; i < number_of_descriptors; i++) {
+        hw_iaa_descriptor_init_mem_copy(&descriptors[i], source.data() + 64u * i, destination.data() + 64u * i, 64u);
+    }
+
+    const auto result = qpl::ml::util::process_descriptor<qpl::ml::analytics::analytic_operation_result_t,
+                                                          number_of_descriptors>(descriptors, records, -1);
+
+    if (QPL_STS_QUEUES_ARE_BUSY_ERR != result.status_code_) {
+        return 2;
+    }
+
+    // The enqueued descriptors are completed before the call returns and retired after that
+    for (uint32_t i = 0u; i < 2u; i++) {
+        if (AD_STATUS_INPROG == reinterpret_cast<hw_iaa_completion_record &>(records[i]).status) {
+            return 3;
+        }
+    }
+
+    return (0u == get_outstanding_count(dispatcher)) ? 0 : 4;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_dispatcher, enqueue_fallback) {
+    // The accelerator configuration is read once per process, so the dispatcher is used in a child process
+    // that starts with its own configuration. The emulator is enabled in the child only,
+    // otherwise the tests that follow would discover the emulated devices
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    EXPECT_EXIT({
+                    setenv("QPL_HW_EMULATOR", "devices=1,wqs=2,max_transfer=4096:8192,busy_period=2", 1);
+                    std::exit(run_enqueue_fallback());
+                }, ::testing::ExitedWithCode(0), "");
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_dispatcher, rejected_multi_descriptor) {
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    // The descriptors stay in the queue long enough to be in flight when the third one is rejected
+    EXPECT_EXIT({
+                    setenv("QPL_HW_EMULATOR", "devices=1,wqs=1,busy_period=3,latency_ns=50000000", 1);
+                    std::exit(run_rejected_multi_descriptor());
+                }, ::testing::ExitedWithCode(0), "");
+}
+
+}
+
+#endif
@@ -0,0 +1,243 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#if defined( linux ) && defined( QPL_HW_EMULATOR )
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qpl/qpl.h"
+#include "qpl_test_environment.hpp"
+#include "random_generator.h"
+#include "../t_common.hpp"
+
+#include "hw_completion_record_api.h"
+#include "hw_descriptors_api.h"
+#include "hw_status.h"
+#include "dispatcher/dispatcher.hpp"
+#include "dispatcher/hw_emulated_portal.hpp"
+
+namespace qpl::test {
+
+static void wait_completion(HW_PATH_VOLATILE hw_iaa_completion_record *record_ptr) {
+    while (AD_STATUS_INPROG == record_ptr->status) {
+        std::this_thread::yield();
+    }
+}
+
+static auto execute_with_retries(qpl_job *job_ptr, uint32_t &retries_count) -> qpl_status {
+    auto status = qpl_execute_job(job_ptr);
+
+    for (; QPL_STS_QUEUES_ARE_BUSY_ERR == status; retries_count++) {
+        status = qpl_execute_job(job_ptr);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Executes memory copy and CRC64 jobs on the hardware path, returns 0 or the number of the failed check
+ */
+static auto run_hardware_path_jobs(bool is_retry_expected) -> int {
+    constexpr uint32_t job_count  = 64u;
+    constexpr uint64_t polynomial = 0x42F0E1EBA9EA3693ull;
+
+    uint32_t job_size = 0u;
+
+    if (QPL_STS_OK != qpl_get_job_size(qpl_path_hardware, &job_size)) {
+        return 1;
+    }
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto *job_ptr   = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    if (QPL_STS_OK != qpl_init_job(qpl_path_hardware, job_ptr)) {
+        return 2;
+    }
+
+    std::vector<uint8_t> source(4096u);
+    std::vector<uint8_t> destination(source.size());
+
+    for (size_t i = 0u; i < source.size(); i++) {
+        source[i] = static_cast<uint8_t>(i * 7u);
+    }
+
+    const uint64_t reference = qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_crc64_table()[0](
+            source.data(), static_cast<uint32_t>(source.size()), polynomial, false, false);
+
+    uint32_t retries_count = 0u;
+
+    for (uint32_t i = 0u; i < job_count; i++) {
+        std::fill(destination.begin(), destination.end(), 0u);
+
+        job_ptr->op            = qpl_op_memcpy;
+        job_ptr->flags         = 0u;
+        job_ptr->next_in_ptr   = source.data();
+        job_ptr->available_in  = static_cast<uint32_t>(source.size());
+        job_ptr->next_out_ptr  = destination.data();
+        job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+        if (QPL_STS_OK != execute_with_retries(job_ptr, retries_count) || source != destination) {
+            return 3;
+        }
+
+        job_ptr->op           = qpl_op_crc64;
+        job_ptr->flags        = 0u;
+        job_ptr->crc64_poly   = polynomial;
+        job_ptr->next_in_ptr  = source.data();
+        job_ptr->available_in = static_cast<uint32_t>(source.size());
+
+        if (QPL_STS_OK != execute_with_retries(job_ptr, retries_count) || reference != job_ptr->crc64) {
+            return 4;
+        }
+    }
+
+    if (QPL_STS_OK != qpl_fini_job(job_ptr)) {
+        return 5;
+    }
+
+    return (is_retry_expected && 0u == retries_count) ? 6 : 0;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_portal, execution) {
+    auto   seed = util::TestEnvironment::GetInstance().GetSeed();
+    random random_8u(0u, UINT8_MAX, seed);
+
+    std::vector<uint8_t> source(1000u);
+    std::vector<uint8_t> destination(source.size(), 0u);
+
+    std::generate(source.begin(), source.end(), [&random_8u]() { return static_cast<uint8_t>(random_8u); });
+
+    qpl::ml::dispatcher::hw_emulated_portal portal(4u, 0u, 0u);
+
+    HW_PATH_VOLATILE hw_iaa_completion_record HW_PATH_ALIGN_STRUCTURE copy_record{};
+    HW_PATH_VOLATILE hw_iaa_completion_record HW_PATH_ALIGN_STRUCTURE crc_record{};
+    HW_PATH_VOLATILE hw_iaa_completion_record HW_PATH_ALIGN_STRUCTURE unsupported_record{};
+    hw_descriptor HW_PATH_ALIGN_STRUCTURE                             descriptor{};
+
+    hw_iaa_descriptor_init_mem_copy(&descriptor, source.data(), destination.data(), static_cast<uint32_t>(source.size()));
+    hw_iaa_descriptor_set_completion_record(&descriptor, reinterpret_cast<HW_PATH_VOLATILE hw_completion_record *>(&copy_record));
+
+    ASSERT_FALSE(portal.enqueue_descriptor(&descriptor));
+    wait_completion(&copy_record);
+
+    ASSERT_EQ(AD_STATUS_SUCCESS, copy_record.status);
+    ASSERT_EQ(source, destination);
+
+    constexpr uint64_t polynomial = 0x42F0E1EBA9EA3693ull;
+
+    const uint64_t reference = qpl::ml::dispatcher::kernels_dispatcher::get_instance().get_crc64_table()[0](
+            source.data(), static_cast<uint32_t>(source.size()), polynomial, true, false);
+
+    hw_iaa_descriptor_init_crc64(&descriptor, source.data(), static_cast<uint32_t>(source.size()), polynomial, true, false);
+    hw_iaa_descriptor_set_completion_record(&descriptor, reinterpret_cast<HW_PATH_VOLATILE hw_completion_record *>(&crc_record));
+
+    ASSERT_FALSE(portal.enqueue_descriptor(&descriptor));
+    wait_completion(&crc_record);
+
+    ASSERT_EQ(AD_STATUS_SUCCESS, crc_record.status);
+    ASSERT_EQ(reference, (static_cast<uint64_t>(crc_record.sum_agg) << 32u) | crc_record.max_last_agg);
+
+    // Operations without emulation are reported as unsupported
+    hw_iaa_descriptor_set_completion_record(&descriptor,
+                                            reinterpret_cast<HW_PATH_VOLATILE hw_completion_record *>(&unsupported_record));
+    reinterpret_cast<hw_iaa_analytics_descriptor *>(&descriptor)->op_code_op_flags = 0xFFu << 24u;
+
+    ASSERT_FALSE(portal.enqueue_descriptor(&descriptor));
+    wait_completion(&unsupported_record);
+
+    ASSERT_EQ(AD_STATUS_UNSUPPORTED_OPCODE, unsupported_record.status);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_portal, rejection) {
+    constexpr uint32_t queue_size       = 4u;
+    constexpr uint32_t descriptor_count = 12u;
+
+    std::vector<uint8_t> source(64u, 0xAAu);
+    std::vector<uint8_t> destination(source.size());
+
+    HW_PATH_VOLATILE hw_iaa_completion_record HW_PATH_ALIGN_STRUCTURE record{};
+    hw_descriptor HW_PATH_ALIGN_STRUCTURE                             descriptor{};
+
+    hw_iaa_descriptor_init_mem_copy(&descriptor, source.data(), destination.data(), static_cast<uint32_t>(source.size()));
+    hw_iaa_descriptor_set_completion_record(&descriptor, reinterpret_cast<HW_PATH_VOLATILE hw_completion_record *>(&record));
+
+    {
+        // Every 3rd enqueue is rejected
+        qpl::ml::dispatcher::hw_emulated_portal portal(descriptor_count, 3u, 0u);
+
+        for (uint32_t i = 1u; i <= descriptor_count; i++) {
+            EXPECT_EQ(0u == i % 3u, portal.enqueue_descriptor(&descriptor)) << "enqueue: " << i;
+        }
+    }
+
+    {
+        // Descriptors stay in the queue until the latency expires, so the queue is full after queue_size enqueues
+        qpl::ml::dispatcher::hw_emulated_portal portal(queue_size, 0u, 1000000000u);
+
+        for (uint32_t i = 0u; i < queue_size; i++) {
+            EXPECT_FALSE(portal.enqueue_descriptor(&descriptor)) << "enqueue: " << i;
+        }
+
+        EXPECT_TRUE(portal.enqueue_descriptor(&descriptor));
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_portal, pending_tasks_on_destruction) {
+    constexpr uint32_t descriptor_count = 4u;
+
+    std::vector<uint8_t> source(64u, 0xAAu);
+    std::vector<uint8_t> destination(source.size());
+
+    std::vector<hw_iaa_completion_record> records(descriptor_count);
+    hw_descriptor HW_PATH_ALIGN_STRUCTURE descriptor{};
+
+    hw_iaa_descriptor_init_mem_copy(&descriptor, source.data(), destination.data(), static_cast<uint32_t>(source.size()));
+
+    {
+        // Descriptors don't start before the portal is destroyed
+        qpl::ml::dispatcher::hw_emulated_portal portal(descriptor_count, 0u, 1000000000u);
+
+        for (auto &record : records) {
+            record.status = AD_STATUS_INPROG;
+            hw_iaa_descriptor_set_completion_record(&descriptor, reinterpret_cast<hw_completion_record *>(&record));
+
+            ASSERT_FALSE(portal.enqueue_descriptor(&descriptor));
+        }
+    }
+
+    for (const auto &record : records) {
+        EXPECT_EQ(AD_STATUS_ANALYTICS_ERROR, record.status);
+        EXPECT_EQ(AD_ERROR_CODE_TIMEOUT, record.error_code);
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_emulated_portal, hardware_path_jobs) {
+    // The accelerator configuration is read once per process, so the jobs are executed in child processes
+    // that start with their own configuration. The emulator is enabled in the child only,
+    // otherwise the tests that follow would discover the emulated devices
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+    // Rejected enqueues are returned as busy queues and retried
+    EXPECT_EXIT({
+                    setenv("QPL_HW_EMULATOR", "wqs=1,busy_period=3", 1);
+                    std::exit(run_hardware_path_jobs(true));
+                }, ::testing::ExitedWithCode(0), "");
+
+    // Rejected enqueues are moved to other work queues first
+    EXPECT_EXIT({
+                    setenv("QPL_HW_EMULATOR", "devices=2,wqs=2,busy_period=2,latency_ns=1000", 1);
+                    std::exit(run_hardware_path_jobs(false));
+                }, ::testing::ExitedWithCode(0), "");
+}
+
+}
+
+#endif
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../t_common.hpp"
+
+#include "dispatcher/hw_selection_policy.hpp"
+
+namespace qpl::test {
+
+using qpl::ml::dispatcher::hw_load_aware_policy;
+using qpl::ml::dispatcher::hw_queue_state_t;
+using qpl::ml::dispatcher::hw_selection_policy;
+using qpl::ml::dispatcher::hw_submission_t;
+
+static auto make_queue(uint64_t numa_id,
+                       uint32_t outstanding_count,
+                       uint32_t size = 16u,
+                       uint64_t max_transfer_size = 1ull << 31u,
+                       int32_t priority = 1) -> hw_queue_state_t {
+    hw_queue_state_t queue{};
+
+    queue.numa_id           = numa_id;
+    queue.outstanding_count = outstanding_count;
+    queue.size              = size;
+    queue.max_transfer_size = max_transfer_size;
+    queue.priority          = priority;
+
+    return queue;
+}
+
+static auto make_submission(uint64_t numa_id, bool is_numa_strict, uint32_t transfer_size = 4096u) -> hw_submission_t {
+    hw_submission_t submission{};
+
+    submission.numa_id        = numa_id;
+    submission.is_numa_strict = is_numa_strict;
+    submission.transfer_size  = transfer_size;
+
+    return submission;
+}
+
+/**
+ * @brief Index of the queue the policy prefers, the same way the dispatcher picks it
+ */
+static auto select(const hw_selection_policy &policy,
+                   const std::vector<hw_queue_state_t> &queues,
+                   const hw_submission_t &submission) -> int32_t {
+    int32_t  best_idx  = -1;
+    uint64_t best_rank = hw_selection_policy::not_eligible;
+
+    for (size_t i = 0u; i < queues.size(); i++) {
+        const auto rank = policy.rank(queues[i], submission);
+
+        if (rank < best_rank) {
+            best_rank = rank;
+            best_idx  = static_cast<int32_t>(i);
+        }
+    }
+
+    return best_idx;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_selection_policy, numa_fallback) {
+    const hw_load_aware_policy policy;
+
+    const auto local_submission = make_submission(0u, false);
+
+    // Local queue is preferred even if it is more loaded
+    EXPECT_EQ(0, select(policy, {make_queue(0u, 8u), make_queue(1u, 0u)}, local_submission));
+
+    // Remote queue is used once the local one is saturated
+    EXPECT_EQ(1, select(policy, {make_queue(0u, 16u), make_queue(1u, 8u)}, local_submission));
+
+    // Saturated local queue is preferred over the saturated remote one
+    EXPECT_EQ(1, select(policy, {make_queue(1u, 16u), make_queue(0u, 32u)}, local_submission));
+
+    // Requested NUMA node is strict
+    const auto strict_submission = make_submission(0u, true);
+
+    EXPECT_EQ(hw_selection_policy::not_eligible, policy.rank(make_queue(1u, 0u), strict_submission));
+    EXPECT_EQ(0, select(policy, {make_queue(0u, 16u), make_queue(1u, 0u)}, strict_submission));
+    EXPECT_EQ(-1, select(policy, {make_queue(1u, 0u), make_queue(2u, 0u)}, strict_submission));
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_selection_policy, transfer_size) {
+    const hw_load_aware_policy policy;
+
+    const std::vector<hw_queue_state_t> queues = {make_queue(0u, 0u, 16u, 1ull << 31u),
+                                                  make_queue(0u, 0u, 16u, 1ull << 16u)};
+
+    // Small job goes to the low-latency queue, large job can only use the queue it fits
+    EXPECT_EQ(1, select(policy, queues, make_submission(0u, false, 4096u)));
+    EXPECT_EQ(0, select(policy, queues, make_submission(0u, false, (1u << 16u) + 1u)));
+
+    EXPECT_EQ(hw_selection_policy::not_eligible,
+              policy.rank(make_queue(0u, 0u, 16u, 1u << 10u), make_submission(0u, false, (1u << 10u) + 1u)));
+
+    // Unknown maximum transfer size accepts any job but is used last
+    EXPECT_EQ(0, select(policy,
+                        {make_queue(0u, 0u, 16u, 1ull << 31u), make_queue(0u, 0u, 16u, 0u)},
+                        make_submission(0u, false)));
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(hw_selection_policy, load_and_priority) {
+    const hw_load_aware_policy policy;
+
+    const auto submission = make_submission(0u, false);
+
+    // Least loaded queue relative to its size
+    EXPECT_EQ(1, select(policy, {make_queue(0u, 4u, 16u), make_queue(0u, 4u, 32u)}, submission));
+    EXPECT_EQ(0, select(policy, {make_queue(0u, 3u), make_queue(0u, 5u)}, submission));
+
+    // Priority breaks the tie
+    EXPECT_EQ(1, select(policy, {make_queue(0u, 2u, 16u, 1ull << 31u, 1), make_queue(0u, 2u, 16u, 1ull << 31u, 10)},
+                        submission));
+
+    // Queue of unknown size is never saturated
+    EXPECT_EQ(0, select(policy, {make_queue(0u, 100u, 0u), make_queue(1u, 0u)}, submission));
+}
+
+}
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../t_common.hpp"
+
+#include "qpl/qpl.h"
+
+namespace qpl::test {
+
+static auto init_hardware_job_status() -> qpl_status {
+    uint32_t job_size = 0u;
+
+    if (QPL_STS_OK != qpl_get_job_size(qpl_path_hardware, &job_size)) {
+        return QPL_STS_LIBRARY_INTERNAL_ERR;
+    }
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto *job_ptr   = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    const auto status = qpl_init_job(qpl_path_hardware, job_ptr);
+
+    qpl_fini_job(job_ptr);
+
+    return status;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(library_initialization, device_subset) {
+    // Both statuses are taken from a fresh discovery, so the state left by earlier tests doesn't matter
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_library());
+    const auto default_status = init_hardware_job_status();
+
+    // None of the devices is requested, only the software path is usable
+    const uint32_t      missing_device_id = UINT32_MAX;
+    qpl_library_options options{-1, &missing_device_id, 1u};
+
+    EXPECT_NE(QPL_STS_OK, qpl_init_library(&options));
+    EXPECT_NE(QPL_STS_OK, init_hardware_job_status());
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &job_size));
+
+    auto job_buffer = std::make_unique<uint8_t[]>(job_size);
+    auto *job_ptr   = reinterpret_cast<qpl_job *>(job_buffer.get());
+
+    std::vector<uint8_t> source(1024u, 0x5Au);
+    std::vector<uint8_t> destination(source.size(), 0u);
+
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, job_ptr));
+
+    job_ptr->op            = qpl_op_memcpy;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    EXPECT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+    EXPECT_EQ(source, destination);
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+
+    // Released hardware is discovered again with the default options by the next hardware job
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_library());
+    EXPECT_EQ(default_status, init_hardware_job_status());
+}
+
+}
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../t_common.hpp"
+
+#include "qpl/qpl.h"
+#include "util/awaiter.hpp"
+
+namespace qpl::test {
+
+constexpr uint8_t in_progress_status = 0u;
+constexpr uint8_t completed_status   = 1u;
+
+/**
+ * @brief Completion record that is flipped by a helper thread once the waiter started
+ */
+class completion_flipper {
+public:
+    explicit completion_flipper(std::chrono::microseconds delay)
+            : worker_([this, delay]() -> void {
+                  while (!is_waiting_.load(std::memory_order_acquire)) {
+                      std::this_thread::yield();
+                  }
+
+                  std::this_thread::sleep_for(delay);
+                  status_ = completed_status;
+              }) {
+    }
+
+    ~completion_flipper() {
+        worker_.join();
+    }
+
+    auto wait(const ml::wait_policy_t &policy) -> bool {
+        is_waiting_.store(true, std::memory_order_release);
+
+        return ml::awaiter::wait_for(&status_, in_progress_status, policy, ml::make_wait_deadline(policy));
+    }
+
+    [[nodiscard]] auto status() const -> uint8_t {
+        return status_;
+    }
+
+private:
+    volatile uint8_t  status_ = in_progress_status;
+    std::atomic<bool> is_waiting_{false};
+    std::thread       worker_;
+};
+
+static auto make_policy(ml::wait_mode_t mode, uint32_t spin_count, uint64_t timeout_ns) -> ml::wait_policy_t {
+    ml::wait_policy_t policy;
+
+    policy.mode       = mode;
+    policy.spin_count = spin_count;
+    policy.timeout_ns = timeout_ns;
+
+    return policy;
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(wait_policy, completion_is_awaited) {
+    for (auto mode : {ml::wait_mode_t::spin, ml::wait_mode_t::umwait, ml::wait_mode_t::yield}) {
+        for (uint32_t spin_count : {0u, 64u}) {
+            completion_flipper flipper(std::chrono::microseconds(500));
+
+            ASSERT_TRUE(flipper.wait(make_policy(mode, spin_count, 0u)))
+                                        << "mode: " << static_cast<uint32_t>(mode) << ", spin count: " << spin_count;
+            ASSERT_EQ(completed_status, flipper.status());
+        }
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(wait_policy, completion_before_timeout) {
+    constexpr uint64_t timeout_ns = 10ull * 1000u * 1000u * 1000u;
+
+    for (auto mode : {ml::wait_mode_t::spin, ml::wait_mode_t::umwait, ml::wait_mode_t::yield}) {
+        completion_flipper flipper(std::chrono::microseconds(500));
+
+        ASSERT_TRUE(flipper.wait(make_policy(mode, 16u, timeout_ns))) << "mode: " << static_cast<uint32_t>(mode);
+        ASSERT_EQ(completed_status, flipper.status());
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(wait_policy, timeout_is_reported) {
+    constexpr uint64_t timeout_ns = 2u * 1000u * 1000u;
+
+    for (auto mode : {ml::wait_mode_t::spin, ml::wait_mode_t::umwait, ml::wait_mode_t::yield}) {
+        volatile uint8_t status = in_progress_status;
+        const auto       policy = make_policy(mode, 16u, timeout_ns);
+        const auto       start  = std::chrono::steady_clock::now();
+
+        ASSERT_FALSE(ml::awaiter::wait_for(&status, in_progress_status, policy, ml::make_wait_deadline(policy)))
+                                    << "mode: " << static_cast<uint32_t>(mode);
+        ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::nanoseconds(timeout_ns));
+    }
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(wait_policy, global_policy) {
+    const auto initial_policy = ml::get_wait_policy();
+
+    qpl_wait_policy policy{qpl_wait_yield, 32u, 1000u};
+    ASSERT_EQ(QPL_STS_OK, qpl_set_wait_policy(&policy));
+
+    auto current_policy = ml::get_wait_policy();
+    EXPECT_EQ(ml::wait_mode_t::yield, current_policy.mode);
+    EXPECT_EQ(32u, current_policy.spin_count);
+    EXPECT_EQ(1000u, current_policy.timeout_ns);
+
+    policy.mode = qpl_wait_default;
+    ASSERT_EQ(QPL_STS_OK, qpl_set_wait_policy(&policy));
+
+    current_policy = ml::get_wait_policy();
+    EXPECT_EQ(ml::get_default_wait_policy().mode, current_policy.mode);
+    EXPECT_EQ(0u, current_policy.timeout_ns);
+
+    ml::set_wait_policy(initial_policy);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(wait_policy, concurrent_global_policy) {
+    const auto initial_policy = ml::get_wait_policy();
+
+    // Fields of every policy are derived from its mode, so a mixed policy is detected by the reader
+    const auto make_policy = [](ml::wait_mode_t mode) -> ml::wait_policy_t {
+        ml::wait_policy_t policy;
+
+        policy.mode       = mode;
+        policy.spin_count = static_cast<uint32_t>(mode) + 1u;
+        policy.timeout_ns = (static_cast<uint64_t>(mode) + 1u) << 40u;
+
+        return policy;
+    };
+
+    ml::set_wait_policy(make_policy(ml::wait_mode_t::spin));
+
+    // The writer changes the policy for the whole time the reader checks it
+    std::atomic<bool> is_done{false};
+    std::thread       writer([&is_done, &make_policy]() -> void {
+        for (uint32_t i = 0u; !is_done.load(std::memory_order_acquire); i++) {
+            ml::set_wait_policy(make_policy((i & 1u) ? ml::wait_mode_t::yield : ml::wait_mode_t::umwait));
+        }
+    });
+
+    while (ml::wait_mode_t::spin == ml::get_wait_policy().mode) {
+        std::this_thread::yield();
+    }
+
+    uint32_t mixed_count = 0u;
+
+    for (uint32_t i = 0u; i < 10000000u; i++) {
+        const auto policy   = ml::get_wait_policy();
+        const auto expected = make_policy(policy.mode);
+
+        if (expected.spin_count != policy.spin_count || expected.timeout_ns != policy.timeout_ns) {
+            mixed_count++;
+        }
+    }
+
+    is_done.store(true, std::memory_order_release);
+    writer.join();
+
+    EXPECT_EQ(0u, mixed_count);
+
+    ml::set_wait_policy(initial_policy);
+}
+
+QPL_UNIT_API_ALGORITHMIC_TEST(wait_policy, job_policy) {
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &job_size));
+
+    std::unique_ptr<uint8_t[]> job_buffer(new uint8_t[job_size]);
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.get());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, job_ptr));
+
+    const qpl_wait_policy policy{qpl_wait_umwait, 16u, 10ull * 1000u * 1000u * 1000u};
+    ASSERT_EQ(QPL_STS_OK, qpl_set_job_wait_policy(job_ptr, &policy));
+
+    std::vector<uint8_t> source(64u * 1024u, 0xA5u);
+
+    job_ptr->op           = qpl_op_crc64;
+    job_ptr->next_in_ptr  = source.data();
+    job_ptr->available_in = static_cast<uint32_t>(source.size());
+    job_ptr->crc64_poly   = 0x9A6C9329AC4BC9B5ull;
+
+    ASSERT_EQ(QPL_STS_OK, qpl_execute_job(job_ptr));
+    const auto expected_crc = job_ptr->crc64;
+
+    job_ptr->next_in_ptr  = source.data();
+    job_ptr->available_in = static_cast<uint32_t>(source.size());
+    job_ptr->crc64        = 0u;
+
+    ASSERT_EQ(QPL_STS_OK, qpl_submit_job(job_ptr));
+    ASSERT_EQ(QPL_STS_OK, qpl_wait_job(job_ptr));
+    EXPECT_EQ(expected_crc, job_ptr->crc64);
+
+    ASSERT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+}
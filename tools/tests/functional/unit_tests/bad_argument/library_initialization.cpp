@@ -0,0 +1,28 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Tests
+ */
+
+#include "qpl/qpl.h"
+#include "../t_common.hpp"
+
+namespace qpl::test {
+
+QPL_UNIT_API_BAD_ARGUMENT_TEST(library_initialization, invalid_options) {
+    qpl_library_options options{-1, nullptr, 1u};
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_init_library(&options));
+
+    options.device_ids_count = 0u;
+    options.numa_id          = -2;
+
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_init_library(&options));
+}
+
+}
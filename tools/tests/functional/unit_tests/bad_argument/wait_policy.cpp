@@ -0,0 +1,28 @@
+/*******************************************************************************
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/*
+ *  Intel® Query Processing Library (Intel® QPL)
+ *  Tests
+ */
+
+#include "qpl/qpl.h"
+#include "../t_common.hpp"
+
+namespace qpl::test {
+
+QPL_UNIT_API_BAD_ARGUMENT_TEST(wait_policy, invalid_policy) {
+    qpl_wait_policy policy{static_cast<qpl_wait_mode>(qpl_wait_yield + 1), 0u, 0u};
+    qpl_job         job{};
+
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_set_wait_policy(nullptr));
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_set_job_wait_policy(nullptr, &policy));
+    EXPECT_EQ(QPL_STS_NULL_PTR_ERR, qpl_set_job_wait_policy(&job, nullptr));
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_set_wait_policy(&policy));
+    EXPECT_EQ(QPL_STS_INVALID_PARAM_ERR, qpl_set_job_wait_policy(&job, &policy));
+}
+
+}
@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <future>
+#include <thread>
 #include <vector>
 #include <string>
 
@@ -12,7 +15,10 @@
 #include "tt_common.hpp"
 #include "qpl/cpp_api/operations/compression/deflate_operation.hpp"
 #include "qpl/cpp_api/operations/compression/inflate_operation.hpp"
+#include "qpl/cpp_api/operations/analytics/scan_operation.hpp"
+#include "qpl/cpp_api/operations/analytics/select_operation.hpp"
 #include "qpl/cpp_api/chaining/operation_chain.hpp"
+#include "qpl/cpp_api/util/task_pool.hpp"
 
 #include "source_provider.hpp"
 #include "util.hpp"
@@ -29,7 +35,7 @@ QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, default_callable) {
     std::vector<std::vector<uint8_t>> source(number_of_copies);
     std::vector<uint32_t>             result_size;
 
-    std::vector<qpl::execution_result<uint32_t, qpl::execution_mode::sync>> result_event;
+    std::vector<qpl::execution_result<uint32_t, qpl::execution_mode::async>> result_event;
 
     for (int i = 0; i < number_of_copies; i++) {
         source[i] = dataset.get_data().begin()->second;
@@ -70,6 +76,86 @@ QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, default_callable) {
     }
 }
 
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, chains_in_flight) {
+    constexpr uint32_t number_of_chains = 48u;
+    constexpr uint32_t boundary         = 48u;
+
+    auto &dataset = util::TestEnvironment::GetInstance().GetAlgorithmicDataset();
+    auto source   = dataset.get_data().begin()->second;
+
+    std::vector<uint8_t> compressed_source(2u * source.size() + 1024u);
+
+    uint32_t compressed_size = 0u;
+
+    auto deflate_operation = qpl::deflate_operation::builder().build();
+    auto deflate_result    = qpl::execute(deflate_operation, source, compressed_source);
+
+    deflate_result.if_present([&compressed_size](uint32_t value) -> void {
+        compressed_size = value;
+    });
+    ASSERT_NE(0u, compressed_size);
+
+    compressed_source.resize(compressed_size);
+
+    auto chain = qpl::inflate_operation() |
+                 qpl::scan_operation::builder(qpl::less, boundary)
+                         .input_vector_width(8u)
+                         .output_vector_width(1u)
+                         .build() |
+                 qpl::select_operation::builder()
+                         .output_vector_width(8u)
+                         .build();
+
+    std::vector<uint8_t> reference_destination(source.size());
+    uint32_t             reference_size = 0u;
+
+    qpl::execute(chain, compressed_source, reference_destination).if_present([&reference_size](uint32_t value) -> void {
+        reference_size = value;
+    });
+    ASSERT_NE(0u, reference_size);
+
+    std::vector<std::vector<uint8_t>> destination(number_of_chains, std::vector<uint8_t>(source.size()));
+
+    std::vector<qpl::execution_result<uint32_t, qpl::execution_mode::async>> result_event;
+    result_event.reserve(number_of_chains);
+
+    auto path = util::TestEnvironment::GetInstance().GetExecutionPath();
+    for (uint32_t i = 0; i < number_of_chains; i++) {
+        if (qpl_path_hardware == path) {
+            result_event.push_back(qpl::submit<qpl::hardware>(chain, compressed_source, destination[i]));
+        } else {
+            result_event.push_back(qpl::submit<qpl::software>(chain, compressed_source, destination[i]));
+        }
+    }
+
+    // Poll the results without blocking, as a caller doing other work would
+    uint32_t ready_count = 0u;
+    while (ready_count != number_of_chains) {
+        ready_count = 0u;
+
+        for (auto &result : result_event) {
+            ready_count += result.is_ready() ? 1u : 0u;
+        }
+
+        std::this_thread::yield();
+    }
+
+    for (uint32_t i = 0; i < number_of_chains; i++) {
+        uint32_t result_size = 0u;
+        result_event[i].handle([&result_size](uint32_t value) -> void {
+                                   result_size = value;
+                               },
+                               [](uint32_t status) -> void {
+                                   throw std::runtime_error("Error: Status code - " + std::to_string(status));
+                               });
+
+        EXPECT_EQ(reference_size, result_size);
+        EXPECT_TRUE(std::equal(reference_destination.begin(),
+                               reference_destination.begin() + reference_size,
+                               destination[i].begin()));
+    }
+}
+
 QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, copy) {
     constexpr uint32_t length       = 8000u;
     uint32_t           num_threads  = 8u;
@@ -120,4 +206,118 @@ QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, copy) {
         EXPECT_TRUE(CompareVectors(sources[i], destinations[i]));
     }
 }
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, software_submit_check_wait) {
+    constexpr uint32_t length     = 256u * 1024u;
+    constexpr uint32_t jobs_count = 16u;
+    const uint32_t     cpu_ids[]  = {0u};
+
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &job_size));
+
+    // Two workers pinned to the same CPU have to share the submitted jobs
+    ASSERT_EQ(QPL_STS_NULL_PTR_ERR, qpl_configure_sw_executor(2u, nullptr, 1u));
+    ASSERT_EQ(QPL_STS_OK, qpl_configure_sw_executor(2u, cpu_ids, 1u));
+
+    std::vector<std::vector<uint8_t>> sources(jobs_count, std::vector<uint8_t>(length));
+    std::vector<std::vector<uint8_t>> destinations(jobs_count, std::vector<uint8_t>(length, 0u));
+    std::vector<std::vector<uint8_t>> job_buffers(jobs_count, std::vector<uint8_t>(job_size));
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        std::fill(sources[i].begin(), sources[i].end(), static_cast<uint8_t>(i + 1u));
+
+        auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffers[i].data());
+        ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, job_ptr));
+
+        // Job that was never submitted is reported as completed
+        EXPECT_EQ(QPL_STS_OK, qpl_check_job(job_ptr));
+
+        job_ptr->op            = qpl_op_memcpy;
+        job_ptr->next_in_ptr   = sources[i].data();
+        job_ptr->available_in  = length;
+        job_ptr->next_out_ptr  = destinations[i].data();
+        job_ptr->available_out = length;
+
+        ASSERT_EQ(QPL_STS_OK, qpl_submit_job(job_ptr));
+    }
+
+    // Even jobs are polled, odd jobs are waited for
+    for (uint32_t i = 0u; i < jobs_count; i += 2u) {
+        auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffers[i].data());
+
+        qpl_status status = QPL_STS_BEING_PROCESSED;
+
+        while (QPL_STS_BEING_PROCESSED == status) {
+            status = qpl_check_job(job_ptr);
+            std::this_thread::yield();
+        }
+
+        EXPECT_EQ(QPL_STS_OK, status);
+    }
+
+    for (uint32_t i = 1u; i < jobs_count; i += 2u) {
+        EXPECT_EQ(QPL_STS_OK, qpl_wait_job(reinterpret_cast<qpl_job *>(job_buffers[i].data())));
+    }
+
+    for (uint32_t i = 0u; i < jobs_count; i++) {
+        auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffers[i].data());
+
+        EXPECT_EQ(length, job_ptr->total_out);
+        EXPECT_TRUE(CompareVectors(sources[i], destinations[i]));
+        EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+    }
+
+    EXPECT_EQ(QPL_STS_OK, qpl_configure_sw_executor(0u, nullptr, 0u));
+}
+
+QPL_LOW_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, software_error_status) {
+    uint32_t job_size = 0u;
+    ASSERT_EQ(QPL_STS_OK, qpl_get_job_size(qpl_path_software, &job_size));
+
+    std::vector<uint8_t> job_buffer(job_size);
+    std::vector<uint8_t> source(1024u, 1u);
+    std::vector<uint8_t> destination(source.size() / 2u);
+
+    auto *job_ptr = reinterpret_cast<qpl_job *>(job_buffer.data());
+    ASSERT_EQ(QPL_STS_OK, qpl_init_job(qpl_path_software, job_ptr));
+
+    job_ptr->op            = qpl_op_memcpy;
+    job_ptr->next_in_ptr   = source.data();
+    job_ptr->available_in  = static_cast<uint32_t>(source.size());
+    job_ptr->next_out_ptr  = destination.data();
+    job_ptr->available_out = static_cast<uint32_t>(destination.size());
+
+    // Processing errors are reported on completion, not on submission
+    ASSERT_EQ(QPL_STS_OK, qpl_submit_job(job_ptr));
+    EXPECT_EQ(QPL_STS_DST_IS_SHORT_ERR, qpl_wait_job(job_ptr));
+    EXPECT_EQ(QPL_STS_OK, qpl_wait_job(job_ptr));
+
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_job(job_ptr));
+}
+
+QPL_HIGH_LEVEL_API_ALGORITHMIC_TEST(asynchronous_execution, configure_from_worker) {
+    std::promise<std::pair<qpl_status, qpl_status>> statuses;
+    auto                                            future = statuses.get_future();
+
+    // Worker would wait for itself to stop
+    qpl::util::submit_task([&statuses]() -> void {
+        statuses.set_value({qpl_configure_sw_executor(1u, nullptr, 0u), qpl_fini_library()});
+    });
+
+    const auto [configure_status, fini_status] = future.get();
+
+    EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, configure_status);
+    EXPECT_EQ(QPL_STS_NOT_SUPPORTED_MODE_ERR, fini_status);
+
+    // Workers are started again by the next task once they are stopped
+    EXPECT_EQ(QPL_STS_OK, qpl_fini_library());
+
+    std::promise<void> completion;
+
+    qpl::util::submit_task([&completion]() -> void {
+        completion.set_value();
+    });
+
+    completion.get_future().wait();
+}
 } // namespace qpl::test
@@ -192,6 +192,24 @@ static inline auto execute(operation_t &operation,
     }
 }
 
+template <class operation_t, class input_container_t, class output_container_t>
+static inline auto execute(operation_t &operation,
+                           execution_context<std::allocator> &context,
+                           input_container_t &source,
+                           output_container_t &destination) -> execution_result<uint32_t, sync> {
+    switch (util::TestEnvironment::GetInstance().GetExecutionPath()) {
+        case qpl_path_software: {
+            return qpl::execute<qpl::software>(operation, context, source, destination);
+        }
+        case qpl_path_hardware: {
+            return qpl::execute<qpl::hardware>(operation, context, source, destination);
+        }
+        default: {
+            return qpl::execute<qpl::auto_detect>(operation, context, source, destination);
+        }
+    }
+}
+
 static inline auto build_deflate_block(deflate_operation &operation,
                                        std::vector<uint8_t> &source,
                                        mini_block_sizes mini_block_size) -> deflate_block<std::allocator> {